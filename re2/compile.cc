@@ -10,6 +10,7 @@
 
 #include <stdint.h>
 #include <string.h>
+#include <algorithm>
 #include <unordered_map>
 #include <utility>
 
@@ -19,6 +20,7 @@
 #include "re2/prog.h"
 #include "re2/re2.h"
 #include "re2/regexp.h"
+#include "re2/unicode_groups.h"
 #include "re2/walker-inl.h"
 
 namespace re2 {
@@ -188,6 +190,9 @@ class Compiler : public Regexp::Walker<Frag> {
   // Returns the alternation of all the added suffixes.
   Frag EndRange();
 
+  // Returns a fragment matching the precompiled UTF-8 automaton a.
+  Frag Automaton(const UTF8Automaton& a);
+
   // Single rune.
   Frag Literal(Rune r, bool foldcase);
 
@@ -600,6 +605,97 @@ Frag Compiler::EndRange() {
   return rune_range_;
 }
 
+// Returns the FNV-1a fingerprint of the ranges in cc.
+// Must agree with Fingerprint() in make_unicode_groups.py.
+static uint32_t UGroupFingerprint(CharClass* cc) {
+  uint32_t h = 2166136261U;
+  for (CharClass::iterator i = cc->begin(); i != cc->end(); ++i) {
+    h = (h ^ static_cast<uint32_t>(i->lo)) * 16777619U;
+    h = (h ^ static_cast<uint32_t>(i->hi)) * 16777619U;
+  }
+  return h;
+}
+
+// Advances *it to the range of cc that could contain lo and
+// returns whether that range contains all of lo-hi.
+static bool ContainsRange(CharClass* cc, CharClass::iterator* it,
+                          Rune lo, Rune hi) {
+  while (*it != cc->end() && (*it)->hi < lo)
+    ++*it;
+  return *it != cc->end() && (*it)->lo <= lo && hi <= (*it)->hi;
+}
+
+// Returns whether cc contains exactly the runes in g.
+static bool IsUGroup(CharClass* cc, const UGroup* g) {
+  int n = 0;
+  CharClass::iterator it = cc->begin();
+  for (int i = 0; i < g->nr16; i++) {
+    if (!ContainsRange(cc, &it, g->r16[i].lo, g->r16[i].hi))
+      return false;
+    n += g->r16[i].hi - g->r16[i].lo + 1;
+  }
+  for (int i = 0; i < g->nr32; i++) {
+    if (!ContainsRange(cc, &it, g->r32[i].lo, g->r32[i].hi))
+      return false;
+    n += g->r32[i].hi - g->r32[i].lo + 1;
+  }
+  return n == cc->size();
+}
+
+static bool FingerprintLess(const UGroupAutomata& a, uint32_t fingerprint) {
+  return a.fingerprint < fingerprint;
+}
+
+// Returns the precompiled automata for cc if it is one of
+// the standard Unicode groups or NULL otherwise.
+static const UGroupAutomata* LookupUGroupAutomata(CharClass* cc) {
+  uint32_t fingerprint = UGroupFingerprint(cc);
+  const UGroupAutomata* end =
+      unicode_group_automata + num_unicode_group_automata;
+  for (const UGroupAutomata* a = std::lower_bound(
+           unicode_group_automata, end, fingerprint, FingerprintLess);
+       a != end && a->fingerprint == fingerprint; ++a) {
+    if (IsUGroup(cc, a->group))
+      return a;
+  }
+  return NULL;
+}
+
+Frag Compiler::Automaton(const UTF8Automaton& a) {
+  // Every transition leads to a higher-numbered state, so emitting the
+  // states in reverse order means that the targets always exist already.
+  PODArray<int> begin(a.nstate);
+  PatchList end = kNullPatchList;
+  for (int s = a.nstate-1; s >= 0; s--) {
+    // Likewise, emit the transitions in reverse order so that the
+    // alternation tries them in order.
+    int id = 0;
+    for (int i = a.state[s+1]-1; i >= a.state[s]; i--) {
+      const UTF8Range& r = a.range[i];
+      int br = AllocInst(1);
+      if (br < 0)
+        return NoMatch();
+      if (r.next == 0) {
+        inst_[br].InitByteRange(r.lo, r.hi, false, 0);
+        end = PatchList::Append(inst_.data(), end, PatchList::Mk(br << 1));
+      } else {
+        inst_[br].InitByteRange(r.lo, r.hi, false, begin[r.next]);
+      }
+      if (id == 0) {
+        id = br;
+        continue;
+      }
+      int alt = AllocInst(1);
+      if (alt < 0)
+        return NoMatch();
+      inst_[alt].InitAlt(br, id);
+      id = alt;
+    }
+    begin[s] = id;
+  }
+  return Frag(begin[0], end);
+}
+
 // Converts rune range lo-hi into a fragment that recognizes
 // the bytes that would make up those runes in the current
 // encoding (Latin 1 or UTF-8).
@@ -901,6 +997,15 @@ Frag Compiler::PostVisit(Regexp* re, Frag, Frag, Frag* child_frags,
         return NoMatch();
       }
 
+      // The standard Unicode groups (e.g. \pL) have precompiled
+      // automata, which are smaller than the machine that the rune
+      // range compiler would build and much cheaper to splice in.
+      if (encoding_ == kEncodingUTF8) {
+        const UGroupAutomata* a = LookupUGroupAutomata(cc);
+        if (a != NULL)
+          return Automaton(reversed_ ? a->reverse : a->forward);
+      }
+
       // ASCII case-folding optimization: if the char class
       // behaves the same on A-Z as it does on a-z,
       // discard any ranges wholly contained in A-Z
@@ -1209,26 +1314,28 @@ Prog* Compiler::CompileSet(Regexp* re, RE2::Anchor anchor, int64_t max_mem) {
   if (c.failed_)
     return NULL;
 
-  c.prog_->set_anchor_start(true);
+  c.prog_->set_anchor_start(anchor != RE2::UNANCHORED);
   c.prog_->set_anchor_end(true);
 
+  // Keep the anchored entry point as start() so that the NFA can
+  // tell where each match started.
+  c.prog_->set_start(all.begin);
   if (anchor == RE2::UNANCHORED) {
     // Prepend .* or else the expression will effectively be anchored.
     // Complemented by the ANCHOR_BOTH case in PostVisit().
     all = c.Cat(c.DotStar(), all);
   }
-  c.prog_->set_start(all.begin);
   c.prog_->set_start_unanchored(all.begin);
 
   Prog* prog = c.Finish(re);
   if (prog == NULL)
     return NULL;
 
-  // Make sure DFA has enough memory to operate,
-  // since we're not going to fall back to the NFA.
+  // Make sure DFA has enough memory to operate. RE2::Set can fall back
+  // to the NFA, but doing that for every search would be much slower.
   bool dfa_failed = false;
   StringPiece sp = "hello, world";
-  prog->SearchDFA(sp, sp, Prog::kAnchored, Prog::kManyMatch,
+  prog->SearchDFA(sp, sp, Prog::kUnanchored, Prog::kManyMatch,
                   NULL, &dfa_failed, NULL);
   if (dfa_failed) {
     delete prog;
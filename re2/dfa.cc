@@ -28,6 +28,7 @@
 #include <algorithm>
 #include <atomic>
 #include <deque>
+#include <iterator>
 #include <mutex>
 #include <new>
 #include <string>
@@ -84,9 +85,16 @@ class DFA {
   //   returning the leftmost end of the match instead of the rightmost one.
   // If the DFA cannot complete the search (for example, if it is out of
   //   memory), it sets *failed and returns false.
+  // If "limit" is not NULL, a kManyMatch search stops as it says.
   bool Search(const StringPiece& text, const StringPiece& context,
               bool anchored, bool want_earliest_match, bool run_forward,
-              bool* failed, const char** ep, SparseSet* matches);
+              bool* failed, const char** ep, SparseSet* matches,
+              const Prog::ManyMatchLimit* limit);
+
+  // Searches chunk for Prog::SearchManyMatchDFAChunk().
+  bool SearchChunk(const StringPiece& chunk, const StringPiece& context,
+                   const Prog::ManyMatchThreads* from, bool* failed,
+                   SparseSet* matches, Prog::ManyMatchThreads* to);
 
   // Builds out all states for the entire DFA.
   // If cb is not empty, it receives one callback per state built.
@@ -243,7 +251,9 @@ class DFA {
         cache_lock(cache_lock),
         failed(false),
         ep(NULL),
-        matches(NULL) {}
+        matches(NULL),
+        limit(NULL),
+        end_threads(NULL) {}
 
     StringPiece text;
     StringPiece context;
@@ -256,6 +266,8 @@ class DFA {
     bool failed;     // "out" parameter: whether search gave up
     const char* ep;  // "out" parameter: end pointer for match
     SparseSet* matches;
+    const Prog::ManyMatchLimit* limit;
+    Prog::ManyMatchThreads* end_threads;  // "out" parameter: see SearchChunk
 
    private:
     SearchParams(const SearchParams&) = delete;
@@ -277,6 +289,13 @@ class DFA {
   bool AnalyzeSearchHelper(SearchParams* params, StartInfo* info,
                            uint32_t flags);
 
+  // Adds the match IDs in s to params->matches.
+  // Returns whether that reaches params->limit, if any.
+  bool AddMatches(State* s, SearchParams* params);
+
+  // Copies the threads in s to *threads.
+  static void StateToThreads(State* s, Prog::ManyMatchThreads* threads);
+
   // The generic search loop, inlined to create specialized versions.
   // cache_mutex_.r <= L < mutex_
   // Might unlock and relock cache_mutex_ via params->cache_lock.
@@ -1342,13 +1361,10 @@ inline bool DFA::InlinedSearchLoop(SearchParams* params) {
     lastmatch = p;
     if (ExtraDebug)
       fprintf(stderr, "match @stx! [%s]\n", DumpState(s).c_str());
-    if (params->matches != NULL && kind_ == Prog::kManyMatch) {
-      for (int i = s->ninst_ - 1; i >= 0; i--) {
-        int id = s->inst_[i];
-        if (id == MatchSep)
-          break;
-        params->matches->insert(id);
-      }
+    if (params->matches != NULL && kind_ == Prog::kManyMatch &&
+        AddMatches(s, params)) {
+      params->ep = reinterpret_cast<const char*>(lastmatch);
+      return true;
     }
     if (want_earliest_match) {
       params->ep = reinterpret_cast<const char*>(lastmatch);
@@ -1406,11 +1422,10 @@ inline bool DFA::InlinedSearchLoop(SearchParams* params) {
         // byte runs at about 0.2 MB/s, while the NFA (nfa.cc) can do the
         // same at about 2 MB/s.  Unless we're processing an average
         // of 10 bytes per state computation, fail so that RE2 can
-        // fall back to the NFA.  However, RE2::Set cannot fall back,
-        // so we just have to keep on keeping on in that case.
+        // fall back to the NFA.  (RE2::Set falls back to a many-match
+        // NFA; see Prog::SearchManyMatchNFA().)
         if (dfa_should_bail_when_slow && resetp != NULL &&
-            static_cast<size_t>(p - resetp) < 10*state_cache_.size() &&
-            kind_ != Prog::kManyMatch) {
+            static_cast<size_t>(p - resetp) < 10*state_cache_.size()) {
           params->failed = true;
           return false;
         }
@@ -1459,13 +1474,10 @@ inline bool DFA::InlinedSearchLoop(SearchParams* params) {
         lastmatch = p + 1;
       if (ExtraDebug)
         fprintf(stderr, "match @%td! [%s]\n", lastmatch - bp, DumpState(s).c_str());
-      if (params->matches != NULL && kind_ == Prog::kManyMatch) {
-        for (int i = s->ninst_ - 1; i >= 0; i--) {
-          int id = s->inst_[i];
-          if (id == MatchSep)
-            break;
-          params->matches->insert(id);
-        }
+      if (params->matches != NULL && kind_ == Prog::kManyMatch &&
+          AddMatches(s, params)) {
+        params->ep = reinterpret_cast<const char*>(lastmatch);
+        return true;
       }
       if (want_earliest_match) {
         params->ep = reinterpret_cast<const char*>(lastmatch);
@@ -1474,6 +1486,10 @@ inline bool DFA::InlinedSearchLoop(SearchParams* params) {
     }
   }
 
+  // Save the threads still running before the last byte finishes them.
+  if (params->end_threads != NULL)
+    StateToThreads(s, params->end_threads);
+
   // Process one more byte to see if it triggers a match.
   // (Remember, matches are delayed one byte.)
   if (ExtraDebug)
@@ -1526,20 +1542,43 @@ inline bool DFA::InlinedSearchLoop(SearchParams* params) {
     lastmatch = p;
     if (ExtraDebug)
       fprintf(stderr, "match @etx! [%s]\n", DumpState(s).c_str());
-    if (params->matches != NULL && kind_ == Prog::kManyMatch) {
-      for (int i = s->ninst_ - 1; i >= 0; i--) {
-        int id = s->inst_[i];
-        if (id == MatchSep)
-          break;
-        params->matches->insert(id);
-      }
-    }
+    if (params->matches != NULL && kind_ == Prog::kManyMatch)
+      AddMatches(s, params);
   }
 
   params->ep = reinterpret_cast<const char*>(lastmatch);
   return matched;
 }
 
+bool DFA::AddMatches(State* s, SearchParams* params) {
+  const Prog::ManyMatchLimit* limit = params->limit;
+  bool reached = false;
+  for (int i = s->ninst_ - 1; i >= 0; i--) {
+    int id = s->inst_[i];
+    if (id == MatchSep)
+      break;
+    params->matches->insert(id);
+    if (limit != NULL && id < limit->priority_limit)
+      reached = true;
+  }
+  if (limit != NULL && limit->max_matches > 0 &&
+      params->matches->size() >= limit->max_matches)
+    reached = true;
+  return reached;
+}
+
+void DFA::StateToThreads(State* s, Prog::ManyMatchThreads* threads) {
+  threads->inst.clear();
+  for (int i = 0; i < s->ninst_; i++) {
+    if (s->inst_[i] == MatchSep)
+      break;
+    threads->inst.push_back(s->inst_[i]);
+  }
+  // The match flag describes the matches already reported,
+  // not the threads, so leave it out.
+  threads->flag = s->flag_ & ~kFlagMatch;
+}
+
 // Inline specializations of the general loop.
 bool DFA::SearchFFF(SearchParams* params) {
   return InlinedSearchLoop<false, false, false>(params);
@@ -1728,7 +1767,8 @@ bool DFA::Search(const StringPiece& text,
                  bool run_forward,
                  bool* failed,
                  const char** epp,
-                 SparseSet* matches) {
+                 SparseSet* matches,
+                 const Prog::ManyMatchLimit* limit) {
   *epp = NULL;
   if (!ok()) {
     *failed = true;
@@ -1748,6 +1788,7 @@ bool DFA::Search(const StringPiece& text,
   params.want_earliest_match = want_earliest_match;
   params.run_forward = run_forward;
   params.matches = matches;
+  params.limit = limit;
 
   if (!AnalyzeSearch(&params)) {
     *failed = true;
@@ -1773,6 +1814,88 @@ bool DFA::Search(const StringPiece& text,
   return ret;
 }
 
+bool DFA::SearchChunk(const StringPiece& chunk,
+                      const StringPiece& context,
+                      const Prog::ManyMatchThreads* from,
+                      bool* failed,
+                      SparseSet* matches,
+                      Prog::ManyMatchThreads* to) {
+  if (to != NULL) {
+    to->inst.clear();
+    to->flag = 0;
+  }
+  if (!ok()) {
+    *failed = true;
+    return false;
+  }
+  *failed = false;
+  DCHECK_EQ(kind_, Prog::kManyMatch);
+
+  RWLocker l(&cache_mutex_);
+  SearchParams params(chunk, context, &l);
+  params.run_forward = true;
+  params.matches = matches;
+  params.end_threads = to;
+
+  if (!AnalyzeSearch(&params)) {
+    *failed = true;
+    return false;
+  }
+
+  if (from != NULL) {
+    // Drop the threads that the start state has: the search from scratch
+    // runs those. Both lists are sorted, as kManyMatch states are.
+    std::vector<int> start;
+    if (params.start > SpecialStateMax)
+      for (int i = 0; i < params.start->ninst_; i++) {
+        if (params.start->inst_[i] == MatchSep)
+          break;
+        start.push_back(params.start->inst_[i]);
+      }
+    std::vector<int> inst;
+    std::set_difference(from->inst.begin(), from->inst.end(),
+                        start.begin(), start.end(),
+                        std::back_inserter(inst));
+    if (inst.empty())
+      return false;
+    int ninst = static_cast<int>(inst.size());
+
+    State* s;
+    {
+      MutexLock ml(&mutex_);
+      s = CachedState(inst.data(), ninst, from->flag);
+    }
+    if (s == NULL) {
+      ResetCache(&l);
+      MutexLock ml(&mutex_);
+      s = CachedState(inst.data(), ninst, from->flag);
+      if (s == NULL) {
+        LOG(DFATAL) << "CachedState failed after ResetCache";
+        *failed = true;
+        return false;
+      }
+    }
+    params.start = s;
+  }
+  // Prefix acceleration skips to the next occurrence of the prefix within
+  // the chunk, so it would skip a prefix that the end of the chunk cuts
+  // off, dropping the threads that ought to be carried into the next
+  // chunk. (It only works from the real start state anyway.)
+  params.can_prefix_accel = false;
+
+  if (params.start == DeadState)
+    return false;
+  DCHECK(params.start != FullMatchState);
+  if (ExtraDebug)
+    fprintf(stderr, "start %s\n", DumpState(params.start).c_str());
+  bool ret = FastSearchLoop(&params);
+  if (params.failed) {
+    *failed = true;
+    return false;
+  }
+  return ret;
+}
+
 DFA* Prog::GetDFA(MatchKind kind) {
   // For a forward DFA, half the memory goes to each DFA.
   // However, if it is a "many match" DFA, then there is
@@ -1864,7 +1987,7 @@ bool Prog::SearchDFA(const StringPiece& text, const StringPiece& const_context,
   const char* ep;
   bool matched = dfa->Search(text, context, anchored,
                              want_earliest_match, !reversed_,
-                             failed, &ep, matches);
+                             failed, &ep, matches, NULL);
   if (*failed) {
     hooks::GetDFASearchFailureHook()({
         // Nothing yet...
@@ -1890,6 +2013,68 @@ bool Prog::SearchDFA(const StringPiece& text, const StringPiece& const_context,
   return true;
 }
 
+bool Prog::SearchManyMatchDFA(const StringPiece& text,
+                              const StringPiece& const_context,
+                              Anchor anchor, const ManyMatchLimit* limit,
+                              bool* failed, SparseSet* matches) {
+  if (limit == NULL || matches == NULL)
+    return SearchDFA(text, const_context, anchor, kManyMatch, NULL, failed,
+                     matches);
+  DCHECK(!reversed_);
+  *failed = false;
+
+  StringPiece context = const_context;
+  if (context.data() == NULL)
+    context = text;
+  if (anchor_start() && context.begin() != text.begin())
+    return false;
+  if (anchor_end() && context.end() != text.end())
+    return false;
+
+  bool anchored = anchor == kAnchored || anchor_start();
+  DFA* dfa = GetDFA(kManyMatch);
+  const char* ep;
+  bool matched = dfa->Search(text, context, anchored, false, true,
+                             failed, &ep, matches, limit);
+  if (*failed) {
+    hooks::GetDFASearchFailureHook()({
+        // Nothing yet...
+    });
+    return false;
+  }
+  return matched;
+}
+
+void Prog::ManyMatchThreads::Merge(const ManyMatchThreads& other) {
+  std::vector<int> merged;
+  std::set_union(inst.begin(), inst.end(),
+                 other.inst.begin(), other.inst.end(),
+                 std::back_inserter(merged));
+  inst.swap(merged);
+  // The threads are at the same point, so the empty-width flags that
+  // either list holds are valid for both; a list whose threads need
+  // no flags may have dropped them.
+  flag |= other.flag;
+}
+
+bool Prog::SearchManyMatchDFAChunk(const StringPiece& chunk,
+                                   const StringPiece& context,
+                                   const ManyMatchThreads* from,
+                                   bool* failed, SparseSet* matches,
+                                   ManyMatchThreads* to) {
+  DCHECK(!reversed_);
+  DCHECK(!anchor_start());
+  DFA* dfa = GetDFA(kManyMatch);
+  bool matched = dfa->SearchChunk(chunk, context, from, failed, matches, to);
+  if (*failed) {
+    hooks::GetDFASearchFailureHook()({
+        // Nothing yet...
+    });
+    return false;
+  }
+  return matched;
+}
+
 // Build out all states in DFA.  Returns number of states.
 int DFA::BuildAllStates(const Prog::DFAStateCallback& cb) {
   if (!ok())
@@ -5,23 +5,218 @@
 #include "re2/filtered_re2.h"
 
 #include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <tuple>
 #include <utility>
 
 #include "util/util.h"
 #include "util/logging.h"
+#include "util/parallel.h"
 #include "re2/prefilter.h"
 #include "re2/prefilter_tree.h"
+#include "re2/regexp.h"
+#include "re2/serialize.h"
+#include "re2/set.h"
 
 namespace re2 {
 
+// Finds atoms in texts case-insensitively using RE2::Sets of the atoms
+// as literals, whose many-match DFAs are in effect Aho-Corasick automata.
+// There is a set for each encoding that the regexps use: an atom of a
+// Latin-1 regexp need not be valid UTF-8, and an atom of a UTF-8 regexp
+// must be folded as UTF-8. When the encodings are mixed, each atom goes
+// in every set that can hold it, which might find an atom where the
+// regexps cannot match, but never misses one.
+class FilteredRE2::AtomMatcher {
+ public:
+  AtomMatcher() : updates_(0) {}
+
+  // Builds the sets. Returns false if some atom fits in none of them.
+  // Skips the atoms marked in removed.
+  bool Compile(const std::vector<std::string>& atoms,
+               const std::vector<bool>& removed, bool utf8, bool latin1);
+
+  // Adds atoms[first] onwards to the sets and removes the atoms with
+  // the indices in removed. Returns false if some new atom fits in none
+  // of the sets, or if a set fails to compile, in which case the
+  // matcher must be built again.
+  bool Update(const std::vector<std::string>& atoms, int first,
+              const std::vector<int>& removed);
+
+  // Fills atoms with the indices of the atoms that occur in text.
+  // The empty atoms, which occur in every text, are always reported.
+  void Match(const StringPiece& text, std::vector<int>* atoms) const;
+
+ private:
+  struct Part {
+    std::unique_ptr<RE2::Set> set;
+    std::vector<int> atoms;  // the atom index of each regexp in set
+    std::vector<int> index;  // the index in set of each atom, or -1
+  };
+  std::vector<Part> parts_;
+  std::vector<int> empty_;  // the indices of the empty atoms
+  int updates_;             // the number of calls to Update
+
+  AtomMatcher(const AtomMatcher&) = delete;
+  AtomMatcher& operator=(const AtomMatcher&) = delete;
+};
+
+bool FilteredRE2::AtomMatcher::Compile(const std::vector<std::string>& atoms,
+                                       const std::vector<bool>& removed,
+                                       bool utf8, bool latin1) {
+  int natoms = static_cast<int>(atoms.size());
+  std::vector<bool> added(natoms, false);
+  for (int i = 0; i < natoms; i++) {
+    if (removed[i]) {
+      added[i] = true;
+    } else if (atoms[i].empty()) {
+      empty_.push_back(i);
+      added[i] = true;
+    }
+  }
+  for (RE2::Options::Encoding encoding :
+       {RE2::Options::EncodingUTF8, RE2::Options::EncodingLatin1}) {
+    if (!(encoding == RE2::Options::EncodingUTF8 ? utf8 : latin1))
+      continue;
+    RE2::Options options;
+    options.set_encoding(encoding);
+    options.set_literal(true);
+    options.set_case_sensitive(false);
+    options.set_log_errors(false);
+    Part part;
+    part.set.reset(new RE2::Set(options, RE2::UNANCHORED));
+    part.index.assign(natoms, -1);
+    for (int i = 0; i < natoms; i++) {
+      if (removed[i] || atoms[i].empty())
+        continue;
+      int index = part.set->Add(atoms[i], NULL);
+      if (index < 0)
+        continue;
+      part.atoms.push_back(i);
+      part.index[i] = index;
+      added[i] = true;
+    }
+    if (!part.set->Compile())
+      return false;
+    parts_.push_back(std::move(part));
+  }
+  for (int i = 0; i < natoms; i++) {
+    if (!added[i]) {
+      LOG(ERROR) << "Couldn't add atom to matcher: " << atoms[i];
+      return false;
+    }
+  }
+  return true;
+}
+
+// Each Update compiles the new atoms into programs of their own, which
+// every Match has to run, so every so many Updates merge the programs.
+static const int kMergeInterval = 16;
+
+bool FilteredRE2::AtomMatcher::Update(const std::vector<std::string>& atoms,
+                                      int first,
+                                      const std::vector<int>& removed) {
+  int natoms = static_cast<int>(atoms.size());
+  for (size_t i = 0; i < parts_.size(); i++) {
+    Part* part = &parts_[i];
+    for (size_t j = 0; j < removed.size(); j++) {
+      int& index = part->index[removed[j]];
+      if (index >= 0)
+        part->set->Remove(index);
+      index = -1;
+    }
+    part->index.resize(natoms, -1);
+  }
+  for (size_t j = 0; j < removed.size(); j++) {
+    std::vector<int>::iterator it =
+        std::find(empty_.begin(), empty_.end(), removed[j]);
+    if (it != empty_.end())
+      empty_.erase(it);
+  }
+  for (int i = first; i < natoms; i++) {
+    if (atoms[i].empty()) {
+      empty_.push_back(i);
+      continue;
+    }
+    bool added = false;
+    for (size_t j = 0; j < parts_.size(); j++) {
+      Part* part = &parts_[j];
+      int index = part->set->Add(atoms[i], NULL);
+      if (index < 0)
+        continue;
+      // Set indices are never reused, even for removed regexps.
+      DCHECK_EQ(index, static_cast<int>(part->atoms.size()));
+      part->atoms.push_back(i);
+      part->index[i] = index;
+      added = true;
+    }
+    if (!added)
+      return false;
+  }
+  bool merge = ++updates_ % kMergeInterval == 0;
+  for (size_t i = 0; i < parts_.size(); i++) {
+    RE2::Set* set = parts_[i].set.get();
+    if (!(merge ? set->Merge() : set->Compile()))
+      return false;
+  }
+  return true;
+}
+
+void FilteredRE2::AtomMatcher::Match(const StringPiece& text,
+                                     std::vector<int>* atoms) const {
+  atoms->clear();
+  std::vector<int> v;
+  for (size_t i = 0; i < parts_.size(); i++) {
+    parts_[i].set->Match(text, &v);
+    for (size_t j = 0; j < v.size(); j++)
+      atoms->push_back(parts_[i].atoms[v[j]]);
+  }
+  atoms->insert(atoms->end(), empty_.begin(), empty_.end());
+  if (parts_.size() > 1 || !empty_.empty()) {
+    std::sort(atoms->begin(), atoms->end());
+    atoms->erase(std::unique(atoms->begin(), atoms->end()), atoms->end());
+  }
+}
+
+// The regexps of a cluster are compiled into a set only when AllMatches
+// first needs it, as most clusters never have enough candidates at once.
+struct FilteredRE2::Cluster {
+  std::vector<int> regexps;  // the id of each regexp in set
+  std::once_flag once;
+  std::unique_ptr<RE2::Set> set;
+};
+
+// The number of regexps in a cluster. Sets of this size compile quickly
+// and have DFAs with few states.
+static const int kClusterSize = 32;
+
+// Searching for a cluster's regexps in one pass costs about as much as
+// searching for a few of them one by one, so AllMatches uses the set
+// only for clusters with at least this many candidates.
+static const int kMinCandidates = 4;
+
 FilteredRE2::FilteredRE2()
     : compiled_(false),
+      num_compiled_(0),
+      max_exact_size_(Prefilter::kDefaultMaxExactSize),
       prefilter_tree_(new PrefilterTree()) {
 }
 
 FilteredRE2::FilteredRE2(int min_atom_len)
     : compiled_(false),
+      num_compiled_(0),
+      max_exact_size_(Prefilter::kDefaultMaxExactSize),
+      prefilter_tree_(new PrefilterTree(min_atom_len)) {
+}
+
+FilteredRE2::FilteredRE2(int min_atom_len, int max_exact_size)
+    : compiled_(false),
+      num_compiled_(0),
+      max_exact_size_(max_exact_size),
       prefilter_tree_(new PrefilterTree(min_atom_len)) {
 }
 
@@ -33,10 +228,20 @@ FilteredRE2::~FilteredRE2() {
 FilteredRE2::FilteredRE2(FilteredRE2&& other)
     : re2_vec_(std::move(other.re2_vec_)),
       compiled_(other.compiled_),
-      prefilter_tree_(std::move(other.prefilter_tree_)) {
+      num_compiled_(other.num_compiled_),
+      removed_(std::move(other.removed_)),
+      priorities_(std::move(other.priorities_)),
+      costs_(std::move(other.costs_)),
+      max_exact_size_(other.max_exact_size_),
+      prefilter_tree_(std::move(other.prefilter_tree_)),
+      atoms_(std::move(other.atoms_)),
+      atom_matcher_(std::move(other.atom_matcher_)),
+      clusters_(std::move(other.clusters_)),
+      cluster_of_(std::move(other.cluster_of_)) {
   other.re2_vec_.clear();
   other.re2_vec_.shrink_to_fit();
   other.compiled_ = false;
+  other.num_compiled_ = 0;
   other.prefilter_tree_.reset(new PrefilterTree());
 }
 
@@ -65,7 +270,50 @@ RE2::ErrorCode FilteredRE2::Add(const StringPiece& pattern,
   return code;
 }
 
+RE2::ErrorCode FilteredRE2::AddAll(const std::vector<std::string>& patterns,
+                                   const RE2::Options& options,
+                                   int num_threads, std::vector<int>* ids) {
+  // Construct the RE2 objects concurrently, then assign the ids in order.
+  int npatterns = static_cast<int>(patterns.size());
+  std::vector<RE2*> res(npatterns);
+  ParallelFor(npatterns, num_threads, [&](int i) {
+    res[i] = new RE2(patterns[i], options);
+  });
+
+  RE2::ErrorCode code = RE2::NoError;
+  ids->assign(npatterns, -1);
+  for (int i = 0; i < npatterns; i++) {
+    RE2* re = res[i];
+    if (!re->ok()) {
+      if (options.log_errors()) {
+        LOG(ERROR) << "Couldn't compile regular expression, skipping: "
+                   << patterns[i] << " due to error " << re->error();
+      }
+      if (code == RE2::NoError)
+        code = re->error_code();
+      delete re;
+    } else {
+      (*ids)[i] = static_cast<int>(re2_vec_.size());
+      re2_vec_.push_back(re);
+    }
+  }
+  return code;
+}
+
+void FilteredRE2::SetSample(const std::vector<std::string>& sample,
+                            double max_fraction) {
+  if (compiled_) {
+    LOG(ERROR) << "SetSample called after Compile.";
+    return;
+  }
+  prefilter_tree_->SetSample(sample, max_fraction);
+}
+
 void FilteredRE2::Compile(std::vector<std::string>* atoms) {
+  Compile(atoms, 1);
+}
+
+void FilteredRE2::Compile(std::vector<std::string>* atoms, int num_threads) {
   if (compiled_) {
     LOG(ERROR) << "Compile called already.";
     return;
@@ -76,19 +324,169 @@ void FilteredRE2::Compile(std::vector<std::string>* atoms) {
     return;
   }
 
-  for (size_t i = 0; i < re2_vec_.size(); i++) {
-    Prefilter* prefilter = Prefilter::FromRE2(re2_vec_[i]);
-    prefilter_tree_->Add(prefilter);
-  }
+  AddPrefilters(num_threads);
   atoms->clear();
   prefilter_tree_->Compile(atoms);
+  atoms_ = *atoms;
+  BuildClusters();
   compiled_ = true;
 }
 
+// Estimates the cost of searching for re. The DFA does more work for
+// bigger programs, while a literal string is found by memchr() and
+// the like, without running the DFA much, so it is cheapest of all.
+// (Being one-pass makes no difference, as the OnePass engine is used
+// only for submatches, which the searches here do not ask for.)
+static int SearchCost(const RE2& re) {
+  if (re.options().literal())
+    return 0;
+  Regexp* regexp = re.Regexp();
+  while (regexp != NULL && regexp->op() == kRegexpCapture)
+    regexp = regexp->sub()[0];
+  if (regexp != NULL && (regexp->op() == kRegexpLiteral ||
+                         regexp->op() == kRegexpLiteralString))
+    return 0;
+  return re.ProgramSize();
+}
+
+void FilteredRE2::AddPrefilters(int num_threads) {
+  // Compute the prefilters concurrently, then add them in order.
+  int first = num_compiled_;
+  int n = static_cast<int>(re2_vec_.size()) - first;
+  std::vector<Prefilter*> prefilters(n);
+  ParallelFor(n, num_threads, [&](int i) {
+    prefilters[i] = Prefilter::FromRE2(re2_vec_[first + i], max_exact_size_);
+  });
+  for (int i = 0; i < n; i++)
+    prefilter_tree_->Add(prefilters[i]);
+  num_compiled_ = first + n;
+  for (int i = first; i < num_compiled_; i++)
+    costs_.push_back(SearchCost(*re2_vec_[i]));
+}
+
+void FilteredRE2::Update(std::vector<std::string>* added,
+                         std::vector<int>* removed) {
+  added->clear();
+  removed->clear();
+  if (!compiled_) {
+    LOG(ERROR) << "Update called before Compile.";
+    return;
+  }
+
+  int first = num_compiled_;
+  AddPrefilters(1);
+  for (int i = first; i < num_compiled_; i++)
+    if (i < static_cast<int>(removed_.size()) && removed_[i])
+      prefilter_tree_->Remove(i);
+  prefilter_tree_->Update(added, removed);
+
+  int first_atom = static_cast<int>(atoms_.size());
+  atoms_.insert(atoms_.end(), added->begin(), added->end());
+  for (size_t i = 0; i < removed->size(); i++)
+    atoms_[(*removed)[i]].clear();
+  BuildClusters();
+  if (atom_matcher_ != NULL &&
+      !atom_matcher_->Update(atoms_, first_atom, *removed))
+    BuildAtomMatcher();
+}
+
+bool FilteredRE2::Remove(int id) {
+  if (!compiled_) {
+    LOG(ERROR) << "Remove called before Compile.";
+    return false;
+  }
+  if (id < 0 || id >= NumRegexps())
+    return false;
+  removed_.resize(re2_vec_.size(), false);
+  if (removed_[id])
+    return false;
+  // The regexps added since the last Update reach the tree only then.
+  if (id < num_compiled_ && !prefilter_tree_->Remove(id))
+    return false;
+  removed_[id] = true;
+  return true;
+}
+
+void FilteredRE2::BuildClusters() {
+  // A set has one encoding, so the clusters do too. Otherwise, the
+  // clusters follow the order of the Add calls, which tends to keep
+  // related regexps, which match together, in the same cluster. The
+  // regexps added by Update go in new clusters, as the sets of the
+  // existing ones might have been built already.
+  int last[2] = {-1, -1};  // the last cluster of each encoding
+  size_t first = cluster_of_.size();
+  cluster_of_.resize(re2_vec_.size());
+  for (size_t i = first; i < re2_vec_.size(); i++) {
+    int e = re2_vec_[i]->options().encoding() ==
+            RE2::Options::EncodingLatin1;
+    if (last[e] < 0 ||
+        static_cast<int>(clusters_[last[e]]->regexps.size()) == kClusterSize) {
+      last[e] = static_cast<int>(clusters_.size());
+      clusters_.emplace_back(new Cluster);
+    }
+    cluster_of_[i] = last[e];
+    clusters_[last[e]]->regexps.push_back(static_cast<int>(i));
+  }
+}
+
+const RE2::Set* FilteredRE2::ClusterSet(Cluster* cluster) const {
+  std::call_once(cluster->once, [this, cluster]() {
+    RE2::Options options = re2_vec_[cluster->regexps[0]]->options();
+    options.set_log_errors(false);
+    std::unique_ptr<RE2::Set> set(new RE2::Set(options, RE2::UNANCHORED));
+    for (size_t i = 0; i < cluster->regexps.size(); i++) {
+      const RE2* re = re2_vec_[cluster->regexps[i]];
+      if (set->Add(re->pattern(), re->options(), RE2::UNANCHORED, NULL) !=
+          static_cast<int>(i))
+        return;
+    }
+    if (!set->Compile())
+      return;
+    cluster->set = std::move(set);
+  });
+  return cluster->set.get();
+}
+
+void FilteredRE2::CompileWithAtomMatcher(std::vector<std::string>* atoms,
+                                         int num_threads) {
+  if (compiled_) {
+    LOG(ERROR) << "Compile called already.";
+    return;
+  }
+  Compile(atoms, num_threads);
+  if (!compiled_)
+    return;
+  BuildAtomMatcher();
+}
+
+void FilteredRE2::BuildAtomMatcher() {
+  bool utf8 = false;
+  bool latin1 = false;
+  for (size_t i = 0; i < re2_vec_.size(); i++) {
+    if (re2_vec_[i]->options().encoding() == RE2::Options::EncodingLatin1)
+      latin1 = true;
+    else
+      utf8 = true;
+  }
+  // The removed atoms have been emptied, but an atom can be empty
+  // without being removed, so ask the tree.
+  std::vector<bool> removed(atoms_.size());
+  for (size_t i = 0; i < atoms_.size(); i++)
+    removed[i] = prefilter_tree_->IsRemovedAtom(static_cast<int>(i));
+  atom_matcher_.reset(new AtomMatcher());
+  if (!atom_matcher_->Compile(atoms_, removed, utf8, latin1)) {
+    LOG(ERROR) << "Couldn't build the atom matcher.";
+    atom_matcher_.reset();
+  }
+}
+
 int FilteredRE2::SlowFirstMatch(const StringPiece& text) const {
-  for (size_t i = 0; i < re2_vec_.size(); i++)
+  for (size_t i = 0; i < re2_vec_.size(); i++) {
+    if (i < removed_.size() && removed_[i])
+      continue;
     if (RE2::PartialMatch(text, *re2_vec_[i]))
       return static_cast<int>(i);
+  }
   return -1;
 }
 
@@ -106,25 +504,189 @@ int FilteredRE2::FirstMatch(const StringPiece& text,
   return -1;
 }
 
+int FilteredRE2::FirstMatchGivenPositions(
+    const StringPiece& text,
+    const std::vector<AtomMatch>& matches) const {
+  if (!compiled_) {
+    LOG(DFATAL) << "FirstMatchGivenPositions called before Compile.";
+    return -1;
+  }
+  std::vector<int> regexps;
+  CandidatesGivenMatches(matches, true, &regexps);
+  for (size_t i = 0; i < regexps.size(); i++)
+    if (RE2::PartialMatch(text, *re2_vec_[regexps[i]]))
+      return regexps[i];
+  return -1;
+}
+
 bool FilteredRE2::AllMatches(
     const StringPiece& text,
     const std::vector<int>& atoms,
     std::vector<int>* matching_regexps) const {
-  matching_regexps->clear();
   std::vector<int> regexps;
-  prefilter_tree_->RegexpsGivenStrings(atoms, &regexps);
+  prefilter_tree_->RegexpsGivenStrings(atoms, false, &regexps);
+  return MatchCandidates(text, regexps, matching_regexps);
+}
+
+bool FilteredRE2::AllMatchesGivenPositions(
+    const StringPiece& text,
+    const std::vector<AtomMatch>& matches,
+    std::vector<int>* matching_regexps) const {
+  std::vector<int> regexps;
+  CandidatesGivenMatches(matches, false, &regexps);
+  return MatchCandidates(text, regexps, matching_regexps);
+}
+
+void FilteredRE2::CandidatesGivenMatches(
+    const std::vector<AtomMatch>& matches, bool sorted,
+    std::vector<int>* regexps) const {
+  std::vector<PrefilterTree::AtomMatch> v(matches.size());
+  for (size_t i = 0; i < matches.size(); i++) {
+    v[i].atom = matches[i].atom;
+    v[i].begin = matches[i].begin;
+    v[i].end = matches[i].end;
+  }
+  prefilter_tree_->RegexpsGivenMatches(v, sorted, regexps);
+}
+
+bool FilteredRE2::MatchCandidates(
+    const StringPiece& text, const std::vector<int>& regexps,
+    std::vector<int>* matching_regexps) const {
+  matching_regexps->clear();
+  if (static_cast<int>(regexps.size()) < kMinCandidates || !compiled_) {
+    for (size_t i = 0; i < regexps.size(); i++)
+      if (RE2::PartialMatch(text, *re2_vec_[regexps[i]]))
+        matching_regexps->push_back(regexps[i]);
+    std::sort(matching_regexps->begin(), matching_regexps->end());
+    return !matching_regexps->empty();
+  }
+
+  // Group the candidates by cluster.
+  std::vector<std::pair<int, int>> candidates;
+  candidates.reserve(regexps.size());
   for (size_t i = 0; i < regexps.size(); i++)
-    if (RE2::PartialMatch(text, *re2_vec_[regexps[i]]))
-      matching_regexps->push_back(regexps[i]);
+    candidates.emplace_back(cluster_of_[regexps[i]], regexps[i]);
+  std::sort(candidates.begin(), candidates.end());
+
+  std::vector<int> v;
+  for (size_t i = 0; i < candidates.size(); ) {
+    size_t j = i;
+    while (j < candidates.size() && candidates[j].first == candidates[i].first)
+      j++;
+    Cluster* cluster = clusters_[candidates[i].first].get();
+    const RE2::Set* set = NULL;
+    if (static_cast<int>(j - i) >= kMinCandidates)
+      set = ClusterSet(cluster);
+    if (set != NULL) {
+      // Only candidates can match, but check in case the caller
+      // left some atoms out.
+      set->Match(text, &v);
+      std::sort(v.begin(), v.end());
+      for (size_t k = 0; k < v.size(); k++) {
+        int id = cluster->regexps[v[k]];
+        if (std::binary_search(candidates.begin() + i, candidates.begin() + j,
+                               std::make_pair(candidates[i].first, id)))
+          matching_regexps->push_back(id);
+      }
+    } else {
+      for (size_t k = i; k < j; k++)
+        if (RE2::PartialMatch(text, *re2_vec_[candidates[k].second]))
+          matching_regexps->push_back(candidates[k].second);
+    }
+    i = j;
+  }
+  std::sort(matching_regexps->begin(), matching_regexps->end());
   return !matching_regexps->empty();
 }
 
+void FilteredRE2::FindAtoms(const StringPiece& text,
+                            std::vector<int>* atoms) const {
+  if (atom_matcher_ == NULL) {
+    LOG(DFATAL) << "FindAtoms called without an atom matcher.";
+    atoms->clear();
+    return;
+  }
+  atom_matcher_->Match(text, atoms);
+}
+
+bool FilteredRE2::SetPriority(int id, int priority) {
+  if (id < 0 || id >= NumRegexps())
+    return false;
+  if (priorities_.size() < re2_vec_.size())
+    priorities_.resize(re2_vec_.size(), 0);
+  priorities_[id] = priority;
+  return true;
+}
+
+int FilteredRE2::FirstMatchByPriority(const StringPiece& text,
+                                      const std::vector<int>& atoms) const {
+  if (!compiled_) {
+    LOG(DFATAL) << "FirstMatchByPriority called before Compile.";
+    return -1;
+  }
+  std::vector<int> regexps;
+  prefilter_tree_->RegexpsGivenStrings(atoms, false, &regexps);
+  // Search tier by tier, cheapest first within each tier. Sorting by
+  // id as well makes the result depend only on the text.
+  std::vector<std::tuple<int, int, int>> order;
+  order.reserve(regexps.size());
+  for (size_t i = 0; i < regexps.size(); i++) {
+    int id = regexps[i];
+    order.emplace_back(-Priority(id), costs_[id], id);
+  }
+  std::sort(order.begin(), order.end());
+  for (size_t i = 0; i < order.size(); i++) {
+    int id = std::get<2>(order[i]);
+    if (RE2::PartialMatch(text, *re2_vec_[id]))
+      return id;
+  }
+  return -1;
+}
+
+int FilteredRE2::FirstMatchByPriority(const StringPiece& text) const {
+  if (atom_matcher_ == NULL) {
+    LOG(DFATAL) << "FirstMatchByPriority called without an atom matcher.";
+    return -1;
+  }
+  std::vector<int> atoms;
+  atom_matcher_->Match(text, &atoms);
+  return FirstMatchByPriority(text, atoms);
+}
+
+int FilteredRE2::FirstMatch(const StringPiece& text) const {
+  if (atom_matcher_ == NULL) {
+    LOG(DFATAL) << "FirstMatch called without an atom matcher.";
+    return -1;
+  }
+  std::vector<int> atoms;
+  atom_matcher_->Match(text, &atoms);
+  return FirstMatch(text, atoms);
+}
+
+bool FilteredRE2::AllMatches(const StringPiece& text,
+                             std::vector<int>* matching_regexps) const {
+  if (atom_matcher_ == NULL) {
+    LOG(DFATAL) << "AllMatches called without an atom matcher.";
+    matching_regexps->clear();
+    return false;
+  }
+  std::vector<int> atoms;
+  atom_matcher_->Match(text, &atoms);
+  return AllMatches(text, atoms, matching_regexps);
+}
+
 void FilteredRE2::AllPotentials(
     const std::vector<int>& atoms,
     std::vector<int>* potential_regexps) const {
   prefilter_tree_->RegexpsGivenStrings(atoms, potential_regexps);
 }
 
+void FilteredRE2::AllPotentialsGivenPositions(
+    const std::vector<AtomMatch>& matches,
+    std::vector<int>* potential_regexps) const {
+  CandidatesGivenMatches(matches, true, potential_regexps);
+}
+
 void FilteredRE2::RegexpsGivenStrings(const std::vector<int>& matched_atoms,
                                       std::vector<int>* passed_regexps) {
   prefilter_tree_->RegexpsGivenStrings(matched_atoms, passed_regexps);
@@ -134,4 +696,126 @@ void FilteredRE2::PrintPrefilter(int regexpid) {
   prefilter_tree_->PrintPrefilter(regexpid);
 }
 
+/***** Serialization *****/
+
+// Identifies serialized FilteredRE2s: a magic number and a format
+// version, which must be incremented whenever the format changes.
+static const uint32_t kSerializeMagic = 0x46324552;  // "RE2F"
+static const uint32_t kSerializeVersion = 3;
+
+bool FilteredRE2::Serialize(std::string* out) const {
+  out->clear();
+  if (!compiled_ || num_compiled_ != NumRegexps())
+    return false;
+
+  Encoder enc(out);
+  enc.PutU32(kSerializeMagic);
+  enc.PutU32(kSerializeVersion);
+
+  std::string data;
+  enc.PutU32(static_cast<uint32_t>(re2_vec_.size()));
+  for (size_t i = 0; i < re2_vec_.size(); i++) {
+    if (!re2_vec_[i]->Serialize(&data)) {
+      out->clear();
+      return false;
+    }
+    enc.PutString(data);
+  }
+
+  std::vector<int> removed;
+  for (size_t i = 0; i < removed_.size(); i++)
+    if (removed_[i])
+      removed.push_back(static_cast<int>(i));
+  enc.PutU32(static_cast<uint32_t>(removed.size()));
+  for (size_t i = 0; i < removed.size(); i++)
+    enc.PutU32(static_cast<uint32_t>(removed[i]));
+
+  // The costs are written too, as a regexp read back has no parse tree
+  // to tell whether it is a literal string.
+  for (size_t i = 0; i < re2_vec_.size(); i++) {
+    enc.PutU32(static_cast<uint32_t>(Priority(static_cast<int>(i))));
+    enc.PutU32(static_cast<uint32_t>(costs_[i]));
+  }
+
+  enc.PutU32(static_cast<uint32_t>(atoms_.size()));
+  for (size_t i = 0; i < atoms_.size(); i++)
+    enc.PutString(atoms_[i]);
+  enc.PutU8(atom_matcher_ != NULL ? 1 : 0);
+
+  prefilter_tree_->Serialize(&enc);
+  return true;
+}
+
+FilteredRE2* FilteredRE2::Deserialize(
+    const StringPiece& data, std::vector<std::string>* strings_to_match) {
+  Decoder dec(data);
+  uint32_t magic, version;
+  if (!dec.GetU32(&magic) || magic != kSerializeMagic ||
+      !dec.GetU32(&version) || version != kSerializeVersion)
+    return NULL;
+
+  std::unique_ptr<FilteredRE2> f(new FilteredRE2());
+  uint32_t nregexps;
+  if (!dec.GetU32(&nregexps) || nregexps > dec.remaining().size() / 4)
+    return NULL;
+  f->re2_vec_.reserve(nregexps);
+  std::string re2_data;
+  for (uint32_t i = 0; i < nregexps; i++) {
+    if (!dec.GetString(&re2_data))
+      return NULL;
+    RE2* re = RE2::Deserialize(re2_data);
+    if (re == NULL)
+      return NULL;
+    f->re2_vec_.push_back(re);
+  }
+
+  uint32_t nremoved;
+  if (!dec.GetU32(&nremoved) || nremoved > nregexps)
+    return NULL;
+  if (nremoved > 0)
+    f->removed_.resize(nregexps, false);
+  for (uint32_t i = 0; i < nremoved; i++) {
+    uint32_t id;
+    if (!dec.GetU32(&id) || id >= nregexps)
+      return NULL;
+    f->removed_[id] = true;
+  }
+
+  f->costs_.resize(nregexps);
+  for (uint32_t i = 0; i < nregexps; i++) {
+    uint32_t priority, cost;
+    if (!dec.GetU32(&priority) || !dec.GetU32(&cost) ||
+        static_cast<int>(cost) < 0)
+      return NULL;
+    if (priority != 0)
+      f->SetPriority(static_cast<int>(i), static_cast<int>(priority));
+    f->costs_[i] = static_cast<int>(cost);
+  }
+
+  uint32_t natoms;
+  if (!dec.GetU32(&natoms) || natoms > dec.remaining().size() / 4)
+    return NULL;
+  f->atoms_.resize(natoms);
+  for (uint32_t i = 0; i < natoms; i++) {
+    if (!dec.GetString(&f->atoms_[i]))
+      return NULL;
+  }
+  uint8_t has_atom_matcher;
+  if (!dec.GetU8(&has_atom_matcher))
+    return NULL;
+
+  f->prefilter_tree_.reset(PrefilterTree::Deserialize(&dec));
+  if (f->prefilter_tree_ == NULL || !dec.remaining().empty())
+    return NULL;
+
+  f->BuildClusters();
+  f->compiled_ = true;
+  f->num_compiled_ = static_cast<int>(nregexps);
+  if (has_atom_matcher)
+    f->BuildAtomMatcher();
+  if (strings_to_match != NULL)
+    *strings_to_match = f->atoms_;
+  return f.release();
+}
+
 }  // namespace re2
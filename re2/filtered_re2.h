@@ -20,6 +20,10 @@
 // on a lowercased version of the search text. Then call FirstMatch
 // or AllMatches with a vector of indices of strings that were found
 // in the text to get the actual regexp matches.
+//
+// Alternatively, CompileWithAtomMatcher builds a string matching engine
+// for the returned strings, and then FirstMatch and AllMatches can be
+// called with just the text: they find the strings themselves.
 
 #include <memory>
 #include <string>
@@ -35,6 +39,10 @@ class FilteredRE2 {
  public:
   FilteredRE2();
   explicit FilteredRE2(int min_atom_len);
+  // As above, but passes max_exact_size to Prefilter::FromRE2, which
+  // bounds the number of strings that the prefilter of a concatenation
+  // such as [a-f][0-9]{2}foo(bar|baz) may expand to.
+  FilteredRE2(int min_atom_len, int max_exact_size);
   ~FilteredRE2();
 
   // Not copyable.
@@ -46,11 +54,29 @@ class FilteredRE2 {
 
   // Uses RE2 constructor to create a RE2 object (re). Returns
   // re->error_code(). If error_code is other than NoError, then re is
-  // deleted and not added to re2_vec_.
+  // deleted and not added to re2_vec_. If called after Compile, the
+  // regexp is not matched until Update is called.
   RE2::ErrorCode Add(const StringPiece& pattern,
                      const RE2::Options& options,
                      int* id);
 
+  // Adds patterns as if by calling Add() on each of them in turn, but
+  // constructs the RE2 objects on up to num_threads threads, which speeds
+  // up building large FilteredRE2s. The ids are assigned in the same
+  // order as by Add(), regardless of the number of threads. Fills ids
+  // with the id of each pattern, or -1 if it cannot be compiled. Returns
+  // NoError or the error code for the first pattern that cannot be
+  // compiled.
+  RE2::ErrorCode AddAll(const std::vector<std::string>& patterns,
+                        const RE2::Options& options, int num_threads,
+                        std::vector<int>* ids);
+
+  // Gives a sample of the texts to be searched, so that Compile can
+  // drop atoms that occur in more than max_fraction of them, as those
+  // cost more to match than they save by filtering. A regexp with only
+  // such atoms always passes the filter. Call before Compile.
+  void SetSample(const std::vector<std::string>& sample, double max_fraction);
+
   // Prepares the regexps added by Add for filtering.  Returns a set
   // of strings that the caller should check for in candidate texts.
   // The returned strings are lowercased and distinct. When doing
@@ -59,6 +85,43 @@ class FilteredRE2 {
   // all Add calls are done.
   void Compile(std::vector<std::string>* strings_to_match);
 
+  // As above, but computes the prefilters of the regexps
+  // on up to num_threads threads.
+  void Compile(std::vector<std::string>* strings_to_match, int num_threads);
+
+  // As above, but also builds a matcher for the strings to match,
+  // for the overloads of FirstMatch and AllMatches that take just the
+  // text. The matcher is a many-match DFA that finds the strings
+  // case-insensitively, so the text need not be lowercased, in a single
+  // pass over the text. The strings are still returned, for callers
+  // that want to match them against other texts themselves.
+  void CompileWithAtomMatcher(std::vector<std::string>* strings_to_match,
+                              int num_threads);
+
+  // Brings a compiled FilteredRE2 up to date with the calls to Add and
+  // Remove since Compile or the last Update, without recomputing the
+  // prefilters of the other regexps. Appends to added the strings to
+  // match that the new regexps need; they take the indices following
+  // those of the strings returned so far, so no string changes its
+  // index. Fills removed with the indices of the strings that no regexp
+  // needs any more, which the caller should stop matching and which are
+  // not reused. The matcher built by CompileWithAtomMatcher, if any, is
+  // updated too. The removed regexps keep their ids and their memory.
+  // Add, Remove and Update modify the FilteredRE2, so they must not be
+  // called concurrently with matching or with each other.
+  void Update(std::vector<std::string>* added, std::vector<int>* removed);
+
+  // Removes the regexp with the given id, so that it no longer matches.
+  // Its strings to match are reported by the next Update. Returns false
+  // if Compile has not been called, if there is no such regexp or if it
+  // was already removed.
+  bool Remove(int id);
+
+  // Sets the priority of the regexp with the given id, which is 0 by
+  // default, for FirstMatchByPriority. Returns false if there is no
+  // such regexp. Must not be called concurrently with matching.
+  bool SetPriority(int id, int priority);
+
   // Returns the index of the first matching regexp.
   // Returns -1 on no match. Can be called prior to Compile.
   // Does not do any filtering: simply tries to Match the
@@ -71,12 +134,60 @@ class FilteredRE2 {
   int FirstMatch(const StringPiece& text,
                  const std::vector<int>& atoms) const;
 
+  // Returns the index of a matching regexp of the highest priority that
+  // any matching regexp has, or -1 on no match. Unlike FirstMatch, which
+  // searches for the regexps that pass the filter in the order of their
+  // ids, this searches for those of higher priority first and, among
+  // those of the same priority, for those that are cheaper to search
+  // for first (those with smaller programs, and literal strings before
+  // all others), and stops at the first match. So of the matching
+  // regexps of the same priority, it returns the cheapest, not the one
+  // added first. Compile has to be called before calling this.
+  int FirstMatchByPriority(const StringPiece& text,
+                           const std::vector<int>& atoms) const;
+
   // Returns the indices of all matching regexps, after first clearing
-  // matched_regexps.
+  // matched_regexps. When many of the regexps that pass the filter are
+  // close together in the order of Add calls, they are searched for in
+  // a single pass over the text instead of one by one.
   bool AllMatches(const StringPiece& text,
                   const std::vector<int>& atoms,
                   std::vector<int>* matching_regexps) const;
 
+  // Where a string to match occurs in the text: atom is its index, and
+  // the occurrence spans the bytes from begin up to (but not including)
+  // end.
+  struct AtomMatch {
+    int atom;
+    size_t begin;
+    size_t end;
+  };
+
+  // As above, but given where in text the strings occur, which lets the
+  // filter also check that they occur where the regexps need them to:
+  // for example, that "bar" begins after "foo" ends for foo.*bar, or
+  // 1 to 3 bytes after for foo\d{1,3}bar. So fewer regexps have to be
+  // searched. matches must hold every occurrence of each string that
+  // occurs, including overlapping ones, with offsets into text; if the
+  // strings are found in a lowercased copy of text, it must be of the
+  // same length, as it is when text is ASCII.
+  int FirstMatchGivenPositions(const StringPiece& text,
+                               const std::vector<AtomMatch>& matches) const;
+  bool AllMatchesGivenPositions(const StringPiece& text,
+                                const std::vector<AtomMatch>& matches,
+                                std::vector<int>* matching_regexps) const;
+
+  // As above, but finds the atoms in text using the matcher built by
+  // CompileWithAtomMatcher, which has to be called before calling these.
+  int FirstMatch(const StringPiece& text) const;
+  int FirstMatchByPriority(const StringPiece& text) const;
+  bool AllMatches(const StringPiece& text,
+                  std::vector<int>* matching_regexps) const;
+
+  // Fills atoms with the indices of the strings to match that occur in
+  // text, using the matcher built by CompileWithAtomMatcher.
+  void FindAtoms(const StringPiece& text, std::vector<int>* atoms) const;
+
   // Returns the indices of all potentially matching regexps after first
   // clearing potential_regexps.
   // A regexp is potentially matching if it passes the filter.
@@ -85,12 +196,37 @@ class FilteredRE2 {
   void AllPotentials(const std::vector<int>& atoms,
                      std::vector<int>* potential_regexps) const;
 
+  // As above, but given where the strings occur, as for
+  // FirstMatchGivenPositions.
+  void AllPotentialsGivenPositions(const std::vector<AtomMatch>& matches,
+                                   std::vector<int>* potential_regexps) const;
+
   // The number of regexps added.
   int NumRegexps() const { return static_cast<int>(re2_vec_.size()); }
 
   // Get the individual RE2 objects.
   const RE2& GetRE2(int regexpid) const { return *re2_vec_[regexpid]; }
 
+  // Writes the compiled form of this FilteredRE2 (the regexps, in the
+  // form written by RE2::Serialize(), their priorities, the strings to
+  // match and the prefilter tree) to *out. The format is versioned and
+  // independent of the host byte order. Returns false (and leaves *out
+  // empty) if Compile has not been called or regexps have been added
+  // since the last Update. A FilteredRE2 read back cannot be updated.
+  bool Serialize(std::string* out) const;
+
+  // Constructs a compiled FilteredRE2 from the output of Serialize()
+  // without compiling the regexps or computing their prefilters, and
+  // fills strings_to_match (if not NULL) as Compile did. The matcher
+  // built by CompileWithAtomMatcher is built again. data need only
+  // outlive the call, so it can be, say, a file mapped into memory.
+  // The caller takes ownership of the result. Returns NULL if data is
+  // malformed or was written by an incompatible version. Sanity checks
+  // are applied, but data is assumed to have been produced by
+  // Serialize(), not by an adversary.
+  static FilteredRE2* Deserialize(const StringPiece& data,
+                                  std::vector<std::string>* strings_to_match);
+
  private:
   // Print prefilter.
   void PrintPrefilter(int regexpid);
@@ -105,8 +241,65 @@ class FilteredRE2 {
   // Has the FilteredRE2 been compiled using Compile()
   bool compiled_;
 
+  // The number of regexps compiled by Compile and Update.
+  int num_compiled_;
+
+  // Whether each regexp has been removed, if any has.
+  std::vector<bool> removed_;
+
+  // The priority of each regexp, if any has been set.
+  std::vector<int> priorities_;
+
+  // The estimated cost of searching for each compiled regexp.
+  std::vector<int> costs_;
+
+  // Bounds the exact sets of strings formed by Prefilter::FromRE2.
+  int max_exact_size_;
+
   // An AND-OR tree of string atoms used for filtering regexps.
   std::unique_ptr<PrefilterTree> prefilter_tree_;
+
+  // The strings returned by Compile and Update, kept for Serialize,
+  // with the removed ones emptied.
+  std::vector<std::string> atoms_;
+
+  // Finds the atoms in texts, if built by CompileWithAtomMatcher.
+  class AtomMatcher;
+  std::unique_ptr<AtomMatcher> atom_matcher_;
+
+  // Batches of regexps that AllMatches searches for together.
+  struct Cluster;
+  std::vector<std::unique_ptr<Cluster>> clusters_;
+  std::vector<int> cluster_of_;  // the index in clusters_ of each regexp
+
+  // Groups the regexps into clusters. Called by Compile.
+  void BuildClusters();
+
+  // Builds atom_matcher_ for the strings returned by Compile.
+  void BuildAtomMatcher();
+
+  // Computes the prefilters of the regexps from num_compiled_ on and
+  // adds them to prefilter_tree_.
+  void AddPrefilters(int num_threads);
+
+  // Returns the priority of the regexp with the given id.
+  int Priority(int id) const {
+    return id < static_cast<int>(priorities_.size()) ? priorities_[id] : 0;
+  }
+
+  // Fills matching_regexps with the candidates in regexps that match
+  // text, sorted. Implements AllMatches.
+  bool MatchCandidates(const StringPiece& text,
+                       const std::vector<int>& regexps,
+                       std::vector<int>* matching_regexps) const;
+
+  // Fills regexps with the candidates given matches, sorted if sorted.
+  void CandidatesGivenMatches(const std::vector<AtomMatch>& matches,
+                              bool sorted, std::vector<int>* regexps) const;
+
+  // Returns the set of the regexps in cluster, building it the first
+  // time, or NULL if it cannot be built.
+  const RE2::Set* ClusterSet(Cluster* cluster) const;
 };
 
 }  // namespace re2
@@ -9,6 +9,7 @@ from __future__ import absolute_import
 from __future__ import division
 from __future__ import print_function
 
+import bisect
 import sys
 import unicode
 
@@ -30,6 +31,10 @@ _trailer = """
 
 n16 = 0
 n32 = 0
+nautomata = 0
+
+# The largest code point that can be represented in 1, 2, 3, 4 UTF-8 bytes.
+_UTF8_MAX = [0x7F, 0x7FF, 0xFFFF, 0x10FFFF]
 
 def MakeRanges(codes):
   """Turn a list like [1,2,3,7,8,9] into a range list [[1,3], [7,9]]"""
@@ -95,6 +100,156 @@ def PrintGroup(name, codes):
   ugroup += " }"
   return ugroup
 
+def Fingerprint(ranges):
+  """Return the FNV-1a fingerprint of a range list.
+  Must agree with UGroupFingerprint() in compile.cc."""
+  h = 2166136261
+  for lo, hi in ranges:
+    for v in (lo, hi):
+      h = ((h ^ v) * 16777619) & 0xFFFFFFFF
+  return h
+
+def ClipRanges(ranges, lo, hi):
+  """Return the ranges intersected with [lo, hi], shifted down by lo."""
+  out = []
+  i = max(bisect.bisect_left(ranges, (lo, lo)) - 1, 0)
+  while i < len(ranges) and ranges[i][0] <= hi:
+    rlo, rhi = ranges[i]
+    if rhi >= lo:
+      out.append((max(rlo, lo) - lo, min(rhi, hi) - lo))
+    i += 1
+  return tuple(out)
+
+def ForwardAutomaton(ranges):
+  """Build the minimal DFA recognizing the UTF-8 encodings of the ranges.
+  Return a dict mapping state to a list of (lo, hi, next) transitions;
+  state 0 is the start state and None is the (only) accepting state."""
+  ranges = [tuple(r) for r in ranges]
+  states = {}
+  memo = {}
+
+  def Continuation(n, offsets):
+    # Returns the state recognizing the n continuation bytes that
+    # encode the given offsets (each in [0, 64**n)).
+    if n == 0:
+      return None
+    key = (n, offsets)
+    if key not in memo:
+      span = 64 ** (n-1)
+      trans = []
+      for c in range(64):
+        sub = ClipRanges(offsets, c*span, (c+1)*span - 1)
+        if sub:
+          trans.append((0x80 + c, 0x80 + c, Continuation(n-1, sub)))
+      memo[key] = len(memo) + 1
+      states[memo[key]] = trans
+    return memo[key]
+
+  trans = []
+  for b in range(256):
+    if b < 0x80:
+      n, base, lo = 0, b, b
+    elif 0xC0 <= b < 0xE0:
+      n, base, lo = 1, (b & 0x1F) << 6, _UTF8_MAX[0] + 1
+    elif 0xE0 <= b < 0xF0:
+      n, base, lo = 2, (b & 0x0F) << 12, _UTF8_MAX[1] + 1
+    elif 0xF0 <= b < 0xF8:
+      n, base, lo = 3, (b & 0x07) << 18, _UTF8_MAX[2] + 1
+    else:
+      continue
+    # Reject overlong encodings and code points past the maximum.
+    hi = min(base + 64**n - 1, _UTF8_MAX[n])
+    lo = max(base, lo)
+    if lo > hi:
+      continue
+    sub = ClipRanges(ranges, lo, hi)
+    if sub:
+      sub = tuple((l + lo - base, h + lo - base) for l, h in sub)
+      trans.append((b, b, Continuation(n, sub)))
+  states[0] = trans
+  return states
+
+def ReverseAutomaton(automaton):
+  """Reverse an automaton in the form that MinimizeAutomaton returns.
+  Return it in the form that ForwardAutomaton returns, but note that
+  it is nondeterministic: the minimal DFA for the reversed encodings
+  would be several times larger."""
+  # The forward accepting state becomes the start state and
+  # the forward start state becomes the accepting state.
+  out = dict((s, []) for s in range(len(automaton)))
+  for s, trans in enumerate(automaton):
+    for lo, hi, t in trans:
+      out[t].append((lo, hi, None if s == 0 else s))
+  return out
+
+def MinimizeAutomaton(states):
+  """Minimize an acyclic automaton in the form that ForwardAutomaton
+  returns by merging states that have the same transitions, and merge
+  adjacent transitions to the same state.  Return a list of
+  transition lists, numbered in topological order starting from 0,
+  with transitions to the accepting state having next 0."""
+  canon = {None: None}
+  signatures = {}
+  order = []
+
+  def Visit(s):
+    if s in canon:
+      return canon[s]
+    trans = []
+    for lo, hi, t in sorted(states[s], key=lambda t: t[:2]):
+      t = Visit(t)
+      if trans and trans[-1][1] + 1 == lo and trans[-1][2] == t:
+        trans[-1] = (trans[-1][0], hi, t)
+      else:
+        trans.append((lo, hi, t))
+    sig = tuple(trans)
+    if sig not in signatures:
+      signatures[sig] = len(order)
+      order.append(sig)
+    canon[s] = signatures[sig]
+    return canon[s]
+
+  Visit(0)
+  # Every transition leads to a state that was numbered earlier,
+  # so reversing the order yields a topological order with the
+  # start state first.
+  n = len(order)
+  result = []
+  for sig in reversed(order):
+    result.append([(lo, hi, 0 if t is None else n-1 - t) for lo, hi, t in sig])
+  return result
+
+def PrintAutomaton(name, automaton):
+  """Print an automaton as arrays named after name.
+  Return a UTF8Automaton literal for it."""
+  global nautomata
+  nautomata += sum(len(trans) for trans in automaton)
+  # The automata are much larger than the range tables, so pack
+  # several entries onto each line.
+  offsets = [0]
+  for trans in automaton:
+    offsets.append(offsets[-1] + len(trans))
+  print("static const uint16_t %s_state[] = {" % (name,))
+  for i in range(0, len(offsets), 12):
+    print("\t%s" % (" ".join("%d," % (o,) for o in offsets[i:i+12]),))
+  print("};")
+  ranges = [t for trans in automaton for t in trans]
+  print("static const UTF8Range %s_range[] = {" % (name,))
+  for i in range(0, len(ranges), 6):
+    print("\t%s" % (" ".join("{ %d, %d, %d }," % t for t in ranges[i:i+6]),))
+  print("};")
+  return "{ %s_state, %d, %s_range }" % (name, len(automaton), name)
+
+def PrintGroupAutomata(name, codes):
+  """Print the UTF-8 automata for the group of codes.
+  Return the fingerprint of the group and UTF8Automaton literals."""
+  ranges = MakeRanges(codes)
+  forward = MinimizeAutomaton(ForwardAutomaton(ranges))
+  reverse = MinimizeAutomaton(ReverseAutomaton(forward))
+  forward = PrintAutomaton(name+"_forward", forward)
+  reverse = PrintAutomaton(name+"_reverse", reverse)
+  return (Fingerprint(ranges), forward, reverse)
+
 def main():
   categories = unicode.Categories()
   scripts = unicode.Scripts()
@@ -111,6 +266,24 @@ def main():
     print("\t%s," % (ug,))
   print("};")
   print("const int num_unicode_groups = %d;" % (len(ugroups),))
+  print()
+
+  # See unicode_groups.h for a description of the automata.
+  groups = dict(categories)
+  groups.update(scripts)
+  names = sorted(groups)
+  automata = []
+  for index, name in enumerate(names):
+    fingerprint, forward, reverse = PrintGroupAutomata(name, groups[name])
+    automata.append((fingerprint, index, forward, reverse))
+  print("// %d automaton transitions" % (nautomata,))
+  print("const UGroupAutomata unicode_group_automata[] = {")
+  automata.sort()
+  for fingerprint, index, forward, reverse in automata:
+    print("\t{ &unicode_groups[%d], 0x%08X, %s, %s }," %
+          (index, fingerprint, forward, reverse))
+  print("};")
+  print("const int num_unicode_group_automata = %d;" % (len(automata),))
   print(_trailer)
 
 if __name__ == '__main__':
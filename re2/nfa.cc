@@ -651,6 +651,195 @@ Prog::SearchNFA(const StringPiece& text, const StringPiece& context,
   return true;
 }
 
+// A many-match NFA: like the DFA in kManyMatch mode, it finds every match
+// ID that matches anywhere in the text, but it needs memory only in
+// proportion to the size of the program.  Each thread remembers where
+// its match started, so that the matches can be located as well.
+class ManyMatchNFA {
+ public:
+  explicit ManyMatchNFA(Prog* prog);
+
+  // Searches text within context.  Adds the match IDs found to matches
+  // (if not NULL) and locates them in locations (if not NULL).
+  // If neither is given, stops at the first match.  Otherwise, stops
+  // once max_locations IDs have been located (if max_locations > 0)
+  // or once the matches reach limit (if not NULL).
+  bool Search(const StringPiece& text, const StringPiece& context,
+              bool anchored, SparseSet* matches,
+              SparseArray<Prog::Span>* locations, int max_locations,
+              const Prog::ManyMatchLimit* limit);
+
+ private:
+  // Map from instruction to the start of the thread's match.
+  typedef SparseArray<const char*> Threadq;
+
+  // Adds id0 and the instructions reachable from it by empty transitions
+  // to q as a thread whose match started at start, given the empty-width
+  // flags at p.  Records any matches ending at p.
+  // Returns whether any kInstMatch was reached.
+  bool AddToThreadq(Threadq* q, int id0, const char* start, uint32_t flags,
+                    const char* p);
+
+  Prog* prog_;
+  PODArray<int> stack_;
+  SparseSet* matches_;
+  SparseArray<Prog::Span>* locations_;
+  const Prog::ManyMatchLimit* limit_;
+  bool limit_reached_;
+
+  ManyMatchNFA(const ManyMatchNFA&) = delete;
+  ManyMatchNFA& operator=(const ManyMatchNFA&) = delete;
+};
+
+ManyMatchNFA::ManyMatchNFA(Prog* prog)
+    : prog_(prog),
+      stack_(prog->size()),
+      matches_(NULL),
+      locations_(NULL),
+      limit_(NULL),
+      limit_reached_(false) {}
+
+bool ManyMatchNFA::AddToThreadq(Threadq* q, int id0, const char* start,
+                                uint32_t flags, const char* p) {
+  if (id0 == 0 || q->has_index(id0))
+    return false;
+
+  // Each instruction goes on the stack at most once, so the stack
+  // never holds more entries than there are instructions.
+  int* stk = stack_.data();
+  int nstk = 0;
+  q->set_new(id0, start);
+  stk[nstk++] = id0;
+  bool matched = false;
+  while (nstk > 0) {
+    int id = stk[--nstk];
+    Prog::Inst* ip = prog_->inst(id);
+    int next[2] = {0, 0};
+    if (!ip->last())
+      next[0] = id+1;
+    switch (ip->opcode()) {
+      default:
+        LOG(DFATAL) << "unhandled " << ip->opcode()
+                    << " in ManyMatchNFA::AddToThreadq";
+        break;
+
+      case kInstFail:
+      case kInstByteRange:
+      case kInstAltMatch:
+        break;
+
+      case kInstCapture:
+      case kInstNop:
+        next[1] = ip->out();
+        break;
+
+      case kInstEmptyWidth:
+        if ((ip->empty() & ~flags) == 0)
+          next[1] = ip->out();
+        break;
+
+      case kInstMatch:
+        matched = true;
+        if (matches_ != NULL) {
+          matches_->insert(ip->match_id());
+          if (limit_ != NULL &&
+              (ip->match_id() < limit_->priority_limit ||
+               (limit_->max_matches > 0 &&
+                matches_->size() >= limit_->max_matches)))
+            limit_reached_ = true;
+        }
+        // The threads are added in order of where their matches started,
+        // so the first match found for each ID at p starts leftmost.
+        if (locations_ != NULL && !locations_->has_index(ip->match_id()))
+          locations_->set_new(ip->match_id(), {start, p});
+        break;
+    }
+    for (int i = 0; i < 2; i++) {
+      if (next[i] != 0 && !q->has_index(next[i])) {
+        q->set_new(next[i], start);
+        stk[nstk++] = next[i];
+      }
+    }
+  }
+  return matched;
+}
+
+bool ManyMatchNFA::Search(const StringPiece& text,
+                          const StringPiece& context, bool anchored,
+                          SparseSet* matches,
+                          SparseArray<Prog::Span>* locations,
+                          int max_locations,
+                          const Prog::ManyMatchLimit* limit) {
+  if (text.begin() < context.begin() || text.end() > context.end()) {
+    LOG(DFATAL) << "context does not contain text";
+    return false;
+  }
+  if (prog_->anchor_start() && context.begin() != text.begin())
+    return false;
+  anchored |= prog_->anchor_start();
+  matches_ = matches;
+  locations_ = locations;
+  limit_ = limit;
+  limit_reached_ = false;
+  bool stop_early = matches == NULL && locations == NULL;
+
+  // Rather than start once from start_unanchored(), which loops over
+  // the text with .*?, start from start() at every position: that way,
+  // every thread knows where its match started.
+  Threadq q0(prog_->size()), q1(prog_->size());
+  Threadq* runq = &q0;
+  Threadq* nextq = &q1;
+  bool matched = false;
+  const char* p = text.data();
+  const char* ep = text.data() + text.size();
+  for (;;) {
+    uint32_t flags = Prog::EmptyFlags(context, p);
+    if (p > text.data()) {
+      // Advance the threads over the byte before p.
+      int c = p[-1] & 0xFF;
+      nextq->clear();
+      for (Threadq::iterator i = runq->begin(); i != runq->end(); ++i) {
+        Prog::Inst* ip = prog_->inst(i->index());
+        if (ip->opcode() == kInstByteRange && ip->Matches(c) &&
+            AddToThreadq(nextq, ip->out(), i->value(), flags, p))
+          matched = true;
+      }
+      using std::swap;
+      swap(runq, nextq);
+    }
+    if ((!anchored || p == text.data()) &&
+        AddToThreadq(runq, prog_->start(), p, flags, p))
+      matched = true;
+
+    if (matched && (stop_early || limit_reached_))
+      return true;
+    if (locations != NULL && max_locations > 0 &&
+        locations->size() >= max_locations)
+      return matched;
+    if (p == ep || (anchored && runq->size() == 0))
+      return matched;
+    p++;
+  }
+}
+
+bool Prog::SearchManyMatchNFA(const StringPiece& text,
+                              const StringPiece& context,
+                              Anchor anchor, const ManyMatchLimit* limit,
+                              SparseSet* matches) {
+  ManyMatchNFA nfa(this);
+  return nfa.Search(text, context, anchor == kAnchored, matches, NULL, 0,
+                    limit);
+}
+
+bool Prog::LocateManyMatchNFA(const StringPiece& text,
+                              const StringPiece& context, Anchor anchor,
+                              SparseArray<Span>* locations,
+                              int max_locations) {
+  ManyMatchNFA nfa(this);
+  return nfa.Search(text, context, anchor == kAnchored, NULL, locations,
+                    max_locations, NULL);
+}
+
 // For each instruction i in the program reachable from the start, compute the
 // number of instructions reachable from i by following only empty transitions
 // and record that count as fanout[i].
@@ -6,6 +6,7 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -103,11 +104,13 @@ Prefilter* Prefilter::AndOr(Op op, Prefilter* a, Prefilter* b) {
   }
 
   // If a and b match op, merge their contents.
+  // The gaps of the children of an AND hold for the merged AND too.
   if (a->op() == op && b->op() == op) {
     for (size_t i = 0; i < b->subs()->size(); i++) {
       Prefilter* bb = (*b->subs())[i];
       a->subs()->push_back(bb);
     }
+    a->gaps_.insert(a->gaps_.end(), b->gaps_.begin(), b->gaps_.end());
     b->subs()->clear();
     delete b;
     return a;
@@ -230,6 +233,11 @@ class Prefilter::Info {
 
   bool is_exact() const { return is_exact_; }
 
+  // The shortest and longest (-1 if unbounded) lengths in bytes
+  // of the strings that match, as set by the Walker.
+  int min_len() const { return min_len_; }
+  int max_len() const { return max_len_; }
+
   class Walker;
 
  private:
@@ -245,12 +253,17 @@ class Prefilter::Info {
   // Accumulated Prefilter query that any
   // match for this regexp is guaranteed to match.
   Prefilter* match_;
+
+  int min_len_;
+  int max_len_;
 };
 
 
 Prefilter::Info::Info()
   : is_exact_(false),
-    match_(NULL) {
+    match_(NULL),
+    min_len_(0),
+    max_len_(-1) {
 }
 
 Prefilter::Info::~Info() {
@@ -303,6 +316,44 @@ static void CrossProduct(const std::set<std::string>& a,
       dst->insert(*i + *j);
 }
 
+// Fills suffixes with the longest suffixes of the strings in ss, all of
+// the same length except for strings that are shorter (which are kept
+// whole) and, unless latin1, for suffixes that would start in the middle
+// of a UTF-8 sequence (which start at its end instead), such that there
+// are at most max_size of them. Returns false if there are none but the
+// empty string.
+static bool LongestSuffixes(const std::set<std::string>& ss, size_t max_size,
+                            bool latin1, std::set<std::string>* suffixes) {
+  size_t maxlen = 0;
+  for (ConstSSIter i = ss.begin(); i != ss.end(); ++i)
+    maxlen = std::max(maxlen, i->size());
+  for (size_t n = maxlen; n > 0; n--) {
+    suffixes->clear();
+    for (ConstSSIter i = ss.begin(); i != ss.end(); ++i) {
+      size_t start = i->size() > n ? i->size() - n : 0;
+      if (!latin1) {
+        while (start < i->size() && ((*i)[start] & 0xC0) == 0x80)
+          start++;
+      }
+      suffixes->insert(i->substr(start));
+      if (suffixes->size() > max_size)
+        break;
+    }
+    if (suffixes->size() <= max_size)
+      return suffixes->size() > 1 || !suffixes->begin()->empty();
+  }
+  suffixes->clear();
+  return false;
+}
+
+// Returns the length of the shortest string in ss.
+static size_t MinLength(const std::set<std::string>& ss) {
+  size_t n = std::string::npos;
+  for (ConstSSIter i = ss.begin(); i != ss.end(); ++i)
+    n = std::min(n, i->size());
+  return n;
+}
+
 // Concats a and b. Requires that both are exact sets.
 // Forms an exact set that is a crossproduct of a and b.
 Prefilter::Info* Prefilter::Info::Concat(Info* a, Info* b) {
@@ -399,6 +450,29 @@ static std::string RuneToStringLatin1(Rune r) {
   return std::string(&c, 1);
 }
 
+std::string Prefilter::LowercaseUTF8(const std::string& text) {
+  std::string lower;
+  lower.reserve(text.size());
+  const char* p = text.data();
+  const char* ep = p + text.size();
+  while (p < ep) {
+    Rune r;
+    int n;
+    if (fullrune(p, static_cast<int>(std::min<ptrdiff_t>(UTFmax, ep - p)))) {
+      n = chartorune(&r, p);
+    } else {
+      r = Runeerror;
+      n = 1;
+    }
+    if (r == Runeerror && n == 1)
+      lower.push_back(*p);
+    else
+      lower.append(RuneToString(ToLowerRune(r)));
+    p += n;
+  }
+  return lower;
+}
+
 // Constructs Info for literal rune.
 Prefilter::Info* Prefilter::Info::Literal(Rune r) {
   Info* info = new Info();
@@ -482,7 +556,8 @@ Prefilter::Info* Prefilter::Info::CClass(CharClass *cc,
 
 class Prefilter::Info::Walker : public Regexp::Walker<Prefilter::Info*> {
  public:
-  Walker(bool latin1) : latin1_(latin1) {}
+  Walker(bool latin1, int max_exact_size)
+      : latin1_(latin1), max_exact_size_(max_exact_size) {}
 
   virtual Info* PostVisit(
       Regexp* re, Info* parent_arg,
@@ -494,19 +569,38 @@ class Prefilter::Info::Walker : public Regexp::Walker<Prefilter::Info*> {
       Info* parent_arg);
 
   bool latin1() { return latin1_; }
+  size_t max_exact_size() { return max_exact_size_; }
+
+  // Computes the lengths of the strings that re matches from those
+  // of the strings that its children match.
+  void MatchLengths(Regexp* re, Info** child_args, int nchild_args,
+                    int* min_len, int* max_len);
+
+  // Notes the end of an exact run in a concatenation, which matches
+  // run_min to run_max bytes. If the run matches a single string, the
+  // gap from the string of the last such run (the anchor) to it is
+  // added to gaps, and it becomes the anchor, unless it has been cut
+  // down to a suffix, which can serve as an anchor but whose start is
+  // unknown. Otherwise, the gap from the anchor grows by the length of
+  // the run.
+  static void EndRun(Info* exact, bool suffixed, int run_min, int run_max,
+                     std::string* anchor, int* gap_min, int* gap_max,
+                     std::vector<Gap>* gaps);
+
  private:
   bool latin1_;
+  size_t max_exact_size_;
 
   Walker(const Walker&) = delete;
   Walker& operator=(const Walker&) = delete;
 };
 
-Prefilter::Info* Prefilter::BuildInfo(Regexp* re) {
+Prefilter::Info* Prefilter::BuildInfo(Regexp* re, int max_exact_size) {
   if (ExtraDebug)
     LOG(ERROR) << "BuildPrefilter::Info: " << re->ToString();
 
   bool latin1 = (re->parse_flags() & Regexp::Latin1) != 0;
-  Prefilter::Info::Walker w(latin1);
+  Prefilter::Info::Walker w(latin1, std::max(max_exact_size, 1));
   Prefilter::Info* info = w.WalkExponential(re, NULL, 100000);
 
   if (w.stopped_early()) {
@@ -517,6 +611,162 @@ Prefilter::Info* Prefilter::BuildInfo(Regexp* re) {
   return info;
 }
 
+// Lengths beyond this are taken to be unbounded.
+static const int kMaxMatchLength = 1 << 24;
+
+// Returns the sum of match lengths a and b, either of which
+// may be -1 (unbounded).
+static int AddLengths(int a, int b) {
+  if (a < 0 || b < 0 || a + b > kMaxMatchLength)
+    return -1;
+  return a + b;
+}
+
+// Returns the shortest and longest lengths in bytes of the runes
+// that r matches, given whether it matches them case-insensitively.
+static void RuneLengths(Rune r, bool latin1, bool foldcase,
+                        int* min_len, int* max_len) {
+  if (latin1) {
+    *min_len = *max_len = 1;
+    return;
+  }
+  *min_len = *max_len = runelen(r);
+  if (!foldcase)
+    return;
+  // Go around the orbit of r under case folding.
+  Rune r1 = r;
+  for (;;) {
+    const CaseFold* f = LookupCaseFold(unicode_casefold,
+                                       num_unicode_casefold, r1);
+    if (f == NULL || r1 < f->lo)
+      break;
+    r1 = ApplyFold(f, r1);
+    if (r1 == r)
+      break;
+    *min_len = std::min(*min_len, runelen(r1));
+    *max_len = std::max(*max_len, runelen(r1));
+  }
+}
+
+void Prefilter::Info::Walker::MatchLengths(Regexp* re, Info** child_args,
+                                           int nchild_args,
+                                           int* min_len, int* max_len) {
+  bool foldcase = (re->parse_flags() & Regexp::FoldCase) != 0;
+  switch (re->op()) {
+    default:
+      *min_len = 0;
+      *max_len = -1;
+      break;
+
+    case kRegexpNoMatch:
+    case kRegexpEmptyMatch:
+    case kRegexpBeginLine:
+    case kRegexpEndLine:
+    case kRegexpBeginText:
+    case kRegexpEndText:
+    case kRegexpWordBoundary:
+    case kRegexpNoWordBoundary:
+      *min_len = *max_len = 0;
+      break;
+
+    case kRegexpLiteral:
+      RuneLengths(re->rune(), latin1(), foldcase, min_len, max_len);
+      break;
+
+    case kRegexpLiteralString:
+      *min_len = *max_len = 0;
+      for (int i = 0; i < re->nrunes(); i++) {
+        int lo, hi;
+        RuneLengths(re->runes()[i], latin1(), foldcase, &lo, &hi);
+        *min_len = std::min(*min_len + lo, kMaxMatchLength);
+        *max_len = AddLengths(*max_len, hi);
+      }
+      break;
+
+    case kRegexpConcat:
+      *min_len = *max_len = 0;
+      for (int i = 0; i < nchild_args; i++) {
+        *min_len = std::min(*min_len + child_args[i]->min_len(),
+                            kMaxMatchLength);
+        *max_len = AddLengths(*max_len, child_args[i]->max_len());
+      }
+      break;
+
+    case kRegexpAlternate:
+      *min_len = child_args[0]->min_len();
+      *max_len = child_args[0]->max_len();
+      for (int i = 1; i < nchild_args; i++) {
+        *min_len = std::min(*min_len, child_args[i]->min_len());
+        if (*max_len >= 0 && child_args[i]->max_len() >= 0)
+          *max_len = std::max(*max_len, child_args[i]->max_len());
+        else
+          *max_len = -1;
+      }
+      break;
+
+    case kRegexpStar:
+      *min_len = 0;
+      *max_len = child_args[0]->max_len() == 0 ? 0 : -1;
+      break;
+
+    case kRegexpQuest:
+      *min_len = 0;
+      *max_len = child_args[0]->max_len();
+      break;
+
+    case kRegexpPlus:
+      *min_len = child_args[0]->min_len();
+      *max_len = child_args[0]->max_len() == 0 ? 0 : -1;
+      break;
+
+    case kRegexpCapture:
+      *min_len = child_args[0]->min_len();
+      *max_len = child_args[0]->max_len();
+      break;
+
+    case kRegexpAnyChar:
+      *min_len = 1;
+      *max_len = latin1() ? 1 : UTFmax;
+      break;
+
+    case kRegexpAnyByte:
+      *min_len = *max_len = 1;
+      break;
+
+    case kRegexpCharClass: {
+      CharClass* cc = re->cc();
+      if (cc->empty()) {
+        *min_len = *max_len = 0;
+      } else if (latin1()) {
+        *min_len = *max_len = 1;
+      } else {
+        // The runes are sorted, and longer runes encode to more bytes.
+        *min_len = runelen(cc->begin()->lo);
+        *max_len = runelen((cc->end() - 1)->hi);
+      }
+      break;
+    }
+  }
+}
+
+void Prefilter::Info::Walker::EndRun(Info* exact, bool suffixed,
+                                     int run_min, int run_max,
+                                     std::string* anchor,
+                                     int* gap_min, int* gap_max,
+                                     std::vector<Gap>* gaps) {
+  if (exact != NULL && exact->exact().size() == 1 &&
+      !exact->exact().begin()->empty()) {
+    const std::string& s = *exact->exact().begin();
+    if (!suffixed && !anchor->empty())
+      gaps->push_back(Gap{*anchor, s, *gap_min, *gap_max});
+    *anchor = s;
+    *gap_min = *gap_max = 0;
+    return;
+  }
+  *gap_min = std::min(*gap_min + run_min, kMaxMatchLength);
+  *gap_max = AddLengths(*gap_max, run_max);
+}
+
 Prefilter::Info* Prefilter::Info::Walker::ShortVisit(
     Regexp* re, Prefilter::Info* parent_arg) {
   return AnyMatch();
@@ -528,6 +778,9 @@ Prefilter::Info* Prefilter::Info::Walker::PostVisit(
     Regexp* re, Prefilter::Info* parent_arg,
     Prefilter::Info* pre_arg, Prefilter::Info** child_args,
     int nchild_args) {
+  int min_len, max_len;
+  MatchLengths(re, child_args, nchild_args, &min_len, &max_len);
+
   Prefilter::Info *info;
   switch (re->op()) {
     default:
@@ -581,23 +834,91 @@ Prefilter::Info* Prefilter::Info::Walker::PostVisit(
     case kRegexpConcat: {
       // Accumulate in info.
       // Exact is concat of recent contiguous exact nodes.
+      // Suffixed is whether exact has been cut down to suffixes,
+      // in which case it no longer holds the exact matches of the run.
+      // Run_min and run_max are the match lengths of the run.
       info = NULL;
       Info* exact = NULL;
+      bool suffixed = false;
+      int run_min = 0;
+      int run_max = 0;
+      // Where runs that match a single string occur relative to each
+      // other: anchor is the string of the last such run (if any), which
+      // ends gap_min to gap_max bytes before the current run begins.
+      std::string anchor;
+      int gap_min = 0;
+      int gap_max = 0;
+      std::vector<Gap> gaps;
       for (int i = 0; i < nchild_args; i++) {
         Info* ci = child_args[i];  // child info
-        if (!ci->is_exact() ||
-            (exact && ci->exact().size() * exact->exact().size() > 16)) {
+        int ci_min = ci->min_len();
+        int ci_max = ci->max_len();
+        if (!ci->is_exact()) {
           // Exact run is over.
+          EndRun(exact, suffixed, run_min, run_max,
+                 &anchor, &gap_min, &gap_max, &gaps);
           info = And(info, exact);
           exact = NULL;
+          suffixed = false;
+          run_min = run_max = 0;
           // Add this child's info.
           info = And(info, ci);
+          gap_min = std::min(gap_min + ci_min, kMaxMatchLength);
+          gap_max = AddLengths(gap_max, ci_max);
+          continue;
+        }
+        if (exact &&
+            ci->exact().size() * exact->exact().size() > max_exact_size()) {
+          // The cross product would be too big. Rather than end the run,
+          // which leaves it to match the many short strings of each
+          // part, carry on with the longest suffixes of the run that are
+          // few enough: every match of the run ends with one of them.
+          // Only if there are none does the run end.
+          std::set<std::string> suffixes;
+          if (LongestSuffixes(exact->exact(),
+                              max_exact_size() / ci->exact().size(),
+                              latin1(), &suffixes)) {
+            Info* rest = new Info();
+            rest->exact_.swap(suffixes);
+            rest->is_exact_ = true;
+            rest = Concat(rest, ci);
+            // Keep the run so far as well only if its strings are
+            // longer, and so likely more selective, than those of the
+            // run that carries on.
+            if (MinLength(exact->exact()) > MinLength(rest->exact()))
+              info = And(info, exact);
+            else
+              delete exact;
+            exact = rest;
+            suffixed = true;
+          } else {
+            EndRun(exact, suffixed, run_min, run_max,
+                   &anchor, &gap_min, &gap_max, &gaps);
+            info = And(info, exact);
+            exact = ci;
+            suffixed = false;
+            run_min = run_max = 0;
+          }
         } else {
           // Append to exact run.
           exact = Concat(exact, ci);
         }
+        run_min = std::min(run_min + ci_min, kMaxMatchLength);
+        run_max = AddLengths(run_max, ci_max);
       }
+      EndRun(exact, suffixed, run_min, run_max,
+             &anchor, &gap_min, &gap_max, &gaps);
+      // If the run has been cut down to suffixes, it must not be
+      // taken as the exact matches of the whole concatenation.
+      if (suffixed && info == NULL)
+        info = AnyMatch();
       info = And(info, exact);
+      // The runs that match single strings are ATOM children of
+      // the AND node, which is where their gaps belong.
+      if (!gaps.empty() && info->match_ != NULL &&
+          info->match_->op() == AND)
+        info->match_->gaps_.insert(info->match_->gaps_.end(),
+                                   gaps.begin(), gaps.end());
     }
       break;
 
@@ -635,6 +956,9 @@ Prefilter::Info* Prefilter::Info::Walker::PostVisit(
       break;
   }
 
+  info->min_len_ = min_len;
+  info->max_len_ = max_len;
+
   if (ExtraDebug)
     LOG(ERROR) << "BuildInfo " << re->ToString()
                << ": " << (info ? info->ToString() : "");
@@ -643,7 +967,7 @@ Prefilter::Info* Prefilter::Info::Walker::PostVisit(
 }
 
 
-Prefilter* Prefilter::FromRegexp(Regexp* re) {
+Prefilter* Prefilter::FromRegexp(Regexp* re, int max_exact_size) {
   if (re == NULL)
     return NULL;
 
@@ -651,7 +975,7 @@ Prefilter* Prefilter::FromRegexp(Regexp* re) {
   if (simple == NULL)
     return NULL;
 
-  Prefilter::Info* info = BuildInfo(simple);
+  Prefilter::Info* info = BuildInfo(simple, max_exact_size);
   simple->Decref();
   if (info == NULL)
     return NULL;
@@ -697,6 +1021,10 @@ std::string Prefilter::DebugString() const {
 }
 
 Prefilter* Prefilter::FromRE2(const RE2* re2) {
+  return FromRE2(re2, kDefaultMaxExactSize);
+}
+
+Prefilter* Prefilter::FromRE2(const RE2* re2, int max_exact_size) {
   if (re2 == NULL)
     return NULL;
 
@@ -704,7 +1032,7 @@ Prefilter* Prefilter::FromRE2(const RE2* re2) {
   if (regexp == NULL)
     return NULL;
 
-  return FromRegexp(regexp);
+  return FromRegexp(regexp, max_exact_size);
 }
 
 
@@ -51,11 +51,43 @@ class Prefilter {
   // subs_ will be deleted when Prefilter is deleted.
   void set_subs(std::vector<Prefilter*>* subs) { subs_ = subs; }
 
+  // A constraint that a regexp implies on where two atoms occur in a
+  // match: some occurrence of the atom first ends at least min_gap and
+  // at most max_gap (if not -1) bytes before an occurrence of the atom
+  // second begins. For example, foo\d{1,3}bar implies that "foo" ends
+  // 1 to 3 bytes before "bar" begins.
+  struct Gap {
+    std::string first;
+    std::string second;
+    int min_gap;
+    int max_gap;
+
+    bool operator==(const Gap& g) const {
+      return first == g.first && second == g.second &&
+             min_gap == g.min_gap && max_gap == g.max_gap;
+    }
+  };
+
+  // The gaps between the atoms of ATOM children of an AND node, which
+  // hold in addition to each child matching. Empty for other nodes.
+  std::vector<Gap>* gaps() { return &gaps_; }
+
   // Given a RE2, return a Prefilter. The caller takes ownership of
   // the Prefilter and should deallocate it. Returns NULL if Prefilter
   // cannot be formed.
   static Prefilter* FromRE2(const RE2* re2);
 
+  // As above, but bounds the exact sets of strings formed for
+  // concatenations at max_exact_size strings rather than at
+  // kDefaultMaxExactSize. Larger bounds yield longer atoms, and
+  // so fewer false positives, at the cost of more atoms.
+  static Prefilter* FromRE2(const RE2* re2, int max_exact_size);
+
+  // Returns the UTF-8 text lowercased the way the atoms of prefilters
+  // for UTF-8 regexps are. Bytes that are not valid UTF-8 are kept.
+  static std::string LowercaseUTF8(const std::string& text);
+  static const int kDefaultMaxExactSize = 16;
+
   // Returns a readable debug string of the prefilter.
   std::string DebugString() const;
 
@@ -73,13 +105,13 @@ class Prefilter {
   // Generalized And/Or
   static Prefilter* AndOr(Op op, Prefilter* a, Prefilter* b);
 
-  static Prefilter* FromRegexp(Regexp* a);
+  static Prefilter* FromRegexp(Regexp* a, int max_exact_size);
 
   static Prefilter* FromString(const std::string& str);
 
   static Prefilter* OrStrings(std::set<std::string>* ss);
 
-  static Info* BuildInfo(Regexp* re);
+  static Info* BuildInfo(Regexp* re, int max_exact_size);
 
   Prefilter* Simplify();
 
@@ -92,6 +124,9 @@ class Prefilter {
   // Actual string to match in leaf node.
   std::string atom_;
 
+  // Constraints on where the atoms of the children of an AND node occur.
+  std::vector<Gap> gaps_;
+
   // If different prefilters have the same string atom, or if they are
   // structurally the same (e.g., OR of same atom strings) they are
   // considered the same unique nodes. This is the id for each unique
@@ -10,42 +10,46 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "util/util.h"
 #include "util/logging.h"
+#include "util/mix.h"
 #include "util/strutil.h"
 #include "re2/prefilter.h"
 #include "re2/re2.h"
+#include "re2/serialize.h"
 
 namespace re2 {
 
 static const bool ExtraDebug = false;
 
 PrefilterTree::PrefilterTree()
-    : compiled_(false),
-      min_atom_len_(3) {
+    : num_merged_(0),
+      compiled_(false),
+      min_atom_len_(3),
+      sample_size_(0),
+      max_fraction_(1.0) {
 }
 
 PrefilterTree::PrefilterTree(int min_atom_len)
-    : compiled_(false),
-      min_atom_len_(min_atom_len) {
+    : num_merged_(0),
+      compiled_(false),
+      min_atom_len_(min_atom_len),
+      sample_size_(0),
+      max_fraction_(1.0) {
 }
 
 PrefilterTree::~PrefilterTree() {
   for (size_t i = 0; i < prefilter_vec_.size(); i++)
     delete prefilter_vec_[i];
-
-  for (size_t i = 0; i < entries_.size(); i++)
-    delete entries_[i].parents;
 }
 
 void PrefilterTree::Add(Prefilter* prefilter) {
-  if (compiled_) {
-    LOG(DFATAL) << "Add called after Compile.";
-    return;
-  }
   if (prefilter != NULL && !KeepNode(prefilter)) {
     delete prefilter;
     prefilter = NULL;
@@ -54,6 +58,69 @@ void PrefilterTree::Add(Prefilter* prefilter) {
   prefilter_vec_.push_back(prefilter);
 }
 
+// Packs the n bytes at p (n <= 3), with ASCII lowercased, into a key
+// for sample_ngrams_.
+static uint32_t NgramKey(const char* p, int n) {
+  uint32_t key = static_cast<uint32_t>(n);
+  for (int i = 0; i < n; i++) {
+    uint8_t c = static_cast<uint8_t>(p[i]);
+    if ('A' <= c && c <= 'Z')
+      c += 'a' - 'A';
+    key = key << 8 | c;
+  }
+  return key;
+}
+
+// Adds the keys of the n-grams (n <= 3) of text to seen.
+static void AddNgrams(const std::string& text,
+                      std::unordered_set<uint32_t>* seen) {
+  for (size_t j = 0; j < text.size(); j++)
+    for (int n = 1; n <= 3 && j + n <= text.size(); n++)
+      seen->insert(NgramKey(text.data() + j, n));
+}
+
+void PrefilterTree::SetSample(const std::vector<std::string>& sample,
+                              double max_fraction) {
+  if (!prefilter_vec_.empty()) {
+    LOG(DFATAL) << "SetSample called after Add.";
+    return;
+  }
+  sample_ngrams_.clear();
+  sample_size_ = static_cast<int>(sample.size());
+  max_fraction_ = max_fraction;
+  std::unordered_set<uint32_t> seen;
+  for (size_t i = 0; i < sample.size(); i++) {
+    const std::string& text = sample[i];
+    seen.clear();
+    // The atoms of Latin-1 regexps have just ASCII lowercased, like the
+    // keys, but those of UTF-8 regexps are lowercased as Unicode, so
+    // count the n-grams of the text lowercased that way too.
+    AddNgrams(text, &seen);
+    for (size_t j = 0; j < text.size(); j++) {
+      if (static_cast<uint8_t>(text[j]) >= 0x80) {
+        AddNgrams(Prefilter::LowercaseUTF8(text), &seen);
+        break;
+      }
+    }
+    for (std::unordered_set<uint32_t>::const_iterator it = seen.begin();
+         it != seen.end(); ++it)
+      sample_ngrams_[*it]++;
+  }
+}
+
+bool PrefilterTree::IsCommonAtom(const std::string& atom) const {
+  if (sample_size_ == 0 || atom.empty())
+    return false;
+  int n = std::min(static_cast<int>(atom.size()), 3);
+  int count = sample_size_;
+  for (size_t j = 0; j + n <= atom.size() && count > 0; j++) {
+    std::unordered_map<uint32_t, int>::const_iterator it =
+        sample_ngrams_.find(NgramKey(atom.data() + j, n));
+    count = std::min(count, it == sample_ngrams_.end() ? 0 : it->second);
+  }
+  return count > max_fraction_ * sample_size_;
+}
+
 void PrefilterTree::Compile(std::vector<std::string>* atom_vec) {
   if (compiled_) {
     LOG(DFATAL) << "Compile called already.";
@@ -66,10 +133,11 @@ void PrefilterTree::Compile(std::vector<std::string>* atom_vec) {
     return;
 
   compiled_ = true;
+  num_merged_ = static_cast<int>(prefilter_vec_.size());
 
-  // TODO(junyer): Use std::unordered_set<Prefilter*> instead?
-  NodeMap nodes;
-  AssignUniqueIds(&nodes, atom_vec);
+  NodeSet nodes;
+  std::vector<std::vector<int>> parents;
+  AssignUniqueIds(&nodes, atom_vec, &parents);
 
   // Identify nodes that are too common among prefilters and are
   // triggering too many parents. Then get rid of them if possible.
@@ -78,39 +146,71 @@ void PrefilterTree::Compile(std::vector<std::string>* atom_vec) {
   // not miss out on any regexps triggering by getting rid of a
   // prefilter node.
   for (size_t i = 0; i < entries_.size(); i++) {
-    StdIntMap* parents = entries_[i].parents;
-    if (parents->size() > 8) {
+    std::vector<int>* entry_parents = &parents[i];
+    if (entry_parents->size() > 8) {
       // This one triggers too many things. If all the parents are AND
       // nodes and have other things guarding them, then get rid of
       // this trigger. TODO(vsri): Adjust the threshold appropriately,
       // make it a function of total number of nodes?
       bool have_other_guard = true;
-      for (StdIntMap::iterator it = parents->begin();
-           it != parents->end(); ++it) {
+      for (size_t j = 0; j < entry_parents->size(); j++) {
         have_other_guard = have_other_guard &&
-            (entries_[it->first].propagate_up_at_count > 1);
+            (entries_[(*entry_parents)[j]].propagate_up_at_count > 1);
       }
 
       if (have_other_guard) {
-        for (StdIntMap::iterator it = parents->begin();
-             it != parents->end(); ++it)
-          entries_[it->first].propagate_up_at_count -= 1;
+        for (size_t j = 0; j < entry_parents->size(); j++)
+          entries_[(*entry_parents)[j]].propagate_up_at_count -= 1;
 
-        parents->clear();  // Forget the parents
+        entry_parents->clear();  // Forget the parents
       }
     }
   }
 
+  // Lay the parents out flat, so that propagating a match
+  // reads them from consecutive memory.
+  for (size_t i = 0; i < entries_.size(); i++) {
+    entries_[i].parents_begin = static_cast<int>(parents_.size());
+    parents_.insert(parents_.end(), parents[i].begin(), parents[i].end());
+    entries_[i].parents_end = static_cast<int>(parents_.size());
+  }
+
   if (ExtraDebug)
     PrintDebugInfo(&nodes);
 }
 
-Prefilter* PrefilterTree::CanonicalNode(NodeMap* nodes, Prefilter* node) {
-  std::string node_string = NodeString(node);
-  NodeMap::iterator iter = nodes->find(node_string);
-  if (iter == nodes->end())
-    return NULL;
-  return (*iter).second;
+size_t PrefilterTree::NodeHash::operator()(Prefilter* node) const {
+  HashMix mix(node->op());
+  if (node->op() == Prefilter::ATOM) {
+    mix.Mix(std::hash<std::string>()(node->atom()));
+  } else {
+    const std::vector<Prefilter*>& subs = *node->subs();
+    for (size_t i = 0; i < subs.size(); i++)
+      mix.Mix(static_cast<size_t>(subs[i]->unique_id()));
+    const std::vector<Prefilter::Gap>& gaps = *node->gaps();
+    for (size_t i = 0; i < gaps.size(); i++) {
+      mix.Mix(std::hash<std::string>()(gaps[i].first));
+      mix.Mix(std::hash<std::string>()(gaps[i].second));
+      mix.Mix(static_cast<size_t>(gaps[i].min_gap));
+      mix.Mix(static_cast<size_t>(gaps[i].max_gap));
+    }
+  }
+  return mix.get();
+}
+
+bool PrefilterTree::NodeEqual::operator()(Prefilter* a, Prefilter* b) const {
+  if (a->op() != b->op())
+    return false;
+  if (a->op() == Prefilter::ATOM)
+    return a->atom() == b->atom();
+  const std::vector<Prefilter*>& asubs = *a->subs();
+  const std::vector<Prefilter*>& bsubs = *b->subs();
+  if (asubs.size() != bsubs.size())
+    return false;
+  for (size_t i = 0; i < asubs.size(); i++)
+    if (asubs[i]->unique_id() != bsubs[i]->unique_id())
+      return false;
+  return *a->gaps() == *b->gaps();
 }
 
 std::string PrefilterTree::NodeString(Prefilter* node) const {
@@ -142,7 +242,8 @@ bool PrefilterTree::KeepNode(Prefilter* node) const {
       return false;
 
     case Prefilter::ATOM:
-      return node->atom().size() >= static_cast<size_t>(min_atom_len_);
+      return node->atom().size() >= static_cast<size_t>(min_atom_len_) &&
+             !IsCommonAtom(node->atom());
 
     case Prefilter::AND: {
       int j = 0;
@@ -154,6 +255,28 @@ bool PrefilterTree::KeepNode(Prefilter* node) const {
           delete (*subs)[i];
 
       subs->resize(j);
+
+      // Drop the gaps between atoms that are no longer children, and
+      // put the rest in order, so that equal nodes have equal gaps.
+      std::vector<Prefilter::Gap>* gaps = node->gaps();
+      if (!gaps->empty()) {
+        std::set<std::string> atoms;
+        for (size_t i = 0; i < subs->size(); i++)
+          if ((*subs)[i]->op() == Prefilter::ATOM)
+            atoms.insert((*subs)[i]->atom());
+        int k = 0;
+        for (size_t i = 0; i < gaps->size(); i++)
+          if (atoms.count((*gaps)[i].first) > 0 &&
+              atoms.count((*gaps)[i].second) > 0)
+            (*gaps)[k++] = (*gaps)[i];
+        gaps->resize(k);
+        std::sort(gaps->begin(), gaps->end(),
+                  [](const Prefilter::Gap& a, const Prefilter::Gap& b) {
+                    return std::tie(a.first, a.second, a.min_gap, a.max_gap) <
+                           std::tie(b.first, b.second, b.min_gap, b.max_gap);
+                  });
+        gaps->erase(std::unique(gaps->begin(), gaps->end()), gaps->end());
+      }
       return j > 0;
     }
 
@@ -165,8 +288,9 @@ bool PrefilterTree::KeepNode(Prefilter* node) const {
   }
 }
 
-void PrefilterTree::AssignUniqueIds(NodeMap* nodes,
-                                    std::vector<std::string>* atom_vec) {
+void PrefilterTree::AssignUniqueIds(NodeSet* nodes,
+                                    std::vector<std::string>* atom_vec,
+                                    std::vector<std::vector<int>>* parents) {
   atom_vec->clear();
 
   // Build vector of all filter nodes, sorted topologically
@@ -196,52 +320,39 @@ void PrefilterTree::AssignUniqueIds(NodeMap* nodes,
     }
   }
 
-  // Identify unique nodes.
-  int unique_id = 0;
+  // Identify unique nodes. Working from the bottom up means that the
+  // children of each node have their unique ids by the time the node
+  // is hashed, so nodes can be compared by their children's ids
+  // instead of by their whole subtrees.
+  std::vector<Prefilter*>& canonical = canonical_;
+  nodes->reserve(v.size());
   for (int i = static_cast<int>(v.size()) - 1; i >= 0; i--) {
     Prefilter *node = v[i];
     if (node == NULL)
       continue;
     node->set_unique_id(-1);
-    Prefilter* canonical = CanonicalNode(nodes, node);
-    if (canonical == NULL) {
-      // Any further nodes that have the same node string
-      // will find this node as the canonical node.
-      nodes->emplace(NodeString(node), node);
+    std::pair<NodeSet::iterator, bool> ins = nodes->insert(node);
+    if (ins.second) {
+      // Any further nodes that are the same will find this
+      // node as the canonical node.
+      int unique_id = static_cast<int>(canonical.size());
       if (node->op() == Prefilter::ATOM) {
         atom_vec->push_back(node->atom());
         atom_index_to_id_.push_back(unique_id);
       }
-      node->set_unique_id(unique_id++);
+      node->set_unique_id(unique_id);
+      canonical.push_back(node);
     } else {
-      node->set_unique_id(canonical->unique_id());
+      node->set_unique_id((*ins.first)->unique_id());
     }
   }
-  entries_.resize(nodes->size());
-
-  // Create parent StdIntMap for the entries.
-  for (int i = static_cast<int>(v.size()) - 1; i >= 0; i--) {
-    Prefilter* prefilter = v[i];
-    if (prefilter == NULL)
-      continue;
-
-    if (CanonicalNode(nodes, prefilter) != prefilter)
-      continue;
-
-    Entry* entry = &entries_[prefilter->unique_id()];
-    entry->parents = new StdIntMap();
-  }
+  entries_.resize(canonical.size());
+  parents->resize(canonical.size());
 
   // Fill the entries.
-  for (int i = static_cast<int>(v.size()) - 1; i >= 0; i--) {
-    Prefilter* prefilter = v[i];
-    if (prefilter == NULL)
-      continue;
-
-    if (CanonicalNode(nodes, prefilter) != prefilter)
-      continue;
-
-    Entry* entry = &entries_[prefilter->unique_id()];
+  for (size_t id = 0; id < canonical.size(); id++) {
+    Prefilter* prefilter = canonical[id];
+    Entry* entry = &entries_[id];
 
     switch (prefilter->op()) {
       default:
@@ -255,47 +366,306 @@ void PrefilterTree::AssignUniqueIds(NodeMap* nodes,
 
       case Prefilter::OR:
       case Prefilter::AND: {
-        std::set<int> uniq_child;
+        std::vector<int> uniq_child;
         for (size_t j = 0; j < prefilter->subs()->size(); j++) {
-          Prefilter* child = (*prefilter->subs())[j];
-          Prefilter* canonical = CanonicalNode(nodes, child);
-          if (canonical == NULL) {
-            LOG(DFATAL) << "Null canonical node";
-            return;
-          }
-          int child_id = canonical->unique_id();
-          uniq_child.insert(child_id);
+          int child_id = (*prefilter->subs())[j]->unique_id();
+          uniq_child.push_back(child_id);
           // To the child, we want to add to parent indices.
-          Entry* child_entry = &entries_[child_id];
-          if (child_entry->parents->find(prefilter->unique_id()) ==
-              child_entry->parents->end()) {
-            (*child_entry->parents)[prefilter->unique_id()] = 1;
-          }
+          (*parents)[child_id].push_back(static_cast<int>(id));
         }
+        std::sort(uniq_child.begin(), uniq_child.end());
+        uniq_child.erase(std::unique(uniq_child.begin(), uniq_child.end()),
+                         uniq_child.end());
         entry->propagate_up_at_count = prefilter->op() == Prefilter::AND
                                            ? static_cast<int>(uniq_child.size())
                                            : 1;
+        SetGaps(prefilter, entry);
 
         break;
       }
     }
   }
 
+  // A node can list the same child more than once.
+  for (size_t id = 0; id < parents->size(); id++) {
+    std::vector<int>* p = &(*parents)[id];
+    std::sort(p->begin(), p->end());
+    p->erase(std::unique(p->begin(), p->end()), p->end());
+  }
+
   // For top level nodes, populate regexp id.
   for (size_t i = 0; i < prefilter_vec_.size(); i++) {
     if (prefilter_vec_[i] == NULL)
       continue;
-    int id = CanonicalNode(nodes, prefilter_vec_[i])->unique_id();
+    int id = prefilter_vec_[i]->unique_id();
     DCHECK_LE(0, id);
     Entry* entry = &entries_[id];
     entry->regexps.push_back(static_cast<int>(i));
   }
 }
 
+void PrefilterTree::SetGaps(Prefilter* node, Entry* entry) {
+  entry->gaps.clear();
+  const std::vector<Prefilter::Gap>& gaps = *node->gaps();
+  if (gaps.empty())
+    return;
+  // KeepNode has checked that the atoms are those of children.
+  std::map<std::string, int> ids;
+  for (size_t j = 0; j < node->subs()->size(); j++) {
+    Prefilter* sub = (*node->subs())[j];
+    if (sub->op() == Prefilter::ATOM)
+      ids[sub->atom()] = sub->unique_id();
+  }
+  for (size_t i = 0; i < gaps.size(); i++) {
+    Gap gap;
+    gap.first = ids[gaps[i].first];
+    gap.second = ids[gaps[i].second];
+    gap.min_gap = gaps[i].min_gap;
+    gap.max_gap = gaps[i].max_gap;
+    entry->gaps.push_back(gap);
+  }
+}
+
+// Fills ids with the distinct unique ids of the children of node.
+static void UniqueChildren(Prefilter* node, std::vector<int>* ids) {
+  ids->clear();
+  for (size_t j = 0; j < node->subs()->size(); j++)
+    ids->push_back((*node->subs())[j]->unique_id());
+  std::sort(ids->begin(), ids->end());
+  ids->erase(std::unique(ids->begin(), ids->end()), ids->end());
+}
+
+void PrefilterTree::PrepareUpdates() {
+  if (refs_.size() == entries_.size())
+    return;
+  nodes_.reserve(canonical_.size());
+  refs_.assign(entries_.size(), 0);
+  atom_index_.assign(entries_.size(), -1);
+  for (size_t id = 0; id < canonical_.size(); id++) {
+    Prefilter* node = canonical_[id];
+    nodes_.insert(node);
+    if (node->op() == Prefilter::AND || node->op() == Prefilter::OR) {
+      std::vector<int> uniq_child;
+      UniqueChildren(node, &uniq_child);
+      for (size_t j = 0; j < uniq_child.size(); j++)
+        refs_[uniq_child[j]]++;
+    }
+  }
+  for (size_t id = 0; id < entries_.size(); id++)
+    refs_[id] += static_cast<int>(entries_[id].regexps.size());
+  for (size_t i = 0; i < atom_index_to_id_.size(); i++)
+    if (atom_index_to_id_[i] >= 0)
+      atom_index_[atom_index_to_id_[i]] = static_cast<int>(i);
+}
+
+int PrefilterTree::AddNodes(Prefilter* prefilter,
+                            std::vector<std::vector<int>>* parents,
+                            std::vector<std::string>* added_atoms) {
+  // As in AssignUniqueIds, list the nodes from top to bottom,
+  // then identify them from the bottom up.
+  std::vector<Prefilter*> v;
+  v.push_back(prefilter);
+  for (size_t i = 0; i < v.size(); i++) {
+    Prefilter* f = v[i];
+    if (f->op() == Prefilter::AND || f->op() == Prefilter::OR) {
+      const std::vector<Prefilter*>& subs = *f->subs();
+      for (size_t j = 0; j < subs.size(); j++)
+        v.push_back(subs[j]);
+    }
+  }
+
+  for (int i = static_cast<int>(v.size()) - 1; i >= 0; i--) {
+    Prefilter* node = v[i];
+    node->set_unique_id(-1);
+    std::pair<NodeSet::iterator, bool> ins = nodes_.insert(node);
+    if (!ins.second) {
+      node->set_unique_id((*ins.first)->unique_id());
+      continue;
+    }
+    int id = static_cast<int>(entries_.size());
+    node->set_unique_id(id);
+    canonical_.push_back(node);
+    entries_.emplace_back();
+    parents->emplace_back();
+    refs_.push_back(0);
+    atom_index_.push_back(-1);
+    Entry* entry = &entries_.back();
+    if (node->op() == Prefilter::ATOM) {
+      entry->propagate_up_at_count = 1;
+      atom_index_.back() = static_cast<int>(atom_index_to_id_.size());
+      atom_index_to_id_.push_back(id);
+      added_atoms->push_back(node->atom());
+    } else {
+      std::vector<int> uniq_child;
+      UniqueChildren(node, &uniq_child);
+      for (size_t j = 0; j < uniq_child.size(); j++) {
+        (*parents)[uniq_child[j]].push_back(id);
+        refs_[uniq_child[j]]++;
+      }
+      entry->propagate_up_at_count = node->op() == Prefilter::AND
+                                         ? static_cast<int>(uniq_child.size())
+                                         : 1;
+      SetGaps(node, entry);
+    }
+  }
+  return prefilter->unique_id();
+}
+
+void PrefilterTree::Update(std::vector<std::string>* added_atoms,
+                           std::vector<int>* removed_atoms) {
+  added_atoms->clear();
+  removed_atoms->clear();
+  if (!compiled_) {
+    LOG(DFATAL) << "Update called before Compile.";
+    return;
+  }
+  if (canonical_.size() != entries_.size()) {
+    LOG(DFATAL) << "Update called on a deserialized tree.";
+    return;
+  }
+  PrepareUpdates();
+
+  // Unflatten the parents, dropping those that Remove has dropped,
+  // to add the parents of the new nodes.
+  int nentries = static_cast<int>(entries_.size());
+  std::vector<std::vector<int>> parents(nentries);
+  for (int id = 0; id < nentries; id++) {
+    const Entry& entry = entries_[id];
+    for (int k = entry.parents_begin; k < entry.parents_end; k++)
+      if (refs_[parents_[k]] > 0)
+        parents[id].push_back(parents_[k]);
+  }
+
+  int nregexps = static_cast<int>(prefilter_vec_.size());
+  for (int i = num_merged_; i < nregexps; i++) {
+    Prefilter* f = prefilter_vec_[i];
+    if (i < static_cast<int>(removed_.size()) && removed_[i])
+      continue;
+    if (f == NULL) {
+      unfiltered_.push_back(i);
+      continue;
+    }
+    int id = AddNodes(f, &parents, added_atoms);
+    entries_[id].regexps.push_back(i);
+    refs_[id]++;
+  }
+  num_merged_ = nregexps;
+
+  // The new parents of the existing nodes follow the old ones,
+  // so the parents of each node stay sorted.
+  parents_.clear();
+  for (size_t id = 0; id < entries_.size(); id++) {
+    entries_[id].parents_begin = static_cast<int>(parents_.size());
+    parents_.insert(parents_.end(), parents[id].begin(), parents[id].end());
+    entries_[id].parents_end = static_cast<int>(parents_.size());
+  }
+
+  removed_atoms->swap(removed_atoms_);
+  std::sort(removed_atoms->begin(), removed_atoms->end());
+}
+
+bool PrefilterTree::Remove(int regexp) {
+  int nregexps = static_cast<int>(prefilter_vec_.size());
+  if (regexp < 0 || regexp >= nregexps)
+    return false;
+  removed_.resize(nregexps, false);
+  if (removed_[regexp])
+    return false;
+  if (!compiled_) {
+    LOG(DFATAL) << "Remove called before Compile.";
+    return false;
+  }
+  if (regexp < num_merged_ && canonical_.size() != entries_.size()) {
+    LOG(DFATAL) << "Remove called on a deserialized tree.";
+    return false;
+  }
+  removed_[regexp] = true;
+  // The regexps not merged yet are just skipped by Update.
+  if (regexp >= num_merged_)
+    return true;
+
+  Prefilter* f = prefilter_vec_[regexp];
+  if (f == NULL) {
+    unfiltered_.erase(std::lower_bound(unfiltered_.begin(), unfiltered_.end(),
+                                       regexp));
+    return true;
+  }
+
+  PrepareUpdates();
+  int top = f->unique_id();
+  std::vector<int>* regexps = &entries_[top].regexps;
+  regexps->erase(std::find(regexps->begin(), regexps->end(), regexp));
+
+  // Drop the entries that nothing refers to any more, and in turn
+  // the children that only they referred to.
+  std::vector<int> dead;
+  if (--refs_[top] == 0)
+    dead.push_back(top);
+  while (!dead.empty()) {
+    int id = dead.back();
+    dead.pop_back();
+    Prefilter* node = canonical_[id];
+    nodes_.erase(node);
+    if (node->op() == Prefilter::ATOM) {
+      atom_index_to_id_[atom_index_[id]] = -1;
+      removed_atoms_.push_back(atom_index_[id]);
+      continue;
+    }
+    std::vector<int> uniq_child;
+    UniqueChildren(node, &uniq_child);
+    for (size_t j = 0; j < uniq_child.size(); j++)
+      if (--refs_[uniq_child[j]] == 0)
+        dead.push_back(uniq_child[j]);
+  }
+  return true;
+}
+
 // Functions for triggering during search.
 void PrefilterTree::RegexpsGivenStrings(
     const std::vector<int>& matched_atoms,
     std::vector<int>* regexps) const {
+  RegexpsGivenStrings(matched_atoms, true, regexps);
+}
+
+void PrefilterTree::RegexpsGivenStrings(
+    const std::vector<int>& matched_atoms, bool sorted,
+    std::vector<int>* regexps) const {
+  std::unique_ptr<Scratch> scratch = GetScratch();
+  RegexpsGivenStrings(matched_atoms, sorted, scratch.get(), regexps);
+  PutScratch(std::move(scratch));
+}
+
+void PrefilterTree::RegexpsGivenMatches(const std::vector<AtomMatch>& matches,
+                                        bool sorted,
+                                        std::vector<int>* regexps) const {
+  std::unique_ptr<Scratch> scratch = GetScratch();
+  RegexpsGivenMatches(matches, sorted, scratch.get(), regexps);
+  PutScratch(std::move(scratch));
+}
+
+std::unique_ptr<PrefilterTree::Scratch> PrefilterTree::GetScratch() const {
+  std::unique_ptr<Scratch> scratch;
+  {
+    MutexLock l(&scratch_mutex_);
+    if (!scratch_pool_.empty()) {
+      scratch = std::move(scratch_pool_.back());
+      scratch_pool_.pop_back();
+    }
+  }
+  if (scratch == NULL)
+    scratch.reset(new Scratch());
+  return scratch;
+}
+
+void PrefilterTree::PutScratch(std::unique_ptr<Scratch> scratch) const {
+  MutexLock l(&scratch_mutex_);
+  scratch_pool_.push_back(std::move(scratch));
+}
+
+void PrefilterTree::RegexpsGivenStrings(
+    const std::vector<int>& matched_atoms,
+    bool sorted, Scratch* scratch,
+    std::vector<int>* regexps) const {
   regexps->clear();
   if (!compiled_) {
     // Some legacy users of PrefilterTree call Compile() before
@@ -307,80 +677,300 @@ void PrefilterTree::RegexpsGivenStrings(
     LOG(ERROR) << "RegexpsGivenStrings called before Compile.";
     for (size_t i = 0; i < prefilter_vec_.size(); i++)
       regexps->push_back(static_cast<int>(i));
-  } else {
-    IntMap regexps_map(static_cast<int>(prefilter_vec_.size()));
-    std::vector<int> matched_atom_ids;
-    for (size_t j = 0; j < matched_atoms.size(); j++)
-      matched_atom_ids.push_back(atom_index_to_id_[matched_atoms[j]]);
-    PropagateMatch(matched_atom_ids, &regexps_map);
-    for (IntMap::iterator it = regexps_map.begin();
-         it != regexps_map.end();
-         ++it)
-      regexps->push_back(it->index());
+    return;
+  }
+
+  PropagateMatch(matched_atoms, false, scratch);
+  CollectRegexps(sorted, scratch, regexps);
+}
+
+// Orders atom matches by atom and then by end.
+static bool AtomThenEnd(const PrefilterTree::AtomMatch& a,
+                        const PrefilterTree::AtomMatch& b) {
+  return a.atom < b.atom || (a.atom == b.atom && a.end < b.end);
+}
+
+static bool ByAtom(const PrefilterTree::AtomMatch& a,
+                   const PrefilterTree::AtomMatch& b) {
+  return a.atom < b.atom;
+}
+
+static bool ByEnd(const PrefilterTree::AtomMatch& a,
+                  const PrefilterTree::AtomMatch& b) {
+  return a.end < b.end;
+}
+
+void PrefilterTree::RegexpsGivenMatches(const std::vector<AtomMatch>& matches,
+                                        bool sorted, Scratch* scratch,
+                                        std::vector<int>* regexps) const {
+  std::vector<int>* atoms = &scratch->atoms_;
+  std::vector<AtomMatch>* byid = &scratch->matches_;
+  atoms->clear();
+  byid->clear();
+  for (size_t i = 0; i < matches.size(); i++) {
+    atoms->push_back(matches[i].atom);
+    if (!compiled_)
+      continue;
+    int id = atom_index_to_id_[matches[i].atom];
+    if (id >= 0) {
+      byid->push_back(matches[i]);
+      byid->back().atom = id;
+    }
+  }
+  if (!compiled_) {
+    RegexpsGivenStrings(*atoms, sorted, scratch, regexps);
+    return;
+  }
+  std::sort(atoms->begin(), atoms->end());
+  atoms->erase(std::unique(atoms->begin(), atoms->end()), atoms->end());
+  std::sort(byid->begin(), byid->end(), AtomThenEnd);
 
+  regexps->clear();
+  PropagateMatch(*atoms, true, scratch);
+  CollectRegexps(sorted, scratch, regexps);
+}
+
+void PrefilterTree::CollectRegexps(bool sorted, Scratch* scratch,
+                                   std::vector<int>* regexps) const {
+  regexps->assign(scratch->regexps_.begin(), scratch->regexps_.end());
+  if (sorted) {
+    // The unfiltered regexps are sorted already, so merge them in.
+    std::sort(regexps->begin(), regexps->end());
+    size_t n = regexps->size();
+    regexps->insert(regexps->end(), unfiltered_.begin(), unfiltered_.end());
+    std::inplace_merge(regexps->begin(), regexps->begin() + n,
+                       regexps->end());
+  } else {
     regexps->insert(regexps->end(), unfiltered_.begin(), unfiltered_.end());
   }
-  std::sort(regexps->begin(), regexps->end());
 }
 
-void PrefilterTree::PropagateMatch(const std::vector<int>& atom_ids,
-                                   IntMap* regexps) const {
-  IntMap count(static_cast<int>(entries_.size()));
-  IntMap work(static_cast<int>(entries_.size()));
-  for (size_t i = 0; i < atom_ids.size(); i++)
-    work.set(atom_ids[i], 1);
-  for (IntMap::iterator it = work.begin(); it != work.end(); ++it) {
-    const Entry& entry = entries_[it->index()];
+bool PrefilterTree::GapsHold(const Entry& entry, const Scratch* scratch) {
+  typedef std::vector<AtomMatch>::const_iterator Iter;
+  const std::vector<AtomMatch>& matches = scratch->matches_;
+  for (size_t i = 0; i < entry.gaps.size(); i++) {
+    const Gap& gap = entry.gaps[i];
+    AtomMatch key = {gap.first, 0, 0};
+    std::pair<Iter, Iter> first =
+        std::equal_range(matches.begin(), matches.end(), key, ByAtom);
+    key.atom = gap.second;
+    std::pair<Iter, Iter> second =
+        std::equal_range(matches.begin(), matches.end(), key, ByAtom);
+    // Some occurrence of second must begin between min_gap and max_gap
+    // (if bounded) bytes after an occurrence of first ends. As those are
+    // sorted by end, the earliest that ends late enough is the one to try.
+    bool found = false;
+    for (Iter b = second.first; !found && b != second.second; ++b) {
+      if (b->begin < static_cast<size_t>(gap.min_gap))
+        continue;
+      key.end = 0;
+      if (gap.max_gap >= 0 && b->begin > static_cast<size_t>(gap.max_gap))
+        key.end = b->begin - gap.max_gap;
+      Iter a = std::lower_bound(first.first, first.second, key, ByEnd);
+      found = a != first.second && a->end <= b->begin - gap.min_gap;
+    }
+    if (!found)
+      return false;
+  }
+  return true;
+}
+
+void PrefilterTree::PropagateMatch(const std::vector<int>& matched_atoms,
+                                   bool check_gaps, Scratch* scratch) const {
+  int nentries = static_cast<int>(entries_.size());
+  int nregexps = static_cast<int>(prefilter_vec_.size());
+  IntMap* count = &scratch->count_;
+  SparseSet* work = &scratch->work_;
+  SparseSet* regexps = &scratch->regexps_;
+  if (count->max_size() < nentries) {
+    count->resize(nentries);
+    work->resize(nentries);
+  }
+  if (regexps->max_size() < nregexps)
+    regexps->resize(nregexps);
+  count->clear();
+  work->clear();
+  regexps->clear();
+
+  for (size_t i = 0; i < matched_atoms.size(); i++) {
+    int id = atom_index_to_id_[matched_atoms[i]];
+    if (id >= 0)
+      work->insert(id);
+  }
+  for (SparseSet::iterator it = work->begin(); it != work->end(); ++it) {
+    const Entry& entry = entries_[*it];
     // Record regexps triggered.
     for (size_t i = 0; i < entry.regexps.size(); i++)
-      regexps->set(entry.regexps[i], 1);
+      regexps->insert(entry.regexps[i]);
     int c;
     // Pass trigger up to parents.
-    for (StdIntMap::iterator it = entry.parents->begin();
-         it != entry.parents->end();
-         ++it) {
-      int j = it->first;
+    for (int k = entry.parents_begin; k < entry.parents_end; k++) {
+      int j = parents_[k];
       const Entry& parent = entries_[j];
       // Delay until all the children have succeeded.
       if (parent.propagate_up_at_count > 1) {
-        if (count.has_index(j)) {
-          c = count.get_existing(j) + 1;
-          count.set_existing(j, c);
+        if (count->has_index(j)) {
+          c = count->get_existing(j) + 1;
+          count->set_existing(j, c);
         } else {
           c = 1;
-          count.set_new(j, c);
+          count->set_new(j, c);
         }
         if (c < parent.propagate_up_at_count)
           continue;
       }
+      // The atoms must occur where the regexp needs them to.
+      if (check_gaps && !parent.gaps.empty() && !work->contains(j) &&
+          !GapsHold(parent, scratch))
+        continue;
       // Trigger the parent.
-      work.set(j, 1);
+      work->insert(j);
     }
   }
 }
 
 // Debugging help.
 void PrefilterTree::PrintPrefilter(int regexpid) {
+  if (prefilter_vec_[regexpid] == NULL) {
+    LOG(ERROR) << "No prefilter";
+    return;
+  }
   LOG(ERROR) << DebugNodeString(prefilter_vec_[regexpid]);
 }
 
-void PrefilterTree::PrintDebugInfo(NodeMap* nodes) {
+static void PutInts(const std::vector<int>& v, Encoder* enc) {
+  enc->PutU32(static_cast<uint32_t>(v.size()));
+  for (size_t i = 0; i < v.size(); i++)
+    enc->PutU32(static_cast<uint32_t>(v[i]));
+}
+
+// Reads a vector written by PutInts, checking that each int is in
+// [0, limit) or, if none_ok, is -1.
+static bool GetInts(Decoder* dec, int limit, bool none_ok,
+                    std::vector<int>* v) {
+  uint32_t n;
+  if (!dec->GetU32(&n) || n > dec->remaining().size() / 4)
+    return false;
+  v->resize(n);
+  for (uint32_t i = 0; i < n; i++) {
+    uint32_t x;
+    if (!dec->GetU32(&x) ||
+        (x >= static_cast<uint32_t>(limit) && !(none_ok && x == ~0u)))
+      return false;
+    (*v)[i] = static_cast<int>(x);
+  }
+  return true;
+}
+
+void PrefilterTree::Serialize(Encoder* enc) const {
+  enc->PutU32(static_cast<uint32_t>(min_atom_len_));
+  enc->PutU8(compiled_ ? 1 : 0);
+  enc->PutU32(static_cast<uint32_t>(prefilter_vec_.size()));
+  enc->PutU32(static_cast<uint32_t>(entries_.size()));
+  for (size_t i = 0; i < entries_.size(); i++) {
+    const Entry& entry = entries_[i];
+    enc->PutU32(static_cast<uint32_t>(entry.propagate_up_at_count));
+    enc->PutU32(static_cast<uint32_t>(entry.parents_begin));
+    enc->PutU32(static_cast<uint32_t>(entry.parents_end));
+    PutInts(entry.regexps, enc);
+    enc->PutU32(static_cast<uint32_t>(entry.gaps.size()));
+    for (size_t j = 0; j < entry.gaps.size(); j++) {
+      enc->PutU32(static_cast<uint32_t>(entry.gaps[j].first));
+      enc->PutU32(static_cast<uint32_t>(entry.gaps[j].second));
+      enc->PutU32(static_cast<uint32_t>(entry.gaps[j].min_gap));
+      enc->PutU32(static_cast<uint32_t>(entry.gaps[j].max_gap));
+    }
+  }
+  PutInts(parents_, enc);
+  PutInts(unfiltered_, enc);
+  PutInts(atom_index_to_id_, enc);
+}
+
+PrefilterTree* PrefilterTree::Deserialize(Decoder* dec) {
+  uint32_t min_atom_len, nregexps, nentries;
+  uint8_t compiled;
+  if (!dec->GetU32(&min_atom_len) ||
+      !dec->GetU8(&compiled) ||
+      !dec->GetU32(&nregexps) ||
+      !dec->GetU32(&nentries))
+    return NULL;
+  if (static_cast<int>(min_atom_len) < 0 ||
+      static_cast<int>(nregexps) < 0 ||
+      nentries > dec->remaining().size() / 16)
+    return NULL;
+  std::unique_ptr<PrefilterTree> tree(
+      new PrefilterTree(static_cast<int>(min_atom_len)));
+  tree->compiled_ = compiled != 0;
+  // The prefilters are not needed for matching, only their number.
+  tree->prefilter_vec_.assign(nregexps, NULL);
+  tree->num_merged_ = static_cast<int>(nregexps);
+  tree->entries_.resize(nentries);
+  for (uint32_t i = 0; i < nentries; i++) {
+    Entry* entry = &tree->entries_[i];
+    uint32_t count, begin, end;
+    if (!dec->GetU32(&count) ||
+        !dec->GetU32(&begin) ||
+        !dec->GetU32(&end) ||
+        !GetInts(dec, static_cast<int>(nregexps), false, &entry->regexps))
+      return NULL;
+    if (static_cast<int>(count) < 0 || begin > end ||
+        static_cast<int>(end) < 0)
+      return NULL;
+    entry->propagate_up_at_count = static_cast<int>(count);
+    entry->parents_begin = static_cast<int>(begin);
+    entry->parents_end = static_cast<int>(end);
+    uint32_t ngaps;
+    if (!dec->GetU32(&ngaps) || ngaps > dec->remaining().size() / 16)
+      return NULL;
+    entry->gaps.resize(ngaps);
+    for (uint32_t j = 0; j < ngaps; j++) {
+      Gap* gap = &entry->gaps[j];
+      uint32_t first, second, min_gap, max_gap;
+      if (!dec->GetU32(&first) ||
+          !dec->GetU32(&second) ||
+          !dec->GetU32(&min_gap) ||
+          !dec->GetU32(&max_gap))
+        return NULL;
+      if (first >= nentries || second >= nentries ||
+          static_cast<int>(min_gap) < 0 || static_cast<int>(max_gap) < -1)
+        return NULL;
+      gap->first = static_cast<int>(first);
+      gap->second = static_cast<int>(second);
+      gap->min_gap = static_cast<int>(min_gap);
+      gap->max_gap = static_cast<int>(max_gap);
+    }
+  }
+  if (!GetInts(dec, static_cast<int>(nentries), false, &tree->parents_) ||
+      !GetInts(dec, static_cast<int>(nregexps), false, &tree->unfiltered_) ||
+      !GetInts(dec, static_cast<int>(nentries), true,
+               &tree->atom_index_to_id_))
+    return NULL;
+  for (uint32_t i = 0; i < nentries; i++) {
+    if (tree->entries_[i].parents_end >
+        static_cast<int>(tree->parents_.size()))
+      return NULL;
+  }
+  return tree.release();
+}
+
+void PrefilterTree::PrintDebugInfo(NodeSet* nodes) {
   LOG(ERROR) << "#Unique Atoms: " << atom_index_to_id_.size();
   LOG(ERROR) << "#Unique Nodes: " << entries_.size();
 
   for (size_t i = 0; i < entries_.size(); i++) {
-    StdIntMap* parents = entries_[i].parents;
-    const std::vector<int>& regexps = entries_[i].regexps;
+    const Entry& entry = entries_[i];
+    const std::vector<int>& regexps = entry.regexps;
     LOG(ERROR) << "EntryId: " << i
-               << " N: " << parents->size() << " R: " << regexps.size();
-    for (StdIntMap::iterator it = parents->begin(); it != parents->end(); ++it)
-      LOG(ERROR) << it->first;
+               << " N: " << entry.parents_end - entry.parents_begin
+               << " R: " << regexps.size();
+    for (int k = entry.parents_begin; k < entry.parents_end; k++)
+      LOG(ERROR) << parents_[k];
   }
   LOG(ERROR) << "Map:";
-  for (NodeMap::const_iterator iter = nodes->begin();
+  for (NodeSet::const_iterator iter = nodes->begin();
        iter != nodes->end(); ++iter)
-    LOG(ERROR) << "NodeId: " << (*iter).second->unique_id()
-               << " Str: " << (*iter).first;
+    LOG(ERROR) << "NodeId: " << (*iter)->unique_id()
+               << " Str: " << NodeString(*iter);
 }
 
 std::string PrefilterTree::DebugNodeString(Prefilter* node) const {
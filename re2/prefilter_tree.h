@@ -16,27 +16,49 @@
 // atoms) that the user of this class should use to do the string
 // matching.
 
-#include <map>
+#include <stddef.h>
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "util/util.h"
+#include "util/mutex.h"
 #include "re2/prefilter.h"
 #include "re2/sparse_array.h"
+#include "re2/sparse_set.h"
 
 namespace re2 {
 
+class Decoder;
+class Encoder;
+
 class PrefilterTree {
+ private:
+  typedef SparseArray<int> IntMap;
+
  public:
   PrefilterTree();
   explicit PrefilterTree(int min_atom_len);
   ~PrefilterTree();
 
   // Adds the prefilter for the next regexp. Note that we assume that
-  // Add called sequentially for all regexps. All Add calls
-  // must precede Compile.
+  // Add called sequentially for all regexps. If called after Compile,
+  // the regexp passes no filter until Update is called.
   void Add(Prefilter* prefilter);
 
+  // Estimates from a sample of the texts to be searched how many texts
+  // each atom occurs in. Atoms estimated to occur in more than
+  // max_fraction of the texts filter out too little to be worth matching,
+  // so they are dropped just like atoms shorter than min_atom_len: an AND
+  // node keeps its other children, while an OR node is dropped in turn.
+  // The estimate for an atom is the fraction of the sample texts that
+  // contain its rarest trigram, after lowercasing them as the atoms are,
+  // which is never less than the fraction that contain the atom itself.
+  // Call before Add.
+  void SetSample(const std::vector<std::string>& sample, double max_fraction);
+
   // The Compile returns a vector of string in atom_vec.
   // Call this after all the prefilters are added through Add.
   // No calls to Add after Compile are allowed.
@@ -45,22 +67,134 @@ class PrefilterTree {
   // and passed to RegexpsGivenStrings below.
   void Compile(std::vector<std::string>* atom_vec);
 
+  // Brings a compiled tree up to date with the calls to Add and Remove
+  // since Compile or the last Update, without compiling it again: the
+  // nodes of the new prefilters are merged into the tree, and the nodes
+  // needed only by removed regexps are dropped. The atoms of the new
+  // nodes are appended to added_atoms; they take the indices following
+  // those of the atoms returned so far, so no atom changes its index.
+  // removed_atoms is filled with the indices of the atoms that no regexp
+  // needs any more, which are not reused and need not be matched.
+  // Takes time in proportion to the number of nodes in the tree plus
+  // the size of the new prefilters. A tree read by Deserialize() cannot
+  // be updated.
+  // Add, Remove and Update modify the tree, so they must not be called
+  // concurrently with RegexpsGivenStrings or with each other.
+  void Update(std::vector<std::string>* added_atoms,
+              std::vector<int>* removed_atoms);
+
+  // Removes the regexp with the given index, so that RegexpsGivenStrings
+  // no longer returns it. Its atoms are reported by the next Update.
+  // Returns false if there is no such regexp or it was already removed.
+  bool Remove(int regexp);
+
+  // Returns true if the atom with the given index has been
+  // reported as removed by Update.
+  bool IsRemovedAtom(int atom) const { return atom_index_to_id_[atom] < 0; }
+
   // Given the indices of the atoms that matched, returns the indexes
   // of regexps that should be searched.  The matched_atoms should
   // contain all the ids of string atoms that were found to match the
   // content. The caller can use any string match engine to perform
-  // this function. This function is thread safe.
+  // this function. This function is thread safe. The regexps are sorted.
+  // It reuses working space from earlier calls, so it doesn't allocate
+  // once enough space for the busiest concurrent calls has been made.
+  void RegexpsGivenStrings(const std::vector<int>& matched_atoms,
+                           std::vector<int>* regexps) const;
+
+  // As above, but if sorted is false, leaves the regexps in no particular
+  // order. Then the time taken is proportional to the number of nodes
+  // that the matched atoms trigger (plus the number of regexps that
+  // always pass the filter), not to the number of regexps.
+  void RegexpsGivenStrings(const std::vector<int>& matched_atoms, bool sorted,
+                           std::vector<int>* regexps) const;
+
+  // Where an atom occurs in the text: atom is its index, and the
+  // occurrence spans the bytes from begin up to (but not including) end.
+  struct AtomMatch {
+    int atom;
+    size_t begin;
+    size_t end;
+  };
+
+  // As RegexpsGivenStrings, but also enforces the constraints that the
+  // prefilters place on where their atoms occur relative to each other
+  // (see Prefilter::Gap): for example, that "bar" begins after "foo"
+  // ends for foo.*bar. The matches must include every occurrence of each
+  // atom that occurs, overlapping ones too, with offsets into the text
+  // that the regexps are matched against; if the atoms are found in a
+  // lowercased copy of the text, lowercasing must not change its length.
+  // With those, fewer regexps pass the filter, but none that can match.
+  void RegexpsGivenMatches(const std::vector<AtomMatch>& matches,
+                           bool sorted, std::vector<int>* regexps) const;
+
+  // Working space for RegexpsGivenStrings. It grows as needed, so a
+  // Scratch that is reused doesn't allocate after its first few uses.
+  // A Scratch must not be used by two calls at once.
+  class Scratch {
+   public:
+    Scratch() {}
+
+   private:
+    friend class PrefilterTree;
+
+    IntMap count_;       // how many children of each AND node triggered
+    SparseSet work_;     // the nodes triggered
+    SparseSet regexps_;  // the regexps triggered
+
+    // For RegexpsGivenMatches: the atoms that matched, and the matches
+    // with their atoms' entry ids in place of their indices, sorted by
+    // entry id and then by end.
+    std::vector<int> atoms_;
+    std::vector<AtomMatch> matches_;
+
+    Scratch(const Scratch&) = delete;
+    Scratch& operator=(const Scratch&) = delete;
+  };
+
+  // As above, but works in scratch instead of space of its own.
   void RegexpsGivenStrings(const std::vector<int>& matched_atoms,
+                           bool sorted, Scratch* scratch,
+                           std::vector<int>* regexps) const;
+  void RegexpsGivenMatches(const std::vector<AtomMatch>& matches,
+                           bool sorted, Scratch* scratch,
                            std::vector<int>* regexps) const;
 
   // Print debug prefilter. Also prints unique ids associated with
   // nodes of the prefilter of the regexp.
   void PrintPrefilter(int regexpid);
 
+  // Writes the tree to enc: the entries, their parents and gaps, the
+  // regexps that always pass the filter and the entry of each atom,
+  // which is all that RegexpsGivenStrings and RegexpsGivenMatches need.
+  // The prefilters are not written, so a tree read back cannot print
+  // them.
+  void Serialize(Encoder* enc) const;
+
+  // Reads a tree written by Serialize() from dec. Returns NULL if the
+  // data is malformed. Sanity checks are applied, but the data is
+  // assumed to have been produced by Serialize(), not an adversary.
+  static PrefilterTree* Deserialize(Decoder* dec);
+
  private:
-  typedef SparseArray<int> IntMap;
-  typedef std::map<int, int> StdIntMap;
-  typedef std::map<std::string, Prefilter*> NodeMap;
+  // Hashes and compares nodes by their op and their atom or the unique
+  // ids of their children, which must have been assigned already.
+  struct NodeHash {
+    size_t operator()(Prefilter* node) const;
+  };
+  struct NodeEqual {
+    bool operator()(Prefilter* a, Prefilter* b) const;
+  };
+  typedef std::unordered_set<Prefilter*, NodeHash, NodeEqual> NodeSet;
+
+  // A Prefilter::Gap between the atoms of two children of an AND node,
+  // which are identified by their entry ids.
+  struct Gap {
+    int first;
+    int second;
+    int min_gap;
+    int max_gap;
+  };
 
   // Each unique node has a corresponding Entry that helps in
   // passing the matching trigger information along the tree.
@@ -76,29 +210,56 @@ class PrefilterTree {
     // one is because of sharing. For example (abc | def) and (xyz | def)
     // are two different nodes, but they share the atom 'def'. So when
     // 'def' matches, it triggers two parents, corresponding to the two
-    // different OR nodes.
-    StdIntMap* parents;
+    // different OR nodes. The indices are parents_[parents_begin] up to
+    // (but not including) parents_[parents_end].
+    int parents_begin;
+    int parents_end;
 
     // When this node is ready to trigger the parent, what are the
     // regexps that are triggered.
     std::vector<int> regexps;
+
+    // For an AND node, the gaps that RegexpsGivenMatches checks
+    // before it triggers the node.
+    std::vector<Gap> gaps;
   };
 
   // Returns true if the prefilter node should be kept.
   bool KeepNode(Prefilter* node) const;
 
+  // Returns true if the sample shows atom to be too common to keep.
+  bool IsCommonAtom(const std::string& atom) const;
+
   // This function assigns unique ids to various parts of the
   // prefilter, by looking at if these nodes are already in the
-  // PrefilterTree.
-  void AssignUniqueIds(NodeMap* nodes, std::vector<std::string>* atom_vec);
+  // PrefilterTree. Fills parents with the parents of each entry.
+  void AssignUniqueIds(NodeSet* nodes, std::vector<std::string>* atom_vec,
+                       std::vector<std::vector<int>>* parents);
+
+  // Fills the gaps of entry from those of node, an AND node
+  // whose children have been assigned unique ids.
+  static void SetGaps(Prefilter* node, Entry* entry);
+
+  // Returns true if the matches in scratch->matches_ satisfy the
+  // gaps of entry.
+  static bool GapsHold(const Entry& entry, const Scratch* scratch);
+
+  // Given the matching atoms, find the regexps to be triggered
+  // and leave them in scratch->regexps_. If check_gaps, an AND node
+  // triggers only if its gaps hold.
+  void PropagateMatch(const std::vector<int>& matched_atoms, bool check_gaps,
+                      Scratch* scratch) const;
 
-  // Given the matching atoms, find the regexps to be triggered.
-  void PropagateMatch(const std::vector<int>& atom_ids,
-                      IntMap* regexps) const;
+  // Gets a Scratch from scratch_pool_, or a new one if none is free.
+  std::unique_ptr<Scratch> GetScratch() const;
 
-  // Returns the prefilter node that has the same NodeString as this
-  // node. For the canonical node, returns node.
-  Prefilter* CanonicalNode(NodeMap* nodes, Prefilter* node);
+  // Returns scratch to scratch_pool_.
+  void PutScratch(std::unique_ptr<Scratch> scratch) const;
+
+  // Copies the regexps triggered by PropagateMatch
+  // and those always triggered to regexps.
+  void CollectRegexps(bool sorted, Scratch* scratch,
+                      std::vector<int>* regexps) const;
 
   // A string that uniquely identifies the node. Assumes that the
   // children of node has already been assigned unique ids.
@@ -108,12 +269,25 @@ class PrefilterTree {
   std::string DebugNodeString(Prefilter* node) const;
 
   // Used for debugging.
-  void PrintDebugInfo(NodeMap* nodes);
+  void PrintDebugInfo(NodeSet* nodes);
+
+  // Builds nodes_, refs_ and atom_index_ for Update and Remove,
+  // if they have not been built already.
+  void PrepareUpdates();
+
+  // Merges the nodes of prefilter into the tree, adding entries for the
+  // nodes that are new and their atoms to added_atoms, and returns the
+  // unique id of prefilter.
+  int AddNodes(Prefilter* prefilter, std::vector<std::vector<int>>* parents,
+               std::vector<std::string>* added_atoms);
 
   // These are all the nodes formed by Compile. Essentially, there is
   // one node for each unique atom and each unique AND/OR node.
   std::vector<Entry> entries_;
 
+  // The parents of all of the entries, one entry after another.
+  std::vector<int> parents_;
+
   // indices of regexps that always pass through the filter (since we
   // found no required literals in these regexps).
   std::vector<int> unfiltered_;
@@ -121,15 +295,48 @@ class PrefilterTree {
   // vector of Prefilter for all regexps.
   std::vector<Prefilter*> prefilter_vec_;
 
-  // Atom index in returned strings to entry id mapping.
+  // Atom index in returned strings to entry id mapping,
+  // or -1 for the atoms removed by Update.
   std::vector<int> atom_index_to_id_;
 
+  // The node that each entry was made from.
+  std::vector<Prefilter*> canonical_;
+
+  // For Update and Remove, which build them when first called: the
+  // canonical nodes of the live entries; for each entry, how many
+  // entries and regexps refer to it (an entry is dropped when none
+  // do); and the index of each atom entry in the atoms (-1 for other
+  // entries).
+  NodeSet nodes_;
+  std::vector<int> refs_;
+  std::vector<int> atom_index_;
+
+  // The number of regexps merged into the tree by Compile and Update;
+  // later ones wait for the next Update.
+  int num_merged_;
+
+  // Whether each regexp has been removed.
+  std::vector<bool> removed_;
+
+  // The indices of the atoms dropped by Remove since the last Update.
+  std::vector<int> removed_atoms_;
+
   // Has the prefilter tree been compiled.
   bool compiled_;
 
+  // Scratches not in use by any call to RegexpsGivenStrings.
+  mutable Mutex scratch_mutex_;
+  mutable std::vector<std::unique_ptr<Scratch>> scratch_pool_;
+
   // Strings less than this length are not stored as atoms.
   const int min_atom_len_;
 
+  // For each n-gram (n <= 3) in the sample given to SetSample,
+  // keyed by NgramKey, the number of sample texts that contain it.
+  std::unordered_map<uint32_t, int> sample_ngrams_;
+  int sample_size_;
+  double max_fraction_;
+
   PrefilterTree(const PrefilterTree&) = delete;
   PrefilterTree& operator=(const PrefilterTree&) = delete;
 };
@@ -23,6 +23,7 @@
 #include "util/logging.h"
 #include "util/strutil.h"
 #include "re2/bitmap256.h"
+#include "re2/serialize.h"
 #include "re2/stringpiece.h"
 
 namespace re2 {
@@ -916,6 +917,212 @@ void Prog::ComputeHints(std::vector<Inst>* flat, int begin, int end) {
   }
 }
 
+void Prog::Serialize(Encoder* enc) {
+  DCHECK(did_flatten_);
+  enc->PutU8((anchor_start_ ? 1 : 0) |
+             (anchor_end_ ? 2 : 0) |
+             (reversed_ ? 4 : 0) |
+             (did_onepass_ ? 8 : 0));
+  enc->PutU32(start_);
+  enc->PutU32(start_unanchored_);
+  enc->PutU32(size_);
+  enc->PutU32(bytemap_range_);
+  enc->PutU32(static_cast<uint32_t>(prefix_size_));
+  enc->PutU32(prefix_front_);
+  enc->PutU32(prefix_back_);
+  enc->PutU32(list_count_);
+  for (int i = 0; i < kNumInst; i++)
+    enc->PutU32(inst_count_[i]);
+
+  enc->PutU8(list_heads_.data() != NULL ? 1 : 0);
+  if (list_heads_.data() != NULL) {
+    for (int i = 0; i < size_; i++)
+      enc->PutU16(list_heads_[i]);
+  }
+
+  for (int i = 0; i < size_; i++) {
+    Inst* ip = &inst_[i];
+    enc->PutU32(ip->out_opcode_);
+    switch (ip->opcode()) {
+      case kInstAlt:
+      case kInstAltMatch:
+        enc->PutU32(ip->out1_);
+        break;
+      case kInstByteRange:
+        enc->PutU32(ip->lo_ | ip->hi_ << 8 | ip->hint_foldcase_ << 16);
+        break;
+      case kInstCapture:
+        enc->PutU32(ip->cap_);
+        break;
+      case kInstEmptyWidth:
+        enc->PutU32(ip->empty_);
+        break;
+      case kInstMatch:
+        enc->PutU32(ip->match_id_);
+        break;
+      default:
+        enc->PutU32(0);
+        break;
+    }
+  }
+
+  enc->PutU64(dfa_mem_);
+  enc->PutBytes(bytemap_, sizeof bytemap_);
+
+  // The one-pass NFA nodes are arrays of uint32_t.
+  int n = onepass_nodes_.size() / static_cast<int>(sizeof(uint32_t));
+  enc->PutU32(n);
+  for (int i = 0; i < n; i++) {
+    uint32_t v;
+    memmove(&v, onepass_nodes_.data() + i*sizeof v, sizeof v);
+    enc->PutU32(v);
+  }
+}
+
+Prog* Prog::Deserialize(Decoder* dec) {
+  std::unique_ptr<Prog> prog(new Prog);
+  uint8_t flags;
+  uint32_t start, start_unanchored, size, bytemap_range;
+  uint32_t prefix_size, prefix_front, prefix_back, list_count;
+  if (!dec->GetU8(&flags) ||
+      !dec->GetU32(&start) ||
+      !dec->GetU32(&start_unanchored) ||
+      !dec->GetU32(&size) ||
+      !dec->GetU32(&bytemap_range) ||
+      !dec->GetU32(&prefix_size) ||
+      !dec->GetU32(&prefix_front) ||
+      !dec->GetU32(&prefix_back) ||
+      !dec->GetU32(&list_count))
+    return NULL;
+  if (size < 1 || size > static_cast<uint32_t>(Inst::kMaxInst) ||
+      start >= size || start_unanchored >= size ||
+      bytemap_range < 1 || bytemap_range > 256 ||
+      list_count > size)
+    return NULL;
+  int32_t front = static_cast<int32_t>(prefix_front);
+  int32_t back = static_cast<int32_t>(prefix_back);
+  // The compiler stores the bytes as chars, so they are negative
+  // for bytes >= 0x80 where char is signed.
+  if (prefix_size == 0 ? (front != -1 || back != -1)
+                       : (front < -0x80 || front > 0xFF ||
+                          back < -0x80 || back > 0xFF))
+    return NULL;
+
+  prog->anchor_start_ = (flags & 1) != 0;
+  prog->anchor_end_ = (flags & 2) != 0;
+  prog->reversed_ = (flags & 4) != 0;
+  prog->did_onepass_ = (flags & 8) != 0;
+  prog->did_flatten_ = true;
+  prog->start_ = start;
+  prog->start_unanchored_ = start_unanchored;
+  prog->size_ = size;
+  prog->bytemap_range_ = bytemap_range;
+  prog->prefix_size_ = prefix_size;
+  if (prefix_size == 0) {
+    prog->prefix_front_ = front;
+    prog->prefix_back_ = back;
+  } else {
+    // Store them as chars of this host, whether or not char is signed.
+    prog->prefix_front_ = static_cast<char>(front);
+    prog->prefix_back_ = static_cast<char>(back);
+  }
+  prog->list_count_ = list_count;
+  for (int i = 0; i < kNumInst; i++) {
+    uint32_t count;
+    if (!dec->GetU32(&count) || count > size)
+      return NULL;
+    prog->inst_count_[i] = count;
+  }
+
+  uint8_t has_list_heads;
+  if (!dec->GetU8(&has_list_heads))
+    return NULL;
+  if (has_list_heads) {
+    if (dec->remaining().size() < size*sizeof(uint16_t))
+      return NULL;
+    prog->list_heads_ = PODArray<uint16_t>(size);
+    for (uint32_t i = 0; i < size; i++) {
+      uint16_t head;
+      if (!dec->GetU16(&head) ||
+          (head != 0xFFFF && head >= list_count))
+        return NULL;
+      prog->list_heads_[i] = head;
+    }
+  }
+
+  // Check that there is enough input before allocating the instructions.
+  if (dec->remaining().size() < size*2*sizeof(uint32_t))
+    return NULL;
+  prog->inst_ = PODArray<Inst>(size);
+  memset(prog->inst_.data(), 0, size*sizeof prog->inst_[0]);
+  for (uint32_t i = 0; i < size; i++) {
+    Inst* ip = &prog->inst_[i];
+    uint32_t out_opcode, arg;
+    if (!dec->GetU32(&out_opcode) || !dec->GetU32(&arg))
+      return NULL;
+    ip->out_opcode_ = out_opcode;
+    if (ip->opcode() >= kNumInst ||
+        static_cast<uint32_t>(ip->out()) >= size)
+      return NULL;
+    switch (ip->opcode()) {
+      case kInstAlt:
+      case kInstAltMatch:
+        if (arg >= size)
+          return NULL;
+        ip->out1_ = arg;
+        break;
+      case kInstByteRange:
+        ip->lo_ = arg & 0xFF;
+        ip->hi_ = (arg >> 8) & 0xFF;
+        ip->hint_foldcase_ = static_cast<uint16_t>(arg >> 16);
+        break;
+      case kInstCapture:
+        ip->cap_ = static_cast<int32_t>(arg);
+        if (ip->cap_ < 0)
+          return NULL;
+        break;
+      case kInstEmptyWidth:
+        if ((arg & ~kEmptyAllFlags) != 0)
+          return NULL;
+        ip->empty_ = static_cast<EmptyOp>(arg);
+        break;
+      case kInstMatch:
+        ip->match_id_ = static_cast<int32_t>(arg);
+        break;
+      default:
+        break;
+    }
+  }
+
+  uint64_t dfa_mem;
+  if (!dec->GetU64(&dfa_mem) ||
+      !dec->GetBytes(prog->bytemap_, sizeof prog->bytemap_))
+    return NULL;
+  prog->dfa_mem_ = static_cast<int64_t>(dfa_mem);
+  for (int i = 0; i < 256; i++) {
+    if (prog->bytemap_[i] >= bytemap_range)
+      return NULL;
+  }
+
+  uint32_t n;
+  if (!dec->GetU32(&n) ||
+      dec->remaining().size() < n*sizeof(uint32_t))
+    return NULL;
+  if (n > 0) {
+    if (!prog->did_onepass_)
+      return NULL;
+    prog->onepass_nodes_ = PODArray<uint8_t>(n*sizeof(uint32_t));
+    for (uint32_t i = 0; i < n; i++) {
+      uint32_t v;
+      if (!dec->GetU32(&v))
+        return NULL;
+      memmove(prog->onepass_nodes_.data() + i*sizeof v, &v, sizeof v);
+    }
+  }
+
+  return prog.release();
+}
+
 #if defined(__AVX2__)
 // Finds the least significant non-zero bit in n.
 static int FindLSBSet(uint32_t n) {
@@ -50,6 +50,8 @@ enum EmptyOp {
 };
 
 class DFA;
+class Decoder;
+class Encoder;
 class Regexp;
 
 // Compiled form of regexp program.
@@ -271,6 +273,43 @@ class Prog {
                  Anchor anchor, MatchKind kind,
                  StringPiece* match, int nmatch);
 
+  // Conditions under which a many-match search stops before it has read
+  // all of text, having found only some of the matches: once matches
+  // holds at least max_matches IDs (if max_matches > 0) or once it holds
+  // an ID less than priority_limit.  The matches found so far are left
+  // in matches and the search returns true.
+  struct ManyMatchLimit {
+    int max_matches;
+    int priority_limit;
+  };
+
+  // Search using NFA for all of the matches, like SearchDFA() with
+  // kind == kManyMatch: fills matches (if not NULL) with the match IDs
+  // of every match found anywhere in text.  Runs in time linear in the
+  // size of the text and in memory linear in the size of the program,
+  // so it never fails.  Like the DFA in that mode, it ignores
+  // anchor_end(); RE2::Set compiles anchoring at the end into the
+  // program itself.  If limit is not NULL, stops early as it says.
+  bool SearchManyMatchNFA(const StringPiece& text, const StringPiece& context,
+                          Anchor anchor, const ManyMatchLimit* limit,
+                          SparseSet* matches);
+
+  // Where a match was found, as reported by LocateManyMatchNFA().
+  // (SparseArray needs a POD type, so this can't be a StringPiece.)
+  struct Span {
+    const char* begin;
+    const char* end;
+  };
+
+  // As above, but also locates the matches: for each match ID found,
+  // sets (*locations)[id] to the match that ends earliest in text or,
+  // if there are several, to the one of those that starts leftmost.
+  // Stops once max_locations IDs have been located (if max_locations > 0),
+  // so callers that already know the IDs (from the DFA) can stop early.
+  bool LocateManyMatchNFA(const StringPiece& text, const StringPiece& context,
+                          Anchor anchor, SparseArray<Span>* locations,
+                          int max_locations);
+
   // Search using DFA: much faster than NFA but only finds
   // end of match and can use a lot more memory.
   // Returns whether a match was found.
@@ -281,6 +320,42 @@ class Prog {
                  Anchor anchor, MatchKind kind, StringPiece* match0,
                  bool* failed, SparseSet* matches);
 
+  // Like SearchDFA() with kind == kManyMatch, but if limit is not NULL,
+  // stops early as it says.
+  bool SearchManyMatchDFA(const StringPiece& text, const StringPiece& context,
+                          Anchor anchor, const ManyMatchLimit* limit,
+                          bool* failed, SparseSet* matches);
+
+  // The threads still running at some point in a many-match DFA search:
+  // the (sorted) instructions that they are at and the DFA state flags
+  // there. Passing them from the search of one chunk of a text to the
+  // search of the next chunk lets the chunks be searched independently.
+  struct ManyMatchThreads {
+    ManyMatchThreads() : flag(0) {}
+
+    // Adds the threads in other, which must be at the same point.
+    void Merge(const ManyMatchThreads& other);
+
+    std::vector<int> inst;
+    uint32_t flag;
+  };
+
+  // Searches chunk, which must lie within context, adding the IDs of the
+  // matches found to matches. If from is NULL, runs an unanchored search
+  // of chunk from scratch, so it finds only the matches that start within
+  // chunk. Otherwise, runs only the threads in *from (which must be at the
+  // beginning of chunk) that a search from scratch would not start anyway,
+  // so it finds the matches that started earlier; that search is usually
+  // short, as most threads die within a few bytes. If to is not NULL,
+  // sets *to to the threads still running at the end of chunk.
+  // Ignores anchor_end() like SearchManyMatchNFA(), and must not be
+  // used if anchor_start(). If the DFA runs out of memory, sets *failed
+  // to true and returns false.
+  bool SearchManyMatchDFAChunk(const StringPiece& chunk,
+                               const StringPiece& context,
+                               const ManyMatchThreads* from, bool* failed,
+                               SparseSet* matches, ManyMatchThreads* to);
+
   // The callback issued after building each DFA state with BuildEntireDFA().
   // If next is null, then the memory budget has been exhausted and building
   // will halt. Otherwise, the state has been built and next points to an array
@@ -360,6 +435,15 @@ class Prog {
   // its own Match instruction recording the index in the output vector.
   static Prog* CompileSet(Regexp* re, RE2::Anchor anchor, int64_t max_mem);
 
+  // Writes the (flattened) program, including any one-pass NFA,
+  // to enc.  The DFA caches are not written.
+  void Serialize(Encoder* enc);
+
+  // Reads a program written by Serialize() from dec.  Returns NULL
+  // if the data is malformed.  Sanity checks are applied, but the data
+  // is assumed to have been produced by Serialize(), not an adversary.
+  static Prog* Deserialize(Decoder* dec);
+
   // Flattens the Prog from "tree" form to "list" form. This is an in-place
   // operation in the sense that the old instructions are lost.
   void Flatten();
@@ -21,17 +21,23 @@
 #include <algorithm>
 #include <atomic>
 #include <iterator>
+#include <list>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "util/util.h"
 #include "util/logging.h"
+#include "util/mutex.h"
 #include "util/strutil.h"
 #include "util/utf.h"
+#include "re2/prefilter.h"
 #include "re2/prog.h"
 #include "re2/regexp.h"
+#include "re2/serialize.h"
 #include "re2/sparse_array.h"
 
 namespace re2 {
@@ -103,6 +109,74 @@ static RE2::ErrorCode RegexpErrorToRE2(re2::RegexpStatusCode code) {
   return RE2::ErrorInternal;
 }
 
+// Maximum number of literals to check for in RE2::Match().
+static const size_t kMaxRequiredLiterals = 16;
+
+// Maximum size of a program for which to look for required literals.
+// Computing the prefilter costs time at every construction, and larger
+// regexps seldom have a small enough set of literals anyway.
+static const int kMaxRequiredLiteralsProgSize = 1000;
+
+// Finds a set of literals, at least one of which must occur (perhaps
+// after ASCII case-folding) in any text matching the prefilter.
+// The literals are all lowercase.  Returns false if there is no such set.
+static bool RequiredLiterals(Prefilter* pre, bool latin1,
+                             std::vector<std::string>* literals) {
+  switch (pre->op()) {
+    default:
+      return false;
+
+    case Prefilter::ATOM: {
+      const std::string& atom = pre->atom();
+      if (atom.empty())
+        return false;
+      // The prefilter lowercases runes in UTF-8 mode, so we can only use
+      // ASCII atoms, and not even those that contain 's' or 'k' because
+      // U+017F and U+212A lowercase to them.
+      if (!latin1) {
+        for (char c : atom) {
+          if ((c & 0x80) != 0 || c == 's' || c == 'k')
+            return false;
+        }
+      }
+      literals->push_back(atom);
+      return true;
+    }
+
+    case Prefilter::OR:
+      for (Prefilter* sub : *pre->subs()) {
+        if (!RequiredLiterals(sub, latin1, literals) ||
+            literals->size() > kMaxRequiredLiterals)
+          return false;
+      }
+      return true;
+
+    case Prefilter::AND: {
+      // Any child will do, so pick the one whose shortest literal
+      // is longest, which should be the most selective.
+      std::vector<std::string> best;
+      size_t bestlen = 0;
+      for (Prefilter* sub : *pre->subs()) {
+        std::vector<std::string> v;
+        if (!RequiredLiterals(sub, latin1, &v) ||
+            v.size() > kMaxRequiredLiterals)
+          continue;
+        size_t len = v[0].size();
+        for (const std::string& lit : v)
+          len = std::min(len, lit.size());
+        if (len > bestlen || (len == bestlen && v.size() < best.size())) {
+          best.swap(v);
+          bestlen = len;
+        }
+      }
+      if (best.empty())
+        return false;
+      literals->insert(literals->end(), best.begin(), best.end());
+      return true;
+    }
+  }
+}
+
 static std::string trunc(const StringPiece& pattern) {
   if (pattern.size() < 100)
     return std::string(pattern);
@@ -126,6 +200,10 @@ RE2::RE2(const StringPiece& pattern, const Options& options) {
   Init(pattern, options);
 }
 
+RE2::RE2() {
+  Reset(StringPiece(), DefaultOptions);
+}
+
 int RE2::Options::ParseFlags() const {
   int flags = Regexp::ClassNL;
   switch (encoding()) {
@@ -170,7 +248,164 @@ int RE2::Options::ParseFlags() const {
   return flags;
 }
 
-void RE2::Init(const StringPiece& pattern, const Options& options) {
+// Writes options to enc.  Also used for program cache keys.
+static void EncodeOptions(const RE2::Options& options, Encoder* enc) {
+  enc->PutU8(static_cast<uint8_t>(options.encoding()));
+  enc->PutU32((options.posix_syntax() ? 1<<0 : 0) |
+              (options.longest_match() ? 1<<1 : 0) |
+              (options.log_errors() ? 1<<2 : 0) |
+              (options.literal() ? 1<<3 : 0) |
+              (options.never_nl() ? 1<<4 : 0) |
+              (options.dot_nl() ? 1<<5 : 0) |
+              (options.never_capture() ? 1<<6 : 0) |
+              (options.case_sensitive() ? 1<<7 : 0) |
+              (options.perl_classes() ? 1<<8 : 0) |
+              (options.word_boundary() ? 1<<9 : 0) |
+              (options.one_line() ? 1<<10 : 0));
+  enc->PutU64(options.max_mem());
+}
+
+// Reads options written by EncodeOptions() from dec.
+static bool DecodeOptions(Decoder* dec, RE2::Options* options) {
+  uint8_t encoding;
+  uint32_t bits;
+  uint64_t max_mem;
+  if (!dec->GetU8(&encoding) ||
+      !dec->GetU32(&bits) ||
+      !dec->GetU64(&max_mem))
+    return false;
+  if (encoding != RE2::Options::EncodingUTF8 &&
+      encoding != RE2::Options::EncodingLatin1)
+    return false;
+  options->set_encoding(static_cast<RE2::Options::Encoding>(encoding));
+  options->set_posix_syntax((bits & 1<<0) != 0);
+  options->set_longest_match((bits & 1<<1) != 0);
+  options->set_log_errors((bits & 1<<2) != 0);
+  options->set_literal((bits & 1<<3) != 0);
+  options->set_never_nl((bits & 1<<4) != 0);
+  options->set_dot_nl((bits & 1<<5) != 0);
+  options->set_never_capture((bits & 1<<6) != 0);
+  options->set_case_sensitive((bits & 1<<7) != 0);
+  options->set_perl_classes((bits & 1<<8) != 0);
+  options->set_word_boundary((bits & 1<<9) != 0);
+  options->set_one_line((bits & 1<<10) != 0);
+  options->set_max_mem(static_cast<int64_t>(max_mem));
+  return true;
+}
+
+// An RE2 whose compiled form is shared by all RE2 objects constructed
+// with the same pattern and options while the program cache is enabled.
+// The cache holds one reference; each sharing RE2 holds another.
+class ProgramCacheEntry {
+ public:
+  explicit ProgramCacheEntry(RE2* re) : re_(re), refs_(1) {}
+
+  RE2* re() const { return re_; }
+
+  // The size charged against the capacity of the cache.
+  int size() const { return re_->ProgramSize(); }
+
+  void Ref() { refs_.fetch_add(1, std::memory_order_relaxed); }
+
+  void Unref() {
+    if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete re_;
+      delete this;
+    }
+  }
+
+ private:
+  ~ProgramCacheEntry() {}
+
+  RE2* re_;
+  std::atomic<int> refs_;
+
+  ProgramCacheEntry(const ProgramCacheEntry&) = delete;
+  ProgramCacheEntry& operator=(const ProgramCacheEntry&) = delete;
+};
+
+// The program cache: a map from key (see ProgramCacheKey()) to entry
+// with least recently used eviction.
+struct ProgramCache {
+  typedef std::list<std::pair<std::string, ProgramCacheEntry*>> LRUList;
+
+  Mutex mutex;
+  LRUList lru;  // most recently used first
+  std::unordered_map<std::string, LRUList::iterator> map;
+  int64_t size = 0;  // the total size of the entries
+};
+
+static std::atomic<int> program_cache_capacity(0);
+
+static ProgramCache* GetProgramCache() {
+  static std::once_flag program_cache_once;
+  static ProgramCache* program_cache;
+  std::call_once(program_cache_once, []() {
+    program_cache = new ProgramCache;
+  });
+  return program_cache;
+}
+
+// Drops least recently used entries until their total size is at most
+// capacity.
+// REQUIRES: cache->mutex is held.
+static void EvictProgramCache(ProgramCache* cache, int capacity) {
+  while (!cache->lru.empty() && cache->size > std::max(capacity, 0)) {
+    cache->map.erase(cache->lru.back().first);
+    cache->size -= cache->lru.back().second->size();
+    cache->lru.back().second->Unref();
+    cache->lru.pop_back();
+  }
+}
+
+// Returns the entry for key with a new reference, or NULL if none.
+static ProgramCacheEntry* LookupProgramCache(const std::string& key) {
+  ProgramCache* cache = GetProgramCache();
+  MutexLock l(&cache->mutex);
+  auto i = cache->map.find(key);
+  if (i == cache->map.end())
+    return NULL;
+  cache->lru.splice(cache->lru.begin(), cache->lru, i->second);
+  ProgramCacheEntry* entry = i->second->second;
+  entry->Ref();
+  return entry;
+}
+
+// Adds re (which must be ok()) under key, taking ownership of it.
+// If another thread got there first, deletes re and uses that entry.
+// Returns the entry with a new reference.
+static ProgramCacheEntry* InsertProgramCache(const std::string& key, RE2* re) {
+  ProgramCache* cache = GetProgramCache();
+  MutexLock l(&cache->mutex);
+  ProgramCacheEntry* entry;
+  auto i = cache->map.find(key);
+  if (i != cache->map.end()) {
+    delete re;
+    cache->lru.splice(cache->lru.begin(), cache->lru, i->second);
+    entry = i->second->second;
+    entry->Ref();
+  } else {
+    entry = new ProgramCacheEntry(re);
+    cache->lru.emplace_front(key, entry);
+    cache->map[key] = cache->lru.begin();
+    cache->size += entry->size();
+    // Take the new reference first: an entry larger than the capacity
+    // is evicted at once.
+    entry->Ref();
+    EvictProgramCache(cache, program_cache_capacity);
+  }
+  return entry;
+}
+
+void RE2::SetProgramCacheCapacity(int capacity) {
+  ProgramCache* cache = GetProgramCache();
+  MutexLock l(&cache->mutex);
+  program_cache_capacity = capacity;
+  EvictProgramCache(cache, capacity);
+}
+
+// Sets the RE2 to the state that precedes parsing and compiling.
+void RE2::Reset(const StringPiece& pattern, const Options& options) {
   static std::once_flag empty_once;
   std::call_once(empty_once, []() {
     empty_string = new std::string;
@@ -187,14 +422,81 @@ void RE2::Init(const StringPiece& pattern, const Options& options) {
   prefix_.clear();
   prefix_foldcase_ = false;
   suffix_regexp_ = NULL;
+  required_suffix_.clear();
+  required_suffix_foldcase_ = false;
+  required_literals_.clear();
   prog_ = NULL;
   num_captures_ = -1;
   is_one_pass_ = false;
 
+  cache_entry_ = NULL;
+
   rprog_ = NULL;
   named_groups_ = NULL;
   group_names_ = NULL;
+}
 
+void RE2::Init(const StringPiece& pattern, const Options& options) {
+  Reset(pattern, options);
+
+  if (program_cache_capacity > 0) {
+    std::string key;
+    Encoder enc(&key);
+    EncodeOptions(options_, &enc);
+    enc.PutBytes(pattern_.data(), pattern_.size());
+
+    ProgramCacheEntry* entry = LookupProgramCache(key);
+    if (entry == NULL) {
+      RE2* re = new RE2;
+      re->Reset(pattern, options);
+      re->Compile();
+      // Don't bother caching errors; just report them below.
+      if (re->ok())
+        entry = InsertProgramCache(key, re);
+      else
+        delete re;
+    }
+    if (entry != NULL) {
+      ShareFrom(entry);
+      return;
+    }
+  }
+
+  Compile();
+}
+
+// Uses the compiled form of entry->re(), to which the caller
+// has already taken a reference on behalf of this RE2.
+void RE2::ShareFrom(ProgramCacheEntry* entry) {
+  const RE2* re = entry->re();
+  cache_entry_ = entry;
+  // Parse the pattern again rather than share the Regexps of the entry:
+  // Regexp reference counting is not thread-safe, and callers of Regexp()
+  // are free to Incref() and Decref() it.  The pattern parsed before, so
+  // it parses now.
+  entire_regexp_ = Regexp::Parse(
+    pattern_,
+    static_cast<Regexp::ParseFlags>(options_.ParseFlags()),
+    NULL);
+  std::string prefix;
+  bool prefix_foldcase;
+  re2::Regexp* suffix;
+  if (entire_regexp_->RequiredPrefix(&prefix, &prefix_foldcase, &suffix))
+    suffix_regexp_ = suffix;
+  else
+    suffix_regexp_ = entire_regexp_->Incref();
+  prefix_ = re->prefix_;
+  prefix_foldcase_ = re->prefix_foldcase_;
+  required_suffix_ = re->required_suffix_;
+  required_suffix_foldcase_ = re->required_suffix_foldcase_;
+  required_literals_ = re->required_literals_;
+  prog_ = re->prog_;
+  num_captures_ = re->num_captures_;
+  is_one_pass_ = re->is_one_pass_;
+}
+
+// Parses and compiles pattern_ according to options_.
+void RE2::Compile() {
   RegexpStatus status;
   entire_regexp_ = Regexp::Parse(
     pattern_,
@@ -217,6 +519,11 @@ void RE2::Init(const StringPiece& pattern, const Options& options) {
   else
     suffix_regexp_ = entire_regexp_->Incref();
 
+  // The required suffix is used only to reject non-matching text early,
+  // so we keep the entire regexp around for the engines.
+  entire_regexp_->RequiredSuffix(&required_suffix_,
+                                 &required_suffix_foldcase_);
+
   // Two thirds of the memory goes to the forward Prog,
   // one third to the reverse prog, because the forward
   // Prog has two DFAs but the reverse prog has one.
@@ -240,11 +547,33 @@ void RE2::Init(const StringPiece& pattern, const Options& options) {
   // and that is harder to do if the DFA has already
   // been built.
   is_one_pass_ = prog_->IsOnePass();
+
+  // If the match can start anywhere in the text and there is no required
+  // suffix to check for, derive a set of literals, one of which must occur
+  // in any match, so that RE2::Match() can reject most non-matching text
+  // without running the DFA.  Don't bother if the DFA can already skip
+  // ahead to a literal prefix of the match.
+  if (!prog_->anchor_start() && required_suffix_.empty() &&
+      !prog_->can_prefix_accel() &&
+      prog_->size() <= kMaxRequiredLiteralsProgSize) {
+    Prefilter* pre = Prefilter::FromRE2(this);
+    if (pre != NULL) {
+      bool latin1 = options_.encoding() == RE2::Options::EncodingLatin1;
+      if (!RequiredLiterals(pre, latin1, &required_literals_) ||
+          required_literals_.size() > kMaxRequiredLiterals)
+        required_literals_.clear();
+      delete pre;
+    }
+  }
 }
 
 // Returns rprog_, computing it if needed.
 re2::Prog* RE2::ReverseProg() const {
   std::call_once(rprog_once_, [](const RE2* re) {
+    if (re->cache_entry_ != NULL) {
+      re->rprog_ = re->cache_entry_->re()->ReverseProg();
+      return;
+    }
     re->rprog_ =
         re->suffix_regexp_->CompileToReverseProg(re->options_.max_mem() / 3);
     if (re->rprog_ == NULL) {
@@ -265,8 +594,13 @@ RE2::~RE2() {
     suffix_regexp_->Decref();
   if (entire_regexp_)
     entire_regexp_->Decref();
-  delete prog_;
-  delete rprog_;
+  if (cache_entry_ != NULL) {
+    // The Progs belong to the cache entry.
+    cache_entry_->Unref();
+  } else {
+    delete prog_;
+    delete rprog_;
+  }
   if (error_ != empty_string)
     delete error_;
   if (named_groups_ != NULL && named_groups_ != empty_named_groups)
@@ -368,6 +702,148 @@ const std::map<int, std::string>& RE2::CapturingGroupNames() const {
   return *group_names_;
 }
 
+/***** Serialization *****/
+
+// Identifies serialized RE2s: a magic number and a format version,
+// which must be incremented whenever the format changes.
+static const uint32_t kSerializeMagic = 0x53324552;  // "RE2S"
+static const uint32_t kSerializeVersion = 1;
+
+bool RE2::Serialize(std::string* out) const {
+  out->clear();
+  if (!ok())
+    return false;
+
+  Encoder enc(out);
+  enc.PutU32(kSerializeMagic);
+  enc.PutU32(kSerializeVersion);
+
+  enc.PutString(pattern_);
+  EncodeOptions(options_, &enc);
+
+  enc.PutU32(num_captures_);
+  enc.PutU8(is_one_pass_ ? 1 : 0);
+  enc.PutString(prefix_);
+  enc.PutU8(prefix_foldcase_ ? 1 : 0);
+  enc.PutString(required_suffix_);
+  enc.PutU8(required_suffix_foldcase_ ? 1 : 0);
+  enc.PutU32(static_cast<uint32_t>(required_literals_.size()));
+  for (const std::string& lit : required_literals_)
+    enc.PutString(lit);
+
+  // NamedCapturingGroups() is just the inverse of CapturingGroupNames()
+  // because the parser rejects duplicate names.
+  const std::map<int, std::string>& names = CapturingGroupNames();
+  enc.PutU32(static_cast<uint32_t>(names.size()));
+  for (const auto& kv : names) {
+    enc.PutU32(kv.first);
+    enc.PutString(kv.second);
+  }
+
+  prog_->Serialize(&enc);
+  Prog* rprog = ReverseProg();
+  enc.PutU8(rprog != NULL ? 1 : 0);
+  if (rprog != NULL)
+    rprog->Serialize(&enc);
+  return true;
+}
+
+RE2* RE2::Deserialize(const StringPiece& data) {
+  Decoder dec(data);
+  uint32_t magic, version;
+  if (!dec.GetU32(&magic) || magic != kSerializeMagic ||
+      !dec.GetU32(&version) || version != kSerializeVersion)
+    return NULL;
+
+  std::string pattern;
+  Options options;
+  if (!dec.GetString(&pattern) ||
+      !DecodeOptions(&dec, &options))
+    return NULL;
+
+  std::unique_ptr<RE2> re(new RE2);
+  re->Reset(pattern, options);
+
+  uint32_t num_captures, nliterals, nnames;
+  uint8_t is_one_pass, prefix_foldcase, required_suffix_foldcase;
+  if (!dec.GetU32(&num_captures) ||
+      !dec.GetU8(&is_one_pass) ||
+      !dec.GetString(&re->prefix_) ||
+      !dec.GetU8(&prefix_foldcase) ||
+      !dec.GetString(&re->required_suffix_) ||
+      !dec.GetU8(&required_suffix_foldcase) ||
+      !dec.GetU32(&nliterals))
+    return NULL;
+  if (static_cast<int>(num_captures) < 0)
+    return NULL;
+  re->num_captures_ = static_cast<int>(num_captures);
+  re->is_one_pass_ = is_one_pass != 0;
+  re->prefix_foldcase_ = prefix_foldcase != 0;
+  re->required_suffix_foldcase_ = required_suffix_foldcase != 0;
+  if (nliterals > kMaxRequiredLiterals)
+    return NULL;
+  re->required_literals_.resize(nliterals);
+  for (uint32_t i = 0; i < nliterals; i++) {
+    if (!dec.GetString(&re->required_literals_[i]) ||
+        re->required_literals_[i].empty())
+      return NULL;
+  }
+
+  std::unique_ptr<std::map<int, std::string>> group_names(
+      new std::map<int, std::string>);
+  std::unique_ptr<std::map<std::string, int>> named_groups(
+      new std::map<std::string, int>);
+  if (!dec.GetU32(&nnames) || nnames > num_captures)
+    return NULL;
+  for (uint32_t i = 0; i < nnames; i++) {
+    uint32_t index;
+    std::string name;
+    if (!dec.GetU32(&index) || !dec.GetString(&name) ||
+        index < 1 || index > num_captures)
+      return NULL;
+    (*group_names)[index] = name;
+    (*named_groups)[name] = index;
+  }
+
+  re->prog_ = Prog::Deserialize(&dec);
+  if (re->prog_ == NULL || re->prog_->reversed())
+    return NULL;
+  uint8_t has_rprog;
+  if (!dec.GetU8(&has_rprog))
+    return NULL;
+  Prog* rprog = NULL;
+  if (has_rprog) {
+    rprog = Prog::Deserialize(&dec);
+    if (rprog == NULL || !rprog->reversed()) {
+      delete rprog;
+      return NULL;
+    }
+  }
+  if (!dec.remaining().empty()) {
+    delete rprog;
+    return NULL;
+  }
+
+  // There is no Regexp from which to compute these lazily,
+  // so mark them as computed already.
+  std::call_once(re->rprog_once_, [&]() {
+    re->rprog_ = rprog;
+  });
+  std::call_once(re->named_groups_once_, [&]() {
+    if (named_groups->empty())
+      re->named_groups_ = empty_named_groups;
+    else
+      re->named_groups_ = named_groups.release();
+  });
+  std::call_once(re->group_names_once_, [&]() {
+    if (group_names->empty())
+      re->group_names_ = empty_group_names;
+    else
+      re->group_names_ = group_names.release();
+  });
+  return re.release();
+}
+
 /***** Convenience interfaces *****/
 
 bool RE2::FullMatchN(const StringPiece& text, const RE2& re,
@@ -610,6 +1086,61 @@ static int ascii_strcasecmp(const char* a, const char* b, size_t len) {
   return 0;
 }
 
+// Returns whether text contains the string s, which (if foldcase)
+// is known to be all lowercase.
+static bool ContainsString(const StringPiece& text, const std::string& s,
+                           bool foldcase) {
+  size_t n = s.size();
+  if (n > text.size())
+    return false;
+  const char* p = text.data();
+  const char* ep = p + (text.size() - n) + 1;
+  if (foldcase) {
+    for (; p < ep; p++) {
+      if (ascii_strcasecmp(s.data(), p, n) == 0)
+        return true;
+    }
+    return false;
+  }
+  for (;; p++) {
+    p = reinterpret_cast<const char*>(memchr(p, s[0], ep - p));
+    if (p == NULL)
+      return false;
+    if (memcmp(p, s.data(), n) == 0)
+      return true;
+  }
+}
+
+// Returns whether text contains any of the strings in v, all of
+// which are known to be all lowercase.
+static bool ContainsAnyString(const StringPiece& text,
+                              const std::vector<std::string>& v) {
+  bool first[256] = {};
+  size_t minlen = v[0].size();
+  for (const std::string& s : v) {
+    uint8_t c = s[0];
+    first[c] = true;
+    if ('a' <= c && c <= 'z')
+      first[c - 'a' + 'A'] = true;
+    minlen = std::min(minlen, s.size());
+  }
+  if (minlen > text.size())
+    return false;
+  const char* p = text.data();
+  const char* end = p + text.size();
+  const char* ep = end - minlen + 1;
+  for (; p < ep; p++) {
+    if (!first[static_cast<uint8_t>(*p)])
+      continue;
+    for (const std::string& s : v) {
+      if (s.size() <= static_cast<size_t>(end - p) &&
+          ascii_strcasecmp(s.data(), p, s.size()) == 0)
+        return true;
+    }
+  }
+  return false;
+}
+
 
 /***** Actual matching and rewriting code *****/
 
@@ -664,6 +1195,42 @@ bool RE2::Match(const StringPiece& text,
   else if (prog_->anchor_start() && re_anchor != ANCHOR_BOTH)
     re_anchor = ANCHOR_START;
 
+  // Check for the required suffix, if any.  If the match must end at
+  // the end of the text, the suffix must be there; otherwise, it must
+  // at least occur somewhere in the text.  This is worth checking for
+  // ANCHOR_START searches too: one such as Consume() with .*\.jpg runs
+  // the DFA over the whole text before failing, which the scan, running
+  // at memchr() speed, avoids.  The price is a scan of the text by
+  // searches that would have failed within the first few bytes anyway,
+  // which is small in comparison.
+  if (!required_suffix_.empty()) {
+    size_t suffixlen = required_suffix_.size();
+    if (suffixlen > subtext.size())
+      return false;
+    if (re_anchor == ANCHOR_BOTH || prog_->anchor_end()) {
+      const char* p = subtext.data() + subtext.size() - suffixlen;
+      if (required_suffix_foldcase_) {
+        if (ascii_strcasecmp(&required_suffix_[0], p, suffixlen) != 0)
+          return false;
+      } else {
+        if (memcmp(&required_suffix_[0], p, suffixlen) != 0)
+          return false;
+      }
+    } else {
+      if (!ContainsString(subtext, required_suffix_,
+                          required_suffix_foldcase_))
+        return false;
+    }
+  }
+
+  // Check for the required literals, if any.  They are derived only for
+  // regexps whose matches can start anywhere, and they are checked only
+  // for unanchored searches, which would otherwise run the DFA over the
+  // whole text.
+  if (re_anchor == UNANCHORED && !required_literals_.empty() &&
+      !ContainsAnyString(subtext, required_literals_))
+    return false;
+
   // Check for the required prefix, if any.
   size_t prefixlen = 0;
   if (!prefix_.empty()) {
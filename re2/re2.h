@@ -219,6 +219,7 @@
 
 namespace re2 {
 class Prog;
+class ProgramCacheEntry;
 class Regexp;
 }  // namespace re2
 
@@ -316,8 +317,33 @@ class RE2 {
   // Returns the underlying Regexp; not for general use.
   // Returns entire_regexp_ so that callers don't need
   // to know about prefix_ and prefix_foldcase_.
+  // Returns NULL if the RE2 was constructed by Deserialize().
   re2::Regexp* Regexp() const { return entire_regexp_; }
 
+  // Writes the compiled form of this RE2 (forward and reverse Progs,
+  // required prefix and suffix, capture names, one-pass data) to *out.
+  // The format is versioned and independent of the host byte order.
+  // Returns false (and leaves *out empty) if the RE2 is not ok().
+  bool Serialize(std::string* out) const;
+
+  // Constructs an RE2 from the output of Serialize() without parsing or
+  // compiling the pattern.  The caller takes ownership of the result.
+  // Returns NULL if data is malformed or was written by an incompatible
+  // version.  Sanity checks are applied, but data is assumed to have
+  // been produced by Serialize(), not by an adversary.
+  static RE2* Deserialize(const StringPiece& data);
+
+  // Sets the capacity of the process-wide program cache, which is
+  // disabled (capacity 0) by default.  While it is enabled, RE2 objects
+  // constructed with the same pattern and options share one compiled
+  // form -- the forward and reverse Progs and their DFA caches -- so
+  // constructing a duplicate costs only parsing the pattern and its DFA
+  // memory is not duplicated.  The cache holds compiled forms whose
+  // ProgramSize() adds up to at most capacity, evicting the least
+  // recently used; an evicted form stays alive for as long as any RE2
+  // still uses it.
+  static void SetProgramCacheCapacity(int capacity);
+
   /***** The array-based matching interface ******/
 
   // The functions here have names ending in 'N' and are used to implement
@@ -743,7 +769,13 @@ class RE2 {
   static Arg Octal(T* ptr);
 
  private:
+  // For use by Deserialize(); leaves the RE2 to be filled in by the caller.
+  RE2();
+
   void Init(const StringPiece& pattern, const Options& options);
+  void Reset(const StringPiece& pattern, const Options& options);
+  void Compile();
+  void ShareFrom(re2::ProgramCacheEntry* entry);
 
   bool DoMatch(const StringPiece& text,
                Anchor re_anchor,
@@ -762,9 +794,14 @@ class RE2 {
   std::string prefix_;          // required prefix (before suffix_regexp_)
   bool prefix_foldcase_;        // prefix_ is ASCII case-insensitive
   re2::Regexp* suffix_regexp_;  // parsed regular expression, prefix_ removed
+  std::string required_suffix_;    // required suffix (of every match)
+  bool required_suffix_foldcase_;  // required_suffix_ is ASCII case-insensitive
+  std::vector<std::string> required_literals_;  // one must occur in a match
   re2::Prog* prog_;             // compiled program for regexp
   int num_captures_;            // number of capturing groups
   bool is_one_pass_;            // can use prog_->SearchOnePass?
+  // Cache entry that owns the Regexps and Progs (NULL if this RE2 does)
+  re2::ProgramCacheEntry* cache_entry_;
 
   // Reverse Prog for DFA execution only
   mutable re2::Prog* rprog_;
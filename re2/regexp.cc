@@ -409,6 +409,126 @@ static bool TopEqual(Regexp* a, Regexp* b) {
   return 0;
 }
 
+template <typename T>
+static int CompareValues(T a, T b) {
+  return a < b ? -1 : b < a ? 1 : 0;
+}
+
+// Like TopEqual, but orders a and b.
+static int TopCompare(Regexp* a, Regexp* b) {
+  if (a->op() != b->op())
+    return CompareValues(a->op(), b->op());
+
+  int c;
+  switch (a->op()) {
+    case kRegexpNoMatch:
+    case kRegexpEmptyMatch:
+    case kRegexpAnyChar:
+    case kRegexpAnyByte:
+    case kRegexpBeginLine:
+    case kRegexpEndLine:
+    case kRegexpWordBoundary:
+    case kRegexpNoWordBoundary:
+    case kRegexpBeginText:
+      return 0;
+
+    case kRegexpEndText:
+      return CompareValues(a->parse_flags() & Regexp::WasDollar,
+                           b->parse_flags() & Regexp::WasDollar);
+
+    case kRegexpLiteral:
+      if ((c = CompareValues(a->rune(), b->rune())) != 0)
+        return c;
+      return CompareValues(a->parse_flags() & Regexp::FoldCase,
+                           b->parse_flags() & Regexp::FoldCase);
+
+    case kRegexpLiteralString:
+      if ((c = CompareValues(a->nrunes(), b->nrunes())) != 0)
+        return c;
+      if ((c = CompareValues(a->parse_flags() & Regexp::FoldCase,
+                             b->parse_flags() & Regexp::FoldCase)) != 0)
+        return c;
+      for (int i = 0; i < a->nrunes(); i++)
+        if ((c = CompareValues(a->runes()[i], b->runes()[i])) != 0)
+          return c;
+      return 0;
+
+    case kRegexpAlternate:
+    case kRegexpConcat:
+      return CompareValues(a->nsub(), b->nsub());
+
+    case kRegexpStar:
+    case kRegexpPlus:
+    case kRegexpQuest:
+      return CompareValues(a->parse_flags() & Regexp::NonGreedy,
+                           b->parse_flags() & Regexp::NonGreedy);
+
+    case kRegexpRepeat:
+      if ((c = CompareValues(a->parse_flags() & Regexp::NonGreedy,
+                             b->parse_flags() & Regexp::NonGreedy)) != 0)
+        return c;
+      if ((c = CompareValues(a->min(), b->min())) != 0)
+        return c;
+      return CompareValues(a->max(), b->max());
+
+    case kRegexpCapture:
+      if ((c = CompareValues(a->cap(), b->cap())) != 0)
+        return c;
+      if (a->name() == NULL || b->name() == NULL)
+        return CompareValues(a->name() != NULL, b->name() != NULL);
+      return a->name()->compare(*b->name());
+
+    case kRegexpHaveMatch:
+      return CompareValues(a->match_id(), b->match_id());
+
+    case kRegexpCharClass: {
+      CharClass* acc = a->cc();
+      CharClass* bcc = b->cc();
+      if ((c = CompareValues(acc->size(), bcc->size())) != 0)
+        return c;
+      if ((c = CompareValues(acc->end() - acc->begin(),
+                             bcc->end() - bcc->begin())) != 0)
+        return c;
+      for (CharClass::iterator i = acc->begin(), j = bcc->begin();
+           i != acc->end(); ++i, ++j) {
+        if ((c = CompareValues(i->lo, j->lo)) != 0 ||
+            (c = CompareValues(i->hi, j->hi)) != 0)
+          return c;
+      }
+      return 0;
+    }
+  }
+
+  LOG(DFATAL) << "Unexpected op in Regexp::Compare: " << a->op();
+  return 0;
+}
+
+int Regexp::Compare(Regexp* a, Regexp* b) {
+  if (a == NULL || b == NULL)
+    return CompareValues(a != NULL, b != NULL);
+
+  // Compare the regexps node by node in preorder.  Because each node
+  // records how many sub-regexps it has, this compares the trees
+  // themselves, not just the sequences of nodes.
+  std::vector<Regexp*> stk;
+  stk.push_back(a);
+  stk.push_back(b);
+  while (!stk.empty()) {
+    b = stk.back();
+    stk.pop_back();
+    a = stk.back();
+    stk.pop_back();
+    int c = TopCompare(a, b);
+    if (c != 0)
+      return c;
+    for (int i = a->nsub() - 1; i >= 0; i--) {
+      stk.push_back(a->sub()[i]);
+      stk.push_back(b->sub()[i]);
+    }
+  }
+  return 0;
+}
+
 bool Regexp::Equal(Regexp* a, Regexp* b) {
   if (a == NULL || b == NULL)
     return a == b;
@@ -736,6 +856,36 @@ bool Regexp::RequiredPrefixForAccel(std::string* prefix, bool* foldcase) {
   return true;
 }
 
+// Determines whether every match of this regexp must end with a
+// fixed string.  If so, returns the suffix, which might be ASCII
+// case-insensitive.
+bool Regexp::RequiredSuffix(std::string* suffix, bool* foldcase) {
+  suffix->clear();
+  *foldcase = false;
+
+  // No need for a walker: the regexp must either end with or be
+  // a literal char or string, followed by some number of \z anchors.
+  Regexp* re = this;
+  if (op_ == kRegexpConcat) {
+    int i = nsub_;
+    while (i > 0 && sub()[i-1]->op_ == kRegexpEndText)
+      i--;
+    if (i == 0)
+      return false;
+    re = sub()[i-1];
+  }
+  if (re->op_ != kRegexpLiteral &&
+      re->op_ != kRegexpLiteralString)
+    return false;
+
+  bool latin1 = (re->parse_flags() & Latin1) != 0;
+  Rune* runes = re->op_ == kRegexpLiteral ? &re->rune_ : re->runes_;
+  int nrunes = re->op_ == kRegexpLiteral ? 1 : re->nrunes_;
+  ConvertRunesToBytes(latin1, runes, nrunes, suffix);
+  *foldcase = (re->parse_flags() & FoldCase) != 0;
+  return true;
+}
+
 // Character class builder is a balanced binary tree (STL set)
 // containing non-overlapping, non-abutting RuneRanges.
 // The less-than operator used in the tree treats two
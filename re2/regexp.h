@@ -407,6 +407,13 @@ class Regexp {
   // Like Alternate but does not factor out common prefixes.
   static Regexp* AlternateNoFactor(Regexp** subs, int nsubs, ParseFlags flags);
 
+  // Compares the structure of a and b, returning a negative number,
+  // zero or a positive number as a is less than, equal to or greater
+  // than b in an arbitrary but fixed total order.  Returns zero exactly
+  // when Equal(a, b) would return true.  Like Equal, only efficient on
+  // regexps that have not been through Simplify yet.
+  static int Compare(Regexp* a, Regexp* b);
+
   // Debugging function.  Returns string format for regexp
   // that makes structure clear.  Does NOT use regexp syntax.
   std::string Dump();
@@ -448,6 +455,13 @@ class Regexp {
   // regardless of the return value.
   bool RequiredPrefixForAccel(std::string* prefix, bool* foldcase);
 
+  // Whether every match of this regexp must end with a non-empty
+  // fixed string (perhaps after ASCII case-folding), possibly followed
+  // by some number of \z anchors.  If so, returns the suffix.
+  // Callers should expect *suffix and *foldcase to be "zeroed"
+  // regardless of the return value.
+  bool RequiredSuffix(std::string* suffix, bool* foldcase);
+
  private:
   // Constructor allocates vectors as appropriate for operator.
   explicit Regexp(RegexpOp op, ParseFlags parse_flags);
@@ -0,0 +1,136 @@
+// Copyright 2026 The RE2 Authors.  All Rights Reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#ifndef RE2_SERIALIZE_H_
+#define RE2_SERIALIZE_H_
+
+// Helpers for reading and writing the binary serialization format
+// used by RE2::Serialize() and friends.  Integers are written in
+// little-endian byte order regardless of the host byte order, and
+// strings are written as a 32-bit length followed by the bytes.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <string>
+
+#include "re2/stringpiece.h"
+
+namespace re2 {
+
+class Encoder {
+ public:
+  explicit Encoder(std::string* out)
+      : out_(out) {}
+
+  void PutU8(uint8_t v) {
+    out_->push_back(static_cast<char>(v));
+  }
+
+  void PutU16(uint16_t v) {
+    PutU8(static_cast<uint8_t>(v));
+    PutU8(static_cast<uint8_t>(v >> 8));
+  }
+
+  void PutU32(uint32_t v) {
+    char buf[4];
+    for (int i = 0; i < 4; i++)
+      buf[i] = static_cast<char>(v >> (8*i));
+    out_->append(buf, sizeof buf);
+  }
+
+  void PutU64(uint64_t v) {
+    PutU32(static_cast<uint32_t>(v));
+    PutU32(static_cast<uint32_t>(v >> 32));
+  }
+
+  void PutBytes(const void* data, size_t size) {
+    out_->append(reinterpret_cast<const char*>(data), size);
+  }
+
+  void PutString(const StringPiece& s) {
+    PutU32(static_cast<uint32_t>(s.size()));
+    PutBytes(s.data(), s.size());
+  }
+
+ private:
+  std::string* out_;
+
+  Encoder(const Encoder&) = delete;
+  Encoder& operator=(const Encoder&) = delete;
+};
+
+// All of the Get methods return false (and leave the Decoder
+// in an unspecified state) if there is not enough input left.
+class Decoder {
+ public:
+  explicit Decoder(const StringPiece& in)
+      : in_(in) {}
+
+  // Returns the input that has not been consumed yet.
+  StringPiece remaining() const { return in_; }
+
+  bool GetU8(uint8_t* v) {
+    if (in_.size() < 1)
+      return false;
+    *v = static_cast<uint8_t>(in_[0]);
+    in_.remove_prefix(1);
+    return true;
+  }
+
+  bool GetU16(uint16_t* v) {
+    uint8_t lo, hi;
+    if (!GetU8(&lo) || !GetU8(&hi))
+      return false;
+    *v = static_cast<uint16_t>(hi << 8 | lo);
+    return true;
+  }
+
+  bool GetU32(uint32_t* v) {
+    if (in_.size() < 4)
+      return false;
+    uint32_t x = 0;
+    for (int i = 0; i < 4; i++)
+      x |= static_cast<uint32_t>(static_cast<uint8_t>(in_[i])) << (8*i);
+    *v = x;
+    in_.remove_prefix(4);
+    return true;
+  }
+
+  bool GetU64(uint64_t* v) {
+    uint32_t lo, hi;
+    if (!GetU32(&lo) || !GetU32(&hi))
+      return false;
+    *v = static_cast<uint64_t>(hi) << 32 | lo;
+    return true;
+  }
+
+  bool GetBytes(void* data, size_t size) {
+    if (in_.size() < size)
+      return false;
+    if (size > 0)
+      memmove(data, in_.data(), size);
+    in_.remove_prefix(size);
+    return true;
+  }
+
+  bool GetString(std::string* s) {
+    uint32_t size;
+    if (!GetU32(&size) || in_.size() < size)
+      return false;
+    s->assign(in_.data(), size);
+    in_.remove_prefix(size);
+    return true;
+  }
+
+ private:
+  StringPiece in_;
+
+  Decoder(const Decoder&) = delete;
+  Decoder& operator=(const Decoder&) = delete;
+};
+
+}  // namespace re2
+
+#endif  // RE2_SERIALIZE_H_
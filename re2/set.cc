@@ -6,11 +6,15 @@
 
 #include <stddef.h>
 #include <algorithm>
+#include <condition_variable>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <utility>
 
 #include "util/util.h"
 #include "util/logging.h"
+#include "util/parallel.h"
 #include "re2/pod_array.h"
 #include "re2/prog.h"
 #include "re2/re2.h"
@@ -23,27 +27,35 @@ RE2::Set::Set(const RE2::Options& options, RE2::Anchor anchor)
     : options_(options),
       anchor_(anchor),
       compiled_(false),
-      size_(0) {
+      size_(0),
+      tombstones_(0) {
   options_.set_never_capture(true);  // might unblock some optimisations
 }
 
 RE2::Set::~Set() {
   for (size_t i = 0; i < elem_.size(); i++)
-    elem_[i].second->Decref();
+    if (elem_[i].re != NULL)
+      elem_[i].re->Decref();
 }
 
 RE2::Set::Set(Set&& other)
     : options_(other.options_),
       anchor_(other.anchor_),
       elem_(std::move(other.elem_)),
+      removed_(std::move(other.removed_)),
       compiled_(other.compiled_),
       size_(other.size_),
-      prog_(std::move(other.prog_)) {
+      tombstones_(other.tombstones_),
+      progs_(std::move(other.progs_)) {
   other.elem_.clear();
   other.elem_.shrink_to_fit();
+  other.removed_.clear();
+  other.removed_.shrink_to_fit();
   other.compiled_ = false;
   other.size_ = 0;
-  other.prog_.reset();
+  other.tombstones_ = 0;
+  other.progs_.clear();
+  other.progs_.shrink_to_fit();
 }
 
 RE2::Set& RE2::Set::operator=(Set&& other) {
@@ -52,16 +64,63 @@ RE2::Set& RE2::Set::operator=(Set&& other) {
   return *this;
 }
 
+// Anchors the parsed pattern re as requested and concatenates it
+// with a match for index n. Consumes the reference to re.
+static re2::Regexp* FinishElem(re2::Regexp* re, int n,
+                               Regexp::ParseFlags pf, RE2::Anchor anchor) {
+  // \A and \z always parse, whatever the flags of the pattern.
+  Regexp::ParseFlags anchor_pf = static_cast<Regexp::ParseFlags>(
+    (pf & ~Regexp::Literal) | Regexp::PerlX);
+  int nre = re->op() == kRegexpConcat ? re->nsub() : 1;
+  PODArray<re2::Regexp*> sub(nre + 3);
+  int nsub = 0;
+  if (anchor != RE2::UNANCHORED)
+    sub[nsub++] = Regexp::Parse("\\A", anchor_pf, NULL);
+  if (re->op() == kRegexpConcat) {
+    for (int i = 0; i < nre; i++)
+      sub[nsub++] = re->sub()[i]->Incref();
+    re->Decref();
+  } else {
+    sub[nsub++] = re;
+  }
+  if (anchor == RE2::ANCHOR_BOTH)
+    sub[nsub++] = Regexp::Parse("\\z", anchor_pf, NULL);
+  sub[nsub++] = re2::Regexp::HaveMatch(n, pf);
+  return re2::Regexp::Concat(sub.data(), nsub, pf);
+}
+
+// Parses pattern and finishes it as above. Returns NULL
+// (and sets *status) if the pattern cannot be parsed.
+static re2::Regexp* ParseElem(const StringPiece& pattern, int n,
+                              Regexp::ParseFlags pf, RE2::Anchor anchor,
+                              RegexpStatus* status) {
+  re2::Regexp* re = Regexp::Parse(pattern, pf, status);
+  if (re == NULL)
+    return NULL;
+  return FinishElem(re, n, pf, anchor);
+}
+
 int RE2::Set::Add(const StringPiece& pattern, std::string* error) {
-  if (compiled_) {
-    LOG(DFATAL) << "RE2::Set::Add() called after compiling";
+  return Add(pattern, options_, RE2::UNANCHORED, error);
+}
+
+int RE2::Set::Add(const StringPiece& pattern, const RE2::Options& options,
+                  RE2::Anchor anchor, std::string* error) {
+  if (options.encoding() != options_.encoding()) {
+    if (error != NULL)
+      *error = "encoding differs from that of the set";
+    if (options_.log_errors())
+      LOG(ERROR) << "Error adding '" << pattern << "': "
+                 << "encoding differs from that of the set";
     return -1;
   }
 
-  Regexp::ParseFlags pf = static_cast<Regexp::ParseFlags>(
-    options_.ParseFlags());
+  int pf = options.ParseFlags() | Regexp::NeverCapture;
   RegexpStatus status;
-  re2::Regexp* re = Regexp::Parse(pattern, pf, &status);
+  int n = static_cast<int>(elem_.size());
+  re2::Regexp* re = ParseElem(pattern, n,
+                              static_cast<Regexp::ParseFlags>(pf), anchor,
+                              &status);
   if (re == NULL) {
     if (error != NULL)
       *error = status.Text();
@@ -70,55 +129,281 @@ int RE2::Set::Add(const StringPiece& pattern, std::string* error) {
     return -1;
   }
 
-  // Concatenate with match index and push on vector.
-  int n = static_cast<int>(elem_.size());
-  re2::Regexp* m = re2::Regexp::HaveMatch(n, pf);
-  if (re->op() == kRegexpConcat) {
-    int nsub = re->nsub();
-    PODArray<re2::Regexp*> sub(nsub + 1);
-    for (int i = 0; i < nsub; i++)
-      sub[i] = re->sub()[i]->Incref();
-    sub[nsub] = m;
-    re->Decref();
-    re = re2::Regexp::Concat(sub.data(), nsub + 1, pf);
-  } else {
-    re2::Regexp* sub[2];
-    sub[0] = re;
-    sub[1] = m;
-    re = re2::Regexp::Concat(sub, 2, pf);
-  }
-  elem_.emplace_back(std::string(pattern), re);
+  // Push on vector.
+  elem_.push_back({std::string(pattern), pf, anchor, re});
+  removed_.push_back(false);
   return n;
 }
 
-bool RE2::Set::Compile() {
-  if (compiled_) {
-    LOG(DFATAL) << "RE2::Set::Compile() called more than once";
+int RE2::Set::AddAll(const std::vector<std::string>& patterns,
+                     int num_threads, std::vector<int>* indices,
+                     std::vector<std::string>* errors) {
+  // Parse the patterns concurrently, then assign the indices in order.
+  Regexp::ParseFlags pf = static_cast<Regexp::ParseFlags>(
+    options_.ParseFlags());
+  int npatterns = static_cast<int>(patterns.size());
+  std::vector<re2::Regexp*> parsed(npatterns);
+  std::vector<std::string> error_text(npatterns);
+  ParallelFor(npatterns, num_threads, [&](int i) {
+    RegexpStatus status;
+    parsed[i] = Regexp::Parse(patterns[i], pf, &status);
+    if (parsed[i] == NULL)
+      error_text[i] = status.Text();
+  });
+
+  if (indices != NULL)
+    indices->assign(npatterns, -1);
+  if (errors != NULL)
+    errors->assign(npatterns, std::string());
+  int nadded = 0;
+  for (int i = 0; i < npatterns; i++) {
+    if (parsed[i] == NULL) {
+      if (errors != NULL)
+        (*errors)[i] = error_text[i];
+      if (options_.log_errors())
+        LOG(ERROR) << "Error parsing '" << patterns[i] << "': "
+                   << error_text[i];
+      continue;
+    }
+    int n = static_cast<int>(elem_.size());
+    re2::Regexp* re = FinishElem(parsed[i], n, pf, RE2::UNANCHORED);
+    elem_.push_back({patterns[i], pf, RE2::UNANCHORED, re});
+    removed_.push_back(false);
+    if (indices != NULL)
+      (*indices)[i] = n;
+    nadded++;
+  }
+  return nadded;
+}
+
+bool RE2::Set::Remove(int index) {
+  if (index < 0 || index >= static_cast<int>(elem_.size()) ||
+      removed_[index])
     return false;
+  removed_[index] = true;
+  if (index < size_) {
+    // The regexp has been compiled, so it must be filtered out
+    // of the results of Match() until the next Merge().
+    tombstones_++;
+  } else {
+    elem_[index].re->Decref();
+    elem_[index].re = NULL;
   }
+  return true;
+}
+
+// Sorts the n regexps in sub, whose indices into elem_ are in index,
+// by their structure. That puts regexps with common prefixes next to
+// each other, which is where Regexp::Alternate() looks for them, and
+// likewise regexps that differ only in their match.
+static void SortRegexps(int* index, re2::Regexp** sub, int n) {
+  std::vector<std::pair<re2::Regexp*, int>> v(n);
+  for (int i = 0; i < n; i++)
+    v[i] = std::make_pair(sub[i], index[i]);
+  std::sort(v.begin(), v.end(),
+            [](const std::pair<re2::Regexp*, int>& a,
+               const std::pair<re2::Regexp*, int>& b) -> bool {
+              int c = Regexp::Compare(a.first, b.first);
+              if (c != 0)
+                return c < 0;
+              return a.second < b.second;
+            });
+  for (int i = 0; i < n; i++) {
+    sub[i] = v[i].first;
+    index[i] = v[i].second;
+  }
+}
+
+// Returns whether a and b, as returned by FinishElem(), are the same
+// regexp apart from their matches.
+static bool SameButMatch(re2::Regexp* a, re2::Regexp* b) {
+  if (a->op() != kRegexpConcat || b->op() != kRegexpConcat ||
+      a->nsub() != b->nsub())
+    return false;
+  int n = a->nsub();
+  if (a->sub()[n-1]->op() != kRegexpHaveMatch ||
+      b->sub()[n-1]->op() != kRegexpHaveMatch)
+    return false;
+  for (int i = 0; i < n-1; i++)
+    if (Regexp::Compare(a->sub()[i], b->sub()[i]) != 0)
+      return false;
+  return true;
+}
+
+// Combines the n regexps in sub, which must be the same regexp apart from
+// their matches, into one regexp that ends in an alternation of all of
+// the matches, so that the rest of it is compiled only once.
+// Consumes the references to the regexps.
+static re2::Regexp* ShareRegexp(re2::Regexp** sub, int n) {
+  re2::Regexp* re = sub[0];
+  Regexp::ParseFlags pf = re->parse_flags();
+  int nre = re->nsub();
+  PODArray<re2::Regexp*> matches(n);
+  for (int i = 0; i < n; i++)
+    matches[i] = sub[i]->sub()[nre-1]->Incref();
+  PODArray<re2::Regexp*> cat(nre);
+  for (int i = 0; i < nre-1; i++)
+    cat[i] = re->sub()[i]->Incref();
+  cat[nre-1] = re2::Regexp::AlternateNoFactor(matches.data(), n, pf);
+  for (int i = 0; i < n; i++)
+    sub[i]->Decref();
+  return re2::Regexp::Concat(cat.data(), nre, pf);
+}
+
+bool RE2::Set::Compile() {
   compiled_ = true;
+  int old_size = size_;
+  size_t old_nprogs = progs_.size();
   size_ = static_cast<int>(elem_.size());
 
-  // Sort the elements by their patterns. This is good enough for now
-  // until we have a Regexp comparison function. (Maybe someday...)
-  std::sort(elem_.begin(), elem_.end(),
-            [](const Elem& a, const Elem& b) -> bool {
-              return a.first < b.first;
-            });
+  // Compile the regexps added since the last call,
+  // taking the references to their parsed forms.
+  std::vector<int> index;
+  for (int i = old_size; i < size_; i++)
+    if (!removed_[i])
+      index.push_back(i);
+  if (index.empty())
+    return true;
+  int n = static_cast<int>(index.size());
+  PODArray<re2::Regexp*> sub(n);
+  for (int i = 0; i < n; i++) {
+    sub[i] = elem_[index[i]].re;
+    elem_[index[i]].re = NULL;
+  }
+  SortRegexps(index.data(), sub.data(), n);
+  if (CompileShards(index.data(), sub.data(), n, &progs_))
+    return true;
 
-  PODArray<re2::Regexp*> sub(size_);
-  for (int i = 0; i < size_; i++)
-    sub[i] = elem_[i].second;
-  elem_.clear();
-  elem_.shrink_to_fit();
+  // Leave the set as it was, without the new regexps.
+  progs_.resize(old_nprogs);
+  for (int i = 0; i < n; i++)
+    removed_[index[i]] = true;
+  return false;
+}
+
+bool RE2::Set::Merge() {
+  if (!compiled_) {
+    LOG(DFATAL) << "RE2::Set::Merge() called before compiling";
+    return false;
+  }
+
+  // Parse all of the live regexps again, so that on failure,
+  // the set can be left as it was.
+  int size = static_cast<int>(elem_.size());
+  std::vector<int> index;
+  for (int i = 0; i < size; i++)
+    if (!removed_[i])
+      index.push_back(i);
+  int n = static_cast<int>(index.size());
+  PODArray<re2::Regexp*> sub(n);
+  for (int i = 0; i < n; i++)
+    sub[i] = ReparseElem(index[i]);
+  SortRegexps(index.data(), sub.data(), n);
+  std::vector<std::unique_ptr<re2::Prog>> progs;
+  if (n > 0 && !CompileShards(index.data(), sub.data(), n, &progs))
+    return false;
+
+  progs_.swap(progs);
+  for (int i = size_; i < size; i++) {
+    if (elem_[i].re != NULL) {
+      elem_[i].re->Decref();
+      elem_[i].re = NULL;
+    }
+  }
+  size_ = size;
+  tombstones_ = 0;
+  return true;
+}
+
+re2::Regexp* RE2::Set::ReparseElem(int n) const {
+  const Elem& elem = elem_[n];
+  re2::Regexp* re = ParseElem(
+      elem.pattern, n, static_cast<Regexp::ParseFlags>(elem.parse_flags),
+      elem.anchor, NULL);
+  DCHECK(re != NULL);
+  return re;
+}
+
+bool RE2::Set::CompileShards(const int* index, re2::Regexp** sub, int n,
+                             std::vector<std::unique_ptr<re2::Prog>>* progs) {
+  // Duplicate regexps are adjacent, so combine them as we go. Only whole
+  // duplicates can be combined: a Prog cannot share the code for a common
+  // subexpression whose continuations differ, so identical subtrees of
+  // otherwise different regexps are compiled separately.
+  PODArray<re2::Regexp*> alt(n);
+  int nalt = 0;
+  for (int i = 0, j; i < n; i = j) {
+    for (j = i+1; j < n && SameButMatch(sub[i], sub[j]); j++)
+      ;
+    alt[nalt++] = j-i == 1 ? sub[i] : ShareRegexp(sub + i, j-i);
+  }
 
   Regexp::ParseFlags pf = static_cast<Regexp::ParseFlags>(
     options_.ParseFlags());
-  re2::Regexp* re = re2::Regexp::Alternate(sub.data(), size_, pf);
-
-  prog_.reset(Prog::CompileSet(re, anchor_, options_.max_mem()));
+  re2::Regexp* re = re2::Regexp::Alternate(alt.data(), nalt, pf);
+  Prog* prog = Prog::CompileSet(re, anchor_, options_.max_mem());
   re->Decref();
-  return prog_ != nullptr;
+  if (prog != NULL) {
+    progs->emplace_back(prog);
+    return true;
+  }
+
+  // The program or its DFA didn't fit, so split the regexps in half and
+  // try again with each half. Because the regexps are sorted by structure,
+  // this tends to keep regexps with common prefixes in the same shard.
+  // Factoring the alternation modifies the regexps in place, so each
+  // half has to be parsed again.
+  if (n <= 1)
+    return false;
+  int half = n/2;
+  for (int i = 0; i < 2; i++) {
+    const int* shard = i == 0 ? index : index + half;
+    int nshard = i == 0 ? half : n - half;
+    PODArray<re2::Regexp*> shard_sub(nshard);
+    for (int j = 0; j < nshard; j++) {
+      shard_sub[j] = ReparseElem(shard[j]);
+    }
+    if (!CompileShards(shard, shard_sub.data(), nshard, progs))
+      return false;
+  }
+  return true;
+}
+
+// Searches text using one of the programs of a set,
+// adding the indices of the matching regexps to matches (if not NULL).
+// Stops early once the matches reach limit (if not NULL).
+static bool SearchShard(Prog* prog, const StringPiece& text,
+                        const Prog::ManyMatchLimit* limit,
+                        SparseSet* matches, bool log_errors) {
+  bool dfa_failed = false;
+  bool ret = prog->SearchManyMatchDFA(text, text, Prog::kUnanchored, limit,
+                                      &dfa_failed, matches);
+  if (dfa_failed) {
+    // Fall back to the NFA, which is slower, but needs memory only
+    // in proportion to the size of the program and so cannot fail.
+    // Any matches that the DFA found before failing are genuine,
+    // so there is no need to discard them.
+    if (log_errors)
+      LOG(ERROR) << "DFA out of memory: "
+                 << "program size " << prog->size() << ", "
+                 << "list count " << prog->list_count() << ", "
+                 << "bytemap range " << prog->bytemap_range()
+                 << "; falling back to NFA";
+    ret = prog->SearchManyMatchNFA(text, text, Prog::kUnanchored, limit,
+                                   matches);
+  }
+  return ret;
+}
+
+// Returns whether matches has reached limit.
+static bool LimitReached(const Prog::ManyMatchLimit& limit,
+                         const SparseSet& matches) {
+  if (limit.max_matches > 0 && matches.size() >= limit.max_matches)
+    return true;
+  for (SparseSet::const_iterator i = matches.begin(); i != matches.end(); ++i)
+    if (*i < limit.priority_limit)
+      return true;
+  return false;
 }
 
 bool RE2::Set::Match(const StringPiece& text, std::vector<int>* v) const {
@@ -127,47 +412,259 @@ bool RE2::Set::Match(const StringPiece& text, std::vector<int>* v) const {
 
 bool RE2::Set::Match(const StringPiece& text, std::vector<int>* v,
                      ErrorInfo* error_info) const {
+  return Match(text, v, EarlyExit(), error_info);
+}
+
+bool RE2::Set::Match(const StringPiece& text, std::vector<int>* v,
+                     const EarlyExit& early_exit,
+                     ErrorInfo* error_info) const {
+  if (v == NULL)
+    return Search(text, NULL, early_exit, error_info);
+  v->clear();
+  SparseSet matches(size_);
+  if (!Search(text, &matches, early_exit, error_info))
+    return false;
+  v->assign(matches.begin(), matches.end());
+  return true;
+}
+
+bool RE2::Set::Match(const StringPiece& text, Matches* matches,
+                     const EarlyExit& early_exit,
+                     ErrorInfo* error_info) const {
+  if (matches == NULL)
+    return Search(text, NULL, early_exit, error_info);
+  if (matches->set_ == NULL)
+    matches->set_.reset(new SparseSet(size_));
+  else if (matches->set_->max_size() < size_)
+    matches->set_->resize(size_);
+  matches->set_->clear();
+  return Search(text, matches->set_.get(), early_exit, error_info);
+}
+
+bool RE2::Set::Search(const StringPiece& text, SparseSet* matches,
+                      const EarlyExit& early_exit,
+                      ErrorInfo* error_info) const {
   if (!compiled_) {
     LOG(DFATAL) << "RE2::Set::Match() called before compiling";
     if (error_info != NULL)
       error_info->kind = kNotCompiled;
     return false;
   }
-  bool dfa_failed = false;
-  std::unique_ptr<SparseSet> matches;
-  if (v != NULL) {
-    matches.reset(new SparseSet(size_));
-    v->clear();
+  Prog::ManyMatchLimit limit = {early_exit.max_matches,
+                                early_exit.priority_limit};
+  bool use_limit = limit.max_matches > 0 || limit.priority_limit > 0;
+  std::unique_ptr<SparseSet> scratch;
+  if (tombstones_ > 0) {
+    // The programs still match the removed regexps, so find all of
+    // the matches and then filter out the removed regexps.
+    use_limit = false;
+    if (matches == NULL) {
+      scratch.reset(new SparseSet(size_));
+      matches = scratch.get();
+    }
   }
-  bool ret = prog_->SearchDFA(text, text, Prog::kAnchored, Prog::kManyMatch,
-                              NULL, &dfa_failed, matches.get());
-  if (dfa_failed) {
-    if (options_.log_errors())
-      LOG(ERROR) << "DFA out of memory: "
-                 << "program size " << prog_->size() << ", "
-                 << "list count " << prog_->list_count() << ", "
-                 << "bytemap range " << prog_->bytemap_range();
-    if (error_info != NULL)
-      error_info->kind = kOutOfMemory;
-    return false;
+  bool ret = false;
+  for (size_t i = 0; i < progs_.size(); i++) {
+    if (SearchShard(progs_[i].get(), text, use_limit ? &limit : NULL,
+                    matches, options_.log_errors())) {
+      ret = true;
+      // If the caller doesn't care which regexps matched,
+      // then there is no need to search the other shards.
+      if (matches == NULL)
+        break;
+      if (use_limit && LimitReached(limit, *matches))
+        break;
+    }
+  }
+  if (ret && tombstones_ > 0) {
+    std::vector<int> live;
+    for (SparseSet::const_iterator i = matches->begin();
+         i != matches->end(); ++i)
+      if (!removed_[*i])
+        live.push_back(*i);
+    matches->clear();
+    for (size_t i = 0; i < live.size(); i++)
+      matches->insert_new(live[i]);
+    ret = !live.empty();
   }
   if (ret == false) {
     if (error_info != NULL)
       error_info->kind = kNoError;
     return false;
   }
-  if (v != NULL) {
-    if (matches->empty()) {
-      LOG(DFATAL) << "RE2::Set::Match() matched, but no matches returned?!";
-      if (error_info != NULL)
-        error_info->kind = kInconsistent;
-      return false;
-    }
-    v->assign(matches->begin(), matches->end());
+  if (matches != NULL && matches->empty()) {
+    LOG(DFATAL) << "RE2::Set::Match() matched, but no matches returned?!";
+    if (error_info != NULL)
+      error_info->kind = kInconsistent;
+    return false;
   }
   if (error_info != NULL)
     error_info->kind = kNoError;
   return true;
 }
 
+RE2::Set::Matches::Matches() {}
+
+RE2::Set::Matches::~Matches() {}
+
+int RE2::Set::Matches::size() const {
+  return set_ == NULL ? 0 : set_->size();
+}
+
+RE2::Set::Matches::const_iterator RE2::Set::Matches::begin() const {
+  return set_ == NULL ? NULL : set_->begin();
+}
+
+RE2::Set::Matches::const_iterator RE2::Set::Matches::end() const {
+  return set_ == NULL ? NULL : set_->end();
+}
+
+bool RE2::Set::Matches::contains(int index) const {
+  return set_ != NULL && index >= 0 && index < set_->max_size() &&
+         set_->contains(index);
+}
+
+// Calls each of fns, concurrently on executor or, if it is empty, on
+// threads of their own, and returns once they have all returned.
+static void RunConcurrently(const std::vector<std::function<void()>>& fns,
+                            const RE2::Set::Executor& executor) {
+  int n = static_cast<int>(fns.size());
+  if (!executor) {
+    ParallelFor(n, n, [&fns](int i) { fns[i](); });
+    return;
+  }
+  std::mutex mu;
+  std::condition_variable done;
+  int pending = n;
+  for (int i = 0; i < n; i++) {
+    const std::function<void()>* fn = &fns[i];
+    executor([fn, &mu, &done, &pending]() {
+      (*fn)();
+      std::lock_guard<std::mutex> l(mu);
+      if (--pending == 0)
+        done.notify_one();
+    });
+  }
+  std::unique_lock<std::mutex> l(mu);
+  done.wait(l, [&pending]() { return pending == 0; });
+}
+
+bool RE2::Set::ParallelMatch(const StringPiece& text, std::vector<int>* v,
+                             int num_chunks,
+                             const Executor& executor) const {
+  if (!compiled_) {
+    LOG(DFATAL) << "RE2::Set::ParallelMatch() called before compiling";
+    return false;
+  }
+  // Searching a chunk from scratch would let regexps anchored at the
+  // start match at the start of the chunk.
+  if (num_chunks <= 1 || anchor_ != RE2::UNANCHORED)
+    return Match(text, v);
+  if (static_cast<size_t>(num_chunks) > text.size())
+    num_chunks = static_cast<int>(text.size());
+  if (num_chunks <= 1)
+    return Match(text, v);
+  if (v != NULL)
+    v->clear();
+
+  std::vector<StringPiece> chunks(num_chunks);
+  size_t begin = 0;
+  for (int k = 0; k < num_chunks; k++) {
+    size_t end = text.size() * (k + 1) / num_chunks;
+    chunks[k] = StringPiece(text.data() + begin, end - begin);
+    begin = end;
+  }
+
+  // First, search each chunk from scratch with each program, noting the
+  // threads still running at the end of the chunk. The results for chunk
+  // k and program i go in found[k] and threads[k*nprogs + i].
+  int nprogs = static_cast<int>(progs_.size());
+  std::vector<std::unique_ptr<SparseSet>> found(num_chunks);
+  std::vector<Prog::ManyMatchThreads> threads(num_chunks * nprogs);
+  std::unique_ptr<bool[]> failed(new bool[num_chunks * nprogs]);
+  std::vector<std::function<void()>> fns;
+  for (int k = 0; k < num_chunks; k++) {
+    fns.push_back([this, &text, &chunks, &found, &threads, &failed,
+                   nprogs, k]() {
+      found[k].reset(new SparseSet(size_));
+      for (int i = 0; i < nprogs; i++)
+        progs_[i]->SearchManyMatchDFAChunk(
+            chunks[k], text, NULL, &failed[k*nprogs + i], found[k].get(),
+            &threads[k*nprogs + i]);
+    });
+  }
+  RunConcurrently(fns, executor);
+
+  // Any matches found so far are genuine, even if the DFA failed.
+  SparseSet matches(size_);
+  for (int k = 0; k < num_chunks; k++)
+    for (SparseSet::const_iterator j = found[k]->begin();
+         j != found[k]->end(); ++j)
+      matches.insert(*j);
+
+  // Then, for each program, carry the threads across each chunk boundary
+  // in turn, adding to them the threads started within the next chunk.
+  for (int i = 0; i < nprogs; i++) {
+    Prog* prog = progs_[i].get();
+    bool dfa_failed = false;
+    for (int k = 0; k < num_chunks; k++)
+      dfa_failed |= failed[k*nprogs + i];
+    Prog::ManyMatchThreads carried = threads[i];
+    Prog::ManyMatchThreads next;
+    for (int k = 1; k < num_chunks && !dfa_failed; k++) {
+      prog->SearchManyMatchDFAChunk(chunks[k], text, &carried, &dfa_failed,
+                                    &matches, &next);
+      next.Merge(threads[k*nprogs + i]);
+      std::swap(carried, next);
+    }
+    if (dfa_failed)
+      SearchShard(prog, text, NULL, &matches, options_.log_errors());
+  }
+
+  bool ret = false;
+  for (SparseSet::const_iterator j = matches.begin(); j != matches.end(); ++j) {
+    if (tombstones_ > 0 && removed_[*j])
+      continue;
+    ret = true;
+    if (v != NULL)
+      v->push_back(*j);
+  }
+  return ret;
+}
+
+bool RE2::Set::MatchPositions(const StringPiece& text,
+                              std::vector<MatchPosition>* v) const {
+  if (v == NULL)
+    return Match(text, NULL, NULL);
+  if (!compiled_) {
+    LOG(DFATAL) << "RE2::Set::MatchPositions() called before compiling";
+    return false;
+  }
+  v->clear();
+  SparseSet matches(size_);
+  SparseArray<Prog::Span> locations(size_);
+  for (size_t i = 0; i < progs_.size(); i++) {
+    matches.clear();
+    if (!SearchShard(progs_[i].get(), text, NULL, &matches,
+                     options_.log_errors()))
+      continue;
+    locations.clear();
+    progs_[i]->LocateManyMatchNFA(text, text, Prog::kUnanchored, &locations,
+                                  matches.size());
+    if (locations.size() != matches.size())
+      LOG(DFATAL) << "RE2::Set::MatchPositions() located "
+                  << locations.size() << " of " << matches.size()
+                  << " matches?!";
+    for (SparseArray<Prog::Span>::iterator j = locations.begin();
+         j != locations.end(); ++j) {
+      if (removed_[j->index()])
+        continue;
+      const Prog::Span& span = j->value();
+      v->push_back({j->index(),
+                    StringPiece(span.begin, span.end - span.begin)});
+    }
+  }
+  return !v->empty();
+}
+
 }  // namespace re2
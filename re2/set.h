@@ -5,6 +5,7 @@
 #ifndef RE2_SET_H_
 #define RE2_SET_H_
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -15,6 +16,7 @@
 namespace re2 {
 class Prog;
 class Regexp;
+template<typename Value> class SparseSetT;
 }  // namespace re2
 
 namespace re2 {
@@ -26,7 +28,7 @@ class RE2::Set {
   enum ErrorKind {
     kNoError = 0,
     kNotCompiled,   // The set is not compiled.
-    kOutOfMemory,   // The DFA ran out of memory.
+    kOutOfMemory,   // The DFA ran out of memory. (No longer returned.)
     kInconsistent,  // The result is inconsistent. This should never happen.
   };
 
@@ -50,34 +52,204 @@ class RE2::Set {
   // Indices are assigned in sequential order starting from 0.
   // Errors do not increment the index; if error is not NULL, *error will hold
   // the error message from the parser.
+  // If called after Compile(), the regexp is not matched until Compile()
+  // is called again.
   int Add(const StringPiece& pattern, std::string* error);
 
+  // As above, but parses pattern using options instead of the options
+  // passed to the constructor and anchors it as anchor says, in addition
+  // to the anchoring of the set. So regexps that differ in, say, case
+  // sensitivity or anchoring can still be matched in a single pass.
+  // Only the options that affect parsing are used: the encoding must be
+  // that of the set (or Add() fails), max_mem and log_errors are those
+  // of the set, and longest_match has no effect, as it doesn't change
+  // whether a regexp matches.
+  int Add(const StringPiece& pattern, const RE2::Options& options,
+          RE2::Anchor anchor, std::string* error);
+
+  // Adds patterns to the set as if by calling Add() on each of them in
+  // turn, but parses them on up to num_threads threads, which speeds up
+  // building large sets. The indices are assigned in the same order as
+  // by Add(), regardless of the number of threads. Fills indices (if not
+  // NULL) with the index of each pattern, or -1 if it cannot be parsed,
+  // and errors (if not NULL) with the error message for each pattern
+  // that cannot be parsed. Returns the number of patterns added.
+  int AddAll(const std::vector<std::string>& patterns, int num_threads,
+             std::vector<int>* indices, std::vector<std::string>* errors);
+
+  // Removes the regexp with the given index from the set, so that Match()
+  // no longer reports it. Its index is not reused. Until the next Merge(),
+  // the compiled programs still contain it, so Match() has to filter it
+  // out, which costs a full scan of the text even given an EarlyExit.
+  // Returns false if there is no such regexp or it was already removed.
+  bool Remove(int index);
+
   // Compiles the set in preparation for matching.
-  // Returns false if the compiler runs out of memory.
-  // Add() must not be called again after Compile().
-  // Compile() must be called before Match().
+  // If the regexps do not fit in one program within the max_mem option,
+  // they are split into several programs (shards), each of which fits
+  // and has its own DFA, and Match() searches all of them. So max_mem
+  // bounds the memory used by each shard rather than by the whole set.
+  // Returns false if the compiler runs out of memory even for a shard
+  // holding just one regexp.
+  // Compile() must be called before Match(). It can be called again after
+  // more calls to Add(), in which case it compiles only the new regexps,
+  // into programs of their own, leaving the existing programs and their
+  // DFA caches as they were. If that fails, the new regexps are removed.
+  // Regexps that are the same apart from spelling share one compiled
+  // form, and regexps with a common leading part share that part's code,
+  // but a subexpression common to regexps that differ around it (say,
+  // [^/]+ between different literals) is compiled once for each: its
+  // code would have to continue differently for each regexp.
   bool Compile();
 
+  // Recompiles all of the regexps not removed (including any added since
+  // the last Compile()) into as few programs as possible, discarding
+  // the programs built by the calls to Compile() and the memory of the
+  // removed regexps. Periodic merging keeps matching fast for sets that
+  // are updated incrementally. Returns false (leaving the set as it was)
+  // if the compiler runs out of memory.
+  // Add(), Remove(), Compile() and Merge() modify the set, so they must
+  // not be called concurrently with Match() or with each other.
+  bool Merge();
+
   // Returns true if text matches at least one of the regexps in the set.
   // Fills v (if not NULL) with the indices of the matching regexps.
   // Callers must not expect v to be sorted.
+  // If the DFA runs out of memory, Match() falls back to a slower NFA
+  // that needs memory only in proportion to the size of the set, so the
+  // result is always complete.
   bool Match(const StringPiece& text, std::vector<int>* v) const;
 
   // As above, but populates error_info (if not NULL) when none of the regexps
-  // in the set matched. This can inform callers when DFA execution fails, for
-  // example, because they might wish to handle that case differently.
+  // in the set matched.
   bool Match(const StringPiece& text, std::vector<int>* v,
              ErrorInfo* error_info) const;
 
+  // Match() ordinarily reads all of text in order to find every regexp
+  // that matches. An EarlyExit tells it when it may stop instead, which
+  // is much faster for large inputs when only some matches are wanted.
+  struct EarlyExit {
+    EarlyExit() : max_matches(0), priority_limit(0) {}
+
+    // If positive, stop once at least this many regexps have matched.
+    // In particular, 1 means stop at the first match.
+    int max_matches;
+
+    // If positive, stop once any regexp whose index is less than this
+    // has matched. Adding a class of high-priority regexps to the set
+    // before the others makes this stop at the first match of that class.
+    int priority_limit;
+  };
+
+  // As above, but stops as soon as early_exit allows. Then v holds the
+  // regexps found to match before stopping: possibly more than
+  // max_matches of them, as several can match at once, and not
+  // necessarily those whose matches end earliest in text.
+  bool Match(const StringPiece& text, std::vector<int>* v,
+             const EarlyExit& early_exit, ErrorInfo* error_info) const;
+
+  // Holds the indices of the regexps that matched, for callers that
+  // match many texts and must not allocate on every call. The first
+  // Match() into a Matches allocates space in proportion to the size of
+  // the set; later calls, even for other sets of the same size or
+  // smaller, reuse that space.
+  class Matches {
+   public:
+    typedef const int* const_iterator;
+
+    Matches();
+    ~Matches();
+
+    // Not copyable.
+    Matches(const Matches&) = delete;
+    Matches& operator=(const Matches&) = delete;
+
+    // Returns the number of regexps that matched.
+    int size() const;
+    bool empty() const { return size() == 0; }
+
+    // Iterates over the indices of the regexps that matched.
+    // Callers must not expect them to be sorted.
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    // Returns whether the regexp with the given index matched.
+    bool contains(int index) const;
+
+   private:
+    friend class Set;
+    std::unique_ptr<SparseSetT<void>> set_;
+  };
+
+  // As above, but fills matches (if not NULL) instead of a vector,
+  // reusing its space.
+  bool Match(const StringPiece& text, Matches* matches,
+             const EarlyExit& early_exit, ErrorInfo* error_info) const;
+
+  // Runs fn, possibly on another thread: for example, by handing it to
+  // a thread pool.
+  typedef std::function<void(std::function<void()>)> Executor;
+
+  // As Match(), but for large texts: splits text into num_chunks chunks
+  // and searches them concurrently, each in a function passed to executor
+  // or, if executor is empty, on a thread of its own. The regexps whose
+  // matches span chunk boundaries are then found by carrying the DFA
+  // threads still running at the end of each chunk into the next one,
+  // which is quick, as few threads survive for long. So v is filled just
+  // as by Match(). Returns once all of the functions passed to executor
+  // have returned. Each chunk costs some setup, so chunks should be
+  // large: hundreds of kilobytes, say. Sets anchored at the start cannot
+  // be split and are searched by Match() on the calling thread.
+  bool ParallelMatch(const StringPiece& text, std::vector<int>* v,
+                     int num_chunks, const Executor& executor) const;
+
+  struct MatchPosition {
+    int index;          // the index of the regexp
+    StringPiece match;  // where it matched in the text
+  };
+
+  // As above, but also reports where in text each regexp matched.
+  // For each matching regexp, of its matches that end earliest in text,
+  // reports the one that starts leftmost. (That is the first match that
+  // a scan over text finds, not necessarily the match that the regexp
+  // would find on its own.) The positions are found by an NFA that runs
+  // after the DFA has determined which regexps matched and that stops as
+  // soon as it has located all of them.
+  // Callers must not expect v to be sorted.
+  bool MatchPositions(const StringPiece& text,
+                      std::vector<MatchPosition>* v) const;
+
  private:
-  typedef std::pair<std::string, re2::Regexp*> Elem;
+  struct Elem {
+    std::string pattern;
+    int parse_flags;     // the Regexp::ParseFlags for pattern
+    RE2::Anchor anchor;  // in addition to anchor_
+    re2::Regexp* re;     // NULL once compiled
+  };
 
   RE2::Options options_;
   RE2::Anchor anchor_;
   std::vector<Elem> elem_;
+  std::vector<bool> removed_;
   bool compiled_;
-  int size_;
-  std::unique_ptr<re2::Prog> prog_;
+  int size_;        // number of regexps compiled into progs_
+  int tombstones_;  // number of those that have since been removed
+  std::vector<std::unique_ptr<re2::Prog>> progs_;
+
+  // Searches text, adding the indices of the matching regexps to
+  // matches (if not NULL). Implements Match().
+  bool Search(const StringPiece& text, SparseSetT<void>* matches,
+              const EarlyExit& early_exit, ErrorInfo* error_info) const;
+
+  // Parses elem_[n] again, for compiling it into a program
+  // other than the one it was first parsed for.
+  re2::Regexp* ReparseElem(int n) const;
+
+  // Compiles the n regexps in sub, whose indices into elem_ are in index
+  // and which must be sorted by structure, into one or more programs and
+  // appends them to progs. Consumes the references to the regexps.
+  bool CompileShards(const int* index, re2::Regexp** sub, int n,
+                     std::vector<std::unique_ptr<re2::Prog>>* progs);
 };
 
 }  // namespace re2
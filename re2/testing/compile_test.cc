@@ -5,11 +5,15 @@
 // Test prog.cc, compile.cc
 
 #include <string>
+#include <vector>
 
 #include "util/test.h"
 #include "util/logging.h"
+#include "util/utf.h"
 #include "re2/regexp.h"
 #include "re2/prog.h"
+#include "re2/serialize.h"
+#include "re2/unicode_groups.h"
 
 namespace re2 {
 
@@ -231,6 +235,76 @@ TEST(TestCompile, UTF8Ranges) {
             bytemap);
 }
 
+static bool InUGroup(const UGroup* g, Rune r) {
+  for (int i = 0; i < g->nr16; i++)
+    if (g->r16[i].lo <= r && r <= g->r16[i].hi)
+      return true;
+  for (int i = 0; i < g->nr32; i++)
+    if (g->r32[i].lo <= r && r <= g->r32[i].hi)
+      return true;
+  return false;
+}
+
+static bool FullMatchProg(Prog* prog, const StringPiece& text) {
+  bool failed = false;
+  bool matched = prog->SearchDFA(text, text, Prog::kAnchored,
+                                 Prog::kFullMatch, NULL, &failed, NULL);
+  EXPECT_FALSE(failed);
+  return matched;
+}
+
+TEST(TestCompile, UnicodeGroups) {
+  // The standard Unicode groups are compiled from precompiled automata,
+  // so check them against the range tables, paying particular attention
+  // to the edges of the ranges.
+  for (int i = 0; i < num_unicode_groups; i++) {
+    const UGroup* g = &unicode_groups[i];
+    std::string pattern = std::string("\\p{") + g->name + "}";
+    Regexp* re = Regexp::Parse(pattern, Regexp::LikePerl, NULL);
+    ASSERT_TRUE(re != NULL) << pattern;
+    Prog* prog = re->CompileToProg(0);
+    ASSERT_TRUE(prog != NULL) << pattern;
+    Prog* rprog = re->CompileToReverseProg(0);
+    ASSERT_TRUE(rprog != NULL) << pattern;
+
+    std::vector<Rune> runes;
+    for (int j = 0; j < g->nr16; j++) {
+      runes.push_back(g->r16[j].lo - 1);
+      runes.push_back(g->r16[j].lo);
+      runes.push_back(g->r16[j].hi);
+      runes.push_back(g->r16[j].hi + 1);
+    }
+    for (int j = 0; j < g->nr32; j++) {
+      runes.push_back(g->r32[j].lo - 1);
+      runes.push_back(g->r32[j].lo);
+      runes.push_back(g->r32[j].hi);
+      runes.push_back(g->r32[j].hi + 1);
+    }
+    for (Rune r : runes) {
+      if (r < 0 || r > Runemax)
+        continue;
+      char buf[UTFmax];
+      StringPiece text(buf, runetochar(buf, &r));
+      bool want = InUGroup(g, r);
+      EXPECT_EQ(want, FullMatchProg(prog, text)) << pattern << " " << r;
+      EXPECT_EQ(want, FullMatchProg(rprog, text)) << pattern << " " << r;
+    }
+
+    // Overlong encodings never match.
+    const char* overlong[] = {"\xC0\x80", "\xC1\xBF", "\xE0\x80\x80",
+                              "\xE0\x9F\xBF", "\xF0\x80\x80\x80",
+                              "\xF0\x8F\xBF\xBF", "\xF4\x90\x80\x80"};
+    for (const char* text : overlong) {
+      EXPECT_FALSE(FullMatchProg(prog, text)) << pattern;
+      EXPECT_FALSE(FullMatchProg(rprog, text)) << pattern;
+    }
+
+    delete rprog;
+    delete prog;
+    re->Decref();
+  }
+}
+
 TEST(TestCompile, InsufficientMemory) {
   Regexp* re = Regexp::Parse(
       "^(?P<name1>[^\\s]+)\\s+(?P<name2>[^\\s]+)\\s+(?P<name3>.+)$",
@@ -400,4 +474,45 @@ TEST(TestCompile, Bug35237384) {
       forward);
 }
 
+TEST(TestCompile, Serialize) {
+  for (size_t i = 0; i < arraysize(tests); i++) {
+    const re2::Test& t = tests[i];
+    Regexp* re = Regexp::Parse(t.regexp, Regexp::PerlX|Regexp::Latin1, NULL);
+    ASSERT_TRUE(re != NULL) << t.regexp;
+    for (int reversed = 0; reversed < 2; reversed++) {
+      Prog* prog = reversed ? re->CompileToReverseProg(0)
+                            : re->CompileToProg(0);
+      ASSERT_TRUE(prog != NULL) << t.regexp;
+      prog->IsOnePass();
+
+      std::string data;
+      Encoder enc(&data);
+      prog->Serialize(&enc);
+
+      Decoder dec(data);
+      Prog* copy = Prog::Deserialize(&dec);
+      ASSERT_TRUE(copy != NULL) << t.regexp;
+      EXPECT_TRUE(dec.remaining().empty()) << t.regexp;
+      EXPECT_EQ(prog->Dump(), copy->Dump()) << t.regexp;
+      EXPECT_EQ(prog->DumpByteMap(), copy->DumpByteMap()) << t.regexp;
+      EXPECT_EQ(prog->reversed(), copy->reversed()) << t.regexp;
+      EXPECT_EQ(prog->IsOnePass(), copy->IsOnePass()) << t.regexp;
+      EXPECT_EQ(prog->list_count(), copy->list_count()) << t.regexp;
+      EXPECT_EQ(prog->dfa_mem(), copy->dfa_mem()) << t.regexp;
+
+      // Truncated data must be rejected.
+      for (size_t n = 0; n < data.size(); n++) {
+        Decoder dec(StringPiece(data.data(), n));
+        Prog* bad = Prog::Deserialize(&dec);
+        EXPECT_TRUE(bad == NULL) << t.regexp << " " << n;
+        delete bad;
+      }
+
+      delete copy;
+      delete prog;
+    }
+    re->Decref();
+  }
+}
+
 }  // namespace re2
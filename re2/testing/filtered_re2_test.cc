@@ -12,6 +12,8 @@
 #include "util/test.h"
 #include "util/logging.h"
 #include "re2/filtered_re2.h"
+#include "re2/prefilter.h"
+#include "re2/prefilter_tree.h"
 #include "re2/re2.h"
 
 namespace re2 {
@@ -337,4 +339,568 @@ TEST(FilteredRE2Test, MoveSemantics) {
   EXPECT_EQ(0, v1.matches.size());
 }
 
+TEST(FilteredRE2Test, AddAll) {
+  std::vector<std::string> patterns;
+  for (int i = 0; i < 200; i++) {
+    if (i % 50 == 7)
+      patterns.push_back("bad(" + std::to_string(i));
+    else
+      patterns.push_back("x" + std::to_string(i*7919) + "\\d+(abc|def)");
+  }
+
+  // The ids and atoms must not depend on the number of threads.
+  FilterTestVars v1, v2;
+  v1.opts.set_log_errors(false);
+  std::vector<int> ids1;
+  for (size_t i = 0; i < patterns.size(); i++) {
+    int id = -1;
+    v1.f.Add(patterns[i], v1.opts, &id);
+    ids1.push_back(id);
+  }
+  v1.f.Compile(&v1.atoms);
+
+  std::vector<int> ids2;
+  EXPECT_EQ(RE2::ErrorMissingParen,
+            v2.f.AddAll(patterns, v1.opts, 4, &ids2));
+  v2.f.Compile(&v2.atoms, 4);
+  EXPECT_EQ(196, v2.f.NumRegexps());
+  EXPECT_TRUE(ids1 == ids2);
+  EXPECT_EQ(-1, ids2[7]);
+  EXPECT_EQ(7, ids2[8]);
+  EXPECT_TRUE(v1.atoms == v2.atoms);
+
+  std::string text = "y x" + std::to_string(8*7919) + "42def";
+  std::vector<int> atom_ids;
+  for (size_t i = 0; i < v2.atoms.size(); i++)
+    if (text.find(v2.atoms[i]) != std::string::npos)
+      atom_ids.push_back(static_cast<int>(i));
+  v2.f.AllMatches(text, atom_ids, &v2.matches);
+  EXPECT_EQ(1, v2.matches.size());
+  EXPECT_EQ(7, v2.matches[0]);
+}
+
+TEST(FilteredRE2Test, AtomMatcher) {
+  FilterTestVars v;
+  RE2::Options latin1;
+  latin1.set_encoding(RE2::Options::EncodingLatin1);
+  const char* patterns[] = {
+    "(abc123|def456|ghi789).*mnopqrs",
+    "(?i)\xc3\xa9" "cole",  // école
+    "Hello, World",
+    "a+b+c+",
+    "xyz\\d+xyz",
+  };
+  int id;
+  for (size_t i = 0; i < arraysize(patterns); i++)
+    v.f.Add(patterns[i], v.opts, &id);
+  v.f.Add("\xde\xadQ\xbe\xef", latin1, &id);
+  v.f.CompileWithAtomMatcher(&v.atoms, 1);
+
+  const char* texts[] = {
+    "DEF456 and then mnopqrs",
+    "DEF456 and then MNOPQRS",
+    "ghi78 mnopqrs",
+    "\xc3\x89" "COLE",  // ÉCOLE
+    "HELLO, WORLD",
+    "say Hello, World",
+    "aaabbc",
+    "xyz12XYZ",
+    "xyz12xyz",
+    "foo\xde\xadQ\xbe\xeflemur",
+    "",
+  };
+  for (size_t i = 0; i < arraysize(texts); i++) {
+    // The atom matcher must find every atom that occurs in the text
+    // case-insensitively, so no regexp that matches can be missed.
+    std::vector<int> want;
+    for (int j = 0; j < v.f.NumRegexps(); j++)
+      if (RE2::PartialMatch(texts[i], v.f.GetRE2(j)))
+        want.push_back(j);
+    v.f.AllMatches(texts[i], &v.matches);
+    std::sort(v.matches.begin(), v.matches.end());
+    EXPECT_TRUE(v.matches == want);
+    EXPECT_EQ(want.empty() ? -1 : want[0], v.f.FirstMatch(texts[i]));
+  }
+
+  v.f.FindAtoms("DEF456 and then MNOPQRS", &v.atom_indices);
+  EXPECT_EQ(2, v.atom_indices.size());
+}
+
+TEST(FilteredRE2Test, AtomMatcherEmptyAtom) {
+  // With min_atom_len 0, an atom can be empty, and it occurs in every
+  // text, so the atom matcher must always report it.
+  FilterTestVars v(0);
+  int id;
+  v.f.Add("^((?:Bc){0,2}|(?:a)?)", v.opts, &id);
+  v.f.CompileWithAtomMatcher(&v.atoms, 1);
+  ASSERT_TRUE(std::find(v.atoms.begin(), v.atoms.end(), "") != v.atoms.end());
+  EXPECT_TRUE(RE2::PartialMatch("zzz", v.f.GetRE2(0)));
+  EXPECT_EQ(0, v.f.FirstMatch("zzz"));
+  v.f.AllMatches("zzz", &v.matches);
+  ASSERT_EQ(1, v.matches.size());
+  EXPECT_EQ(0, v.matches[0]);
+
+  // The same goes for empty atoms added by Update, until they are removed.
+  std::vector<std::string> added;
+  std::vector<int> removed;
+  EXPECT_TRUE(v.f.Remove(0));
+  v.f.Add("xyz", v.opts, &id);
+  v.f.Add("(?:q|)", v.opts, &id);
+  v.f.Update(&added, &removed);
+  EXPECT_EQ(2, v.f.FirstMatch("zzz"));
+  v.f.AllMatches("zzz xyz", &v.matches);
+  std::sort(v.matches.begin(), v.matches.end());
+  ASSERT_EQ(2, v.matches.size());
+  EXPECT_EQ(1, v.matches[0]);
+  EXPECT_EQ(2, v.matches[1]);
+  EXPECT_TRUE(v.f.Remove(2));
+  v.f.Update(&added, &removed);
+  EXPECT_EQ(-1, v.f.FirstMatch("zzz"));
+  EXPECT_EQ(1, v.f.FirstMatch("xyz"));
+}
+
+TEST(FilteredRE2Test, PrefilterTreeScratch) {
+  // A Scratch reused across calls, and even across trees of different
+  // sizes, must give the same regexps as fresh working space.
+  PrefilterTree::Scratch scratch;
+  for (int n : {50, 200, 20}) {
+    PrefilterTree tree;
+    std::vector<std::unique_ptr<RE2>> res;
+    for (int i = 0; i < n; i++) {
+      std::string pattern;
+      if (i % 7 == 0)
+        pattern = "\\d+";  // unfiltered
+      else
+        pattern = "(abc" + std::to_string(i % 13) + "|def" +
+                  std::to_string(i % 5) + ").*xyz" + std::to_string(i % 3);
+      res.emplace_back(new RE2(pattern));
+      tree.Add(Prefilter::FromRE2(res.back().get()));
+    }
+    std::vector<std::string> atoms;
+    tree.Compile(&atoms);
+
+    uint32_t x = static_cast<uint32_t>(n);
+    for (int round = 0; round < 20; round++) {
+      std::vector<int> matched_atoms;
+      for (size_t i = 0; i < atoms.size(); i++) {
+        x = x*1103515245 + 12345;
+        if ((x>>16) % 3 == 0)
+          matched_atoms.push_back(static_cast<int>(i));
+      }
+      std::vector<int> want;
+      tree.RegexpsGivenStrings(matched_atoms, &want);
+      EXPECT_TRUE(std::is_sorted(want.begin(), want.end()));
+      std::vector<int> got;
+      tree.RegexpsGivenStrings(matched_atoms, false, &scratch, &got);
+      std::sort(got.begin(), got.end());
+      EXPECT_TRUE(got == want);
+      tree.RegexpsGivenStrings(matched_atoms, true, &scratch, &got);
+      EXPECT_TRUE(got == want);
+    }
+  }
+}
+
+TEST(FilteredRE2Test, ManyCandidates) {
+  // Many regexps share atoms, so they become candidates together and
+  // are searched for in clusters, which must give the same matches as
+  // searching for them one by one.
+  FilterTestVars v;
+  RE2::Options nocase;
+  nocase.set_case_sensitive(false);
+  RE2::Options latin1;
+  latin1.set_encoding(RE2::Options::EncodingLatin1);
+  int id;
+  for (int i = 0; i < 150; i++) {
+    std::string n = std::to_string(i % 10);
+    if (i % 3 == 0)
+      v.f.Add("common\\w*" + n + "z", v.opts, &id);
+    else if (i % 3 == 1)
+      v.f.Add("Common\\d+" + n, nocase, &id);
+    else
+      v.f.Add("common[\\xe0-\\xff]" + n, latin1, &id);
+  }
+  v.f.CompileWithAtomMatcher(&v.atoms, 1);
+
+  const char* texts[] = {
+    "common3z",
+    "COMMON42 and commonx7z",
+    "common\xe9" "5",
+    "common",
+    "xyz",
+  };
+  for (size_t i = 0; i < arraysize(texts); i++) {
+    std::vector<int> want;
+    for (int j = 0; j < v.f.NumRegexps(); j++)
+      if (RE2::PartialMatch(texts[i], v.f.GetRE2(j)))
+        want.push_back(j);
+    v.f.AllMatches(texts[i], &v.matches);
+    EXPECT_TRUE(v.matches == want);
+  }
+}
+
+TEST(FilteredRE2Test, SampleDropsCommonAtoms) {
+  FilterTestVars v;
+  int id;
+  v.f.Add("http://\\w+", v.opts, &id);
+  v.f.Add("http.*xyzzy", v.opts, &id);
+  v.f.Add("(the|plugh)\\s+\\d+", v.opts, &id);
+  v.f.Add("(?i)\xc3\xa9" "cole", v.opts, &id);  // école
+  std::vector<std::string> sample = {
+    "see HTTP://example.com/ for the details",
+    "the page at http://example.org/ has the answer \xc3\x89" "COLE",
+    "there is nothing here, \xc3\x89" "COLE",  // ÉCOLE
+    "http://example.net/ xyzzy \xc3\x89" "cole",
+  };
+  v.f.SetSample(sample, 0.5);
+  v.f.Compile(&v.atoms);
+  // "http" and "the" occur in too many of the sample texts. So does
+  // "http://", as all of its trigrams do, and "\xc3\xa9" "cole", once
+  // the sample is lowercased as the atoms are.
+  std::sort(v.atoms.begin(), v.atoms.end());
+  ASSERT_EQ(1, v.atoms.size());
+  EXPECT_EQ("xyzzy", v.atoms[0]);
+
+  // The first, third and fourth regexps always pass the filter now.
+  v.f.AllPotentials(v.atom_indices, &v.matches);
+  ASSERT_EQ(3, v.matches.size());
+  EXPECT_EQ(0, v.matches[0]);
+  EXPECT_EQ(2, v.matches[1]);
+  EXPECT_EQ(3, v.matches[2]);
+  v.atom_indices.push_back(0);
+  v.f.AllMatches("http://a then xyzzy", v.atom_indices, &v.matches);
+  ASSERT_EQ(2, v.matches.size());
+  EXPECT_EQ(0, v.matches[0]);
+  EXPECT_EQ(1, v.matches[1]);
+}
+
+TEST(FilteredRE2Test, ExactSetSuffixes) {
+  // The cross product of [a-f] and [0-9]{2} is too big, but the strings
+  // that end with "foo" can be carried on into (bar|baz).
+  FilterTestVars v;
+  int id;
+  v.f.Add("[a-f][0-9]{2}foo(bar|baz)", v.opts, &id);
+  v.f.Compile(&v.atoms);
+  std::sort(v.atoms.begin(), v.atoms.end());
+  ASSERT_EQ(2, v.atoms.size());
+  EXPECT_EQ("foobar", v.atoms[0]);
+  EXPECT_EQ("foobaz", v.atoms[1]);
+  v.atom_indices.push_back(1);
+  EXPECT_EQ(0, v.f.FirstMatch("c42foobaz", v.atom_indices));
+  EXPECT_EQ(-1, v.f.FirstMatch("cc2foobaz", v.atom_indices));
+
+  // A bigger bound keeps all 32 of the strings that this matches,
+  // whereas the default bound of 16 splits them into two sets of 16.
+  const char* regexp = "(abc|def)(ghi|jkl)(mno|pqr)(stu|vwx)(yz|zy)";
+  FilteredRE2 small(3);
+  small.Add(regexp, v.opts, &id);
+  small.Compile(&v.atoms);
+  EXPECT_EQ(32, v.atoms.size());
+  for (size_t i = 0; i < v.atoms.size(); i++)
+    EXPECT_TRUE(v.atoms[i].size() == 11 || v.atoms[i].size() == 12);
+  FilteredRE2 big(3, 32);
+  big.Add(regexp, v.opts, &id);
+  big.Compile(&v.atoms);
+  EXPECT_EQ(32, v.atoms.size());
+  for (size_t i = 0; i < v.atoms.size(); i++)
+    EXPECT_EQ(14, v.atoms[i].size());
+}
+
+TEST(FilteredRE2Test, Serialize) {
+  FilterTestVars v;
+  RE2::Options latin1;
+  latin1.set_encoding(RE2::Options::EncodingLatin1);
+  const char* patterns[] = {
+    "(abc123|def456|ghi789).*mnopqrs",
+    "(?i)\xc3\xa9" "cole",  // école
+    "Hello, World",
+    "a+b+c+",
+    "xyz\\d+xyz",
+  };
+  int id;
+  std::string data;
+  for (size_t i = 0; i < arraysize(patterns); i++)
+    v.f.Add(patterns[i], v.opts, &id);
+  v.f.Add("\xde\xadQ\xbe\xef", latin1, &id);
+  EXPECT_FALSE(v.f.Serialize(&data));
+  EXPECT_TRUE(data.empty());
+  v.f.CompileWithAtomMatcher(&v.atoms, 1);
+  ASSERT_TRUE(v.f.Serialize(&data));
+
+  std::vector<std::string> atoms;
+  std::unique_ptr<FilteredRE2> copy(FilteredRE2::Deserialize(data, &atoms));
+  ASSERT_TRUE(copy != NULL);
+  EXPECT_TRUE(atoms == v.atoms);
+  ASSERT_EQ(v.f.NumRegexps(), copy->NumRegexps());
+
+  const char* texts[] = {
+    "DEF456 and then MNOPQRS",
+    "ghi78 mnopqrs",
+    "\xc3\x89" "COLE",  // ÉCOLE
+    "say Hello, World",
+    "aaabbc",
+    "xyz12xyz",
+    "foo\xde\xadQ\xbe\xeflemur",
+    "",
+  };
+  std::vector<int> matches;
+  for (size_t i = 0; i < arraysize(texts); i++) {
+    v.f.AllMatches(texts[i], &v.matches);
+    copy->AllMatches(texts[i], &matches);
+    EXPECT_TRUE(matches == v.matches);
+    EXPECT_EQ(v.f.FirstMatch(texts[i]), copy->FirstMatch(texts[i]));
+  }
+
+  // The copy writes out the same data.
+  std::string again;
+  ASSERT_TRUE(copy->Serialize(&again));
+  EXPECT_TRUE(again == data);
+
+  // Truncated data is rejected.
+  for (size_t n = 0; n < data.size(); n += 7)
+    EXPECT_TRUE(FilteredRE2::Deserialize(StringPiece(data.data(), n),
+                                         NULL) == NULL);
+}
+
+TEST(FilteredRE2Test, Update) {
+  const char* words[] = {
+    "apple", "banana", "cherry", "damson", "elder", "fig", "grape",
+  };
+  int nwords = static_cast<int>(arraysize(words));
+  auto pattern = [&](int i) -> std::string {
+    if (i % 10 == 9)
+      return "\\d{3}";  // has no atoms
+    return std::string(words[i % nwords]) + ".*" +
+           words[i / nwords % nwords];
+  };
+  const char* texts[] = {
+    "apple pie and banana split",
+    "cherry, damson, elder, fig",
+    "grape apple 123",
+    "fig apple grape cherry banana damson elder",
+    "none",
+  };
+
+  FilterTestVars v;
+  int id;
+  std::vector<bool> live;
+  for (int i = 0; i < 20; i++) {
+    v.f.Add(pattern(i), v.opts, &id);
+    live.push_back(true);
+  }
+  v.f.CompileWithAtomMatcher(&v.atoms, 1);
+
+  std::vector<std::string> added;
+  std::vector<int> removed;
+  int nremoved = 0;
+  for (int round = 0; round < 20; round++) {
+    // Remove a few regexps, old and new, and add a few more.
+    for (int i = round; i < static_cast<int>(live.size()); i += 7) {
+      if (live[i]) {
+        EXPECT_TRUE(v.f.Remove(i));
+        live[i] = false;
+      }
+      EXPECT_FALSE(v.f.Remove(i));
+    }
+    for (int i = 0; i < 3; i++) {
+      v.f.Add(pattern(round * 5 + i), v.opts, &id);
+      live.push_back(true);
+      ASSERT_EQ(static_cast<int>(live.size()) - 1, id);
+    }
+    if (round % 2 == 1) {
+      // Removing a regexp that was added since the last Update.
+      EXPECT_TRUE(v.f.Remove(id));
+      live[id] = false;
+    }
+    v.f.Update(&added, &removed);
+    v.atoms.insert(v.atoms.end(), added.begin(), added.end());
+    nremoved += static_cast<int>(removed.size());
+    for (size_t i = 0; i < removed.size(); i++) {
+      ASSERT_FALSE(v.atoms[removed[i]].empty());
+      v.atoms[removed[i]].clear();
+    }
+
+    // The remaining atoms are just those that a FilteredRE2 compiled
+    // from scratch would have.
+    FilteredRE2 scratch;
+    std::vector<std::string> want_atoms, got_atoms;
+    for (size_t i = 0; i < live.size(); i++)
+      if (live[i])
+        scratch.Add(v.f.GetRE2(static_cast<int>(i)).pattern(), v.opts, &id);
+    scratch.Compile(&want_atoms);
+    for (size_t i = 0; i < v.atoms.size(); i++)
+      if (!v.atoms[i].empty())
+        got_atoms.push_back(v.atoms[i]);
+    std::sort(want_atoms.begin(), want_atoms.end());
+    std::sort(got_atoms.begin(), got_atoms.end());
+    EXPECT_TRUE(want_atoms == got_atoms) << round;
+
+    for (size_t i = 0; i < arraysize(texts); i++) {
+      std::vector<int> want;
+      for (size_t j = 0; j < live.size(); j++)
+        if (live[j] && RE2::PartialMatch(texts[i], v.f.GetRE2(j)))
+          want.push_back(static_cast<int>(j));
+      v.f.AllMatches(texts[i], &v.matches);
+      EXPECT_TRUE(v.matches == want) << round << " " << texts[i];
+      EXPECT_EQ(want.empty() ? -1 : want[0], v.f.FirstMatch(texts[i]));
+      EXPECT_EQ(want.empty() ? -1 : want[0], v.f.SlowFirstMatch(texts[i]));
+
+      // The caller's own atom matching gives the same results.
+      std::vector<int> atoms;
+      for (size_t j = 0; j < v.atoms.size(); j++)
+        if (!v.atoms[j].empty() &&
+            std::string(texts[i]).find(v.atoms[j]) != std::string::npos)
+          atoms.push_back(static_cast<int>(j));
+      v.f.AllMatches(texts[i], atoms, &v.matches);
+      EXPECT_TRUE(v.matches == want) << round << " " << texts[i];
+    }
+  }
+  // Some of the atoms were dropped along the way.
+  EXPECT_GT(nremoved, 0);
+}
+
+// Finds every occurrence of each atom in text, which is lowercased first.
+static void FindAtomMatches(const std::vector<std::string>& atoms,
+                            const std::string& text,
+                            std::vector<FilteredRE2::AtomMatch>* matches,
+                            std::vector<int>* matched_atoms) {
+  std::string lower = text;
+  for (size_t i = 0; i < lower.size(); i++)
+    if ('A' <= lower[i] && lower[i] <= 'Z')
+      lower[i] += 'a' - 'A';
+  matches->clear();
+  matched_atoms->clear();
+  for (size_t i = 0; i < atoms.size(); i++) {
+    size_t pos = lower.find(atoms[i]);
+    if (pos != std::string::npos)
+      matched_atoms->push_back(static_cast<int>(i));
+    for (; pos != std::string::npos; pos = lower.find(atoms[i], pos + 1)) {
+      FilteredRE2::AtomMatch m = {static_cast<int>(i), pos,
+                                  pos + atoms[i].size()};
+      matches->push_back(m);
+    }
+  }
+}
+
+TEST(FilteredRE2Test, AtomPositions) {
+  FilterTestVars v;
+  const char* patterns[] = {
+    "foo.*bar",
+    "abc\\d{1,3}xyz",
+    "(?i)hello[ ,]+world",
+    "one.two.*three",
+    "(ab+c|xyz)qqq.*rrr",
+    "aaa.*aaa",
+  };
+  int id;
+  for (size_t i = 0; i < arraysize(patterns); i++)
+    v.f.Add(patterns[i], v.opts, &id);
+  v.f.Compile(&v.atoms);
+
+  struct {
+    const char* text;
+    int pruned;  // the regexp that positions rule out, or -1
+  } tests[] = {
+    { "foo and bar", -1 },
+    { "bar and foo", 0 },
+    { "foobar", -1 },
+    { "fobar foo", 0 },
+    { "abc12xyz", -1 },
+    { "abcxyz", 1 },
+    { "abc1234xyz", 1 },
+    { "abc1234xyz abc1xyz", -1 },
+    { "HELLO, WORLD", -1 },
+    { "world, hello", 2 },
+    { "helloworld", 2 },
+    { "one two three", -1 },
+    { "one     two three", 3 },
+    { "three one-two", 3 },
+    { "abbcqqq rrr", -1 },
+    { "rrr abcqqq", 4 },
+    { "aaaa", 5 },
+    { "aaaaaa", -1 },
+  };
+  std::vector<FilteredRE2::AtomMatch> matches;
+  std::vector<int> atoms;
+  std::vector<int> potentials;
+  for (size_t i = 0; i < arraysize(tests); i++) {
+    std::string text = tests[i].text;
+    FindAtomMatches(v.atoms, text, &matches, &atoms);
+    v.f.AllPotentials(atoms, &v.matches);
+    v.f.AllPotentialsGivenPositions(matches, &potentials);
+    for (size_t j = 0; j < arraysize(patterns); j++) {
+      bool before = std::binary_search(v.matches.begin(), v.matches.end(),
+                                       static_cast<int>(j));
+      bool after = std::binary_search(potentials.begin(), potentials.end(),
+                                      static_cast<int>(j));
+      // The positions rule out only the regexps that cannot match.
+      if (RE2::PartialMatch(text, v.f.GetRE2(static_cast<int>(j)))) {
+        EXPECT_TRUE(after) << text << " " << patterns[j];
+      }
+      if (static_cast<int>(j) == tests[i].pruned) {
+        EXPECT_TRUE(before && !after) << text << " " << patterns[j];
+      } else {
+        EXPECT_EQ(before, after) << text << " " << patterns[j];
+      }
+    }
+    v.f.AllMatches(text, atoms, &v.matches);
+    std::vector<int> all;
+    v.f.AllMatchesGivenPositions(text, matches, &all);
+    EXPECT_TRUE(all == v.matches);
+    EXPECT_EQ(v.f.FirstMatch(text, atoms),
+              v.f.FirstMatchGivenPositions(text, matches));
+  }
+
+  // The gaps survive serialization.
+  std::string data;
+  ASSERT_TRUE(v.f.Serialize(&data));
+  std::unique_ptr<FilteredRE2> copy(FilteredRE2::Deserialize(data, NULL));
+  ASSERT_TRUE(copy != NULL);
+  FindAtomMatches(v.atoms, "bar and foo", &matches, &atoms);
+  copy->AllPotentialsGivenPositions(matches, &potentials);
+  EXPECT_FALSE(std::binary_search(potentials.begin(), potentials.end(), 0));
+}
+
+TEST(FilteredRE2Test, FirstMatchByPriority) {
+  FilterTestVars v;
+  const char* patterns[] = {
+    "(abc|xyz).*(foo|bar)+\\d",  // 0
+    "xyz",                       // 1
+    "x[a-z]z",                   // 2
+    "route/\\w+/admin",          // 3
+    "route/",                    // 4
+  };
+  int id;
+  for (size_t i = 0; i < arraysize(patterns); i++)
+    v.f.Add(patterns[i], v.opts, &id);
+  EXPECT_TRUE(v.f.SetPriority(3, 2));
+  EXPECT_TRUE(v.f.SetPriority(4, 1));
+  EXPECT_FALSE(v.f.SetPriority(5, 1));
+  v.f.CompileWithAtomMatcher(&v.atoms, 1);
+
+  // Of the regexps of the same priority, the literal string is cheapest.
+  EXPECT_EQ(0, v.f.FirstMatch("xyz foo1"));
+  EXPECT_EQ(1, v.f.FirstMatchByPriority("xyz foo1"));
+  EXPECT_EQ(2, v.f.FirstMatchByPriority("xaz foo1"));
+  EXPECT_EQ(0, v.f.FirstMatchByPriority("abc foo1"));
+  // The higher priorities win, however costly.
+  EXPECT_EQ(3, v.f.FirstMatchByPriority("xyz route/users/admin"));
+  EXPECT_EQ(4, v.f.FirstMatchByPriority("xyz route/users"));
+  EXPECT_EQ(-1, v.f.FirstMatchByPriority("nothing"));
+
+  // The priorities survive serialization.
+  std::string data;
+  ASSERT_TRUE(v.f.Serialize(&data));
+  std::unique_ptr<FilteredRE2> copy(FilteredRE2::Deserialize(data, NULL));
+  ASSERT_TRUE(copy != NULL);
+  const char* texts[] = {
+    "xyz foo1",
+    "xaz foo1",
+    "xyz route/users/admin",
+    "xyz route/users",
+  };
+  for (size_t i = 0; i < arraysize(texts); i++)
+    EXPECT_EQ(v.f.FirstMatchByPriority(texts[i]),
+              copy->FirstMatchByPriority(texts[i]));
+}
+
 }  //  namespace re2
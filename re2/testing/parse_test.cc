@@ -251,6 +251,12 @@ void TestParse(const Test* tests, int ntests, Regexp::ParseFlags flags,
       EXPECT_EQ(std::string(tests[i].parse) == std::string(tests[j].parse),
                 RegexpEqualTestingOnly(re[i], re[j]))
         << "Regexp: " << tests[i].regexp << " " << tests[j].regexp;
+      // Compare must be a consistent ordering that agrees with Equal.
+      int c = Regexp::Compare(re[i], re[j]);
+      EXPECT_EQ(RegexpEqualTestingOnly(re[i], re[j]), c == 0)
+        << "Regexp: " << tests[i].regexp << " " << tests[j].regexp;
+      EXPECT_EQ(c < 0, Regexp::Compare(re[j], re[i]) > 0)
+        << "Regexp: " << tests[i].regexp << " " << tests[j].regexp;
     }
   }
 
@@ -10,7 +10,9 @@
 #include <stdint.h>
 #include <string.h>
 #include <map>
+#include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 #if !defined(_MSC_VER) && !defined(__CYGWIN__) && !defined(__MINGW32__)
@@ -1641,4 +1643,240 @@ TEST(RE2, Issue104) {
   ASSERT_EQ("小人小类小", s);
 }
 
+TEST(RE2, RequiredSuffix) {
+  // The required suffix check must not reject any text that matches.
+  RE2 jpg("\\w+\\.jpg$");
+  ASSERT_TRUE(RE2::PartialMatch("cat.jpg", jpg));
+  ASSERT_TRUE(RE2::PartialMatch("/a/b/cat.jpg", jpg));
+  ASSERT_FALSE(RE2::PartialMatch("cat.jpg.gz", jpg));
+  ASSERT_FALSE(RE2::PartialMatch("cat.png", jpg));
+  ASSERT_FALSE(RE2::PartialMatch("jpg", jpg));
+
+  RE2 charset("(?i);\\s*charset=utf-8");
+  ASSERT_TRUE(RE2::PartialMatch("text/html; Charset=UTF-8", charset));
+  ASSERT_TRUE(RE2::PartialMatch("text/html;CHARSET=utf-8; q=1", charset));
+  ASSERT_FALSE(RE2::PartialMatch("text/html; charset=utf-16", charset));
+
+  RE2 re("a+bc");
+  std::string s = "xxaabcxx";
+  StringPiece m;
+  ASSERT_TRUE(re.Match(s, 0, s.size(), RE2::UNANCHORED, &m, 1));
+  ASSERT_EQ(m, "aabc");
+  ASSERT_TRUE(re.Match(s, 2, 6, RE2::ANCHOR_BOTH, &m, 1));
+  ASSERT_EQ(m, "aabc");
+  ASSERT_FALSE(re.Match(s, 2, 7, RE2::ANCHOR_BOTH, &m, 1));
+  ASSERT_FALSE(re.Match(s, 2, 5, RE2::UNANCHORED, &m, 1));
+
+  // The suffix is checked for ANCHOR_START searches as well.
+  RE2 any_jpg("(.*)\\.jpg");
+  std::string path = "a/b/cat.jpg and more";
+  ASSERT_TRUE(any_jpg.Match(path, 0, path.size(), RE2::ANCHOR_START, &m, 1));
+  ASSERT_EQ(m, "a/b/cat.jpg");
+  ASSERT_FALSE(any_jpg.Match(path, 8, path.size(), RE2::ANCHOR_START, &m, 1));
+  StringPiece input(path), dir;
+  ASSERT_TRUE(RE2::Consume(&input, any_jpg, &dir));
+  ASSERT_EQ(dir, "a/b/cat");
+  ASSERT_FALSE(RE2::Consume(&input, any_jpg));
+  ASSERT_EQ(input, " and more");
+}
+
+TEST(RE2, RequiredLiterals) {
+  // The required literals check must not reject any text that matches.
+  RE2 re("(?:foo|bar)\\d+(?:x|y)*");
+  ASSERT_TRUE(RE2::PartialMatch("xx foo123", re));
+  ASSERT_TRUE(RE2::PartialMatch("xx bar1 yy", re));
+  ASSERT_FALSE(RE2::PartialMatch("xx baz123", re));
+  ASSERT_FALSE(RE2::PartialMatch("foo", re));
+
+  RE2 fold("(?i)hello\\s+\\w+");
+  ASSERT_TRUE(RE2::PartialMatch("Say HeLLo world", fold));
+  ASSERT_FALSE(RE2::PartialMatch("Say Hell o world", fold));
+
+  // U+212A (KELVIN SIGN) and U+017F (LATIN SMALL LETTER LONG S)
+  // lowercase to ASCII, so they must not confuse the check.
+  RE2 kelvin("(?i)k\\d+");
+  ASSERT_TRUE(RE2::PartialMatch("\xe2\x84\xaa" "42", kelvin));
+  RE2 long_s("(?i)ss\\d+");
+  ASSERT_TRUE(RE2::PartialMatch("\xc5\xbf" "S42", long_s));
+
+  RE2 latin1("(?i)caf\xe9" "\\d+", RE2::Latin1);
+  ASSERT_TRUE(RE2::PartialMatch("CAF\xe9" "12", latin1));
+  ASSERT_FALSE(RE2::PartialMatch("CAFE12", latin1));
+}
+
+TEST(RE2, Serialize) {
+  static const char* patterns[] = {
+    "",
+    "abc",
+    "^abc",
+    "(?i)hello, (\\w+)!",
+    "(?P<key>\\w+)=(?P<value>[^;]*)",
+    "\\w+\\.jpg$",
+    "(foo|bar)\\d+",
+    "\\p{L}+\\s\\p{N}{2,4}",
+    "a\\C*?c|a\\C*?b",
+    "caf\xc3\xa9",  // a prefix that ends with a byte >= 0x80
+  };
+  static const char* texts[] = {
+    "",
+    "abc",
+    "xxabcxx",
+    "Hello, World!",
+    "key=value; other=thing",
+    "/a/b/cat.jpg",
+    "xx bar123 foo4",
+    "\xce\xb1\xce\xb2 42",
+    "abcabc",
+    "un caf\xc3\xa9",
+  };
+  for (const char* pattern : patterns) {
+    for (int latin1 = 0; latin1 < 2; latin1++) {
+      RE2::Options opt;
+      if (latin1)
+        opt.set_encoding(RE2::Options::EncodingLatin1);
+      RE2 re(pattern, opt);
+      ASSERT_TRUE(re.ok()) << pattern;
+
+      std::string data;
+      ASSERT_TRUE(re.Serialize(&data)) << pattern;
+      std::unique_ptr<RE2> copy(RE2::Deserialize(data));
+      ASSERT_TRUE(copy != nullptr) << pattern;
+      ASSERT_TRUE(copy->ok()) << pattern;
+      ASSERT_TRUE(copy->Regexp() == NULL) << pattern;
+      ASSERT_EQ(re.pattern(), copy->pattern());
+      ASSERT_EQ(re.options().encoding(), copy->options().encoding());
+      ASSERT_EQ(re.NumberOfCapturingGroups(),
+                copy->NumberOfCapturingGroups());
+      ASSERT_EQ(re.NamedCapturingGroups(), copy->NamedCapturingGroups());
+      ASSERT_EQ(re.CapturingGroupNames(), copy->CapturingGroupNames());
+      ASSERT_EQ(re.ProgramSize(), copy->ProgramSize());
+      ASSERT_EQ(re.ReverseProgramSize(), copy->ReverseProgramSize());
+
+      std::string again;
+      ASSERT_TRUE(copy->Serialize(&again));
+      ASSERT_EQ(data, again) << pattern;
+
+      for (const char* text : texts) {
+        for (RE2::Anchor anchor : {RE2::UNANCHORED, RE2::ANCHOR_START,
+                                   RE2::ANCHOR_BOTH}) {
+          StringPiece want[4], got[4];
+          StringPiece t(text);
+          bool want_match = re.Match(t, 0, t.size(), anchor, want, 4);
+          bool got_match = copy->Match(t, 0, t.size(), anchor, got, 4);
+          ASSERT_EQ(want_match, got_match) << pattern << " " << text;
+          if (want_match) {
+            for (int i = 0; i < 4; i++)
+              ASSERT_TRUE(want[i] == got[i] && want[i].data() == got[i].data())
+                  << pattern << " " << text << " " << i;
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(RE2, SerializeHighBytePrefix) {
+  // The first and last bytes of the prefix are >= 0x80.
+  RE2::Options opt;
+  opt.set_encoding(RE2::Options::EncodingLatin1);
+  RE2 re("\xe9" "abc\xe9", opt);
+  ASSERT_TRUE(re.ok());
+  std::string data;
+  ASSERT_TRUE(re.Serialize(&data));
+  std::unique_ptr<RE2> copy(RE2::Deserialize(data));
+  ASSERT_TRUE(copy != nullptr);
+  ASSERT_TRUE(RE2::PartialMatch("x\xe9" "abc\xe9y", *copy));
+  ASSERT_FALSE(RE2::PartialMatch("x\xe9" "abcy", *copy));
+}
+
+TEST(RE2, SerializeErrors) {
+  RE2 bad("a(", RE2::Quiet);
+  std::string data;
+  ASSERT_FALSE(bad.Serialize(&data));
+  ASSERT_TRUE(data.empty());
+
+  RE2 re("(\\w+)@(\\w+)\\.com");
+  ASSERT_TRUE(re.Serialize(&data));
+  ASSERT_TRUE(RE2::Deserialize(StringPiece()) == NULL);
+  for (size_t n = 0; n < data.size(); n++)
+    ASSERT_TRUE(RE2::Deserialize(StringPiece(data.data(), n)) == NULL) << n;
+  ASSERT_TRUE(RE2::Deserialize(data + "x") == NULL);
+  std::string wrong_version = data;
+  wrong_version[4]++;
+  ASSERT_TRUE(RE2::Deserialize(wrong_version) == NULL);
+}
+
+TEST(RE2, ProgramCache) {
+  // The capacity is the total size of the cached programs.
+  const char* email = "(\\w+)@(\\w+)\\.com";
+  RE2::SetProgramCacheCapacity(RE2(email).ProgramSize() +
+                               RE2("b+").ProgramSize());
+
+  // RE2 objects that share a compiled form still have a Regexp each,
+  // because Regexp reference counting is not thread-safe.
+  RE2 a1(email);
+  RE2 a2(email);
+  ASSERT_TRUE(a1.ok());
+  ASSERT_TRUE(a2.ok());
+  ASSERT_NE(a1.Regexp(), a2.Regexp());
+  ASSERT_EQ(a1.Regexp()->ToString(), a2.Regexp()->ToString());
+  ASSERT_EQ(a1.ProgramSize(), a2.ProgramSize());
+  ASSERT_EQ(a1.ReverseProgramSize(), a2.ReverseProgramSize());
+  ASSERT_EQ(a1.NamedCapturingGroups(), a2.NamedCapturingGroups());
+  std::string user, host;
+  ASSERT_TRUE(RE2::PartialMatch("mail bob@example.com", a2, &user, &host));
+  ASSERT_EQ(user, "bob");
+  ASSERT_EQ(host, "example");
+
+  // So threads can walk the Regexps of RE2 objects that share a compiled
+  // form while others match against them.
+  std::vector<RE2*> res;
+  for (int i = 0; i < 4; i++)
+    res.push_back(new RE2("^(?:foo|bar)+\\d+"));
+  std::vector<std::thread> threads;
+  for (RE2* re : res) {
+    threads.emplace_back([re]() {
+      for (int j = 0; j < 100; j++) {
+        Regexp* sre = re->Regexp()->Simplify();
+        sre->Decref();
+        ASSERT_TRUE(RE2::PartialMatch("foobar42", *re));
+      }
+    });
+  }
+  for (std::thread& t : threads)
+    t.join();
+  for (RE2* re : res)
+    delete re;
+
+  // Different options mean a different compiled form.
+  RE2 a3(email, RE2::Latin1);
+  ASSERT_TRUE(RE2::PartialMatch("bob@example.com", a3));
+
+  // Errors are not cached.
+  RE2 bad1("a(", RE2::Quiet);
+  RE2 bad2("a(", RE2::Quiet);
+  ASSERT_FALSE(bad1.ok());
+  ASSERT_FALSE(bad2.ok());
+  ASSERT_EQ(bad1.error_code(), RE2::ErrorMissingParen);
+
+  // Evicted forms stay alive for as long as they are in use.
+  RE2 b("b+");
+  RE2 c("c+");
+  RE2 a4(email);
+  ASSERT_TRUE(RE2::PartialMatch("x@y.com", a1));
+  ASSERT_TRUE(RE2::PartialMatch("x@y.com", a4));
+  ASSERT_TRUE(RE2::FullMatch("bbb", b));
+  ASSERT_TRUE(RE2::FullMatch("ccc", c));
+
+  // A program larger than the capacity is never cached, but works.
+  RE2 big("\\p{L}{10}");
+  ASSERT_GT(big.ProgramSize(), a1.ProgramSize() + b.ProgramSize());
+  ASSERT_TRUE(RE2::FullMatch("abcdefghij", big));
+
+  // Disabling the cache empties it.
+  RE2::SetProgramCacheCapacity(0);
+  RE2 c2("c+");
+  ASSERT_TRUE(RE2::FullMatch("ccc", c2));
+}
+
 }  // namespace re2
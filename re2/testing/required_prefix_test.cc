@@ -123,6 +123,57 @@ TEST(RequiredPrefixForAccel, SimpleTests) {
   }
 }
 
+static PrefixTest suffix_tests[] = {
+  // Empty cases.
+  { "", false },
+  { "(?m)$", false },
+  { "(?-m)$", false },
+
+  // If the regexp ends with something not a literal match,
+  // there's no required suffix.
+  { "(abc)", false },
+  { "a*",  false },
+  { "abc(?m)$", false },
+  { "abc\\b", false },
+
+  // Otherwise, it should work.
+  { "abc", true, "abc", false, },
+  { "^abc$", true, "abc", false, },
+  { "\\.jpg$", true, ".jpg", false, },
+  { "\\.jpg\\z", true, ".jpg", false, },
+  { "(?i)abc", true, "abc", true, },
+  { "d*abc", true, "abc", false, },
+  { "d*[Aa][Bb]", true, "ab", true, },
+  { "d*[Cc]ab", true, "ab", false, },
+  { "x+☺abc$", true, "☺abc", false, },
+};
+
+TEST(RequiredSuffix, SimpleTests) {
+  for (size_t i = 0; i < arraysize(suffix_tests); i++) {
+    const PrefixTest& t = suffix_tests[i];
+    for (size_t j = 0; j < 2; j++) {
+      Regexp::ParseFlags flags = Regexp::LikePerl;
+      if (j == 0)
+        flags = flags | Regexp::Latin1;
+      Regexp* re = Regexp::Parse(t.regexp, flags, NULL);
+      ASSERT_TRUE(re != NULL) << " " << t.regexp;
+
+      std::string p;
+      bool f;
+      ASSERT_EQ(t.return_value, re->RequiredSuffix(&p, &f))
+        << " " << t.regexp << " " << (j == 0 ? "latin1" : "utf8")
+        << " " << re->Dump();
+      if (t.return_value) {
+        ASSERT_EQ(p, std::string(t.prefix))
+          << " " << t.regexp << " " << (j == 0 ? "latin1" : "utf8");
+        ASSERT_EQ(f, t.foldcase)
+          << " " << t.regexp << " " << (j == 0 ? "latin1" : "utf8");
+      }
+      re->Decref();
+    }
+  }
+}
+
 TEST(PrefixAccel, BasicTest) {
   Regexp* re = Regexp::Parse("abc\\d+", Regexp::LikePerl, NULL);
   ASSERT_TRUE(re != NULL);
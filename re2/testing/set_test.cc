@@ -3,7 +3,10 @@
 // license that can be found in the LICENSE file.
 
 #include <stddef.h>
+#include <algorithm>
+#include <functional>
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 
@@ -14,6 +17,8 @@
 
 namespace re2 {
 
+static int dfa_search_failures = 0;
+
 TEST(Set, Unanchored) {
   RE2::Set s(RE2::DefaultOptions, RE2::UNANCHORED);
 
@@ -227,4 +232,574 @@ TEST(Set, MoveSemantics) {
   ASSERT_EQ(s1.Match("abc bar2 xyz", NULL), false);
 }
 
+TEST(Set, Shards) {
+  // These don't fit in one program within max_mem,
+  // so the set has to be split into several.
+  RE2::Options options;
+  options.set_max_mem(1<<16);
+  options.set_log_errors(false);
+  for (RE2::Anchor anchor : {RE2::UNANCHORED, RE2::ANCHOR_START}) {
+    RE2::Set s(options, anchor);
+    for (int i = 0; i < 1000; i++) {
+      std::string pattern = "pattern" + std::to_string(i*7919) + "x";
+      ASSERT_EQ(s.Add(pattern, NULL), i);
+    }
+    ASSERT_EQ(s.Compile(), true);
+
+    std::vector<int> v;
+    ASSERT_EQ(s.Match("pattern0x pattern7919x pattern7911081x", &v),
+              true);
+    std::sort(v.begin(), v.end());
+    if (anchor == RE2::UNANCHORED) {
+      ASSERT_EQ(v.size(), 3);
+      ASSERT_EQ(v[0], 0);
+      ASSERT_EQ(v[1], 1);
+      ASSERT_EQ(v[2], 999);
+    } else {
+      ASSERT_EQ(v.size(), 1);
+      ASSERT_EQ(v[0], 0);
+    }
+    ASSERT_EQ(s.Match("pattern7911081x", NULL), true);
+    ASSERT_EQ(s.Match("pattern7911081", NULL), false);
+    ASSERT_EQ(s.Match("pattern7911081", &v), false);
+    ASSERT_EQ(v.size(), 0);
+  }
+}
+
+static std::string FormatPositions(const StringPiece& text,
+                                   std::vector<RE2::Set::MatchPosition> v) {
+  std::sort(v.begin(), v.end(),
+            [](const RE2::Set::MatchPosition& a,
+               const RE2::Set::MatchPosition& b) -> bool {
+              return a.index < b.index;
+            });
+  std::string s;
+  for (const RE2::Set::MatchPosition& m : v) {
+    if (!s.empty())
+      s += " ";
+    s += std::to_string(m.index) + ":[" +
+         std::to_string(m.match.begin() - text.begin()) + "," +
+         std::to_string(m.match.end() - text.begin()) + ")";
+  }
+  return s;
+}
+
+TEST(Set, MatchPositions) {
+  RE2::Set s(RE2::DefaultOptions, RE2::UNANCHORED);
+  ASSERT_EQ(s.Add("foo", NULL), 0);
+  ASSERT_EQ(s.Add("o+", NULL), 1);
+  ASSERT_EQ(s.Add("bar$", NULL), 2);
+  ASSERT_EQ(s.Add("x*", NULL), 3);
+  ASSERT_EQ(s.Add(".o+b", NULL), 4);
+  ASSERT_EQ(s.Add("\\bb", NULL), 5);
+  ASSERT_EQ(s.Add("zzz", NULL), 6);
+  ASSERT_EQ(s.Compile(), true);
+
+  StringPiece text = "xfooobar";
+  std::vector<RE2::Set::MatchPosition> v;
+  ASSERT_EQ(s.MatchPositions(text, &v), true);
+  ASSERT_EQ(FormatPositions(text, v),
+            "0:[1,4) 1:[2,3) 2:[5,8) 3:[0,0) 4:[1,6)");
+  ASSERT_EQ(s.MatchPositions(text, NULL), true);
+
+  text = "zzzz";
+  ASSERT_EQ(s.MatchPositions(text, &v), true);
+  ASSERT_EQ(FormatPositions(text, v), "3:[0,0) 6:[0,3)");
+
+  RE2::Set a(RE2::DefaultOptions, RE2::ANCHOR_START);
+  ASSERT_EQ(a.Add("xf", NULL), 0);
+  ASSERT_EQ(a.Add("x.*o", NULL), 1);
+  ASSERT_EQ(a.Add("foo", NULL), 2);
+  ASSERT_EQ(a.Compile(), true);
+
+  text = "xfooobar";
+  ASSERT_EQ(a.MatchPositions(text, &v), true);
+  ASSERT_EQ(FormatPositions(text, v), "0:[0,2) 1:[0,3)");
+  ASSERT_EQ(a.MatchPositions("fooo", &v), true);
+  ASSERT_EQ(v.size(), 1);
+  ASSERT_EQ(v[0].index, 2);
+  ASSERT_EQ(a.MatchPositions("bar", &v), false);
+  ASSERT_EQ(v.size(), 0);
+
+  RE2::Set b(RE2::DefaultOptions, RE2::ANCHOR_BOTH);
+  ASSERT_EQ(b.Add("x.*r", NULL), 0);
+  ASSERT_EQ(b.Add("x.*o", NULL), 1);
+  ASSERT_EQ(b.Compile(), true);
+
+  ASSERT_EQ(b.MatchPositions(text, &v), true);
+  ASSERT_EQ(FormatPositions(text, v), "0:[0,8)");
+}
+
+TEST(Set, DFAOutOfMemory) {
+  // The DFA for these has exponentially many states, so with a small
+  // memory budget, it runs out of memory and Match() must fall back.
+  hooks::SetDFASearchFailureHook([](const hooks::DFASearchFailure&) {
+    ++dfa_search_failures;
+  });
+
+  RE2::Options small;
+  small.set_max_mem(1<<18);
+  small.set_log_errors(false);
+  RE2::Set s(small, RE2::UNANCHORED);
+  RE2::Set big(RE2::DefaultOptions, RE2::UNANCHORED);
+  for (int i = 0; i < 40; i++) {
+    std::string pattern = "a[ab]{" + std::to_string(20+i) + "}c";
+    ASSERT_EQ(s.Add(pattern, NULL), i);
+    ASSERT_EQ(big.Add(pattern, NULL), i);
+  }
+  ASSERT_EQ(s.Add("^b", NULL), 40);
+  ASSERT_EQ(big.Add("^b", NULL), 40);
+  ASSERT_EQ(s.Add("d$", NULL), 41);
+  ASSERT_EQ(big.Add("d$", NULL), 41);
+  ASSERT_EQ(s.Compile(), true);
+  ASSERT_EQ(big.Compile(), true);
+
+  std::string text;
+  uint32_t x = 1;
+  for (int i = 0; i < 5000; i++) {
+    x = x*1103515245 + 12345;
+    text += "ab"[(x>>16)&1];
+  }
+  text = "b" + text + "a" + std::string(20, 'b') + "c";
+
+  dfa_search_failures = 0;
+  std::vector<int> v;
+  RE2::Set::ErrorInfo info;
+  ASSERT_EQ(s.Match(text, &v, &info), true);
+  ASSERT_EQ(info.kind, RE2::Set::kNoError);
+  ASSERT_GT(dfa_search_failures, 0);
+
+  std::vector<int> want;
+  ASSERT_EQ(big.Match(text, &want), true);
+  std::sort(v.begin(), v.end());
+  std::sort(want.begin(), want.end());
+  ASSERT_EQ(v, want);
+  ASSERT_EQ(v[0], 0);
+  ASSERT_EQ(v.back(), 40);
+
+  // Early exit when the caller doesn't need the indices.
+  ASSERT_EQ(s.Match(text, NULL), true);
+  ASSERT_EQ(s.Match(text + "d", &v), true);
+  std::sort(v.begin(), v.end());
+  ASSERT_EQ(v.back(), 41);
+  ASSERT_EQ(s.Match(std::string(5000, 'a'), &v), false);
+  ASSERT_EQ(v.size(), 0);
+
+  hooks::SetDFASearchFailureHook([](const hooks::DFASearchFailure&) {});
+}
+
+TEST(Set, EarlyExit) {
+  RE2::Set s(RE2::DefaultOptions, RE2::UNANCHORED);
+  ASSERT_EQ(s.Add("foo", NULL), 0);
+  ASSERT_EQ(s.Add("bar", NULL), 1);
+  ASSERT_EQ(s.Add("baz", NULL), 2);
+  ASSERT_EQ(s.Add("qux", NULL), 3);
+  ASSERT_EQ(s.Compile(), true);
+
+  std::string text = "bar baz bar foo qux";
+  std::vector<int> v;
+  RE2::Set::EarlyExit early_exit;
+  ASSERT_EQ(s.Match(text, &v, early_exit, NULL), true);
+  ASSERT_EQ(v.size(), 4);
+
+  early_exit.max_matches = 1;
+  ASSERT_EQ(s.Match(text, &v, early_exit, NULL), true);
+  ASSERT_EQ(v.size(), 1);
+  ASSERT_EQ(v[0], 1);
+
+  early_exit.max_matches = 2;
+  ASSERT_EQ(s.Match(text, &v, early_exit, NULL), true);
+  std::sort(v.begin(), v.end());
+  ASSERT_EQ(v.size(), 2);
+  ASSERT_EQ(v[0], 1);
+  ASSERT_EQ(v[1], 2);
+
+  early_exit.max_matches = 0;
+  early_exit.priority_limit = 1;
+  ASSERT_EQ(s.Match(text, &v, early_exit, NULL), true);
+  std::sort(v.begin(), v.end());
+  ASSERT_EQ(v.size(), 3);
+  ASSERT_EQ(v[0], 0);
+  ASSERT_EQ(v[2], 2);
+
+  // Without a match in the priority class, all of text is read.
+  ASSERT_EQ(s.Match("qux bar", &v, early_exit, NULL), true);
+  ASSERT_EQ(v.size(), 2);
+  ASSERT_EQ(s.Match("xyzzy", &v, early_exit, NULL), false);
+  ASSERT_EQ(v.size(), 0);
+}
+
+TEST(Set, EarlyExitNFA) {
+  // As in DFAOutOfMemory, the DFA runs out of memory,
+  // so the NFA has to honour the EarlyExit too.
+  hooks::SetDFASearchFailureHook([](const hooks::DFASearchFailure&) {
+    ++dfa_search_failures;
+  });
+
+  RE2::Options small;
+  small.set_max_mem(1<<18);
+  small.set_log_errors(false);
+  RE2::Set s(small, RE2::UNANCHORED);
+  for (int i = 0; i < 40; i++) {
+    std::string pattern = "a[ab]{" + std::to_string(20+i) + "}c";
+    ASSERT_EQ(s.Add(pattern, NULL), i);
+  }
+  ASSERT_EQ(s.Add("d", NULL), 40);
+  ASSERT_EQ(s.Add("e", NULL), 41);
+  ASSERT_EQ(s.Compile(), true);
+
+  std::string text;
+  uint32_t x = 1;
+  for (int i = 0; i < 5000; i++) {
+    x = x*1103515245 + 12345;
+    text += "ab"[(x>>16)&1];
+  }
+  text += "de";
+
+  dfa_search_failures = 0;
+  std::vector<int> v;
+  RE2::Set::EarlyExit early_exit;
+  early_exit.max_matches = 1;
+  ASSERT_EQ(s.Match(text, &v, early_exit, NULL), true);
+  ASSERT_GT(dfa_search_failures, 0);
+  ASSERT_EQ(v.size(), 1);
+  ASSERT_EQ(v[0], 40);
+
+  early_exit.max_matches = 0;
+  early_exit.priority_limit = 42;
+  ASSERT_EQ(s.Match(text, &v, early_exit, NULL), true);
+  ASSERT_EQ(v.size(), 1);
+  ASSERT_EQ(v[0], 40);
+
+  hooks::SetDFASearchFailureHook([](const hooks::DFASearchFailure&) {});
+}
+
+TEST(Set, Matches) {
+  RE2::Set s(RE2::DefaultOptions, RE2::UNANCHORED);
+  ASSERT_EQ(s.Add("foo", NULL), 0);
+  ASSERT_EQ(s.Add("bar", NULL), 1);
+  ASSERT_EQ(s.Add("baz", NULL), 2);
+  ASSERT_EQ(s.Compile(), true);
+
+  RE2::Set::Matches m;
+  ASSERT_EQ(m.size(), 0);
+  ASSERT_EQ(m.contains(0), false);
+
+  RE2::Set::EarlyExit early_exit;
+  ASSERT_EQ(s.Match("foobar", &m, early_exit, NULL), true);
+  ASSERT_EQ(m.size(), 2);
+  ASSERT_EQ(m.contains(0), true);
+  ASSERT_EQ(m.contains(1), true);
+  ASSERT_EQ(m.contains(2), false);
+  std::vector<int> v(m.begin(), m.end());
+  std::sort(v.begin(), v.end());
+  ASSERT_EQ(v.size(), 2);
+  ASSERT_EQ(v[0], 0);
+  ASSERT_EQ(v[1], 1);
+
+  // The results of the previous call are discarded.
+  ASSERT_EQ(s.Match("baz", &m, early_exit, NULL), true);
+  ASSERT_EQ(m.size(), 1);
+  ASSERT_EQ(*m.begin(), 2);
+  ASSERT_EQ(s.Match("qux", &m, early_exit, NULL), false);
+  ASSERT_EQ(m.empty(), true);
+
+  // The same Matches can be used with a bigger set.
+  RE2::Set big(RE2::DefaultOptions, RE2::UNANCHORED);
+  for (int i = 0; i < 100; i++)
+    ASSERT_EQ(big.Add("x" + std::to_string(i) + "y", NULL), i);
+  ASSERT_EQ(big.Compile(), true);
+  ASSERT_EQ(big.Match("x99y x7y", &m, early_exit, NULL), true);
+  ASSERT_EQ(m.size(), 2);
+  ASSERT_EQ(m.contains(7), true);
+  ASSERT_EQ(m.contains(99), true);
+  ASSERT_EQ(m.contains(100), false);
+}
+
+TEST(Set, Incremental) {
+  RE2::Set s(RE2::DefaultOptions, RE2::UNANCHORED);
+  ASSERT_EQ(s.Add("foo", NULL), 0);
+  ASSERT_EQ(s.Add("bar", NULL), 1);
+  ASSERT_EQ(s.Compile(), true);
+
+  std::vector<int> v;
+  ASSERT_EQ(s.Match("foobaz", &v), true);
+  ASSERT_EQ(v.size(), 1);
+  ASSERT_EQ(v[0], 0);
+
+  // New regexps are matched only once compiled.
+  ASSERT_EQ(s.Add("baz", NULL), 2);
+  ASSERT_EQ(s.Match("baz", &v), false);
+  ASSERT_EQ(s.Compile(), true);
+  ASSERT_EQ(s.Match("foobaz", &v), true);
+  std::sort(v.begin(), v.end());
+  ASSERT_EQ(v.size(), 2);
+  ASSERT_EQ(v[0], 0);
+  ASSERT_EQ(v[1], 2);
+
+  ASSERT_EQ(s.Remove(1), true);
+  ASSERT_EQ(s.Remove(1), false);
+  ASSERT_EQ(s.Remove(3), false);
+  ASSERT_EQ(s.Remove(-1), false);
+  ASSERT_EQ(s.Match("bar", &v), false);
+  ASSERT_EQ(v.size(), 0);
+  ASSERT_EQ(s.Match("bar", NULL), false);
+  ASSERT_EQ(s.Match("barbaz", NULL), true);
+
+  // With removed regexps to filter out, the EarlyExit doesn't apply.
+  RE2::Set::EarlyExit early_exit;
+  early_exit.max_matches = 1;
+  ASSERT_EQ(s.Match("bar baz foo", &v, early_exit, NULL), true);
+  std::sort(v.begin(), v.end());
+  ASSERT_EQ(v.size(), 2);
+  ASSERT_EQ(v[0], 0);
+  ASSERT_EQ(v[1], 2);
+
+  std::vector<RE2::Set::MatchPosition> pos;
+  ASSERT_EQ(s.MatchPositions("bar", &pos), false);
+  ASSERT_EQ(s.MatchPositions("bar baz", &pos), true);
+  ASSERT_EQ(pos.size(), 1);
+  ASSERT_EQ(pos[0].index, 2);
+
+  // Regexps added but not yet compiled are merged too,
+  // and removing them before compiling them is fine.
+  ASSERT_EQ(s.Add("qux", NULL), 3);
+  ASSERT_EQ(s.Add("quux", NULL), 4);
+  ASSERT_EQ(s.Remove(4), true);
+  ASSERT_EQ(s.Merge(), true);
+  ASSERT_EQ(s.Match("foo bar baz qux quux", &v), true);
+  std::sort(v.begin(), v.end());
+  ASSERT_EQ(v.size(), 3);
+  ASSERT_EQ(v[0], 0);
+  ASSERT_EQ(v[1], 2);
+  ASSERT_EQ(v[2], 3);
+
+  ASSERT_EQ(s.Remove(0), true);
+  ASSERT_EQ(s.Remove(2), true);
+  ASSERT_EQ(s.Remove(3), true);
+  ASSERT_EQ(s.Match("foo bar baz qux quux", &v), false);
+  ASSERT_EQ(s.Merge(), true);
+  ASSERT_EQ(s.Match("foo bar baz qux quux", &v), false);
+  ASSERT_EQ(s.Add("foo", NULL), 5);
+  ASSERT_EQ(s.Compile(), true);
+  ASSERT_EQ(s.Match("foo", &v), true);
+  ASSERT_EQ(v.size(), 1);
+  ASSERT_EQ(v[0], 5);
+}
+
+TEST(Set, PerRegexpOptions) {
+  RE2::Set s(RE2::DefaultOptions, RE2::UNANCHORED);
+  RE2::Options fold;
+  fold.set_case_sensitive(false);
+  RE2::Options literal;
+  literal.set_literal(true);
+  ASSERT_EQ(s.Add("foo", NULL), 0);
+  ASSERT_EQ(s.Add("foo", fold, RE2::UNANCHORED, NULL), 1);
+  ASSERT_EQ(s.Add("foobar", fold, RE2::ANCHOR_START, NULL), 2);
+  ASSERT_EQ(s.Add("bar", RE2::DefaultOptions, RE2::ANCHOR_BOTH, NULL), 3);
+  ASSERT_EQ(s.Add("a.c", literal, RE2::UNANCHORED, NULL), 4);
+  ASSERT_EQ(s.Add("a.c", literal, RE2::ANCHOR_BOTH, NULL), 5);
+
+  RE2::Options latin1;
+  latin1.set_encoding(RE2::Options::EncodingLatin1);
+  latin1.set_log_errors(false);
+  std::string error;
+  ASSERT_EQ(s.Add("x", latin1, RE2::UNANCHORED, &error), -1);
+  ASSERT_EQ(error, "encoding differs from that of the set");
+  ASSERT_EQ(s.Compile(), true);
+
+  std::vector<int> v;
+  ASSERT_EQ(s.Match("FOObar", &v), true);
+  std::sort(v.begin(), v.end());
+  ASSERT_EQ(v.size(), 2);
+  ASSERT_EQ(v[0], 1);
+  ASSERT_EQ(v[1], 2);
+
+  ASSERT_EQ(s.Match("xfoobar", &v), true);
+  std::sort(v.begin(), v.end());
+  ASSERT_EQ(v.size(), 2);
+  ASSERT_EQ(v[0], 0);
+  ASSERT_EQ(v[1], 1);
+
+  ASSERT_EQ(s.Match("bar", &v), true);
+  ASSERT_EQ(v.size(), 1);
+  ASSERT_EQ(v[0], 3);
+  ASSERT_EQ(s.Match("bar ", &v), false);
+
+  ASSERT_EQ(s.Match("abc", &v), false);
+  ASSERT_EQ(s.Match("xa.c", &v), true);
+  ASSERT_EQ(v.size(), 1);
+  ASSERT_EQ(v[0], 4);
+  ASSERT_EQ(s.Match("a.c", &v), true);
+  ASSERT_EQ(v.size(), 2);
+
+  // Sharding and merging parse the regexps again with their own options.
+  ASSERT_EQ(s.Merge(), true);
+  ASSERT_EQ(s.Match("FOObar", &v), true);
+  ASSERT_EQ(v.size(), 2);
+  ASSERT_EQ(s.Match("bar ", &v), false);
+}
+
+TEST(Set, AddAll) {
+  std::vector<std::string> patterns;
+  for (int i = 0; i < 100; i++) {
+    if (i % 30 == 3)
+      patterns.push_back("(" + std::to_string(i));
+    else
+      patterns.push_back("a" + std::to_string(i) + "b");
+  }
+
+  RE2::Options options;
+  options.set_log_errors(false);
+  RE2::Set s(options, RE2::UNANCHORED);
+  ASSERT_EQ(s.Add("first", NULL), 0);
+  std::vector<int> indices;
+  std::vector<std::string> errors;
+  ASSERT_EQ(s.AddAll(patterns, 4, &indices, &errors), 96);
+  ASSERT_EQ(indices.size(), 100);
+  ASSERT_EQ(errors.size(), 100);
+  ASSERT_EQ(indices[0], 1);
+  ASSERT_EQ(indices[3], -1);
+  ASSERT_EQ(errors[3], "missing ): (3");
+  ASSERT_EQ(indices[4], 4);
+  ASSERT_EQ(errors[4], "");
+  ASSERT_EQ(indices[99], 96);
+  ASSERT_EQ(s.Add("last", NULL), 97);
+  ASSERT_EQ(s.Compile(), true);
+
+  std::vector<int> v;
+  ASSERT_EQ(s.Match("first a4b a99b last", &v), true);
+  std::sort(v.begin(), v.end());
+  ASSERT_EQ(v.size(), 4);
+  ASSERT_EQ(v[0], 0);
+  ASSERT_EQ(v[1], 4);
+  ASSERT_EQ(v[2], 96);
+  ASSERT_EQ(v[3], 97);
+  ASSERT_EQ(s.Match("a3b", &v), false);
+}
+
+TEST(Set, Duplicates) {
+  // Regexps that are the same apart from their spelling are compiled
+  // once, but each of them must still be reported.
+  for (RE2::Anchor anchor : {RE2::UNANCHORED, RE2::ANCHOR_BOTH}) {
+    RE2::Set s(RE2::DefaultOptions, anchor);
+    ASSERT_EQ(s.Add("https?://[^/]+/api/", NULL), 0);
+    ASSERT_EQ(s.Add("ftp", NULL), 1);
+    ASSERT_EQ(s.Add("https?://[^/]+/api/", NULL), 2);
+    ASSERT_EQ(s.Add("(?:http)s?://[^/]+/ap[i]/", NULL), 3);
+    ASSERT_EQ(s.Add("https?://[^/]+/api/v1", NULL), 4);
+    ASSERT_EQ(s.Add("https?://[^/]+/api/", RE2::DefaultOptions,
+                    RE2::ANCHOR_START, NULL), 5);
+    ASSERT_EQ(s.Compile(), true);
+
+    std::vector<int> v;
+    ASSERT_EQ(s.Match("https://example.com/api/", &v), true);
+    std::sort(v.begin(), v.end());
+    ASSERT_EQ(v.size(), 4);
+    ASSERT_EQ(v[0], 0);
+    ASSERT_EQ(v[1], 2);
+    ASSERT_EQ(v[2], 3);
+    ASSERT_EQ(v[3], 5);
+
+    if (anchor == RE2::UNANCHORED) {
+      std::vector<RE2::Set::MatchPosition> pos;
+      ASSERT_EQ(s.MatchPositions("x http://a/api/v1", &pos), true);
+      ASSERT_EQ(pos.size(), 4);
+      std::sort(pos.begin(), pos.end(),
+                [](const RE2::Set::MatchPosition& a,
+                   const RE2::Set::MatchPosition& b) -> bool {
+                  return a.index < b.index;
+                });
+      ASSERT_EQ(pos[0].index, 0);
+      ASSERT_EQ(pos[0].match, "http://a/api/");
+      ASSERT_EQ(pos[1].index, 2);
+      ASSERT_EQ(pos[1].match, "http://a/api/");
+      ASSERT_EQ(pos[2].index, 3);
+      ASSERT_EQ(pos[2].match, "http://a/api/");
+      ASSERT_EQ(pos[3].index, 4);
+      ASSERT_EQ(pos[3].match, "http://a/api/v1");
+    }
+
+    ASSERT_EQ(s.Remove(0), true);
+    ASSERT_EQ(s.Merge(), true);
+    ASSERT_EQ(s.Match("https://example.com/api/", &v), true);
+    std::sort(v.begin(), v.end());
+    ASSERT_EQ(v.size(), 3);
+    ASSERT_EQ(v[0], 2);
+  }
+}
+
+TEST(Set, ParallelMatch) {
+  // Many of the matches span chunk boundaries, so they are found only
+  // by carrying the threads across the boundaries.
+  RE2::Set s(RE2::DefaultOptions, RE2::UNANCHORED);
+  const char* patterns[] = {
+    "a[ab]{10}c",
+    "(?m)^ba+b$",
+    "\\bab\\b",
+    "c\\s*a",
+    "(?s)a.{30}c",
+    "(?:ab){3,}c",
+    "ba\\z",
+    "\\Aab",
+    "\n\n",
+    "x",
+  };
+  for (size_t i = 0; i < arraysize(patterns); i++)
+    ASSERT_EQ(s.Add(patterns[i], NULL), static_cast<int>(i));
+  ASSERT_EQ(s.Compile(), true);
+
+  // An executor that runs each function on a thread of its own.
+  RE2::Set::Executor executor = [](std::function<void()> fn) {
+    std::thread(fn).detach();
+  };
+
+  uint32_t x = 1;
+  for (int n = 0; n < 50; n++) {
+    std::string text;
+    for (int i = 0; i < 300; i++) {
+      x = x*1103515245 + 12345;
+      text += "abab \ncb"[(x>>16)&7];
+    }
+    std::vector<int> want;
+    s.Match(text, &want);
+    std::sort(want.begin(), want.end());
+    for (int num_chunks = 1; num_chunks <= 17; num_chunks += 4) {
+      std::vector<int> v;
+      ASSERT_EQ(s.ParallelMatch(text, &v, num_chunks, executor),
+                !want.empty());
+      std::sort(v.begin(), v.end());
+      ASSERT_TRUE(v == want);
+      ASSERT_EQ(s.ParallelMatch(text, &v, num_chunks, nullptr),
+                !want.empty());
+      std::sort(v.begin(), v.end());
+      ASSERT_TRUE(v == want);
+    }
+  }
+}
+
+TEST(Set, ParallelMatchPrefixAccel) {
+  // The literal has a prefix that the DFA could skip to, but the chunk
+  // boundary cuts it in two.
+  RE2::Set s(RE2::DefaultOptions, RE2::UNANCHORED);
+  ASSERT_EQ(s.Add("hello", NULL), 0);
+  ASSERT_EQ(s.Compile(), true);
+  std::string text(1000, 'x');
+  text.replace(498, 5, "hello");
+  std::vector<int> v;
+  ASSERT_EQ(s.ParallelMatch(text, &v, 2, nullptr), true);
+  ASSERT_EQ(v.size(), 1);
+  ASSERT_EQ(v[0], 0);
+
+  RE2::Set t(RE2::DefaultOptions, RE2::UNANCHORED);
+  ASSERT_EQ(t.Add("Ab", NULL), 0);
+  ASSERT_EQ(t.Compile(), true);
+  ASSERT_EQ(t.ParallelMatch("cAA A  AAb\nAA A", &v, 5, nullptr), true);
+  ASSERT_EQ(v.size(), 1);
+
+  // A negative number of chunks means just one.
+  ASSERT_EQ(s.ParallelMatch(text, &v, -1, nullptr), true);
+  ASSERT_EQ(v.size(), 1);
+}
+
 }  // namespace re2
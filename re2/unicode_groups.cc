@@ -6263,6 +6263,5597 @@ const UGroup unicode_groups[] = {
 };
 const int num_unicode_groups = 192;
 
+static const uint16_t Adlam_forward_state[] = {
+	0, 1, 2, 4, 7, 8,
+};
+static const UTF8Range Adlam_forward_range[] = {
+	{ 240, 240, 1 }, { 158, 158, 2 }, { 164, 164, 4 }, { 165, 165, 3 }, { 128, 139, 0 }, { 144, 153, 0 },
+	{ 158, 159, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Adlam_reverse_state[] = {
+	0, 4, 5, 6, 7, 8,
+};
+static const UTF8Range Adlam_reverse_range[] = {
+	{ 128, 139, 2 }, { 128, 191, 1 }, { 144, 153, 2 }, { 158, 159, 2 }, { 164, 164, 3 }, { 165, 165, 3 },
+	{ 158, 158, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Ahom_forward_state[] = {
+	0, 1, 2, 3, 6,
+};
+static const UTF8Range Ahom_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 156, 156, 3 }, { 128, 154, 0 }, { 157, 171, 0 }, { 176, 191, 0 },
+};
+static const uint16_t Ahom_reverse_state[] = {
+	0, 3, 4, 5, 6,
+};
+static const UTF8Range Ahom_reverse_range[] = {
+	{ 128, 154, 1 }, { 157, 171, 1 }, { 176, 191, 1 }, { 156, 156, 2 }, { 145, 145, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Anatolian_Hieroglyphs_forward_state[] = {
+	0, 1, 2, 4, 5, 6,
+};
+static const UTF8Range Anatolian_Hieroglyphs_forward_range[] = {
+	{ 240, 240, 1 }, { 148, 148, 2 }, { 144, 152, 4 }, { 153, 153, 3 }, { 128, 134, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Anatolian_Hieroglyphs_reverse_state[] = {
+	0, 2, 3, 4, 5, 6,
+};
+static const UTF8Range Anatolian_Hieroglyphs_reverse_range[] = {
+	{ 128, 134, 2 }, { 128, 191, 1 }, { 144, 152, 3 }, { 153, 153, 3 }, { 148, 148, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Arabic_forward_state[] = {
+	0, 8, 10, 14, 15, 20, 39, 48, 49, 50, 61, 62,
+	64, 66, 68, 69, 71, 73, 76, 78, 79, 81, 82, 85,
+	91,
+};
+static const UTF8Range Arabic_forward_range[] = {
+	{ 216, 216, 23 }, { 217, 217, 22 }, { 218, 218, 21 }, { 219, 219, 20 }, { 221, 221, 19 }, { 224, 224, 16 },
+	{ 239, 239, 9 }, { 240, 240, 1 }, { 144, 144, 7 }, { 158, 158, 2 }, { 184, 184, 6 }, { 185, 185, 5 },
+	{ 186, 186, 4 }, { 187, 187, 3 }, { 176, 177, 0 }, { 128, 137, 0 }, { 139, 155, 0 }, { 161, 163, 0 },
+	{ 165, 169, 0 }, { 171, 187, 0 }, { 130, 130, 0 }, { 135, 135, 0 }, { 137, 137, 0 }, { 139, 139, 0 },
+	{ 141, 143, 0 }, { 145, 146, 0 }, { 148, 148, 0 }, { 151, 151, 0 }, { 153, 153, 0 }, { 155, 155, 0 },
+	{ 157, 157, 0 }, { 159, 159, 0 }, { 161, 162, 0 }, { 164, 164, 0 }, { 167, 170, 0 }, { 172, 178, 0 },
+	{ 180, 183, 0 }, { 185, 188, 0 }, { 190, 190, 0 }, { 128, 131, 0 }, { 133, 159, 0 }, { 161, 162, 0 },
+	{ 164, 164, 0 }, { 167, 167, 0 }, { 169, 178, 0 }, { 180, 183, 0 }, { 185, 185, 0 }, { 187, 187, 0 },
+	{ 185, 185, 8 }, { 160, 190, 0 }, { 173, 173, 19 }, { 174, 174, 21 }, { 175, 175, 15 }, { 176, 179, 21 },
+	{ 180, 180, 14 }, { 181, 181, 19 }, { 182, 182, 13 }, { 183, 183, 12 }, { 185, 185, 11 }, { 186, 186, 21 },
+	{ 187, 187, 10 }, { 128, 188, 0 }, { 176, 180, 0 }, { 182, 191, 0 }, { 128, 135, 0 }, { 176, 189, 0 },
+	{ 128, 143, 0 }, { 146, 191, 0 }, { 128, 189, 0 }, { 128, 129, 0 }, { 147, 191, 0 }, { 162, 162, 18 },
+	{ 163, 163, 17 }, { 128, 135, 0 }, { 147, 161, 0 }, { 163, 191, 0 }, { 160, 180, 0 }, { 182, 191, 0 },
+	{ 144, 191, 0 }, { 128, 156, 0 }, { 158, 191, 0 }, { 128, 191, 0 }, { 129, 138, 0 }, { 150, 175, 0 },
+	{ 177, 191, 0 }, { 128, 132, 0 }, { 134, 139, 0 }, { 141, 154, 0 }, { 156, 156, 0 }, { 158, 158, 0 },
+	{ 160, 191, 0 },
+};
+static const uint16_t Arabic_reverse_state[] = {
+	0, 63, 64, 65, 66, 67, 68, 71, 72, 73, 77, 78,
+	79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+	91,
+};
+static const UTF8Range Arabic_reverse_range[] = {
+	{ 128, 129, 22 }, { 128, 131, 19 }, { 128, 132, 18 }, { 128, 135, 17 }, { 128, 135, 15 }, { 128, 137, 14 },
+	{ 128, 143, 13 }, { 128, 156, 12 }, { 128, 188, 11 }, { 128, 189, 10 }, { 128, 191, 9 }, { 129, 138, 8 },
+	{ 130, 130, 7 }, { 133, 159, 19 }, { 134, 139, 18 }, { 135, 135, 7 }, { 137, 137, 7 }, { 139, 139, 7 },
+	{ 139, 155, 14 }, { 141, 143, 7 }, { 141, 154, 18 }, { 144, 191, 6 }, { 145, 146, 7 }, { 146, 191, 13 },
+	{ 147, 161, 15 }, { 147, 191, 22 }, { 148, 148, 7 }, { 150, 175, 8 }, { 151, 151, 7 }, { 153, 153, 7 },
+	{ 155, 155, 7 }, { 156, 156, 18 }, { 157, 157, 7 }, { 158, 158, 18 }, { 158, 191, 12 }, { 159, 159, 7 },
+	{ 160, 180, 5 }, { 160, 190, 3 }, { 160, 191, 18 }, { 161, 162, 7 }, { 161, 162, 19 }, { 161, 163, 14 },
+	{ 163, 191, 15 }, { 164, 164, 7 }, { 164, 164, 19 }, { 165, 169, 14 }, { 167, 167, 19 }, { 167, 170, 7 },
+	{ 169, 178, 19 }, { 171, 187, 14 }, { 172, 178, 7 }, { 176, 177, 2 }, { 176, 180, 1 }, { 176, 189, 17 },
+	{ 177, 191, 8 }, { 180, 183, 7 }, { 180, 183, 19 }, { 182, 191, 1 }, { 182, 191, 5 }, { 185, 185, 19 },
+	{ 185, 188, 7 }, { 187, 187, 19 }, { 190, 190, 7 }, { 185, 185, 23 }, { 187, 187, 20 }, { 185, 185, 4 },
+	{ 144, 144, 21 }, { 162, 162, 16 }, { 173, 173, 23 }, { 181, 181, 23 }, { 221, 221, 0 }, { 185, 185, 20 },
+	{ 217, 217, 0 }, { 174, 174, 23 }, { 176, 179, 23 }, { 186, 186, 23 }, { 218, 218, 0 }, { 180, 180, 23 },
+	{ 187, 187, 23 }, { 219, 219, 0 }, { 182, 182, 23 }, { 186, 186, 20 }, { 163, 163, 16 }, { 224, 224, 0 },
+	{ 183, 183, 23 }, { 216, 216, 0 }, { 184, 184, 20 }, { 158, 158, 21 }, { 240, 240, 0 }, { 175, 175, 23 },
+	{ 239, 239, 0 },
+};
+static const uint16_t Armenian_forward_state[] = {
+	0, 4, 5, 6, 8, 10, 11,
+};
+static const UTF8Range Armenian_forward_range[] = {
+	{ 212, 212, 5 }, { 213, 213, 4 }, { 214, 214, 3 }, { 239, 239, 1 }, { 172, 172, 2 }, { 147, 151, 0 },
+	{ 128, 138, 0 }, { 141, 143, 0 }, { 128, 150, 0 }, { 153, 191, 0 }, { 177, 191, 0 },
+};
+static const uint16_t Armenian_reverse_state[] = {
+	0, 6, 7, 8, 9, 10, 11,
+};
+static const UTF8Range Armenian_reverse_range[] = {
+	{ 128, 138, 5 }, { 128, 150, 4 }, { 141, 143, 5 }, { 147, 151, 2 }, { 153, 191, 4 }, { 177, 191, 1 },
+	{ 212, 212, 0 }, { 172, 172, 3 }, { 239, 239, 0 }, { 213, 213, 0 }, { 214, 214, 0 },
+};
+static const uint16_t Avestan_forward_state[] = {
+	0, 1, 2, 3, 5,
+};
+static const UTF8Range Avestan_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 172, 172, 3 }, { 128, 181, 0 }, { 185, 191, 0 },
+};
+static const uint16_t Avestan_reverse_state[] = {
+	0, 2, 3, 4, 5,
+};
+static const UTF8Range Avestan_reverse_range[] = {
+	{ 128, 181, 1 }, { 185, 191, 1 }, { 172, 172, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Balinese_forward_state[] = {
+	0, 1, 3, 5, 6,
+};
+static const UTF8Range Balinese_forward_range[] = {
+	{ 225, 225, 1 }, { 172, 172, 3 }, { 173, 173, 2 }, { 128, 139, 0 }, { 144, 188, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Balinese_reverse_state[] = {
+	0, 3, 4, 5, 6,
+};
+static const UTF8Range Balinese_reverse_range[] = {
+	{ 128, 139, 2 }, { 128, 191, 1 }, { 144, 188, 2 }, { 172, 172, 3 }, { 173, 173, 3 }, { 225, 225, 0 },
+};
+static const uint16_t Bamum_forward_state[] = {
+	0, 2, 3, 5, 6, 7, 9, 10, 11,
+};
+static const UTF8Range Bamum_forward_range[] = {
+	{ 234, 234, 5 }, { 240, 240, 1 }, { 150, 150, 2 }, { 160, 167, 4 }, { 168, 168, 3 }, { 128, 184, 0 },
+	{ 128, 191, 0 }, { 154, 154, 7 }, { 155, 155, 6 }, { 128, 183, 0 }, { 160, 191, 0 },
+};
+static const uint16_t Bamum_reverse_state[] = {
+	0, 4, 5, 6, 7, 8, 9, 10, 11,
+};
+static const UTF8Range Bamum_reverse_range[] = {
+	{ 128, 183, 6 }, { 128, 184, 3 }, { 128, 191, 2 }, { 160, 191, 1 }, { 154, 154, 7 }, { 160, 167, 4 },
+	{ 168, 168, 4 }, { 150, 150, 5 }, { 240, 240, 0 }, { 155, 155, 7 }, { 234, 234, 0 },
+};
+static const uint16_t Bassa_Vah_forward_state[] = {
+	0, 1, 2, 3, 5,
+};
+static const UTF8Range Bassa_Vah_forward_range[] = {
+	{ 240, 240, 1 }, { 150, 150, 2 }, { 171, 171, 3 }, { 144, 173, 0 }, { 176, 181, 0 },
+};
+static const uint16_t Bassa_Vah_reverse_state[] = {
+	0, 2, 3, 4, 5,
+};
+static const UTF8Range Bassa_Vah_reverse_range[] = {
+	{ 144, 173, 1 }, { 176, 181, 1 }, { 171, 171, 2 }, { 150, 150, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Batak_forward_state[] = {
+	0, 1, 2, 4,
+};
+static const UTF8Range Batak_forward_range[] = {
+	{ 225, 225, 1 }, { 175, 175, 2 }, { 128, 179, 0 }, { 188, 191, 0 },
+};
+static const uint16_t Batak_reverse_state[] = {
+	0, 2, 3, 4,
+};
+static const UTF8Range Batak_reverse_range[] = {
+	{ 128, 179, 1 }, { 188, 191, 1 }, { 175, 175, 2 }, { 225, 225, 0 },
+};
+static const uint16_t Bengali_forward_state[] = {
+	0, 1, 3, 10, 18,
+};
+static const UTF8Range Bengali_forward_range[] = {
+	{ 224, 224, 1 }, { 166, 166, 3 }, { 167, 167, 2 }, { 128, 132, 0 }, { 135, 136, 0 }, { 139, 142, 0 },
+	{ 151, 151, 0 }, { 156, 157, 0 }, { 159, 163, 0 }, { 166, 190, 0 }, { 128, 131, 0 }, { 133, 140, 0 },
+	{ 143, 144, 0 }, { 147, 168, 0 }, { 170, 176, 0 }, { 178, 178, 0 }, { 182, 185, 0 }, { 188, 191, 0 },
+};
+static const uint16_t Bengali_reverse_state[] = {
+	0, 15, 16, 17, 18,
+};
+static const UTF8Range Bengali_reverse_range[] = {
+	{ 128, 131, 2 }, { 128, 132, 1 }, { 133, 140, 2 }, { 135, 136, 1 }, { 139, 142, 1 }, { 143, 144, 2 },
+	{ 147, 168, 2 }, { 151, 151, 1 }, { 156, 157, 1 }, { 159, 163, 1 }, { 166, 190, 1 }, { 170, 176, 2 },
+	{ 178, 178, 2 }, { 182, 185, 2 }, { 188, 191, 2 }, { 167, 167, 3 }, { 166, 166, 3 }, { 224, 224, 0 },
+};
+static const uint16_t Bhaiksuki_forward_state[] = {
+	0, 1, 2, 4, 6, 9,
+};
+static const UTF8Range Bhaiksuki_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 176, 176, 4 }, { 177, 177, 3 }, { 128, 133, 0 }, { 144, 172, 0 },
+	{ 128, 136, 0 }, { 138, 182, 0 }, { 184, 191, 0 },
+};
+static const uint16_t Bhaiksuki_reverse_state[] = {
+	0, 5, 6, 7, 8, 9,
+};
+static const UTF8Range Bhaiksuki_reverse_range[] = {
+	{ 128, 133, 2 }, { 128, 136, 1 }, { 138, 182, 1 }, { 144, 172, 2 }, { 184, 191, 1 }, { 176, 176, 3 },
+	{ 177, 177, 3 }, { 145, 145, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Bopomofo_forward_state[] = {
+	0, 2, 4, 5, 6, 7,
+};
+static const UTF8Range Bopomofo_forward_range[] = {
+	{ 203, 203, 4 }, { 227, 227, 1 }, { 132, 132, 3 }, { 134, 134, 2 }, { 160, 191, 0 }, { 133, 175, 0 },
+	{ 170, 171, 0 },
+};
+static const uint16_t Bopomofo_reverse_state[] = {
+	0, 3, 4, 5, 6, 7,
+};
+static const UTF8Range Bopomofo_reverse_range[] = {
+	{ 133, 175, 3 }, { 160, 191, 2 }, { 170, 171, 1 }, { 203, 203, 0 }, { 134, 134, 4 }, { 132, 132, 4 },
+	{ 227, 227, 0 },
+};
+static const uint16_t Brahmi_forward_state[] = {
+	0, 1, 2, 4, 7, 8,
+};
+static const UTF8Range Brahmi_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 128, 128, 4 }, { 129, 129, 3 }, { 128, 141, 0 }, { 146, 175, 0 },
+	{ 191, 191, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Brahmi_reverse_state[] = {
+	0, 4, 5, 6, 7, 8,
+};
+static const UTF8Range Brahmi_reverse_range[] = {
+	{ 128, 141, 2 }, { 128, 191, 1 }, { 146, 175, 2 }, { 191, 191, 2 }, { 128, 128, 3 }, { 129, 129, 3 },
+	{ 145, 145, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Braille_forward_state[] = {
+	0, 1, 2, 3,
+};
+static const UTF8Range Braille_forward_range[] = {
+	{ 226, 226, 1 }, { 160, 163, 2 }, { 128, 191, 0 },
+};
+static const uint16_t Braille_reverse_state[] = {
+	0, 1, 2, 3,
+};
+static const UTF8Range Braille_reverse_range[] = {
+	{ 128, 191, 1 }, { 160, 163, 2 }, { 226, 226, 0 },
+};
+static const uint16_t Buginese_forward_state[] = {
+	0, 1, 2, 4,
+};
+static const UTF8Range Buginese_forward_range[] = {
+	{ 225, 225, 1 }, { 168, 168, 2 }, { 128, 155, 0 }, { 158, 159, 0 },
+};
+static const uint16_t Buginese_reverse_state[] = {
+	0, 2, 3, 4,
+};
+static const UTF8Range Buginese_reverse_range[] = {
+	{ 128, 155, 1 }, { 158, 159, 1 }, { 168, 168, 2 }, { 225, 225, 0 },
+};
+static const uint16_t Buhid_forward_state[] = {
+	0, 1, 2, 3,
+};
+static const UTF8Range Buhid_forward_range[] = {
+	{ 225, 225, 1 }, { 157, 157, 2 }, { 128, 147, 0 },
+};
+static const uint16_t Buhid_reverse_state[] = {
+	0, 1, 2, 3,
+};
+static const UTF8Range Buhid_reverse_range[] = {
+	{ 128, 147, 1 }, { 157, 157, 2 }, { 225, 225, 0 },
+};
+static const uint16_t C_forward_state[] = {
+	0, 15, 17, 20, 22, 23, 25, 27, 31, 32, 33, 34,
+	35, 36, 37, 39, 40, 41, 44, 45, 46, 47, 48, 49,
+	51, 53, 55, 56, 57, 58, 59, 60, 61, 63, 65,
+};
+static const UTF8Range C_forward_range[] = {
+	{ 0, 31, 0 }, { 127, 127, 0 }, { 194, 194, 33 }, { 216, 216, 32 }, { 219, 219, 31 }, { 220, 220, 30 },
+	{ 224, 224, 28 }, { 225, 225, 26 }, { 226, 226, 23 }, { 237, 237, 21 }, { 238, 238, 20 }, { 239, 239, 17 },
+	{ 240, 240, 7 }, { 243, 243, 2 }, { 244, 244, 1 }, { 128, 142, 20 }, { 143, 143, 3 }, { 160, 160, 5 },
+	{ 176, 190, 20 }, { 191, 191, 3 }, { 128, 190, 22 }, { 191, 191, 4 }, { 128, 189, 0 }, { 128, 128, 6 },
+	{ 129, 129, 22 }, { 129, 129, 0 }, { 160, 191, 0 }, { 145, 145, 14 }, { 147, 147, 12 }, { 155, 155, 10 },
+	{ 157, 157, 8 }, { 133, 133, 9 }, { 179, 186, 0 }, { 178, 178, 11 }, { 160, 163, 0 }, { 144, 144, 13 },
+	{ 176, 184, 0 }, { 130, 130, 16 }, { 131, 131, 15 }, { 141, 141, 0 }, { 189, 189, 0 }, { 128, 163, 22 },
+	{ 187, 187, 19 }, { 191, 191, 18 }, { 185, 187, 0 }, { 191, 191, 0 }, { 128, 191, 22 }, { 160, 191, 22 },
+	{ 128, 191, 0 }, { 128, 128, 25 }, { 129, 129, 24 }, { 160, 164, 0 }, { 166, 175, 0 }, { 139, 143, 0 },
+	{ 170, 174, 0 }, { 160, 160, 27 }, { 142, 142, 0 }, { 163, 163, 29 }, { 162, 162, 0 }, { 143, 143, 0 },
+	{ 157, 157, 0 }, { 128, 133, 0 }, { 156, 156, 0 }, { 128, 159, 0 }, { 173, 173, 0 },
+};
+static const uint16_t C_reverse_state[] = {
+	0, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+	36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+	52, 53, 54, 57, 58, 59, 61, 62, 63, 64, 65,
+};
+static const UTF8Range C_reverse_range[] = {
+	{ 0, 31, 0 }, { 127, 127, 0 }, { 128, 133, 33 }, { 128, 159, 32 }, { 128, 189, 28 }, { 128, 191, 23 },
+	{ 129, 129, 22 }, { 139, 143, 20 }, { 141, 141, 17 }, { 142, 142, 15 }, { 143, 143, 14 }, { 156, 156, 33 },
+	{ 157, 157, 13 }, { 160, 163, 11 }, { 160, 164, 10 }, { 160, 191, 22 }, { 162, 162, 8 }, { 166, 175, 10 },
+	{ 170, 174, 20 }, { 173, 173, 32 }, { 176, 184, 6 }, { 179, 186, 4 }, { 185, 187, 3 }, { 189, 189, 2 },
+	{ 191, 191, 1 }, { 187, 187, 27 }, { 130, 130, 18 }, { 191, 191, 27 }, { 133, 133, 5 }, { 157, 157, 19 },
+	{ 144, 144, 7 }, { 147, 147, 19 }, { 163, 163, 9 }, { 224, 224, 0 }, { 129, 129, 21 }, { 178, 178, 12 },
+	{ 155, 155, 19 }, { 219, 219, 0 }, { 220, 220, 0 }, { 160, 160, 16 }, { 225, 225, 0 }, { 131, 131, 18 },
+	{ 145, 145, 19 }, { 240, 240, 0 }, { 128, 128, 21 }, { 226, 226, 0 }, { 128, 128, 25 }, { 128, 163, 27 },
+	{ 128, 190, 29 }, { 128, 191, 26 }, { 129, 129, 25 }, { 160, 191, 24 }, { 237, 237, 0 }, { 160, 160, 30 },
+	{ 128, 142, 31 }, { 176, 190, 30 }, { 238, 238, 0 }, { 239, 239, 0 }, { 191, 191, 29 }, { 143, 143, 31 },
+	{ 191, 191, 30 }, { 243, 243, 0 }, { 244, 244, 0 }, { 194, 194, 0 }, { 216, 216, 0 },
+};
+static const uint16_t Canadian_Aboriginal_forward_state[] = {
+	0, 1, 4, 5, 6, 7,
+};
+static const UTF8Range Canadian_Aboriginal_forward_range[] = {
+	{ 225, 225, 1 }, { 144, 153, 4 }, { 162, 162, 3 }, { 163, 163, 2 }, { 128, 181, 0 }, { 176, 191, 0 },
+	{ 128, 191, 0 },
+};
+static const uint16_t Canadian_Aboriginal_reverse_state[] = {
+	0, 3, 4, 5, 6, 7,
+};
+static const UTF8Range Canadian_Aboriginal_reverse_range[] = {
+	{ 128, 181, 3 }, { 128, 191, 2 }, { 176, 191, 1 }, { 162, 162, 4 }, { 144, 153, 4 }, { 163, 163, 4 },
+	{ 225, 225, 0 },
+};
+static const uint16_t Carian_forward_state[] = {
+	0, 1, 2, 4, 5, 6,
+};
+static const UTF8Range Carian_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 138, 138, 4 }, { 139, 139, 3 }, { 128, 144, 0 }, { 160, 191, 0 },
+};
+static const uint16_t Carian_reverse_state[] = {
+	0, 2, 3, 4, 5, 6,
+};
+static const UTF8Range Carian_reverse_range[] = {
+	{ 128, 144, 2 }, { 160, 191, 1 }, { 138, 138, 3 }, { 139, 139, 3 }, { 144, 144, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Caucasian_Albanian_forward_state[] = {
+	0, 1, 2, 4, 6, 7,
+};
+static const UTF8Range Caucasian_Albanian_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 148, 148, 4 }, { 149, 149, 3 }, { 128, 163, 0 }, { 175, 175, 0 },
+	{ 176, 191, 0 },
+};
+static const uint16_t Caucasian_Albanian_reverse_state[] = {
+	0, 3, 4, 5, 6, 7,
+};
+static const UTF8Range Caucasian_Albanian_reverse_range[] = {
+	{ 128, 163, 2 }, { 175, 175, 2 }, { 176, 191, 1 }, { 148, 148, 3 }, { 149, 149, 3 }, { 144, 144, 4 },
+	{ 240, 240, 0 },
+};
+static const uint16_t Cc_forward_state[] = {
+	0, 3, 4,
+};
+static const UTF8Range Cc_forward_range[] = {
+	{ 0, 31, 0 }, { 127, 127, 0 }, { 194, 194, 1 }, { 128, 159, 0 },
+};
+static const uint16_t Cc_reverse_state[] = {
+	0, 3, 4,
+};
+static const UTF8Range Cc_reverse_range[] = {
+	{ 0, 31, 0 }, { 127, 127, 0 }, { 128, 159, 1 }, { 194, 194, 0 },
+};
+static const uint16_t Cf_forward_state[] = {
+	0, 10, 11, 13, 14, 16, 20, 21, 22, 23, 24, 25,
+	26, 28, 29, 30, 32, 33, 34, 36, 38, 40, 41, 42,
+	43, 44, 45, 46, 48, 49,
+};
+static const UTF8Range Cf_forward_range[] = {
+	{ 194, 194, 28 }, { 216, 216, 27 }, { 219, 219, 26 }, { 220, 220, 25 }, { 224, 224, 23 }, { 225, 225, 21 },
+	{ 226, 226, 18 }, { 239, 239, 15 }, { 240, 240, 5 }, { 243, 243, 1 }, { 160, 160, 2 }, { 128, 128, 4 },
+	{ 129, 129, 3 }, { 128, 191, 0 }, { 129, 129, 0 }, { 160, 191, 0 }, { 145, 145, 12 }, { 147, 147, 10 },
+	{ 155, 155, 8 }, { 157, 157, 6 }, { 133, 133, 7 }, { 179, 186, 0 }, { 178, 178, 9 }, { 160, 163, 0 },
+	{ 144, 144, 11 }, { 176, 184, 0 }, { 130, 130, 14 }, { 131, 131, 13 }, { 141, 141, 0 }, { 189, 189, 0 },
+	{ 187, 187, 17 }, { 191, 191, 16 }, { 185, 187, 0 }, { 191, 191, 0 }, { 128, 128, 20 }, { 129, 129, 19 },
+	{ 160, 164, 0 }, { 166, 175, 0 }, { 139, 143, 0 }, { 170, 174, 0 }, { 160, 160, 22 }, { 142, 142, 0 },
+	{ 163, 163, 24 }, { 162, 162, 0 }, { 143, 143, 0 }, { 157, 157, 0 }, { 128, 133, 0 }, { 156, 156, 0 },
+	{ 173, 173, 0 },
+};
+static const uint16_t Cf_reverse_state[] = {
+	0, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43,
+	44, 45, 46, 47, 48, 49,
+};
+static const UTF8Range Cf_reverse_range[] = {
+	{ 128, 133, 28 }, { 128, 191, 25 }, { 129, 129, 24 }, { 139, 143, 22 }, { 141, 141, 19 }, { 142, 142, 17 },
+	{ 143, 143, 16 }, { 156, 156, 28 }, { 157, 157, 15 }, { 160, 163, 13 }, { 160, 164, 12 }, { 160, 191, 24 },
+	{ 162, 162, 10 }, { 166, 175, 12 }, { 170, 174, 22 }, { 173, 173, 9 }, { 176, 184, 7 }, { 179, 186, 5 },
+	{ 185, 187, 3 }, { 189, 189, 2 }, { 191, 191, 1 }, { 187, 187, 4 }, { 130, 130, 20 }, { 191, 191, 4 },
+	{ 239, 239, 0 }, { 133, 133, 6 }, { 157, 157, 21 }, { 144, 144, 8 }, { 147, 147, 21 }, { 194, 194, 0 },
+	{ 163, 163, 11 }, { 224, 224, 0 }, { 129, 129, 23 }, { 178, 178, 14 }, { 155, 155, 21 }, { 219, 219, 0 },
+	{ 220, 220, 0 }, { 160, 160, 18 }, { 225, 225, 0 }, { 131, 131, 20 }, { 145, 145, 21 }, { 240, 240, 0 },
+	{ 128, 128, 23 }, { 226, 226, 0 }, { 128, 128, 26 }, { 129, 129, 26 }, { 160, 160, 27 }, { 243, 243, 0 },
+	{ 216, 216, 0 },
+};
+static const uint16_t Chakma_forward_state[] = {
+	0, 1, 2, 4, 5, 7,
+};
+static const UTF8Range Chakma_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 132, 132, 4 }, { 133, 133, 3 }, { 128, 135, 0 }, { 128, 180, 0 },
+	{ 182, 191, 0 },
+};
+static const uint16_t Chakma_reverse_state[] = {
+	0, 3, 4, 5, 6, 7,
+};
+static const UTF8Range Chakma_reverse_range[] = {
+	{ 128, 135, 2 }, { 128, 180, 1 }, { 182, 191, 1 }, { 132, 132, 3 }, { 133, 133, 3 }, { 145, 145, 4 },
+	{ 240, 240, 0 },
+};
+static const uint16_t Cham_forward_state[] = {
+	0, 1, 3, 6, 7,
+};
+static const UTF8Range Cham_forward_range[] = {
+	{ 234, 234, 1 }, { 168, 168, 3 }, { 169, 169, 2 }, { 128, 141, 0 }, { 144, 153, 0 }, { 156, 159, 0 },
+	{ 128, 182, 0 },
+};
+static const uint16_t Cham_reverse_state[] = {
+	0, 4, 5, 6, 7,
+};
+static const UTF8Range Cham_reverse_range[] = {
+	{ 128, 141, 2 }, { 128, 182, 1 }, { 144, 153, 2 }, { 156, 159, 2 }, { 168, 168, 3 }, { 169, 169, 3 },
+	{ 234, 234, 0 },
+};
+static const uint16_t Cherokee_forward_state[] = {
+	0, 2, 4, 5, 6, 8, 10, 11,
+};
+static const UTF8Range Cherokee_forward_range[] = {
+	{ 225, 225, 4 }, { 234, 234, 1 }, { 173, 173, 3 }, { 174, 174, 2 }, { 128, 191, 0 }, { 176, 191, 0 },
+	{ 142, 142, 6 }, { 143, 143, 5 }, { 128, 181, 0 }, { 184, 189, 0 }, { 160, 191, 0 },
+};
+static const uint16_t Cherokee_reverse_state[] = {
+	0, 5, 6, 7, 8, 9, 10, 11,
+};
+static const UTF8Range Cherokee_reverse_range[] = {
+	{ 128, 181, 5 }, { 128, 191, 3 }, { 160, 191, 2 }, { 176, 191, 1 }, { 184, 189, 5 }, { 173, 173, 4 },
+	{ 142, 142, 6 }, { 174, 174, 4 }, { 234, 234, 0 }, { 143, 143, 6 }, { 225, 225, 0 },
+};
+static const uint16_t Chorasmian_forward_state[] = {
+	0, 1, 2, 4, 5, 6,
+};
+static const UTF8Range Chorasmian_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 190, 190, 4 }, { 191, 191, 3 }, { 128, 139, 0 }, { 176, 191, 0 },
+};
+static const uint16_t Chorasmian_reverse_state[] = {
+	0, 2, 3, 4, 5, 6,
+};
+static const UTF8Range Chorasmian_reverse_range[] = {
+	{ 128, 139, 2 }, { 176, 191, 1 }, { 190, 190, 3 }, { 191, 191, 3 }, { 144, 144, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Co_forward_state[] = {
+	0, 4, 6, 8, 10, 11, 12, 13, 14,
+};
+static const UTF8Range Co_forward_range[] = {
+	{ 238, 238, 6 }, { 239, 239, 5 }, { 243, 243, 2 }, { 244, 244, 1 }, { 128, 142, 6 }, { 143, 143, 3 },
+	{ 176, 190, 6 }, { 191, 191, 3 }, { 128, 190, 7 }, { 191, 191, 4 }, { 128, 189, 0 }, { 128, 163, 7 },
+	{ 128, 191, 7 }, { 128, 191, 0 },
+};
+static const uint16_t Co_reverse_state[] = {
+	0, 2, 5, 8, 9, 10, 12, 13, 14,
+};
+static const UTF8Range Co_reverse_range[] = {
+	{ 128, 189, 4 }, { 128, 191, 1 }, { 128, 163, 3 }, { 128, 190, 5 }, { 128, 191, 2 }, { 128, 142, 7 },
+	{ 176, 190, 6 }, { 238, 238, 0 }, { 239, 239, 0 }, { 191, 191, 5 }, { 143, 143, 7 }, { 191, 191, 6 },
+	{ 243, 243, 0 }, { 244, 244, 0 },
+};
+static const uint16_t Common_forward_state[] = {
+	0, 21, 22, 24, 26, 32, 61, 63, 65, 67, 70, 74,
+	76, 78, 81, 84, 86, 88, 89, 92, 95, 97, 98, 99,
+	101, 104, 106, 109, 110, 111, 112, 131, 133, 137, 143, 145,
+	153, 155, 157, 158, 159, 162, 164, 166, 167, 168, 169, 170,
+	171, 175, 176, 177, 178, 181, 189, 192, 193, 196, 198, 201,
+	203, 204, 210, 212, 213, 214, 215, 216, 217, 218, 229, 230,
+	232, 234, 235, 236, 237, 238, 240, 245, 262, 263, 264, 266,
+	268, 270, 271, 272, 274, 276, 280, 282, 285, 287, 292, 298,
+	300, 301, 302, 303, 307, 308, 309, 310, 311, 312, 313, 317,
+	319, 321, 324, 325, 327, 330,
+};
+static const UTF8Range Common_forward_range[] = {
+	{ 0, 64, 0 }, { 91, 96, 0 }, { 123, 127, 0 }, { 194, 194, 112 }, { 195, 195, 111 }, { 202, 202, 110 },
+	{ 203, 203, 109 }, { 205, 205, 108 }, { 206, 206, 107 }, { 216, 216, 106 }, { 217, 217, 105 }, { 219, 219, 104 },
+	{ 224, 224, 99 }, { 225, 225, 93 }, { 226, 226, 79 }, { 227, 227, 69 }, { 228, 228, 68 }, { 234, 234, 61 },
+	{ 239, 239, 53 }, { 240, 240, 4 }, { 243, 243, 1 }, { 160, 160, 2 }, { 128, 128, 3 }, { 129, 129, 86 },
+	{ 129, 129, 0 }, { 160, 191, 0 }, { 144, 144, 48 }, { 150, 150, 46 }, { 155, 155, 44 }, { 157, 157, 30 },
+	{ 158, 158, 26 }, { 159, 159, 5 }, { 128, 128, 25 }, { 129, 129, 86 }, { 130, 130, 24 }, { 131, 131, 23 },
+	{ 132, 133, 86 }, { 134, 134, 22 }, { 135, 135, 21 }, { 136, 136, 20 }, { 137, 137, 19 }, { 140, 154, 86 },
+	{ 155, 155, 18 }, { 156, 156, 86 }, { 157, 157, 17 }, { 158, 158, 86 }, { 159, 159, 16 }, { 160, 160, 15 },
+	{ 161, 161, 14 }, { 162, 162, 13 }, { 164, 164, 86 }, { 165, 165, 12 }, { 166, 166, 86 }, { 167, 167, 11 },
+	{ 168, 168, 86 }, { 169, 169, 10 }, { 170, 170, 9 }, { 171, 171, 8 }, { 172, 173, 86 }, { 174, 174, 7 },
+	{ 175, 175, 6 }, { 128, 138, 0 }, { 176, 185, 0 }, { 128, 146, 0 }, { 148, 191, 0 }, { 128, 130, 0 },
+	{ 144, 150, 0 }, { 128, 134, 0 }, { 144, 168, 0 }, { 176, 182, 0 }, { 128, 147, 0 }, { 160, 173, 0 },
+	{ 176, 180, 0 }, { 184, 186, 0 }, { 128, 139, 0 }, { 141, 191, 0 }, { 128, 184, 0 }, { 186, 191, 0 },
+	{ 128, 135, 0 }, { 144, 173, 0 }, { 176, 177, 0 }, { 128, 135, 0 }, { 144, 153, 0 }, { 160, 191, 0 },
+	{ 128, 139, 0 }, { 144, 191, 0 }, { 128, 152, 0 }, { 160, 171, 0 }, { 128, 179, 0 }, { 128, 151, 0 },
+	{ 160, 172, 0 }, { 176, 188, 0 }, { 128, 136, 0 }, { 144, 145, 0 }, { 160, 165, 0 }, { 129, 130, 0 },
+	{ 144, 187, 0 }, { 166, 191, 0 }, { 128, 173, 0 }, { 129, 143, 0 }, { 145, 181, 0 }, { 128, 147, 0 },
+	{ 160, 174, 0 }, { 177, 191, 0 }, { 128, 171, 0 }, { 176, 191, 0 }, { 177, 177, 29 }, { 178, 178, 28 },
+	{ 180, 180, 27 }, { 129, 189, 0 }, { 128, 180, 0 }, { 177, 191, 0 }, { 128, 130, 86 }, { 131, 131, 43 },
+	{ 132, 132, 42 }, { 133, 133, 41 }, { 134, 134, 40 }, { 135, 135, 39 }, { 139, 139, 38 }, { 140, 140, 86 },
+	{ 141, 141, 37 }, { 144, 144, 86 }, { 145, 145, 36 }, { 146, 146, 35 }, { 147, 147, 34 }, { 148, 148, 33 },
+	{ 149, 149, 32 }, { 150, 153, 86 }, { 154, 154, 31 }, { 155, 158, 86 }, { 159, 159, 92 }, { 128, 165, 0 },
+	{ 168, 191, 0 }, { 128, 132, 0 }, { 134, 134, 0 }, { 138, 144, 0 }, { 146, 191, 0 }, { 128, 133, 0 },
+	{ 135, 138, 0 }, { 141, 148, 0 }, { 150, 156, 0 }, { 158, 185, 0 }, { 187, 190, 0 }, { 128, 131, 0 },
+	{ 133, 191, 0 }, { 128, 156, 0 }, { 158, 159, 0 }, { 162, 162, 0 }, { 165, 166, 0 }, { 169, 172, 0 },
+	{ 174, 185, 0 }, { 187, 187, 0 }, { 189, 191, 0 }, { 128, 148, 0 }, { 150, 191, 0 }, { 128, 150, 0 },
+	{ 160, 184, 0 }, { 160, 179, 0 }, { 128, 168, 0 }, { 131, 132, 0 }, { 140, 169, 0 }, { 174, 191, 0 },
+	{ 128, 166, 0 }, { 170, 186, 0 }, { 128, 166, 0 }, { 169, 191, 0 }, { 128, 181, 0 }, { 178, 178, 45 },
+	{ 160, 163, 0 }, { 191, 191, 47 }, { 162, 163, 0 }, { 132, 132, 52 }, { 134, 134, 51 }, { 135, 135, 50 },
+	{ 139, 139, 49 }, { 161, 187, 0 }, { 144, 188, 0 }, { 144, 156, 0 }, { 128, 130, 0 }, { 135, 179, 0 },
+	{ 183, 191, 0 }, { 180, 180, 60 }, { 184, 184, 59 }, { 185, 185, 58 }, { 187, 187, 101 }, { 188, 188, 57 },
+	{ 189, 189, 56 }, { 190, 190, 55 }, { 191, 191, 54 }, { 160, 166, 0 }, { 168, 174, 0 }, { 185, 189, 0 },
+	{ 158, 159, 0 }, { 128, 128, 0 }, { 155, 165, 0 }, { 176, 176, 0 }, { 129, 160, 0 }, { 187, 191, 0 },
+	{ 128, 146, 0 }, { 148, 166, 0 }, { 168, 171, 0 }, { 144, 153, 0 }, { 176, 191, 0 }, { 190, 191, 0 },
+	{ 156, 156, 67 }, { 158, 158, 66 }, { 160, 160, 65 }, { 164, 164, 64 }, { 167, 167, 63 }, { 173, 173, 62 },
+	{ 155, 155, 0 }, { 170, 171, 0 }, { 143, 143, 0 }, { 174, 174, 0 }, { 176, 185, 0 }, { 136, 138, 0 },
+	{ 128, 161, 0 }, { 183, 183, 86 }, { 128, 128, 78 }, { 130, 130, 77 }, { 131, 131, 76 }, { 134, 134, 75 },
+	{ 135, 135, 74 }, { 136, 136, 73 }, { 137, 137, 72 }, { 138, 138, 86 }, { 139, 139, 71 }, { 141, 141, 70 },
+	{ 142, 143, 86 }, { 152, 191, 0 }, { 128, 143, 0 }, { 191, 191, 0 }, { 128, 159, 0 }, { 191, 191, 0 },
+	{ 160, 191, 0 }, { 128, 163, 0 }, { 144, 159, 0 }, { 187, 188, 0 }, { 155, 156, 0 }, { 160, 160, 0 },
+	{ 128, 132, 0 }, { 134, 134, 0 }, { 136, 160, 0 }, { 176, 183, 0 }, { 188, 191, 0 }, { 128, 128, 92 },
+	{ 129, 129, 91 }, { 130, 130, 90 }, { 132, 132, 89 }, { 133, 133, 88 }, { 134, 134, 87 }, { 135, 143, 86 },
+	{ 144, 144, 85 }, { 145, 145, 84 }, { 146, 159, 86 }, { 164, 172, 86 }, { 173, 173, 83 }, { 174, 174, 82 },
+	{ 175, 175, 86 }, { 184, 184, 86 }, { 185, 185, 81 }, { 191, 191, 80 }, { 176, 187, 0 }, { 128, 146, 0 },
+	{ 128, 149, 0 }, { 151, 191, 0 }, { 128, 179, 0 }, { 182, 191, 0 }, { 128, 138, 0 }, { 160, 191, 0 },
+	{ 128, 166, 0 }, { 128, 191, 0 }, { 137, 139, 0 }, { 144, 191, 0 }, { 128, 141, 0 }, { 143, 159, 0 },
+	{ 128, 165, 0 }, { 167, 169, 0 }, { 172, 177, 0 }, { 179, 191, 0 }, { 128, 142, 0 }, { 160, 191, 0 },
+	{ 128, 164, 0 }, { 166, 176, 0 }, { 180, 190, 0 }, { 128, 139, 0 }, { 142, 191, 0 }, { 131, 131, 98 },
+	{ 155, 155, 97 }, { 156, 156, 96 }, { 160, 160, 95 }, { 179, 179, 94 }, { 147, 147, 0 }, { 161, 161, 0 },
+	{ 169, 172, 0 }, { 174, 179, 0 }, { 181, 183, 0 }, { 186, 186, 0 }, { 130, 131, 0 }, { 133, 133, 0 },
+	{ 181, 182, 0 }, { 171, 173, 0 }, { 187, 187, 0 }, { 163, 163, 103 }, { 165, 165, 102 }, { 184, 184, 101 },
+	{ 191, 191, 100 }, { 149, 152, 0 }, { 191, 191, 0 }, { 164, 165, 0 }, { 162, 162, 0 }, { 157, 157, 0 },
+	{ 128, 128, 0 }, { 133, 133, 0 }, { 140, 140, 0 }, { 155, 155, 0 }, { 159, 159, 0 }, { 133, 133, 0 },
+	{ 135, 135, 0 }, { 180, 180, 0 }, { 190, 190, 0 }, { 128, 159, 0 }, { 165, 169, 0 }, { 172, 191, 0 },
+	{ 185, 191, 0 }, { 151, 151, 0 }, { 183, 183, 0 }, { 128, 169, 0 }, { 171, 185, 0 }, { 187, 191, 0 },
+};
+static const uint16_t Common_reverse_state[] = {
+	0, 194, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205,
+	206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217,
+	218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229,
+	230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241,
+	242, 243, 244, 267, 268, 269, 270, 271, 272, 273, 274, 275,
+	276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287,
+	288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299,
+	300, 301, 302, 303, 304, 305, 307, 308, 309, 310, 311, 312,
+	313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324,
+	325, 326, 327, 328, 329, 330,
+};
+static const UTF8Range Common_reverse_range[] = {
+	{ 0, 64, 0 }, { 91, 96, 0 }, { 123, 127, 0 }, { 128, 128, 111 }, { 128, 128, 110 }, { 128, 130, 107 },
+	{ 128, 130, 105 }, { 128, 131, 103 }, { 128, 132, 102 }, { 128, 132, 100 }, { 128, 133, 99 }, { 128, 134, 98 },
+	{ 128, 135, 97 }, { 128, 135, 96 }, { 128, 136, 95 }, { 128, 138, 94 }, { 128, 138, 92 }, { 128, 139, 91 },
+	{ 128, 139, 90 }, { 128, 139, 89 }, { 128, 141, 88 }, { 128, 142, 87 }, { 128, 143, 86 }, { 128, 146, 85 },
+	{ 128, 146, 84 }, { 128, 146, 83 }, { 128, 147, 82 }, { 128, 147, 81 }, { 128, 148, 80 }, { 128, 149, 79 },
+	{ 128, 150, 78 }, { 128, 151, 77 }, { 128, 152, 76 }, { 128, 156, 75 }, { 128, 159, 74 }, { 128, 159, 73 },
+	{ 128, 161, 71 }, { 128, 163, 70 }, { 128, 164, 69 }, { 128, 165, 68 }, { 128, 165, 67 }, { 128, 166, 66 },
+	{ 128, 166, 65 }, { 128, 166, 64 }, { 128, 168, 63 }, { 128, 169, 62 }, { 128, 171, 61 }, { 128, 173, 60 },
+	{ 128, 179, 59 }, { 128, 179, 58 }, { 128, 180, 56 }, { 128, 181, 55 }, { 128, 184, 54 }, { 128, 191, 50 },
+	{ 129, 129, 49 }, { 129, 130, 48 }, { 129, 143, 47 }, { 129, 160, 46 }, { 129, 189, 45 }, { 130, 131, 43 },
+	{ 131, 132, 42 }, { 133, 133, 43 }, { 133, 133, 41 }, { 133, 133, 40 }, { 133, 191, 103 }, { 134, 134, 102 },
+	{ 134, 134, 100 }, { 135, 135, 40 }, { 135, 138, 99 }, { 135, 179, 105 }, { 136, 138, 39 }, { 136, 160, 100 },
+	{ 137, 139, 38 }, { 138, 144, 102 }, { 140, 140, 41 }, { 140, 169, 42 }, { 141, 148, 99 }, { 141, 191, 91 },
+	{ 142, 191, 89 }, { 143, 143, 37 }, { 143, 159, 88 }, { 144, 145, 95 }, { 144, 150, 107 }, { 144, 153, 96 },
+	{ 144, 153, 36 }, { 144, 156, 35 }, { 144, 159, 34 }, { 144, 168, 98 }, { 144, 173, 97 }, { 144, 187, 48 },
+	{ 144, 188, 33 }, { 144, 191, 90 }, { 144, 191, 38 }, { 145, 181, 47 }, { 146, 191, 102 }, { 147, 147, 32 },
+	{ 148, 166, 84 }, { 148, 191, 85 }, { 149, 152, 30 }, { 150, 156, 99 }, { 150, 191, 80 }, { 151, 151, 29 },
+	{ 151, 191, 79 }, { 152, 191, 28 }, { 155, 155, 27 }, { 155, 155, 41 }, { 155, 156, 26 }, { 155, 165, 111 },
+	{ 157, 157, 25 }, { 158, 159, 75 }, { 158, 159, 24 }, { 158, 185, 99 }, { 159, 159, 41 }, { 160, 160, 26 },
+	{ 160, 163, 22 }, { 160, 165, 95 }, { 160, 166, 21 }, { 160, 171, 76 }, { 160, 172, 77 }, { 160, 173, 82 },
+	{ 160, 174, 81 }, { 160, 179, 20 }, { 160, 184, 78 }, { 160, 191, 49 }, { 160, 191, 96 }, { 160, 191, 19 },
+	{ 160, 191, 92 }, { 160, 191, 87 }, { 161, 161, 32 }, { 161, 187, 18 }, { 162, 162, 75 }, { 162, 162, 17 },
+	{ 162, 163, 15 }, { 164, 165, 14 }, { 165, 166, 75 }, { 165, 169, 73 }, { 166, 176, 69 }, { 166, 191, 13 },
+	{ 167, 169, 67 }, { 168, 171, 84 }, { 168, 174, 21 }, { 168, 191, 68 }, { 169, 172, 75 }, { 169, 172, 32 },
+	{ 169, 191, 65 }, { 170, 171, 27 }, { 170, 186, 66 }, { 171, 173, 12 }, { 171, 185, 62 }, { 172, 177, 67 },
+	{ 172, 191, 73 }, { 174, 174, 11 }, { 174, 179, 32 }, { 174, 185, 75 }, { 174, 191, 42 }, { 176, 176, 111 },
+	{ 176, 177, 97 }, { 176, 180, 82 }, { 176, 182, 98 }, { 176, 183, 100 }, { 176, 185, 94 }, { 176, 185, 10 },
+	{ 176, 187, 9 }, { 176, 188, 77 }, { 176, 191, 61 }, { 176, 191, 36 }, { 177, 191, 81 }, { 177, 191, 8 },
+	{ 179, 191, 67 }, { 180, 180, 7 }, { 180, 190, 69 }, { 181, 182, 6 }, { 181, 183, 32 }, { 182, 191, 58 },
+	{ 183, 183, 29 }, { 183, 191, 105 }, { 184, 186, 82 }, { 185, 189, 21 }, { 185, 191, 5 }, { 186, 186, 32 },
+	{ 186, 191, 54 }, { 187, 187, 75 }, { 187, 187, 4 }, { 187, 188, 3 }, { 187, 190, 99 }, { 187, 191, 46 },
+	{ 187, 191, 62 }, { 188, 191, 100 }, { 189, 191, 75 }, { 190, 190, 7 }, { 190, 191, 2 }, { 191, 191, 86 },
+	{ 191, 191, 74 }, { 191, 191, 1 }, { 184, 184, 31 }, { 187, 187, 112 }, { 180, 180, 112 }, { 131, 131, 101 },
+	{ 131, 131, 44 }, { 202, 202, 0 }, { 156, 156, 44 }, { 205, 205, 0 }, { 177, 177, 57 }, { 191, 191, 93 },
+	{ 160, 160, 72 }, { 164, 164, 72 }, { 155, 155, 44 }, { 135, 135, 108 }, { 165, 165, 31 }, { 191, 191, 16 },
+	{ 150, 150, 109 }, { 163, 163, 31 }, { 139, 139, 106 }, { 136, 136, 101 }, { 139, 139, 104 }, { 191, 191, 112 },
+	{ 178, 178, 23 }, { 155, 155, 109 }, { 190, 190, 112 }, { 219, 219, 0 }, { 130, 130, 101 }, { 173, 173, 72 },
+	{ 141, 141, 101 }, { 195, 195, 0 }, { 191, 191, 31 }, { 224, 224, 0 }, { 179, 179, 44 }, { 135, 135, 106 },
+	{ 134, 134, 101 }, { 134, 134, 106 }, { 184, 184, 112 }, { 167, 167, 72 }, { 134, 134, 93 }, { 158, 158, 72 },
+	{ 206, 206, 0 }, { 216, 216, 0 }, { 134, 134, 104 }, { 160, 160, 44 }, { 225, 225, 0 }, { 180, 180, 57 },
+	{ 188, 188, 112 }, { 131, 131, 108 }, { 136, 136, 108 }, { 128, 128, 52 }, { 128, 130, 104 }, { 129, 129, 52 },
+	{ 129, 129, 108 }, { 132, 133, 108 }, { 135, 143, 93 }, { 138, 138, 101 }, { 140, 140, 104 }, { 140, 154, 108 },
+	{ 142, 143, 101 }, { 144, 144, 104 }, { 146, 159, 93 }, { 150, 153, 104 }, { 155, 158, 104 }, { 156, 156, 108 },
+	{ 158, 158, 108 }, { 164, 164, 108 }, { 164, 172, 93 }, { 166, 166, 108 }, { 168, 168, 108 }, { 172, 173, 108 },
+	{ 175, 175, 93 }, { 183, 183, 51 }, { 184, 184, 93 }, { 228, 228, 0 }, { 160, 160, 53 }, { 243, 243, 0 },
+	{ 165, 165, 108 }, { 131, 131, 104 }, { 178, 178, 57 }, { 158, 158, 109 }, { 173, 173, 93 }, { 157, 157, 108 },
+	{ 134, 134, 108 }, { 128, 128, 108 }, { 194, 194, 0 }, { 135, 135, 104 }, { 144, 144, 93 }, { 132, 132, 104 },
+	{ 133, 133, 104 }, { 132, 132, 93 }, { 154, 154, 104 }, { 129, 129, 93 }, { 135, 135, 101 }, { 156, 156, 72 },
+	{ 234, 234, 0 }, { 203, 203, 0 }, { 137, 137, 101 }, { 146, 146, 104 }, { 159, 159, 108 }, { 155, 155, 108 },
+	{ 141, 141, 104 }, { 174, 174, 93 }, { 145, 145, 104 }, { 130, 130, 108 }, { 169, 169, 108 }, { 185, 185, 93 },
+	{ 185, 185, 112 }, { 174, 174, 108 }, { 139, 139, 101 }, { 130, 130, 93 }, { 133, 133, 93 }, { 128, 128, 93 },
+	{ 159, 159, 104 }, { 160, 160, 108 }, { 167, 167, 108 }, { 145, 145, 93 }, { 226, 226, 0 }, { 175, 175, 108 },
+	{ 137, 137, 108 }, { 161, 161, 108 }, { 162, 162, 108 }, { 170, 170, 108 }, { 148, 148, 104 }, { 128, 128, 101 },
+	{ 227, 227, 0 }, { 149, 149, 104 }, { 147, 147, 104 }, { 157, 157, 109 }, { 132, 132, 106 }, { 144, 144, 109 },
+	{ 171, 171, 108 }, { 159, 159, 109 }, { 240, 240, 0 }, { 217, 217, 0 }, { 189, 189, 112 }, { 239, 239, 0 },
+};
+static const uint16_t Coptic_forward_state[] = {
+	0, 2, 4, 6, 7, 8,
+};
+static const UTF8Range Coptic_forward_range[] = {
+	{ 207, 207, 4 }, { 226, 226, 1 }, { 178, 178, 3 }, { 179, 179, 2 }, { 128, 179, 0 }, { 185, 191, 0 },
+	{ 128, 191, 0 }, { 162, 175, 0 },
+};
+static const uint16_t Coptic_reverse_state[] = {
+	0, 4, 5, 6, 7, 8,
+};
+static const UTF8Range Coptic_reverse_range[] = {
+	{ 128, 179, 3 }, { 128, 191, 2 }, { 162, 175, 1 }, { 185, 191, 3 }, { 207, 207, 0 }, { 178, 178, 4 },
+	{ 179, 179, 4 }, { 226, 226, 0 },
+};
+static const uint16_t Cs_forward_state[] = {
+	0, 1, 2, 3,
+};
+static const UTF8Range Cs_forward_range[] = {
+	{ 237, 237, 1 }, { 160, 191, 2 }, { 128, 191, 0 },
+};
+static const uint16_t Cs_reverse_state[] = {
+	0, 1, 2, 3,
+};
+static const UTF8Range Cs_reverse_range[] = {
+	{ 128, 191, 1 }, { 160, 191, 2 }, { 237, 237, 0 },
+};
+static const uint16_t Cuneiform_forward_state[] = {
+	0, 1, 2, 8, 9, 11, 12, 13,
+};
+static const UTF8Range Cuneiform_forward_range[] = {
+	{ 240, 240, 1 }, { 146, 146, 2 }, { 128, 141, 6 }, { 142, 142, 5 }, { 144, 144, 6 }, { 145, 145, 4 },
+	{ 146, 148, 6 }, { 149, 149, 3 }, { 128, 131, 0 }, { 128, 174, 0 }, { 176, 180, 0 }, { 128, 153, 0 },
+	{ 128, 191, 0 },
+};
+static const uint16_t Cuneiform_reverse_state[] = {
+	0, 5, 8, 9, 10, 11, 12, 13,
+};
+static const UTF8Range Cuneiform_reverse_range[] = {
+	{ 128, 131, 4 }, { 128, 153, 3 }, { 128, 174, 2 }, { 128, 191, 1 }, { 176, 180, 2 }, { 128, 141, 5 },
+	{ 144, 144, 5 }, { 146, 148, 5 }, { 145, 145, 5 }, { 142, 142, 5 }, { 149, 149, 5 }, { 146, 146, 6 },
+	{ 240, 240, 0 },
+};
+static const uint16_t Cypriot_forward_state[] = {
+	0, 1, 2, 3, 9,
+};
+static const UTF8Range Cypriot_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 160, 160, 3 }, { 128, 133, 0 }, { 136, 136, 0 }, { 138, 181, 0 },
+	{ 183, 184, 0 }, { 188, 188, 0 }, { 191, 191, 0 },
+};
+static const uint16_t Cypriot_reverse_state[] = {
+	0, 6, 7, 8, 9,
+};
+static const UTF8Range Cypriot_reverse_range[] = {
+	{ 128, 133, 1 }, { 136, 136, 1 }, { 138, 181, 1 }, { 183, 184, 1 }, { 188, 188, 1 }, { 191, 191, 1 },
+	{ 160, 160, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Cyrillic_forward_state[] = {
+	0, 8, 9, 10, 12, 13, 14, 15, 18, 19, 20, 21,
+	22, 24, 25,
+};
+static const UTF8Range Cyrillic_forward_range[] = {
+	{ 208, 209, 13 }, { 210, 210, 12 }, { 211, 211, 13 }, { 212, 212, 11 }, { 225, 225, 7 }, { 226, 226, 5 },
+	{ 234, 234, 3 }, { 239, 239, 1 }, { 184, 184, 2 }, { 174, 175, 0 }, { 153, 153, 13 }, { 154, 154, 4 },
+	{ 128, 159, 0 }, { 183, 183, 6 }, { 160, 191, 0 }, { 178, 178, 10 }, { 180, 180, 9 }, { 181, 181, 8 },
+	{ 184, 184, 0 }, { 171, 171, 0 }, { 128, 136, 0 }, { 128, 175, 0 }, { 128, 132, 0 }, { 135, 191, 0 },
+	{ 128, 191, 0 },
+};
+static const uint16_t Cyrillic_reverse_state[] = {
+	0, 10, 11, 12, 13, 14, 15, 16, 19, 20, 21, 22,
+	23, 24, 25,
+};
+static const UTF8Range Cyrillic_reverse_range[] = {
+	{ 128, 132, 13 }, { 128, 136, 11 }, { 128, 159, 9 }, { 128, 175, 8 }, { 128, 191, 7 }, { 135, 191, 13 },
+	{ 160, 191, 5 }, { 171, 171, 4 }, { 174, 175, 2 }, { 184, 184, 1 }, { 181, 181, 12 }, { 184, 184, 3 },
+	{ 239, 239, 0 }, { 180, 180, 12 }, { 183, 183, 6 }, { 226, 226, 0 }, { 153, 153, 10 }, { 208, 209, 0 },
+	{ 211, 211, 0 }, { 212, 212, 0 }, { 154, 154, 10 }, { 234, 234, 0 }, { 178, 178, 12 }, { 225, 225, 0 },
+	{ 210, 210, 0 },
+};
+static const uint16_t Deseret_forward_state[] = {
+	0, 1, 2, 4, 5, 6,
+};
+static const UTF8Range Deseret_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 144, 144, 4 }, { 145, 145, 3 }, { 128, 143, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Deseret_reverse_state[] = {
+	0, 2, 3, 4, 5, 6,
+};
+static const UTF8Range Deseret_reverse_range[] = {
+	{ 128, 143, 2 }, { 128, 191, 1 }, { 144, 144, 3 }, { 145, 145, 3 }, { 144, 144, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Devanagari_forward_state[] = {
+	0, 2, 3, 4, 6, 9, 10,
+};
+static const UTF8Range Devanagari_forward_range[] = {
+	{ 224, 224, 3 }, { 234, 234, 1 }, { 163, 163, 2 }, { 160, 191, 0 }, { 164, 164, 5 }, { 165, 165, 4 },
+	{ 128, 144, 0 }, { 149, 163, 0 }, { 166, 191, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Devanagari_reverse_state[] = {
+	0, 5, 6, 7, 8, 9, 10,
+};
+static const UTF8Range Devanagari_reverse_range[] = {
+	{ 128, 144, 4 }, { 128, 191, 3 }, { 149, 163, 4 }, { 160, 191, 1 }, { 166, 191, 4 }, { 163, 163, 2 },
+	{ 234, 234, 0 }, { 164, 164, 5 }, { 165, 165, 5 }, { 224, 224, 0 },
+};
+static const uint16_t Dives_Akuru_forward_state[] = {
+	0, 1, 2, 4, 6, 13,
+};
+static const UTF8Range Dives_Akuru_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 164, 164, 4 }, { 165, 165, 3 }, { 128, 134, 0 }, { 144, 153, 0 },
+	{ 128, 134, 0 }, { 137, 137, 0 }, { 140, 147, 0 }, { 149, 150, 0 }, { 152, 181, 0 }, { 183, 184, 0 },
+	{ 187, 191, 0 },
+};
+static const uint16_t Dives_Akuru_reverse_state[] = {
+	0, 9, 10, 11, 12, 13,
+};
+static const UTF8Range Dives_Akuru_reverse_range[] = {
+	{ 128, 134, 2 }, { 128, 134, 1 }, { 137, 137, 1 }, { 140, 147, 1 }, { 144, 153, 2 }, { 149, 150, 1 },
+	{ 152, 181, 1 }, { 183, 184, 1 }, { 187, 191, 1 }, { 164, 164, 3 }, { 165, 165, 3 }, { 145, 145, 4 },
+	{ 240, 240, 0 },
+};
+static const uint16_t Dogra_forward_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Dogra_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 160, 160, 3 }, { 128, 187, 0 },
+};
+static const uint16_t Dogra_reverse_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Dogra_reverse_range[] = {
+	{ 128, 187, 1 }, { 160, 160, 2 }, { 145, 145, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Duployan_forward_state[] = {
+	0, 1, 2, 5, 8, 10, 11,
+};
+static const UTF8Range Duployan_forward_range[] = {
+	{ 240, 240, 1 }, { 155, 155, 2 }, { 176, 176, 5 }, { 177, 177, 4 }, { 178, 178, 3 }, { 128, 136, 0 },
+	{ 144, 153, 0 }, { 156, 159, 0 }, { 128, 170, 0 }, { 176, 188, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Duployan_reverse_state[] = {
+	0, 6, 7, 8, 9, 10, 11,
+};
+static const UTF8Range Duployan_reverse_range[] = {
+	{ 128, 136, 3 }, { 128, 170, 2 }, { 128, 191, 1 }, { 144, 153, 3 }, { 156, 159, 3 }, { 176, 188, 2 },
+	{ 176, 176, 4 }, { 177, 177, 4 }, { 178, 178, 4 }, { 155, 155, 5 }, { 240, 240, 0 },
+};
+static const uint16_t Egyptian_Hieroglyphs_forward_state[] = {
+	0, 1, 2, 4, 6, 7,
+};
+static const UTF8Range Egyptian_Hieroglyphs_forward_range[] = {
+	{ 240, 240, 1 }, { 147, 147, 2 }, { 128, 143, 4 }, { 144, 144, 3 }, { 128, 174, 0 }, { 176, 184, 0 },
+	{ 128, 191, 0 },
+};
+static const uint16_t Egyptian_Hieroglyphs_reverse_state[] = {
+	0, 3, 4, 5, 6, 7,
+};
+static const UTF8Range Egyptian_Hieroglyphs_reverse_range[] = {
+	{ 128, 174, 2 }, { 128, 191, 1 }, { 176, 184, 2 }, { 128, 143, 3 }, { 144, 144, 3 }, { 147, 147, 4 },
+	{ 240, 240, 0 },
+};
+static const uint16_t Elbasan_forward_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Elbasan_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 148, 148, 3 }, { 128, 167, 0 },
+};
+static const uint16_t Elbasan_reverse_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Elbasan_reverse_range[] = {
+	{ 128, 167, 1 }, { 148, 148, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Elymaic_forward_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Elymaic_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 191, 191, 3 }, { 160, 182, 0 },
+};
+static const uint16_t Elymaic_reverse_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Elymaic_reverse_range[] = {
+	{ 160, 182, 1 }, { 191, 191, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Ethiopic_forward_state[] = {
+	0, 3, 4, 9, 11, 15, 20, 27, 28, 30, 33, 37,
+	42, 48, 49,
+};
+static const UTF8Range Ethiopic_forward_range[] = {
+	{ 225, 225, 6 }, { 226, 226, 3 }, { 234, 234, 1 }, { 172, 172, 2 }, { 129, 134, 0 }, { 137, 142, 0 },
+	{ 145, 150, 0 }, { 160, 166, 0 }, { 168, 174, 0 }, { 182, 182, 5 }, { 183, 183, 4 }, { 128, 134, 0 },
+	{ 136, 142, 0 }, { 144, 150, 0 }, { 152, 158, 0 }, { 128, 150, 0 }, { 160, 166, 0 }, { 168, 174, 0 },
+	{ 176, 182, 0 }, { 184, 190, 0 }, { 136, 136, 13 }, { 137, 137, 12 }, { 138, 138, 11 }, { 139, 139, 10 },
+	{ 140, 140, 9 }, { 141, 141, 8 }, { 142, 142, 7 }, { 128, 153, 0 }, { 128, 154, 0 }, { 157, 188, 0 },
+	{ 128, 144, 0 }, { 146, 149, 0 }, { 152, 191, 0 }, { 128, 128, 0 }, { 130, 133, 0 }, { 136, 150, 0 },
+	{ 152, 191, 0 }, { 128, 136, 0 }, { 138, 141, 0 }, { 144, 176, 0 }, { 178, 181, 0 }, { 184, 190, 0 },
+	{ 128, 136, 0 }, { 138, 141, 0 }, { 144, 150, 0 }, { 152, 152, 0 }, { 154, 157, 0 }, { 160, 191, 0 },
+	{ 128, 191, 0 },
+};
+static const uint16_t Ethiopic_reverse_state[] = {
+	0, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46,
+	47, 48, 49,
+};
+static const UTF8Range Ethiopic_reverse_range[] = {
+	{ 128, 128, 12 }, { 128, 134, 10 }, { 128, 136, 9 }, { 128, 136, 8 }, { 128, 144, 7 }, { 128, 150, 6 },
+	{ 128, 153, 5 }, { 128, 154, 4 }, { 128, 191, 3 }, { 129, 134, 1 }, { 130, 133, 12 }, { 136, 142, 10 },
+	{ 136, 150, 12 }, { 137, 142, 1 }, { 138, 141, 9 }, { 138, 141, 8 }, { 144, 150, 10 }, { 144, 150, 8 },
+	{ 144, 176, 9 }, { 145, 150, 1 }, { 146, 149, 7 }, { 152, 152, 8 }, { 152, 158, 10 }, { 152, 191, 7 },
+	{ 152, 191, 12 }, { 154, 157, 8 }, { 157, 188, 4 }, { 160, 166, 1 }, { 160, 166, 6 }, { 160, 191, 8 },
+	{ 168, 174, 1 }, { 168, 174, 6 }, { 176, 182, 6 }, { 178, 181, 9 }, { 184, 190, 6 }, { 184, 190, 9 },
+	{ 172, 172, 2 }, { 234, 234, 0 }, { 136, 136, 13 }, { 141, 141, 13 }, { 142, 142, 13 }, { 182, 182, 11 },
+	{ 140, 140, 13 }, { 137, 137, 13 }, { 138, 138, 13 }, { 183, 183, 11 }, { 226, 226, 0 }, { 139, 139, 13 },
+	{ 225, 225, 0 },
+};
+static const uint16_t Georgian_forward_state[] = {
+	0, 2, 3, 6, 9, 11, 16, 17,
+};
+static const UTF8Range Georgian_forward_range[] = {
+	{ 225, 225, 3 }, { 226, 226, 1 }, { 180, 180, 2 }, { 128, 165, 0 }, { 167, 167, 0 }, { 173, 173, 0 },
+	{ 130, 130, 6 }, { 131, 131, 5 }, { 178, 178, 4 }, { 144, 186, 0 }, { 189, 191, 0 }, { 128, 133, 0 },
+	{ 135, 135, 0 }, { 141, 141, 0 }, { 144, 186, 0 }, { 188, 191, 0 }, { 160, 191, 0 },
+};
+static const uint16_t Georgian_reverse_state[] = {
+	0, 11, 12, 13, 14, 15, 16, 17,
+};
+static const UTF8Range Georgian_reverse_range[] = {
+	{ 128, 133, 5 }, { 128, 165, 3 }, { 135, 135, 5 }, { 141, 141, 5 }, { 144, 186, 2 }, { 144, 186, 5 },
+	{ 160, 191, 1 }, { 167, 167, 3 }, { 173, 173, 3 }, { 188, 191, 5 }, { 189, 191, 2 }, { 130, 130, 6 },
+	{ 178, 178, 6 }, { 180, 180, 4 }, { 226, 226, 0 }, { 131, 131, 6 }, { 225, 225, 0 },
+};
+static const uint16_t Glagolitic_forward_state[] = {
+	0, 2, 3, 4, 9, 11, 12, 14,
+};
+static const UTF8Range Glagolitic_forward_range[] = {
+	{ 226, 226, 4 }, { 240, 240, 1 }, { 158, 158, 2 }, { 128, 128, 3 }, { 128, 134, 0 }, { 136, 152, 0 },
+	{ 155, 161, 0 }, { 163, 164, 0 }, { 166, 170, 0 }, { 176, 176, 6 }, { 177, 177, 5 }, { 128, 158, 0 },
+	{ 128, 174, 0 }, { 176, 191, 0 },
+};
+static const uint16_t Glagolitic_reverse_state[] = {
+	0, 8, 9, 10, 11, 12, 13, 14,
+};
+static const UTF8Range Glagolitic_reverse_range[] = {
+	{ 128, 134, 4 }, { 128, 158, 2 }, { 128, 174, 1 }, { 136, 152, 4 }, { 155, 161, 4 }, { 163, 164, 4 },
+	{ 166, 170, 4 }, { 176, 191, 1 }, { 176, 176, 3 }, { 177, 177, 3 }, { 226, 226, 0 }, { 128, 128, 5 },
+	{ 158, 158, 6 }, { 240, 240, 0 },
+};
+static const uint16_t Gothic_forward_state[] = {
+	0, 1, 2, 4, 5, 6,
+};
+static const UTF8Range Gothic_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 140, 140, 4 }, { 141, 141, 3 }, { 128, 138, 0 }, { 176, 191, 0 },
+};
+static const uint16_t Gothic_reverse_state[] = {
+	0, 2, 3, 4, 5, 6,
+};
+static const UTF8Range Gothic_reverse_range[] = {
+	{ 128, 138, 2 }, { 176, 191, 1 }, { 140, 140, 3 }, { 141, 141, 3 }, { 144, 144, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Grantha_forward_state[] = {
+	0, 1, 2, 4, 12, 20,
+};
+static const UTF8Range Grantha_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 140, 140, 4 }, { 141, 141, 3 }, { 128, 132, 0 }, { 135, 136, 0 },
+	{ 139, 141, 0 }, { 144, 144, 0 }, { 151, 151, 0 }, { 157, 163, 0 }, { 166, 172, 0 }, { 176, 180, 0 },
+	{ 128, 131, 0 }, { 133, 140, 0 }, { 143, 144, 0 }, { 147, 168, 0 }, { 170, 176, 0 }, { 178, 179, 0 },
+	{ 181, 185, 0 }, { 188, 191, 0 },
+};
+static const uint16_t Grantha_reverse_state[] = {
+	0, 16, 17, 18, 19, 20,
+};
+static const UTF8Range Grantha_reverse_range[] = {
+	{ 128, 131, 2 }, { 128, 132, 1 }, { 133, 140, 2 }, { 135, 136, 1 }, { 139, 141, 1 }, { 143, 144, 2 },
+	{ 144, 144, 1 }, { 147, 168, 2 }, { 151, 151, 1 }, { 157, 163, 1 }, { 166, 172, 1 }, { 170, 176, 2 },
+	{ 176, 180, 1 }, { 178, 179, 2 }, { 181, 185, 2 }, { 188, 191, 2 }, { 141, 141, 3 }, { 140, 140, 3 },
+	{ 145, 145, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Greek_forward_state[] = {
+	0, 7, 9, 11, 12, 14, 16, 17, 18, 19, 20, 21,
+	28, 34, 36, 43, 46, 47, 49, 50, 52, 58, 62,
+};
+static const UTF8Range Greek_forward_range[] = {
+	{ 205, 205, 21 }, { 206, 206, 20 }, { 207, 207, 19 }, { 225, 225, 11 }, { 226, 226, 9 }, { 234, 234, 7 },
+	{ 240, 240, 1 }, { 144, 144, 4 }, { 157, 157, 2 }, { 136, 136, 6 }, { 137, 137, 3 }, { 128, 133, 0 },
+	{ 133, 133, 6 }, { 134, 134, 5 }, { 128, 142, 0 }, { 160, 160, 0 }, { 128, 191, 0 }, { 173, 173, 8 },
+	{ 165, 165, 0 }, { 132, 132, 10 }, { 166, 166, 0 }, { 180, 180, 18 }, { 181, 181, 17 }, { 182, 182, 16 },
+	{ 188, 188, 15 }, { 189, 189, 14 }, { 190, 190, 13 }, { 191, 191, 12 }, { 128, 132, 0 }, { 134, 147, 0 },
+	{ 150, 155, 0 }, { 157, 175, 0 }, { 178, 180, 0 }, { 182, 190, 0 }, { 128, 180, 0 }, { 182, 191, 0 },
+	{ 128, 133, 0 }, { 136, 141, 0 }, { 144, 151, 0 }, { 153, 153, 0 }, { 155, 155, 0 }, { 157, 157, 0 },
+	{ 159, 189, 0 }, { 128, 149, 0 }, { 152, 157, 0 }, { 160, 191, 0 }, { 191, 191, 0 }, { 157, 161, 0 },
+	{ 166, 170, 0 }, { 166, 170, 0 }, { 128, 161, 0 }, { 176, 191, 0 }, { 132, 132, 0 }, { 134, 134, 0 },
+	{ 136, 138, 0 }, { 140, 140, 0 }, { 142, 161, 0 }, { 163, 191, 0 }, { 176, 179, 0 }, { 181, 183, 0 },
+	{ 186, 189, 0 }, { 191, 191, 0 },
+};
+static const uint16_t Greek_reverse_state[] = {
+	0, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 51,
+	52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62,
+};
+static const UTF8Range Greek_reverse_range[] = {
+	{ 128, 132, 20 }, { 128, 133, 17 }, { 128, 133, 16 }, { 128, 142, 14 }, { 128, 149, 13 }, { 128, 161, 12 },
+	{ 128, 180, 11 }, { 128, 191, 10 }, { 132, 132, 9 }, { 134, 134, 9 }, { 134, 147, 20 }, { 136, 138, 9 },
+	{ 136, 141, 16 }, { 140, 140, 9 }, { 142, 161, 9 }, { 144, 151, 16 }, { 150, 155, 20 }, { 152, 157, 13 },
+	{ 153, 153, 16 }, { 155, 155, 16 }, { 157, 157, 16 }, { 157, 161, 8 }, { 157, 175, 20 }, { 159, 189, 16 },
+	{ 160, 160, 14 }, { 160, 191, 13 }, { 163, 191, 9 }, { 165, 165, 6 }, { 166, 166, 4 }, { 166, 170, 8 },
+	{ 166, 170, 3 }, { 176, 179, 2 }, { 176, 191, 12 }, { 178, 180, 20 }, { 181, 183, 2 }, { 182, 190, 20 },
+	{ 182, 191, 11 }, { 186, 189, 2 }, { 191, 191, 1 }, { 191, 191, 2 }, { 182, 182, 21 }, { 205, 205, 0 },
+	{ 180, 180, 21 }, { 132, 132, 5 }, { 226, 226, 0 }, { 173, 173, 7 }, { 234, 234, 0 }, { 181, 181, 21 },
+	{ 206, 206, 0 }, { 133, 133, 15 }, { 136, 136, 18 }, { 190, 190, 21 }, { 207, 207, 0 }, { 188, 188, 21 },
+	{ 134, 134, 15 }, { 144, 144, 19 }, { 189, 189, 21 }, { 137, 137, 18 }, { 157, 157, 19 }, { 240, 240, 0 },
+	{ 191, 191, 21 }, { 225, 225, 0 },
+};
+static const uint16_t Gujarati_forward_state[] = {
+	0, 1, 3, 10, 18,
+};
+static const UTF8Range Gujarati_forward_range[] = {
+	{ 224, 224, 1 }, { 170, 170, 3 }, { 171, 171, 2 }, { 128, 133, 0 }, { 135, 137, 0 }, { 139, 141, 0 },
+	{ 144, 144, 0 }, { 160, 163, 0 }, { 166, 177, 0 }, { 185, 191, 0 }, { 129, 131, 0 }, { 133, 141, 0 },
+	{ 143, 145, 0 }, { 147, 168, 0 }, { 170, 176, 0 }, { 178, 179, 0 }, { 181, 185, 0 }, { 188, 191, 0 },
+};
+static const uint16_t Gujarati_reverse_state[] = {
+	0, 15, 16, 17, 18,
+};
+static const UTF8Range Gujarati_reverse_range[] = {
+	{ 128, 133, 2 }, { 129, 131, 1 }, { 133, 141, 1 }, { 135, 137, 2 }, { 139, 141, 2 }, { 143, 145, 1 },
+	{ 144, 144, 2 }, { 147, 168, 1 }, { 160, 163, 2 }, { 166, 177, 2 }, { 170, 176, 1 }, { 178, 179, 1 },
+	{ 181, 185, 1 }, { 185, 191, 2 }, { 188, 191, 1 }, { 170, 170, 3 }, { 171, 171, 3 }, { 224, 224, 0 },
+};
+static const uint16_t Gunjala_Gondi_forward_state[] = {
+	0, 1, 2, 4, 8, 11,
+};
+static const UTF8Range Gunjala_Gondi_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 181, 181, 4 }, { 182, 182, 3 }, { 128, 142, 0 }, { 144, 145, 0 },
+	{ 147, 152, 0 }, { 160, 169, 0 }, { 160, 165, 0 }, { 167, 168, 0 }, { 170, 191, 0 },
+};
+static const uint16_t Gunjala_Gondi_reverse_state[] = {
+	0, 7, 8, 9, 10, 11,
+};
+static const UTF8Range Gunjala_Gondi_reverse_range[] = {
+	{ 128, 142, 2 }, { 144, 145, 2 }, { 147, 152, 2 }, { 160, 165, 1 }, { 160, 169, 2 }, { 167, 168, 1 },
+	{ 170, 191, 1 }, { 181, 181, 3 }, { 182, 182, 3 }, { 145, 145, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Gurmukhi_forward_state[] = {
+	0, 1, 3, 10, 20,
+};
+static const UTF8Range Gurmukhi_forward_range[] = {
+	{ 224, 224, 1 }, { 168, 168, 3 }, { 169, 169, 2 }, { 128, 130, 0 }, { 135, 136, 0 }, { 139, 141, 0 },
+	{ 145, 145, 0 }, { 153, 156, 0 }, { 158, 158, 0 }, { 166, 182, 0 }, { 129, 131, 0 }, { 133, 138, 0 },
+	{ 143, 144, 0 }, { 147, 168, 0 }, { 170, 176, 0 }, { 178, 179, 0 }, { 181, 182, 0 }, { 184, 185, 0 },
+	{ 188, 188, 0 }, { 190, 191, 0 },
+};
+static const uint16_t Gurmukhi_reverse_state[] = {
+	0, 17, 18, 19, 20,
+};
+static const UTF8Range Gurmukhi_reverse_range[] = {
+	{ 128, 130, 2 }, { 129, 131, 1 }, { 133, 138, 1 }, { 135, 136, 2 }, { 139, 141, 2 }, { 143, 144, 1 },
+	{ 145, 145, 2 }, { 147, 168, 1 }, { 153, 156, 2 }, { 158, 158, 2 }, { 166, 182, 2 }, { 170, 176, 1 },
+	{ 178, 179, 1 }, { 181, 182, 1 }, { 184, 185, 1 }, { 188, 188, 1 }, { 190, 191, 1 }, { 168, 168, 3 },
+	{ 169, 169, 3 }, { 224, 224, 0 },
+};
+static const uint16_t Han_forward_state[] = {
+	0, 7, 17, 19, 20, 22, 24, 25, 28, 30, 35, 37,
+	38, 41, 42, 43, 44, 48, 49, 51, 53, 54, 55, 57,
+	59, 63, 67, 68, 69, 70, 72,
+};
+static const UTF8Range Han_forward_range[] = {
+	{ 226, 226, 25 }, { 227, 227, 23 }, { 228, 228, 22 }, { 229, 232, 21 }, { 233, 233, 19 }, { 239, 239, 16 },
+	{ 240, 240, 1 }, { 150, 150, 14 }, { 160, 169, 21 }, { 170, 170, 12 }, { 171, 171, 9 }, { 172, 172, 7 },
+	{ 173, 173, 21 }, { 174, 174, 5 }, { 175, 175, 4 }, { 176, 176, 21 }, { 177, 177, 2 }, { 128, 140, 27 },
+	{ 141, 141, 3 }, { 128, 138, 0 }, { 160, 167, 27 }, { 168, 168, 13 }, { 128, 174, 27 }, { 175, 175, 6 },
+	{ 128, 160, 0 }, { 128, 185, 27 }, { 186, 186, 8 }, { 187, 191, 27 }, { 128, 161, 0 }, { 176, 191, 0 },
+	{ 128, 155, 27 }, { 156, 156, 11 }, { 157, 159, 27 }, { 160, 160, 10 }, { 161, 191, 27 }, { 128, 157, 0 },
+	{ 160, 191, 0 }, { 128, 180, 0 }, { 128, 154, 27 }, { 155, 155, 13 }, { 156, 191, 27 }, { 128, 157, 0 },
+	{ 191, 191, 15 }, { 176, 177, 0 }, { 164, 168, 27 }, { 169, 169, 18 }, { 170, 170, 27 }, { 171, 171, 17 },
+	{ 128, 153, 0 }, { 128, 173, 0 }, { 176, 191, 0 }, { 128, 190, 27 }, { 191, 191, 20 }, { 128, 188, 0 },
+	{ 128, 191, 27 }, { 128, 182, 27 }, { 184, 191, 27 }, { 128, 128, 24 }, { 144, 191, 27 }, { 133, 133, 0 },
+	{ 135, 135, 0 }, { 161, 169, 0 }, { 184, 187, 0 }, { 186, 186, 29 }, { 187, 187, 28 }, { 188, 190, 27 },
+	{ 191, 191, 26 }, { 128, 149, 0 }, { 128, 191, 0 }, { 128, 179, 0 }, { 128, 153, 0 }, { 155, 191, 0 },
+};
+static const uint16_t Han_reverse_state[] = {
+	0, 22, 23, 24, 25, 43, 44, 48, 49, 50, 51, 52,
+	53, 54, 55, 56, 57, 58, 60, 61, 62, 63, 64, 65,
+	66, 67, 68, 69, 70, 71, 72,
+};
+static const UTF8Range Han_reverse_range[] = {
+	{ 128, 138, 27 }, { 128, 149, 25 }, { 128, 153, 23 }, { 128, 153, 22 }, { 128, 157, 20 }, { 128, 157, 17 },
+	{ 128, 160, 15 }, { 128, 161, 13 }, { 128, 173, 12 }, { 128, 179, 11 }, { 128, 180, 10 }, { 128, 188, 8 },
+	{ 128, 191, 4 }, { 133, 133, 3 }, { 135, 135, 3 }, { 155, 191, 22 }, { 160, 191, 20 }, { 161, 169, 3 },
+	{ 176, 177, 1 }, { 176, 191, 13 }, { 176, 191, 12 }, { 184, 187, 3 }, { 191, 191, 2 }, { 150, 150, 29 },
+	{ 128, 128, 5 }, { 128, 140, 28 }, { 128, 154, 19 }, { 128, 155, 21 }, { 128, 174, 16 }, { 128, 182, 7 },
+	{ 128, 185, 14 }, { 128, 190, 9 }, { 128, 191, 6 }, { 144, 191, 5 }, { 156, 191, 19 }, { 157, 159, 21 },
+	{ 160, 167, 18 }, { 161, 191, 21 }, { 164, 168, 24 }, { 170, 170, 24 }, { 184, 191, 7 }, { 187, 191, 14 },
+	{ 188, 190, 26 }, { 227, 227, 0 }, { 160, 169, 29 }, { 173, 173, 29 }, { 176, 176, 29 }, { 229, 232, 0 },
+	{ 228, 228, 0 }, { 191, 191, 9 }, { 233, 233, 0 }, { 156, 156, 21 }, { 187, 187, 26 }, { 169, 169, 24 },
+	{ 186, 186, 14 }, { 172, 172, 29 }, { 175, 175, 16 }, { 174, 174, 29 }, { 155, 155, 19 }, { 168, 168, 18 },
+	{ 175, 175, 29 }, { 170, 170, 29 }, { 160, 160, 21 }, { 171, 171, 29 }, { 186, 186, 26 }, { 171, 171, 24 },
+	{ 239, 239, 0 }, { 191, 191, 26 }, { 226, 226, 0 }, { 141, 141, 28 }, { 177, 177, 29 }, { 240, 240, 0 },
+};
+static const uint16_t Hangul_forward_state[] = {
+	0, 6, 8, 12, 15, 17, 19, 20, 22, 23, 29, 30,
+	31, 32, 33, 34, 35, 36,
+};
+static const UTF8Range Hangul_forward_range[] = {
+	{ 225, 225, 15 }, { 227, 227, 9 }, { 234, 234, 7 }, { 235, 236, 6 }, { 237, 237, 3 }, { 239, 239, 1 },
+	{ 190, 190, 10 }, { 191, 191, 2 }, { 130, 135, 0 }, { 138, 143, 0 }, { 146, 151, 0 }, { 154, 156, 0 },
+	{ 128, 157, 16 }, { 158, 158, 5 }, { 159, 159, 4 }, { 128, 134, 0 }, { 139, 187, 0 }, { 128, 163, 0 },
+	{ 176, 191, 0 }, { 128, 191, 16 }, { 165, 165, 8 }, { 176, 191, 16 }, { 160, 188, 0 }, { 128, 128, 14 },
+	{ 132, 132, 13 }, { 133, 133, 16 }, { 134, 134, 12 }, { 136, 136, 11 }, { 137, 137, 10 }, { 160, 190, 0 },
+	{ 128, 158, 0 }, { 128, 142, 0 }, { 177, 191, 0 }, { 174, 175, 0 }, { 132, 135, 16 }, { 128, 191, 0 },
+};
+static const uint16_t Hangul_reverse_state[] = {
+	0, 15, 16, 17, 19, 20, 21, 22, 27, 28, 29, 30,
+	31, 32, 33, 34, 35, 36,
+};
+static const UTF8Range Hangul_reverse_range[] = {
+	{ 128, 134, 15 }, { 128, 142, 13 }, { 128, 158, 12 }, { 128, 163, 11 }, { 128, 191, 7 }, { 130, 135, 5 },
+	{ 138, 143, 5 }, { 139, 187, 15 }, { 146, 151, 5 }, { 154, 156, 5 }, { 160, 188, 4 }, { 160, 190, 3 },
+	{ 174, 175, 2 }, { 176, 191, 11 }, { 177, 191, 1 }, { 132, 132, 14 }, { 128, 128, 14 }, { 137, 137, 14 },
+	{ 190, 190, 6 }, { 165, 165, 8 }, { 191, 191, 6 }, { 239, 239, 0 }, { 128, 157, 16 }, { 128, 191, 10 },
+	{ 132, 135, 9 }, { 133, 133, 14 }, { 176, 191, 8 }, { 234, 234, 0 }, { 225, 225, 0 }, { 235, 236, 0 },
+	{ 158, 158, 16 }, { 136, 136, 14 }, { 134, 134, 14 }, { 227, 227, 0 }, { 159, 159, 16 }, { 237, 237, 0 },
+};
+static const uint16_t Hanifi_Rohingya_forward_state[] = {
+	0, 1, 2, 3, 5,
+};
+static const UTF8Range Hanifi_Rohingya_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 180, 180, 3 }, { 128, 167, 0 }, { 176, 185, 0 },
+};
+static const uint16_t Hanifi_Rohingya_reverse_state[] = {
+	0, 2, 3, 4, 5,
+};
+static const UTF8Range Hanifi_Rohingya_reverse_range[] = {
+	{ 128, 167, 1 }, { 176, 185, 1 }, { 180, 180, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Hanunoo_forward_state[] = {
+	0, 1, 2, 3,
+};
+static const UTF8Range Hanunoo_forward_range[] = {
+	{ 225, 225, 1 }, { 156, 156, 2 }, { 160, 180, 0 },
+};
+static const uint16_t Hanunoo_reverse_state[] = {
+	0, 1, 2, 3,
+};
+static const UTF8Range Hanunoo_reverse_range[] = {
+	{ 160, 180, 1 }, { 156, 156, 2 }, { 225, 225, 0 },
+};
+static const uint16_t Hatran_forward_state[] = {
+	0, 1, 2, 3, 6,
+};
+static const UTF8Range Hatran_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 163, 163, 3 }, { 160, 178, 0 }, { 180, 181, 0 }, { 187, 191, 0 },
+};
+static const uint16_t Hatran_reverse_state[] = {
+	0, 3, 4, 5, 6,
+};
+static const UTF8Range Hatran_reverse_range[] = {
+	{ 160, 178, 1 }, { 180, 181, 1 }, { 187, 191, 1 }, { 163, 163, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Hebrew_forward_state[] = {
+	0, 3, 5, 8, 11, 14, 15,
+};
+static const UTF8Range Hebrew_forward_range[] = {
+	{ 214, 214, 5 }, { 215, 215, 4 }, { 239, 239, 1 }, { 172, 172, 3 }, { 173, 173, 2 }, { 128, 129, 0 },
+	{ 131, 132, 0 }, { 134, 143, 0 }, { 157, 182, 0 }, { 184, 188, 0 }, { 190, 190, 0 }, { 128, 135, 0 },
+	{ 144, 170, 0 }, { 175, 180, 0 }, { 145, 191, 0 },
+};
+static const uint16_t Hebrew_reverse_state[] = {
+	0, 10, 11, 12, 13, 14, 15,
+};
+static const UTF8Range Hebrew_reverse_range[] = {
+	{ 128, 129, 4 }, { 128, 135, 3 }, { 131, 132, 4 }, { 134, 143, 4 }, { 144, 170, 3 }, { 145, 191, 2 },
+	{ 157, 182, 1 }, { 175, 180, 3 }, { 184, 188, 1 }, { 190, 190, 1 }, { 172, 172, 5 }, { 214, 214, 0 },
+	{ 215, 215, 0 }, { 173, 173, 5 }, { 239, 239, 0 },
+};
+static const uint16_t Hiragana_forward_state[] = {
+	0, 2, 4, 5, 6, 10, 11, 12, 13, 15, 17, 18,
+};
+static const UTF8Range Hiragana_forward_range[] = {
+	{ 227, 227, 8 }, { 240, 240, 1 }, { 155, 155, 4 }, { 159, 159, 2 }, { 136, 136, 3 }, { 128, 128, 0 },
+	{ 128, 128, 10 }, { 129, 131, 7 }, { 132, 132, 6 }, { 133, 133, 5 }, { 144, 146, 0 }, { 128, 158, 0 },
+	{ 128, 191, 0 }, { 129, 129, 10 }, { 130, 130, 9 }, { 128, 150, 0 }, { 157, 159, 0 }, { 129, 191, 0 },
+};
+static const uint16_t Hiragana_reverse_state[] = {
+	0, 7, 8, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+};
+static const UTF8Range Hiragana_reverse_range[] = {
+	{ 128, 128, 8 }, { 128, 150, 6 }, { 128, 158, 4 }, { 128, 191, 3 }, { 129, 191, 2 }, { 144, 146, 1 },
+	{ 157, 159, 6 }, { 133, 133, 5 }, { 128, 128, 5 }, { 129, 129, 7 }, { 129, 131, 5 }, { 132, 132, 5 },
+	{ 155, 155, 10 }, { 130, 130, 7 }, { 227, 227, 0 }, { 136, 136, 9 }, { 159, 159, 10 }, { 240, 240, 0 },
+};
+static const uint16_t Imperial_Aramaic_forward_state[] = {
+	0, 1, 2, 3, 5,
+};
+static const UTF8Range Imperial_Aramaic_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 161, 161, 3 }, { 128, 149, 0 }, { 151, 159, 0 },
+};
+static const uint16_t Imperial_Aramaic_reverse_state[] = {
+	0, 2, 3, 4, 5,
+};
+static const UTF8Range Imperial_Aramaic_reverse_range[] = {
+	{ 128, 149, 1 }, { 151, 159, 1 }, { 161, 161, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Inherited_forward_state[] = {
+	0, 11, 12, 14, 17, 19, 22, 24, 25, 26, 28, 29,
+	30, 31, 33, 35, 36, 37, 39, 40, 41, 45, 47, 53,
+	54, 55, 56, 57, 59, 60, 61, 62,
+};
+static const UTF8Range Inherited_forward_range[] = {
+	{ 204, 204, 30 }, { 205, 205, 29 }, { 210, 210, 28 }, { 217, 217, 27 }, { 224, 224, 25 }, { 225, 225, 20 },
+	{ 226, 226, 17 }, { 227, 227, 14 }, { 239, 239, 12 }, { 240, 240, 3 }, { 243, 243, 1 }, { 160, 160, 2 },
+	{ 132, 134, 30 }, { 135, 135, 29 }, { 144, 144, 9 }, { 145, 145, 7 }, { 157, 157, 4 }, { 133, 133, 6 },
+	{ 134, 134, 5 }, { 128, 130, 0 }, { 133, 139, 0 }, { 170, 173, 0 }, { 167, 169, 0 }, { 187, 191, 0 },
+	{ 140, 140, 8 }, { 187, 187, 0 }, { 135, 135, 11 }, { 139, 139, 10 }, { 160, 160, 0 }, { 189, 189, 0 },
+	{ 184, 184, 13 }, { 128, 143, 0 }, { 160, 173, 0 }, { 128, 128, 16 }, { 130, 130, 15 }, { 153, 154, 0 },
+	{ 170, 173, 0 }, { 128, 128, 19 }, { 131, 131, 18 }, { 144, 176, 0 }, { 140, 141, 0 }, { 170, 170, 24 },
+	{ 171, 171, 23 }, { 179, 179, 22 }, { 183, 183, 21 }, { 128, 185, 0 }, { 187, 191, 0 }, { 144, 146, 0 },
+	{ 148, 160, 0 }, { 162, 168, 0 }, { 173, 173, 0 }, { 180, 180, 0 }, { 184, 185, 0 }, { 128, 128, 0 },
+	{ 176, 191, 0 }, { 165, 165, 26 }, { 145, 148, 0 }, { 139, 149, 0 }, { 176, 176, 0 }, { 133, 134, 0 },
+	{ 128, 175, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Inherited_reverse_state[] = {
+	0, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+	41, 42, 43, 44, 45, 46, 47, 48, 50, 51, 53, 54,
+	55, 56, 57, 58, 59, 60, 61, 62,
+};
+static const UTF8Range Inherited_reverse_range[] = {
+	{ 128, 128, 29 }, { 128, 130, 26 }, { 128, 143, 24 }, { 128, 175, 21 }, { 128, 185, 20 }, { 128, 191, 19 },
+	{ 133, 134, 18 }, { 133, 139, 26 }, { 139, 149, 17 }, { 140, 141, 15 }, { 144, 146, 14 }, { 144, 176, 13 },
+	{ 145, 148, 11 }, { 148, 160, 14 }, { 153, 154, 9 }, { 160, 160, 7 }, { 160, 173, 24 }, { 162, 168, 14 },
+	{ 167, 169, 6 }, { 170, 173, 26 }, { 170, 173, 5 }, { 173, 173, 14 }, { 176, 176, 17 }, { 176, 191, 4 },
+	{ 180, 180, 14 }, { 184, 185, 14 }, { 187, 187, 2 }, { 187, 191, 6 }, { 187, 191, 20 }, { 189, 189, 1 },
+	{ 135, 135, 8 }, { 140, 140, 3 }, { 145, 145, 28 }, { 170, 170, 30 }, { 128, 128, 10 }, { 133, 133, 27 },
+	{ 139, 139, 8 }, { 144, 144, 28 }, { 130, 130, 10 }, { 227, 227, 0 }, { 165, 165, 12 }, { 224, 224, 0 },
+	{ 131, 131, 16 }, { 179, 179, 30 }, { 128, 128, 16 }, { 226, 226, 0 }, { 217, 217, 0 }, { 210, 210, 0 },
+	{ 132, 134, 22 }, { 204, 204, 0 }, { 183, 183, 30 }, { 135, 135, 22 }, { 205, 205, 0 }, { 160, 160, 23 },
+	{ 243, 243, 0 }, { 184, 184, 25 }, { 239, 239, 0 }, { 134, 134, 27 }, { 157, 157, 28 }, { 240, 240, 0 },
+	{ 171, 171, 30 }, { 225, 225, 0 },
+};
+static const uint16_t Inscriptional_Pahlavi_forward_state[] = {
+	0, 1, 2, 3, 5,
+};
+static const UTF8Range Inscriptional_Pahlavi_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 173, 173, 3 }, { 160, 178, 0 }, { 184, 191, 0 },
+};
+static const uint16_t Inscriptional_Pahlavi_reverse_state[] = {
+	0, 2, 3, 4, 5,
+};
+static const UTF8Range Inscriptional_Pahlavi_reverse_range[] = {
+	{ 160, 178, 1 }, { 184, 191, 1 }, { 173, 173, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Inscriptional_Parthian_forward_state[] = {
+	0, 1, 2, 3, 5,
+};
+static const UTF8Range Inscriptional_Parthian_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 173, 173, 3 }, { 128, 149, 0 }, { 152, 159, 0 },
+};
+static const uint16_t Inscriptional_Parthian_reverse_state[] = {
+	0, 2, 3, 4, 5,
+};
+static const UTF8Range Inscriptional_Parthian_reverse_range[] = {
+	{ 128, 149, 1 }, { 152, 159, 1 }, { 173, 173, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Javanese_forward_state[] = {
+	0, 1, 3, 6, 7,
+};
+static const UTF8Range Javanese_forward_range[] = {
+	{ 234, 234, 1 }, { 166, 166, 3 }, { 167, 167, 2 }, { 128, 141, 0 }, { 144, 153, 0 }, { 158, 159, 0 },
+	{ 128, 191, 0 },
+};
+static const uint16_t Javanese_reverse_state[] = {
+	0, 4, 5, 6, 7,
+};
+static const UTF8Range Javanese_reverse_range[] = {
+	{ 128, 141, 2 }, { 128, 191, 1 }, { 144, 153, 2 }, { 158, 159, 2 }, { 166, 166, 3 }, { 167, 167, 3 },
+	{ 234, 234, 0 },
+};
+static const uint16_t Kaithi_forward_state[] = {
+	0, 1, 2, 4, 6, 7,
+};
+static const UTF8Range Kaithi_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 130, 130, 4 }, { 131, 131, 3 }, { 128, 129, 0 }, { 141, 141, 0 },
+	{ 128, 191, 0 },
+};
+static const uint16_t Kaithi_reverse_state[] = {
+	0, 3, 4, 5, 6, 7,
+};
+static const UTF8Range Kaithi_reverse_range[] = {
+	{ 128, 129, 2 }, { 128, 191, 1 }, { 141, 141, 2 }, { 130, 130, 3 }, { 131, 131, 3 }, { 145, 145, 4 },
+	{ 240, 240, 0 },
+};
+static const uint16_t Kannada_forward_state[] = {
+	0, 1, 3, 11, 17,
+};
+static const UTF8Range Kannada_forward_range[] = {
+	{ 224, 224, 1 }, { 178, 178, 3 }, { 179, 179, 2 }, { 128, 132, 0 }, { 134, 136, 0 }, { 138, 141, 0 },
+	{ 149, 150, 0 }, { 158, 158, 0 }, { 160, 163, 0 }, { 166, 175, 0 }, { 177, 178, 0 }, { 128, 140, 0 },
+	{ 142, 144, 0 }, { 146, 168, 0 }, { 170, 179, 0 }, { 181, 185, 0 }, { 188, 191, 0 },
+};
+static const uint16_t Kannada_reverse_state[] = {
+	0, 14, 15, 16, 17,
+};
+static const UTF8Range Kannada_reverse_range[] = {
+	{ 128, 132, 2 }, { 128, 140, 1 }, { 134, 136, 2 }, { 138, 141, 2 }, { 142, 144, 1 }, { 146, 168, 1 },
+	{ 149, 150, 2 }, { 158, 158, 2 }, { 160, 163, 2 }, { 166, 175, 2 }, { 170, 179, 1 }, { 177, 178, 2 },
+	{ 181, 185, 1 }, { 188, 191, 1 }, { 178, 178, 3 }, { 179, 179, 3 }, { 224, 224, 0 },
+};
+static const uint16_t Katakana_forward_state[] = {
+	0, 3, 4, 6, 7, 8, 10, 11, 13, 19, 20, 21,
+	22, 23, 25, 26,
+};
+static const UTF8Range Katakana_forward_range[] = {
+	{ 227, 227, 8 }, { 239, 239, 5 }, { 240, 240, 1 }, { 155, 155, 2 }, { 128, 128, 4 }, { 133, 133, 3 },
+	{ 164, 167, 0 }, { 128, 128, 0 }, { 189, 189, 7 }, { 190, 190, 6 }, { 128, 157, 0 }, { 166, 175, 0 },
+	{ 177, 191, 0 }, { 130, 130, 14 }, { 131, 131, 13 }, { 135, 135, 12 }, { 139, 139, 11 }, { 140, 140, 10 },
+	{ 141, 141, 9 }, { 128, 151, 0 }, { 128, 191, 0 }, { 144, 190, 0 }, { 176, 191, 0 }, { 128, 186, 0 },
+	{ 189, 191, 0 }, { 161, 191, 0 },
+};
+static const uint16_t Katakana_reverse_state[] = {
+	0, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+	23, 24, 25, 26,
+};
+static const UTF8Range Katakana_reverse_range[] = {
+	{ 128, 128, 12 }, { 128, 151, 10 }, { 128, 157, 8 }, { 128, 186, 7 }, { 128, 191, 6 }, { 144, 190, 5 },
+	{ 161, 191, 4 }, { 164, 167, 3 }, { 166, 175, 2 }, { 176, 191, 1 }, { 177, 191, 2 }, { 189, 191, 7 },
+	{ 135, 135, 11 }, { 189, 189, 9 }, { 133, 133, 13 }, { 130, 130, 11 }, { 139, 139, 11 }, { 140, 140, 11 },
+	{ 131, 131, 11 }, { 190, 190, 9 }, { 239, 239, 0 }, { 141, 141, 11 }, { 227, 227, 0 }, { 128, 128, 13 },
+	{ 155, 155, 14 }, { 240, 240, 0 },
+};
+static const uint16_t Kayah_Li_forward_state[] = {
+	0, 1, 2, 4,
+};
+static const UTF8Range Kayah_Li_forward_range[] = {
+	{ 234, 234, 1 }, { 164, 164, 2 }, { 128, 173, 0 }, { 175, 175, 0 },
+};
+static const uint16_t Kayah_Li_reverse_state[] = {
+	0, 2, 3, 4,
+};
+static const UTF8Range Kayah_Li_reverse_range[] = {
+	{ 128, 173, 1 }, { 175, 175, 1 }, { 164, 164, 2 }, { 234, 234, 0 },
+};
+static const uint16_t Kharoshthi_forward_state[] = {
+	0, 1, 2, 4, 6, 13,
+};
+static const UTF8Range Kharoshthi_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 168, 168, 4 }, { 169, 169, 3 }, { 128, 136, 0 }, { 144, 152, 0 },
+	{ 128, 131, 0 }, { 133, 134, 0 }, { 140, 147, 0 }, { 149, 151, 0 }, { 153, 181, 0 }, { 184, 186, 0 },
+	{ 191, 191, 0 },
+};
+static const uint16_t Kharoshthi_reverse_state[] = {
+	0, 9, 10, 11, 12, 13,
+};
+static const UTF8Range Kharoshthi_reverse_range[] = {
+	{ 128, 131, 2 }, { 128, 136, 1 }, { 133, 134, 2 }, { 140, 147, 2 }, { 144, 152, 1 }, { 149, 151, 2 },
+	{ 153, 181, 2 }, { 184, 186, 2 }, { 191, 191, 2 }, { 169, 169, 3 }, { 168, 168, 3 }, { 144, 144, 4 },
+	{ 240, 240, 0 },
+};
+static const uint16_t Khitan_Small_Script_forward_state[] = {
+	0, 1, 3, 5, 6, 7, 8, 9,
+};
+static const UTF8Range Khitan_Small_Script_forward_range[] = {
+	{ 240, 240, 1 }, { 150, 150, 5 }, { 152, 152, 2 }, { 172, 178, 4 }, { 179, 179, 3 }, { 128, 149, 0 },
+	{ 128, 191, 0 }, { 191, 191, 6 }, { 164, 164, 0 },
+};
+static const uint16_t Khitan_Small_Script_reverse_state[] = {
+	0, 3, 4, 5, 6, 7, 8, 9,
+};
+static const UTF8Range Khitan_Small_Script_reverse_range[] = {
+	{ 128, 149, 4 }, { 128, 191, 3 }, { 164, 164, 1 }, { 191, 191, 2 }, { 150, 150, 6 }, { 172, 178, 5 },
+	{ 179, 179, 5 }, { 152, 152, 6 }, { 240, 240, 0 },
+};
+static const uint16_t Khmer_forward_state[] = {
+	0, 1, 4, 5, 8, 9,
+};
+static const UTF8Range Khmer_forward_range[] = {
+	{ 225, 225, 1 }, { 158, 158, 4 }, { 159, 159, 3 }, { 167, 167, 2 }, { 160, 191, 0 }, { 128, 157, 0 },
+	{ 160, 169, 0 }, { 176, 185, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Khmer_reverse_state[] = {
+	0, 5, 6, 7, 8, 9,
+};
+static const UTF8Range Khmer_reverse_range[] = {
+	{ 128, 157, 3 }, { 128, 191, 2 }, { 160, 169, 3 }, { 160, 191, 1 }, { 176, 185, 3 }, { 167, 167, 4 },
+	{ 158, 158, 4 }, { 159, 159, 4 }, { 225, 225, 0 },
+};
+static const uint16_t Khojki_forward_state[] = {
+	0, 1, 2, 3, 5,
+};
+static const UTF8Range Khojki_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 136, 136, 3 }, { 128, 145, 0 }, { 147, 190, 0 },
+};
+static const uint16_t Khojki_reverse_state[] = {
+	0, 2, 3, 4, 5,
+};
+static const UTF8Range Khojki_reverse_range[] = {
+	{ 128, 145, 1 }, { 147, 190, 1 }, { 136, 136, 2 }, { 145, 145, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Khudawadi_forward_state[] = {
+	0, 1, 2, 4, 6, 7,
+};
+static const UTF8Range Khudawadi_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 138, 138, 4 }, { 139, 139, 3 }, { 128, 170, 0 }, { 176, 185, 0 },
+	{ 176, 191, 0 },
+};
+static const uint16_t Khudawadi_reverse_state[] = {
+	0, 3, 4, 5, 6, 7,
+};
+static const UTF8Range Khudawadi_reverse_range[] = {
+	{ 128, 170, 2 }, { 176, 185, 2 }, { 176, 191, 1 }, { 138, 138, 3 }, { 139, 139, 3 }, { 145, 145, 4 },
+	{ 240, 240, 0 },
+};
+static const uint16_t L_forward_state[] = {
+	0, 36, 56, 58, 59, 61, 63, 64, 67, 69, 74, 77,
+	78, 88, 93, 112, 121, 123, 124, 125, 127, 140, 142, 145,
+	148, 151, 155, 157, 161, 167, 169, 177, 179, 187, 189, 191,
+	192, 195, 200, 201, 202, 214, 216, 217, 219, 222, 223, 225,
+	227, 231, 232, 273, 274, 275, 277, 281, 284, 285, 287, 289,
+	291, 293, 296, 299, 301, 302, 308, 310, 311, 313, 314, 315,
+	316, 318, 319, 321, 322, 324, 330, 332, 335, 336, 340, 341,
+	342, 343, 344, 384, 386, 387, 390, 392, 393, 394, 396, 398,
+	399, 400, 404, 406, 408, 410, 412, 418, 420, 421, 423, 425,
+	427, 429, 432, 434, 435, 437, 438, 440, 445, 465, 469, 470,
+	472, 473, 475, 477, 479, 480, 481, 482, 483, 486, 493, 494,
+	496, 499, 501, 503, 532, 533, 536, 542, 547, 551, 556, 557,
+	561, 562, 564, 566, 569, 570, 574, 576, 578, 580, 582, 584,
+	587, 588, 589, 591, 592, 593, 595, 604, 605, 607, 609, 611,
+	614, 617, 631, 632, 636, 641, 643, 647, 650, 652, 654, 655,
+	657, 668, 669, 671, 717, 724, 727, 734, 737, 741, 744, 746,
+	747, 748, 751, 752, 753, 754, 755, 757, 758, 760, 762, 763,
+	764, 768, 769, 771, 772, 775, 778, 780, 782, 784, 785, 787,
+	789, 790, 793, 797, 802, 808, 813, 816, 822, 824, 855, 856,
+	858, 859, 862, 870, 872, 873, 877, 881, 885, 888, 895, 897,
+	902, 903, 913, 916, 923, 926, 933, 936, 943, 948, 956, 959,
+	961, 962, 964, 966, 970, 973, 975, 976, 978, 984, 987, 988,
+	990, 991, 994, 996, 998, 1000, 1005, 1009, 1014, 1015, 1018, 1021,
+};
+static const UTF8Range L_forward_range[] = {
+	{ 65, 90, 0 }, { 97, 122, 0 }, { 194, 194, 274 }, { 195, 195, 273 }, { 196, 202, 272 }, { 203, 203, 271 },
+	{ 205, 205, 270 }, { 206, 206, 269 }, { 207, 207, 268 }, { 208, 209, 272 }, { 210, 210, 267 }, { 211, 211, 272 },
+	{ 212, 212, 266 }, { 213, 213, 265 }, { 214, 214, 264 }, { 215, 215, 263 }, { 216, 216, 262 }, { 217, 217, 261 },
+	{ 218, 218, 272 }, { 219, 219, 260 }, { 220, 220, 259 }, { 221, 221, 258 }, { 222, 222, 257 }, { 223, 223, 256 },
+	{ 224, 224, 225 }, { 225, 225, 183 }, { 226, 226, 169 }, { 227, 227, 162 }, { 228, 228, 161 }, { 229, 232, 160 },
+	{ 233, 233, 158 }, { 234, 234, 135 }, { 235, 236, 160 }, { 237, 237, 132 }, { 239, 239, 116 }, { 240, 240, 1 },
+	{ 144, 144, 86 }, { 145, 145, 50 }, { 146, 146, 48 }, { 147, 147, 47 }, { 148, 148, 46 }, { 150, 150, 40 },
+	{ 151, 151, 160 }, { 152, 152, 37 }, { 155, 155, 32 }, { 157, 157, 20 }, { 158, 158, 12 }, { 160, 169, 160 },
+	{ 170, 170, 10 }, { 171, 171, 9 }, { 172, 172, 7 }, { 173, 173, 160 }, { 174, 174, 5 }, { 175, 175, 4 },
+	{ 176, 176, 160 }, { 177, 177, 2 }, { 128, 140, 272 }, { 141, 141, 3 }, { 128, 138, 0 }, { 160, 167, 272 },
+	{ 168, 168, 11 }, { 128, 174, 272 }, { 175, 175, 6 }, { 128, 160, 0 }, { 128, 185, 272 }, { 186, 186, 8 },
+	{ 187, 191, 272 }, { 128, 161, 0 }, { 176, 191, 0 }, { 128, 155, 272 }, { 156, 156, 75 }, { 157, 159, 272 },
+	{ 160, 160, 153 }, { 161, 191, 272 }, { 128, 154, 272 }, { 155, 155, 11 }, { 156, 191, 272 }, { 128, 157, 0 },
+	{ 132, 132, 19 }, { 133, 133, 18 }, { 139, 139, 67 }, { 160, 162, 272 }, { 163, 163, 17 }, { 164, 164, 272 },
+	{ 165, 165, 16 }, { 184, 184, 15 }, { 185, 185, 14 }, { 186, 186, 13 }, { 128, 137, 0 }, { 139, 155, 0 },
+	{ 161, 163, 0 }, { 165, 169, 0 }, { 171, 187, 0 }, { 130, 130, 0 }, { 135, 135, 0 }, { 137, 137, 0 },
+	{ 139, 139, 0 }, { 141, 143, 0 }, { 145, 146, 0 }, { 148, 148, 0 }, { 151, 151, 0 }, { 153, 153, 0 },
+	{ 155, 155, 0 }, { 157, 157, 0 }, { 159, 159, 0 }, { 161, 162, 0 }, { 164, 164, 0 }, { 167, 170, 0 },
+	{ 172, 178, 0 }, { 180, 183, 0 }, { 185, 188, 0 }, { 190, 190, 0 }, { 128, 131, 0 }, { 133, 159, 0 },
+	{ 161, 162, 0 }, { 164, 164, 0 }, { 167, 167, 0 }, { 169, 178, 0 }, { 180, 183, 0 }, { 185, 185, 0 },
+	{ 187, 187, 0 }, { 128, 131, 0 }, { 139, 139, 0 }, { 128, 132, 0 }, { 142, 142, 0 }, { 128, 172, 0 },
+	{ 183, 189, 0 }, { 144, 144, 272 }, { 145, 145, 31 }, { 146, 146, 30 }, { 147, 147, 29 }, { 148, 148, 28 },
+	{ 149, 149, 27 }, { 150, 153, 272 }, { 154, 154, 26 }, { 155, 155, 25 }, { 156, 156, 24 }, { 157, 157, 23 },
+	{ 158, 158, 22 }, { 159, 159, 21 }, { 128, 130, 0 }, { 132, 139, 0 }, { 128, 136, 0 }, { 138, 168, 0 },
+	{ 170, 191, 0 }, { 128, 142, 0 }, { 144, 174, 0 }, { 176, 191, 0 }, { 128, 148, 0 }, { 150, 180, 0 },
+	{ 182, 191, 0 }, { 128, 128, 0 }, { 130, 154, 0 }, { 156, 186, 0 }, { 188, 191, 0 }, { 128, 165, 0 },
+	{ 168, 191, 0 }, { 128, 132, 0 }, { 134, 134, 0 }, { 138, 144, 0 }, { 146, 191, 0 }, { 128, 133, 0 },
+	{ 135, 138, 0 }, { 141, 148, 0 }, { 150, 156, 0 }, { 158, 185, 0 }, { 187, 190, 0 }, { 128, 131, 0 },
+	{ 133, 191, 0 }, { 128, 156, 0 }, { 158, 159, 0 }, { 162, 162, 0 }, { 165, 166, 0 }, { 169, 172, 0 },
+	{ 174, 185, 0 }, { 187, 187, 0 }, { 189, 191, 0 }, { 128, 148, 0 }, { 150, 191, 0 }, { 128, 131, 272 },
+	{ 132, 132, 202 }, { 133, 133, 36 }, { 134, 138, 272 }, { 139, 139, 35 }, { 176, 176, 272 }, { 177, 177, 34 },
+	{ 178, 178, 33 }, { 128, 136, 0 }, { 144, 153, 0 }, { 128, 170, 0 }, { 176, 188, 0 }, { 128, 187, 0 },
+	{ 144, 146, 0 }, { 164, 167, 0 }, { 176, 191, 0 }, { 128, 158, 272 }, { 159, 159, 39 }, { 160, 178, 272 },
+	{ 179, 179, 38 }, { 180, 180, 264 }, { 128, 149, 0 }, { 128, 183, 0 }, { 160, 167, 272 }, { 168, 168, 205 },
+	{ 169, 169, 202 }, { 171, 171, 45 }, { 172, 172, 73 }, { 173, 173, 44 }, { 174, 174, 56 }, { 185, 185, 272 },
+	{ 188, 188, 272 }, { 189, 189, 43 }, { 190, 190, 42 }, { 191, 191, 41 }, { 160, 161, 0 }, { 163, 163, 0 },
+	{ 147, 159, 0 }, { 128, 138, 0 }, { 144, 144, 0 }, { 128, 131, 0 }, { 163, 183, 0 }, { 189, 191, 0 },
+	{ 144, 173, 0 }, { 144, 152, 272 }, { 153, 153, 232 }, { 128, 143, 272 }, { 144, 144, 71 }, { 128, 141, 272 },
+	{ 142, 142, 130 }, { 146, 148, 272 }, { 149, 149, 49 }, { 128, 131, 0 }, { 128, 128, 85 }, { 130, 130, 84 },
+	{ 131, 131, 83 }, { 132, 132, 82 }, { 133, 133, 81 }, { 134, 134, 80 }, { 135, 135, 79 }, { 136, 136, 78 },
+	{ 138, 138, 77 }, { 139, 139, 202 }, { 140, 140, 243 }, { 141, 141, 76 }, { 144, 144, 75 }, { 145, 145, 74 },
+	{ 146, 146, 73 }, { 147, 147, 72 }, { 150, 150, 71 }, { 151, 151, 70 }, { 152, 152, 73 }, { 153, 153, 69 },
+	{ 154, 154, 68 }, { 156, 156, 216 }, { 160, 160, 67 }, { 162, 162, 262 }, { 163, 163, 66 }, { 164, 164, 65 },
+	{ 165, 165, 64 }, { 166, 166, 63 }, { 167, 167, 62 }, { 168, 168, 61 }, { 169, 169, 60 }, { 170, 170, 59 },
+	{ 171, 171, 205 }, { 176, 176, 58 }, { 177, 177, 57 }, { 178, 178, 56 }, { 180, 180, 55 }, { 181, 181, 54 },
+	{ 182, 182, 53 }, { 187, 187, 52 }, { 190, 190, 51 }, { 176, 176, 0 }, { 160, 178, 0 }, { 128, 137, 0 },
+	{ 152, 152, 0 }, { 134, 134, 0 }, { 160, 165, 0 }, { 167, 168, 0 }, { 170, 191, 0 }, { 128, 134, 0 },
+	{ 136, 137, 0 }, { 139, 176, 0 }, { 128, 143, 0 }, { 128, 128, 0 }, { 178, 191, 0 }, { 128, 136, 0 },
+	{ 138, 174, 0 }, { 128, 137, 0 }, { 157, 157, 0 }, { 144, 144, 0 }, { 156, 191, 0 }, { 128, 128, 0 },
+	{ 139, 178, 0 }, { 186, 186, 0 }, { 128, 144, 0 }, { 161, 161, 0 }, { 163, 163, 0 }, { 160, 167, 0 },
+	{ 170, 191, 0 }, { 129, 129, 0 }, { 128, 134, 0 }, { 137, 137, 0 }, { 140, 147, 0 }, { 149, 150, 0 },
+	{ 152, 175, 0 }, { 191, 191, 0 }, { 128, 159, 0 }, { 191, 191, 0 }, { 128, 171, 0 }, { 128, 170, 0 },
+	{ 184, 184, 0 }, { 132, 132, 0 }, { 152, 155, 0 }, { 128, 174, 0 }, { 132, 133, 0 }, { 135, 135, 0 },
+	{ 128, 175, 0 }, { 135, 138, 0 }, { 159, 161, 0 }, { 128, 180, 0 }, { 144, 144, 0 }, { 157, 161, 0 },
+	{ 128, 134, 0 }, { 136, 136, 0 }, { 138, 141, 0 }, { 143, 157, 0 }, { 159, 168, 0 }, { 176, 191, 0 },
+	{ 128, 145, 0 }, { 147, 171, 0 }, { 129, 132, 0 }, { 154, 154, 0 }, { 156, 156, 0 }, { 131, 178, 0 },
+	{ 132, 132, 0 }, { 135, 135, 0 }, { 144, 178, 0 }, { 182, 182, 0 }, { 131, 166, 0 }, { 144, 168, 0 },
+	{ 131, 175, 0 }, { 131, 183, 0 }, { 128, 128, 115 }, { 129, 129, 114 }, { 130, 130, 272 }, { 131, 131, 113 },
+	{ 138, 138, 112 }, { 139, 139, 111 }, { 140, 140, 110 }, { 141, 141, 109 }, { 142, 142, 153 }, { 143, 143, 108 },
+	{ 144, 145, 272 }, { 146, 146, 107 }, { 147, 147, 106 }, { 148, 148, 105 }, { 149, 149, 191 }, { 152, 155, 272 },
+	{ 156, 156, 104 }, { 157, 157, 103 }, { 160, 160, 102 }, { 161, 161, 101 }, { 162, 162, 202 }, { 163, 163, 100 },
+	{ 164, 164, 99 }, { 166, 166, 98 }, { 168, 168, 97 }, { 169, 169, 96 }, { 170, 170, 95 }, { 171, 171, 94 },
+	{ 172, 172, 203 }, { 173, 173, 93 }, { 174, 174, 92 }, { 176, 176, 272 }, { 177, 177, 264 }, { 178, 179, 91 },
+	{ 180, 180, 191 }, { 186, 186, 90 }, { 188, 188, 89 }, { 189, 189, 88 }, { 190, 190, 163 }, { 191, 191, 87 },
+	{ 128, 132, 0 }, { 160, 182, 0 }, { 128, 133, 0 }, { 128, 156, 0 }, { 167, 167, 0 }, { 176, 191, 0 },
+	{ 128, 169, 0 }, { 176, 177, 0 }, { 128, 178, 0 }, { 128, 145, 0 }, { 128, 149, 0 }, { 160, 178, 0 },
+	{ 128, 135, 0 }, { 137, 164, 0 }, { 128, 156, 0 }, { 160, 188, 0 }, { 128, 128, 0 }, { 144, 147, 0 },
+	{ 149, 151, 0 }, { 153, 181, 0 }, { 128, 183, 0 }, { 190, 191, 0 }, { 128, 149, 0 }, { 160, 185, 0 },
+	{ 160, 178, 0 }, { 180, 181, 0 }, { 128, 149, 0 }, { 160, 182, 0 }, { 128, 133, 0 }, { 136, 136, 0 },
+	{ 138, 181, 0 }, { 183, 184, 0 }, { 188, 188, 0 }, { 191, 191, 0 }, { 128, 149, 0 }, { 160, 167, 0 },
+	{ 128, 182, 0 }, { 128, 167, 0 }, { 176, 191, 0 }, { 128, 147, 0 }, { 152, 187, 0 }, { 128, 157, 0 },
+	{ 176, 191, 0 }, { 128, 131, 0 }, { 136, 143, 0 }, { 128, 128, 0 }, { 130, 137, 0 }, { 144, 181, 0 },
+	{ 128, 159, 0 }, { 173, 191, 0 }, { 128, 144, 0 }, { 128, 156, 0 }, { 160, 191, 0 }, { 128, 186, 0 },
+	{ 128, 141, 0 }, { 144, 157, 0 }, { 128, 139, 0 }, { 141, 166, 0 }, { 168, 186, 0 }, { 188, 189, 0 },
+	{ 191, 191, 0 }, { 164, 168, 272 }, { 169, 169, 131 }, { 170, 170, 272 }, { 171, 171, 130 }, { 172, 172, 129 },
+	{ 173, 173, 128 }, { 174, 174, 127 }, { 175, 175, 126 }, { 176, 179, 272 }, { 180, 180, 125 }, { 181, 181, 124 },
+	{ 182, 182, 123 }, { 183, 183, 122 }, { 185, 185, 121 }, { 186, 186, 272 }, { 187, 187, 159 }, { 188, 188, 120 },
+	{ 189, 189, 119 }, { 190, 190, 118 }, { 191, 191, 117 }, { 130, 135, 0 }, { 138, 143, 0 }, { 146, 151, 0 },
+	{ 154, 156, 0 }, { 128, 190, 0 }, { 129, 154, 0 }, { 166, 191, 0 }, { 161, 186, 0 }, { 176, 180, 0 },
+	{ 182, 191, 0 }, { 128, 135, 0 }, { 176, 187, 0 }, { 128, 143, 0 }, { 146, 191, 0 }, { 144, 191, 0 },
+	{ 128, 189, 0 }, { 147, 191, 0 }, { 128, 177, 0 }, { 128, 129, 0 }, { 131, 132, 0 }, { 134, 191, 0 },
+	{ 128, 134, 0 }, { 147, 151, 0 }, { 157, 157, 0 }, { 159, 168, 0 }, { 170, 182, 0 }, { 184, 188, 0 },
+	{ 190, 190, 0 }, { 128, 153, 0 }, { 128, 173, 0 }, { 176, 191, 0 }, { 128, 157, 272 }, { 158, 158, 134 },
+	{ 159, 159, 133 }, { 128, 134, 0 }, { 139, 187, 0 }, { 128, 163, 0 }, { 176, 191, 0 }, { 128, 145, 272 },
+	{ 146, 146, 157 }, { 147, 147, 156 }, { 148, 151, 272 }, { 152, 152, 155 }, { 153, 153, 154 }, { 154, 154, 153 },
+	{ 155, 155, 192 }, { 156, 156, 152 }, { 157, 157, 272 }, { 158, 158, 151 }, { 159, 159, 150 }, { 160, 160, 149 },
+	{ 161, 161, 207 }, { 162, 162, 148 }, { 163, 163, 147 }, { 164, 164, 146 }, { 165, 165, 145 }, { 166, 166, 144 },
+	{ 167, 167, 143 }, { 168, 168, 142 }, { 169, 169, 141 }, { 170, 170, 140 }, { 171, 171, 139 }, { 172, 172, 138 },
+	{ 173, 173, 137 }, { 174, 174, 272 }, { 175, 175, 136 }, { 176, 191, 272 }, { 128, 162, 0 }, { 128, 154, 0 },
+	{ 156, 169, 0 }, { 176, 191, 0 }, { 129, 134, 0 }, { 137, 142, 0 }, { 145, 150, 0 }, { 160, 166, 0 },
+	{ 168, 174, 0 }, { 176, 191, 0 }, { 128, 128, 0 }, { 130, 130, 0 }, { 155, 157, 0 }, { 160, 170, 0 },
+	{ 178, 180, 0 }, { 128, 175, 0 }, { 177, 177, 0 }, { 181, 182, 0 }, { 185, 189, 0 }, { 128, 130, 0 },
+	{ 132, 139, 0 }, { 160, 182, 0 }, { 186, 186, 0 }, { 190, 191, 0 }, { 128, 168, 0 }, { 143, 143, 0 },
+	{ 160, 164, 0 }, { 166, 175, 0 }, { 186, 190, 0 }, { 132, 178, 0 }, { 128, 134, 0 }, { 160, 188, 0 },
+	{ 138, 165, 0 }, { 176, 191, 0 }, { 178, 183, 0 }, { 187, 187, 0 }, { 189, 190, 0 }, { 130, 179, 0 },
+	{ 128, 129, 0 }, { 131, 133, 0 }, { 135, 138, 0 }, { 140, 162, 0 }, { 130, 138, 0 }, { 181, 191, 0 },
+	{ 128, 136, 0 }, { 139, 191, 0 }, { 151, 159, 0 }, { 162, 191, 0 }, { 128, 157, 0 }, { 160, 191, 0 },
+	{ 128, 174, 0 }, { 191, 191, 0 }, { 128, 140, 0 }, { 144, 159, 0 }, { 170, 171, 0 }, { 144, 189, 0 },
+	{ 128, 140, 0 }, { 128, 190, 272 }, { 191, 191, 159 }, { 128, 188, 0 }, { 128, 191, 272 }, { 128, 182, 272 },
+	{ 184, 191, 272 }, { 128, 128, 168 }, { 129, 129, 213 }, { 130, 130, 167 }, { 131, 131, 166 }, { 132, 132, 165 },
+	{ 133, 133, 272 }, { 134, 134, 164 }, { 135, 135, 163 }, { 144, 191, 272 }, { 176, 191, 0 }, { 128, 142, 0 },
+	{ 160, 191, 0 }, { 133, 175, 0 }, { 177, 191, 0 }, { 128, 186, 0 }, { 188, 191, 0 }, { 128, 150, 0 },
+	{ 157, 159, 0 }, { 161, 191, 0 }, { 133, 134, 0 }, { 177, 181, 0 }, { 187, 188, 0 }, { 129, 129, 182 },
+	{ 130, 130, 181 }, { 132, 132, 180 }, { 133, 133, 179 }, { 134, 134, 178 }, { 176, 176, 177 }, { 177, 177, 176 },
+	{ 178, 178, 272 }, { 179, 179, 175 }, { 180, 180, 174 }, { 181, 181, 173 }, { 182, 182, 172 }, { 183, 183, 171 },
+	{ 184, 184, 170 }, { 175, 175, 0 }, { 128, 134, 0 }, { 136, 142, 0 }, { 144, 150, 0 }, { 152, 158, 0 },
+	{ 128, 150, 0 }, { 160, 166, 0 }, { 168, 174, 0 }, { 176, 182, 0 }, { 184, 190, 0 }, { 128, 167, 0 },
+	{ 175, 175, 0 }, { 128, 165, 0 }, { 167, 167, 0 }, { 173, 173, 0 }, { 176, 191, 0 }, { 128, 164, 0 },
+	{ 171, 174, 0 }, { 178, 179, 0 }, { 128, 158, 0 }, { 160, 191, 0 }, { 128, 174, 0 }, { 176, 191, 0 },
+	{ 131, 132, 0 }, { 133, 137, 0 }, { 142, 142, 0 }, { 130, 130, 0 }, { 135, 135, 0 }, { 138, 147, 0 },
+	{ 149, 149, 0 }, { 153, 157, 0 }, { 164, 164, 0 }, { 166, 166, 0 }, { 168, 168, 0 }, { 170, 173, 0 },
+	{ 175, 185, 0 }, { 188, 191, 0 }, { 144, 156, 0 }, { 177, 177, 0 }, { 191, 191, 0 }, { 128, 128, 224 },
+	{ 129, 129, 223 }, { 130, 130, 222 }, { 131, 131, 221 }, { 132, 136, 272 }, { 137, 137, 220 }, { 138, 138, 219 },
+	{ 139, 139, 218 }, { 140, 140, 217 }, { 141, 141, 216 }, { 142, 142, 215 }, { 143, 143, 214 }, { 144, 144, 213 },
+	{ 145, 152, 272 }, { 153, 153, 212 }, { 154, 154, 211 }, { 155, 155, 210 }, { 156, 156, 209 }, { 157, 157, 208 },
+	{ 158, 158, 207 }, { 159, 159, 206 }, { 160, 160, 262 }, { 161, 161, 205 }, { 162, 162, 204 }, { 163, 163, 203 },
+	{ 164, 164, 202 }, { 165, 165, 201 }, { 166, 166, 200 }, { 167, 167, 199 }, { 168, 168, 198 }, { 169, 169, 197 },
+	{ 170, 170, 196 }, { 172, 172, 195 }, { 173, 173, 194 }, { 174, 174, 193 }, { 175, 175, 192 }, { 176, 176, 191 },
+	{ 177, 177, 190 }, { 178, 178, 189 }, { 179, 179, 188 }, { 180, 182, 272 }, { 184, 187, 272 }, { 188, 188, 187 },
+	{ 189, 189, 186 }, { 190, 190, 185 }, { 191, 191, 184 }, { 130, 132, 0 }, { 134, 140, 0 }, { 144, 147, 0 },
+	{ 150, 155, 0 }, { 160, 172, 0 }, { 178, 180, 0 }, { 182, 188, 0 }, { 128, 180, 0 }, { 182, 188, 0 },
+	{ 190, 190, 0 }, { 128, 133, 0 }, { 136, 141, 0 }, { 144, 151, 0 }, { 153, 153, 0 }, { 155, 155, 0 },
+	{ 157, 157, 0 }, { 159, 189, 0 }, { 128, 149, 0 }, { 152, 157, 0 }, { 160, 191, 0 }, { 169, 172, 0 },
+	{ 174, 179, 0 }, { 181, 182, 0 }, { 186, 186, 0 }, { 128, 136, 0 }, { 144, 186, 0 }, { 189, 191, 0 },
+	{ 141, 143, 0 }, { 154, 189, 0 }, { 128, 163, 0 }, { 128, 165, 0 }, { 131, 160, 0 }, { 174, 175, 0 },
+	{ 186, 191, 0 }, { 133, 139, 0 }, { 133, 179, 0 }, { 167, 167, 0 }, { 128, 148, 0 }, { 128, 150, 0 },
+	{ 160, 191, 0 }, { 128, 137, 0 }, { 128, 171, 0 }, { 176, 191, 0 }, { 144, 173, 0 }, { 176, 180, 0 },
+	{ 128, 158, 0 }, { 128, 181, 0 }, { 128, 132, 0 }, { 135, 168, 0 }, { 170, 170, 0 }, { 176, 191, 0 },
+	{ 128, 184, 0 }, { 151, 151, 0 }, { 156, 156, 0 }, { 128, 179, 0 }, { 128, 145, 0 }, { 160, 172, 0 },
+	{ 174, 176, 0 }, { 128, 140, 0 }, { 142, 145, 0 }, { 160, 177, 0 }, { 128, 170, 0 }, { 177, 184, 0 },
+	{ 129, 154, 0 }, { 160, 191, 0 }, { 128, 172, 0 }, { 175, 191, 0 }, { 129, 191, 0 }, { 128, 181, 0 },
+	{ 184, 189, 0 }, { 128, 143, 0 }, { 160, 191, 0 }, { 128, 154, 0 }, { 128, 144, 0 }, { 146, 149, 0 },
+	{ 152, 191, 0 }, { 128, 128, 0 }, { 130, 133, 0 }, { 136, 150, 0 }, { 152, 191, 0 }, { 128, 136, 0 },
+	{ 138, 141, 0 }, { 144, 176, 0 }, { 178, 181, 0 }, { 184, 190, 0 }, { 128, 136, 0 }, { 138, 141, 0 },
+	{ 144, 150, 0 }, { 152, 152, 0 }, { 154, 157, 0 }, { 160, 191, 0 }, { 128, 133, 0 }, { 135, 135, 0 },
+	{ 141, 141, 0 }, { 144, 186, 0 }, { 188, 191, 0 }, { 128, 129, 0 }, { 142, 142, 0 }, { 160, 191, 0 },
+	{ 144, 149, 0 }, { 154, 157, 0 }, { 161, 161, 0 }, { 165, 166, 0 }, { 174, 176, 0 }, { 181, 191, 0 },
+	{ 128, 170, 0 }, { 191, 191, 0 }, { 160, 160, 255 }, { 161, 161, 254 }, { 162, 162, 253 }, { 163, 163, 252 },
+	{ 164, 164, 251 }, { 165, 165, 250 }, { 166, 166, 249 }, { 167, 167, 248 }, { 168, 168, 247 }, { 169, 169, 246 },
+	{ 170, 170, 245 }, { 171, 171, 244 }, { 172, 172, 243 }, { 173, 173, 242 }, { 174, 174, 241 }, { 175, 175, 240 },
+	{ 176, 176, 239 }, { 177, 177, 238 }, { 178, 178, 237 }, { 179, 179, 236 }, { 180, 180, 235 }, { 181, 181, 234 },
+	{ 182, 182, 233 }, { 183, 183, 232 }, { 184, 184, 231 }, { 185, 185, 232 }, { 186, 186, 230 }, { 187, 187, 229 },
+	{ 188, 188, 228 }, { 189, 189, 227 }, { 190, 190, 226 }, { 136, 140, 0 }, { 128, 135, 0 }, { 137, 172, 0 },
+	{ 128, 128, 0 }, { 128, 132, 0 }, { 134, 134, 0 }, { 156, 159, 0 }, { 129, 130, 0 }, { 132, 132, 0 },
+	{ 134, 138, 0 }, { 140, 163, 0 }, { 165, 165, 0 }, { 167, 176, 0 }, { 178, 179, 0 }, { 189, 189, 0 },
+	{ 129, 176, 0 }, { 178, 179, 0 }, { 128, 134, 0 }, { 133, 150, 0 }, { 154, 177, 0 }, { 179, 187, 0 },
+	{ 189, 189, 0 }, { 142, 142, 0 }, { 148, 150, 0 }, { 159, 161, 0 }, { 186, 191, 0 }, { 132, 140, 0 },
+	{ 142, 144, 0 }, { 146, 186, 0 }, { 189, 189, 0 }, { 158, 158, 0 }, { 160, 161, 0 }, { 177, 178, 0 },
+	{ 128, 128, 0 }, { 133, 140, 0 }, { 142, 144, 0 }, { 146, 168, 0 }, { 170, 179, 0 }, { 181, 185, 0 },
+	{ 189, 189, 0 }, { 152, 154, 0 }, { 160, 161, 0 }, { 133, 140, 0 }, { 142, 144, 0 }, { 146, 168, 0 },
+	{ 170, 185, 0 }, { 189, 189, 0 }, { 144, 144, 0 }, { 131, 131, 0 }, { 133, 138, 0 }, { 142, 144, 0 },
+	{ 146, 149, 0 }, { 153, 154, 0 }, { 156, 156, 0 }, { 158, 159, 0 }, { 163, 164, 0 }, { 168, 170, 0 },
+	{ 174, 185, 0 }, { 156, 157, 0 }, { 159, 161, 0 }, { 177, 177, 0 }, { 133, 140, 0 }, { 143, 144, 0 },
+	{ 147, 168, 0 }, { 170, 176, 0 }, { 178, 179, 0 }, { 181, 185, 0 }, { 189, 189, 0 }, { 144, 144, 0 },
+	{ 160, 161, 0 }, { 185, 185, 0 }, { 133, 141, 0 }, { 143, 145, 0 }, { 147, 168, 0 }, { 170, 176, 0 },
+	{ 178, 179, 0 }, { 181, 185, 0 }, { 189, 189, 0 }, { 153, 156, 0 }, { 158, 158, 0 }, { 178, 180, 0 },
+	{ 133, 138, 0 }, { 143, 144, 0 }, { 147, 168, 0 }, { 170, 176, 0 }, { 178, 179, 0 }, { 181, 182, 0 },
+	{ 184, 185, 0 }, { 142, 142, 0 }, { 156, 157, 0 }, { 159, 161, 0 }, { 176, 177, 0 }, { 188, 188, 0 },
+	{ 128, 128, 0 }, { 133, 140, 0 }, { 143, 144, 0 }, { 147, 168, 0 }, { 170, 176, 0 }, { 178, 178, 0 },
+	{ 182, 185, 0 }, { 189, 189, 0 }, { 144, 144, 0 }, { 152, 161, 0 }, { 177, 191, 0 }, { 132, 185, 0 },
+	{ 189, 189, 0 }, { 128, 135, 0 }, { 160, 180, 0 }, { 182, 191, 0 }, { 128, 152, 0 }, { 160, 170, 0 },
+	{ 128, 149, 0 }, { 154, 154, 0 }, { 164, 164, 0 }, { 168, 168, 0 }, { 138, 170, 0 }, { 180, 181, 0 },
+	{ 186, 186, 0 }, { 128, 165, 0 }, { 177, 177, 0 }, { 141, 191, 0 }, { 144, 144, 0 }, { 146, 175, 0 },
+	{ 128, 147, 0 }, { 149, 149, 0 }, { 165, 166, 0 }, { 174, 175, 0 }, { 186, 188, 0 }, { 191, 191, 0 },
+	{ 128, 138, 0 }, { 174, 175, 0 }, { 177, 191, 0 }, { 160, 191, 0 }, { 144, 170, 0 }, { 175, 178, 0 },
+	{ 128, 136, 0 }, { 128, 150, 0 }, { 153, 153, 0 }, { 160, 191, 0 }, { 128, 175, 0 }, { 177, 191, 0 },
+	{ 128, 129, 0 }, { 138, 191, 0 }, { 128, 181, 0 }, { 183, 191, 0 }, { 134, 134, 0 }, { 136, 138, 0 },
+	{ 140, 140, 0 }, { 142, 161, 0 }, { 163, 191, 0 }, { 176, 180, 0 }, { 182, 183, 0 }, { 186, 189, 0 },
+	{ 191, 191, 0 }, { 128, 129, 0 }, { 134, 145, 0 }, { 160, 164, 0 }, { 172, 172, 0 }, { 174, 174, 0 },
+	{ 128, 191, 0 }, { 128, 150, 0 }, { 152, 182, 0 }, { 184, 191, 0 }, { 170, 170, 0 }, { 181, 181, 0 },
+	{ 186, 186, 0 },
+};
+static const uint16_t L_reverse_state[] = {
+	0, 656, 657, 658, 660, 661, 662, 663, 664, 665, 666, 667,
+	668, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681,
+	682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693,
+	694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705,
+	706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717,
+	719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730,
+	731, 732, 733, 734, 735, 736, 737, 738, 739, 740, 741, 742,
+	743, 745, 746, 747, 748, 749, 750, 751, 752, 807, 813, 814,
+	815, 816, 818, 819, 820, 821, 822, 825, 826, 827, 828, 829,
+	830, 832, 833, 835, 837, 838, 839, 840, 841, 844, 845, 846,
+	848, 849, 850, 851, 852, 853, 855, 856, 857, 858, 859, 860,
+	861, 862, 863, 864, 866, 867, 868, 869, 872, 873, 874, 875,
+	876, 877, 878, 879, 880, 885, 886, 889, 890, 891, 893, 894,
+	895, 896, 897, 898, 899, 901, 902, 904, 905, 906, 907, 908,
+	909, 910, 911, 912, 913, 914, 915, 916, 917, 918, 919, 920,
+	921, 922, 923, 924, 925, 926, 927, 928, 929, 930, 932, 933,
+	934, 935, 936, 937, 938, 939, 940, 941, 942, 943, 944, 945,
+	946, 947, 948, 951, 952, 953, 954, 955, 956, 957, 958, 959,
+	960, 961, 962, 963, 964, 967, 968, 969, 970, 971, 972, 973,
+	974, 975, 976, 977, 978, 979, 980, 981, 982, 983, 984, 985,
+	986, 987, 988, 989, 990, 991, 992, 993, 994, 995, 996, 997,
+	998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009,
+	1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021,
+};
+static const UTF8Range L_reverse_range[] = {
+	{ 65, 90, 0 }, { 97, 122, 0 }, { 128, 128, 272 }, { 128, 128, 270 }, { 128, 128, 269 }, { 128, 128, 267 },
+	{ 128, 128, 266 }, { 128, 128, 264 }, { 128, 128, 262 }, { 128, 128, 260 }, { 128, 128, 259 }, { 128, 128, 258 },
+	{ 128, 129, 256 }, { 128, 129, 255 }, { 128, 129, 254 }, { 128, 129, 253 }, { 128, 129, 252 }, { 128, 130, 251 },
+	{ 128, 130, 250 }, { 128, 131, 248 }, { 128, 131, 247 }, { 128, 131, 246 }, { 128, 131, 244 }, { 128, 131, 242 },
+	{ 128, 131, 241 }, { 128, 132, 240 }, { 128, 132, 239 }, { 128, 132, 238 }, { 128, 132, 237 }, { 128, 132, 236 },
+	{ 128, 133, 235 }, { 128, 133, 234 }, { 128, 133, 233 }, { 128, 133, 232 }, { 128, 133, 231 }, { 128, 134, 230 },
+	{ 128, 134, 229 }, { 128, 134, 228 }, { 128, 134, 227 }, { 128, 134, 225 }, { 128, 134, 224 }, { 128, 134, 222 },
+	{ 128, 134, 220 }, { 128, 135, 219 }, { 128, 135, 218 }, { 128, 135, 217 }, { 128, 135, 216 }, { 128, 136, 215 },
+	{ 128, 136, 213 }, { 128, 136, 212 }, { 128, 136, 211 }, { 128, 136, 210 }, { 128, 136, 209 }, { 128, 136, 208 },
+	{ 128, 136, 206 }, { 128, 137, 205 }, { 128, 137, 204 }, { 128, 137, 203 }, { 128, 137, 202 }, { 128, 138, 200 },
+	{ 128, 138, 199 }, { 128, 138, 198 }, { 128, 139, 197 }, { 128, 140, 196 }, { 128, 140, 195 }, { 128, 140, 194 },
+	{ 128, 141, 193 }, { 128, 142, 192 }, { 128, 142, 190 }, { 128, 143, 189 }, { 128, 143, 188 }, { 128, 143, 187 },
+	{ 128, 144, 186 }, { 128, 144, 185 }, { 128, 144, 184 }, { 128, 145, 183 }, { 128, 145, 182 }, { 128, 145, 181 },
+	{ 128, 147, 180 }, { 128, 147, 179 }, { 128, 148, 178 }, { 128, 148, 177 }, { 128, 148, 176 }, { 128, 149, 175 },
+	{ 128, 149, 174 }, { 128, 149, 173 }, { 128, 149, 172 }, { 128, 149, 171 }, { 128, 149, 170 }, { 128, 149, 169 },
+	{ 128, 150, 168 }, { 128, 150, 167 }, { 128, 150, 166 }, { 128, 150, 165 }, { 128, 150, 164 }, { 128, 152, 163 },
+	{ 128, 153, 162 }, { 128, 154, 161 }, { 128, 154, 160 }, { 128, 156, 159 }, { 128, 156, 158 }, { 128, 156, 157 },
+	{ 128, 156, 156 }, { 128, 157, 153 }, { 128, 157, 152 }, { 128, 157, 150 }, { 128, 158, 149 }, { 128, 158, 148 },
+	{ 128, 159, 147 }, { 128, 159, 146 }, { 128, 160, 144 }, { 128, 161, 142 }, { 128, 162, 141 }, { 128, 163, 140 },
+	{ 128, 163, 139 }, { 128, 164, 138 }, { 128, 165, 137 }, { 128, 165, 136 }, { 128, 165, 135 }, { 128, 165, 134 },
+	{ 128, 167, 133 }, { 128, 167, 132 }, { 128, 168, 131 }, { 128, 169, 130 }, { 128, 170, 129 }, { 128, 170, 128 },
+	{ 128, 170, 127 }, { 128, 170, 126 }, { 128, 171, 125 }, { 128, 171, 124 }, { 128, 172, 123 }, { 128, 172, 122 },
+	{ 128, 173, 121 }, { 128, 174, 119 }, { 128, 174, 118 }, { 128, 174, 117 }, { 128, 175, 116 }, { 128, 175, 115 },
+	{ 128, 175, 114 }, { 128, 177, 113 }, { 128, 178, 112 }, { 128, 179, 111 }, { 128, 180, 110 }, { 128, 180, 109 },
+	{ 128, 181, 108 }, { 128, 181, 107 }, { 128, 181, 106 }, { 128, 182, 105 }, { 128, 183, 104 }, { 128, 183, 103 },
+	{ 128, 184, 102 }, { 128, 186, 101 }, { 128, 186, 100 }, { 128, 187, 99 }, { 128, 188, 97 }, { 128, 189, 96 },
+	{ 128, 190, 95 }, { 128, 191, 92 }, { 129, 129, 91 }, { 129, 130, 90 }, { 129, 132, 89 }, { 129, 134, 88 },
+	{ 129, 154, 87 }, { 129, 154, 86 }, { 129, 176, 85 }, { 129, 191, 84 }, { 130, 130, 83 }, { 130, 130, 264 },
+	{ 130, 130, 82 }, { 130, 132, 81 }, { 130, 133, 262 }, { 130, 135, 80 }, { 130, 137, 266 }, { 130, 138, 79 },
+	{ 130, 154, 272 }, { 130, 179, 78 }, { 131, 131, 77 }, { 131, 132, 256 }, { 131, 132, 76 }, { 131, 133, 255 },
+	{ 131, 160, 75 }, { 131, 166, 74 }, { 131, 175, 73 }, { 131, 178, 72 }, { 131, 183, 71 }, { 132, 132, 70 },
+	{ 132, 132, 69 }, { 132, 132, 90 }, { 132, 133, 68 }, { 132, 139, 251 }, { 132, 139, 250 }, { 132, 140, 67 },
+	{ 132, 178, 66 }, { 132, 185, 65 }, { 133, 134, 64 }, { 133, 137, 63 }, { 133, 138, 77 }, { 133, 138, 62 },
+	{ 133, 139, 61 }, { 133, 140, 259 }, { 133, 140, 60 }, { 133, 140, 59 }, { 133, 140, 258 }, { 133, 141, 58 },
+	{ 133, 150, 57 }, { 133, 159, 248 }, { 133, 175, 56 }, { 133, 179, 55 }, { 133, 191, 246 }, { 134, 134, 239 },
+	{ 134, 134, 54 }, { 134, 134, 236 }, { 134, 134, 53 }, { 134, 138, 90 }, { 134, 140, 81 }, { 134, 145, 252 },
+	{ 134, 191, 256 }, { 135, 135, 83 }, { 135, 135, 68 }, { 135, 135, 69 }, { 135, 135, 82 }, { 135, 135, 231 },
+	{ 135, 138, 235 }, { 135, 138, 52 }, { 135, 138, 255 }, { 135, 168, 237 }, { 136, 136, 228 }, { 136, 136, 233 },
+	{ 136, 137, 230 }, { 136, 138, 53 }, { 136, 140, 51 }, { 136, 141, 232 }, { 136, 142, 222 }, { 136, 143, 241 },
+	{ 136, 150, 262 }, { 137, 137, 83 }, { 137, 137, 229 }, { 137, 142, 88 }, { 137, 164, 219 }, { 137, 172, 217 },
+	{ 138, 141, 228 }, { 138, 141, 209 }, { 138, 141, 208 }, { 138, 143, 80 }, { 138, 144, 239 }, { 138, 147, 82 },
+	{ 138, 165, 50 }, { 138, 168, 215 }, { 138, 170, 49 }, { 138, 174, 212 }, { 138, 181, 233 }, { 138, 191, 253 },
+	{ 139, 139, 83 }, { 139, 139, 247 }, { 139, 155, 205 }, { 139, 176, 230 }, { 139, 178, 269 }, { 139, 187, 225 },
+	{ 139, 191, 211 }, { 140, 140, 53 }, { 140, 147, 229 }, { 140, 162, 255 }, { 140, 163, 90 }, { 141, 141, 231 },
+	{ 141, 143, 83 }, { 141, 143, 48 }, { 141, 148, 235 }, { 141, 166, 197 }, { 141, 191, 47 }, { 142, 142, 46 },
+	{ 142, 142, 63 }, { 142, 142, 254 }, { 142, 142, 45 }, { 142, 142, 44 }, { 142, 144, 67 }, { 142, 144, 259 },
+	{ 142, 144, 60 }, { 142, 144, 77 }, { 142, 145, 194 }, { 142, 161, 53 }, { 143, 143, 43 }, { 143, 144, 59 },
+	{ 143, 144, 62 }, { 143, 144, 258 }, { 143, 145, 58 }, { 143, 157, 228 }, { 144, 144, 199 }, { 144, 144, 42 },
+	{ 144, 144, 41 }, { 144, 144, 40 }, { 144, 144, 39 }, { 144, 144, 38 }, { 144, 144, 37 }, { 144, 146, 36 },
+	{ 144, 147, 267 }, { 144, 147, 81 }, { 144, 149, 35 }, { 144, 150, 222 }, { 144, 150, 208 }, { 144, 151, 232 },
+	{ 144, 153, 213 }, { 144, 156, 34 }, { 144, 157, 193 }, { 144, 159, 196 }, { 144, 168, 33 }, { 144, 170, 32 },
+	{ 144, 173, 31 }, { 144, 173, 30 }, { 144, 174, 192 }, { 144, 176, 209 }, { 144, 178, 69 }, { 144, 181, 266 },
+	{ 144, 186, 210 }, { 144, 186, 231 }, { 144, 189, 29 }, { 144, 191, 28 }, { 145, 146, 83 }, { 145, 150, 88 },
+	{ 146, 149, 184 }, { 146, 149, 77 }, { 146, 151, 80 }, { 146, 168, 259 }, { 146, 168, 60 }, { 146, 175, 37 },
+	{ 146, 186, 67 }, { 146, 191, 239 }, { 146, 191, 188 }, { 147, 151, 227 }, { 147, 159, 27 }, { 147, 168, 59 },
+	{ 147, 168, 58 }, { 147, 168, 62 }, { 147, 168, 258 }, { 147, 171, 183 }, { 147, 191, 26 }, { 148, 148, 83 },
+	{ 148, 150, 45 }, { 149, 149, 82 }, { 149, 149, 179 }, { 149, 150, 229 }, { 149, 151, 267 }, { 150, 155, 81 },
+	{ 150, 156, 235 }, { 150, 180, 178 }, { 150, 191, 177 }, { 151, 151, 83 }, { 151, 151, 25 }, { 151, 159, 24 },
+	{ 152, 152, 204 }, { 152, 152, 208 }, { 152, 154, 23 }, { 152, 155, 22 }, { 152, 157, 170 }, { 152, 158, 222 },
+	{ 152, 161, 38 }, { 152, 175, 229 }, { 152, 182, 164 }, { 152, 187, 180 }, { 152, 191, 184 }, { 152, 191, 262 },
+	{ 153, 153, 83 }, { 153, 153, 232 }, { 153, 153, 165 }, { 153, 154, 77 }, { 153, 156, 21 }, { 153, 157, 82 },
+	{ 153, 181, 267 }, { 154, 154, 89 }, { 154, 154, 169 }, { 154, 156, 80 }, { 154, 157, 208 }, { 154, 157, 35 },
+	{ 154, 177, 57 }, { 154, 189, 48 }, { 155, 155, 83 }, { 155, 155, 232 }, { 155, 157, 264 }, { 156, 156, 89 },
+	{ 156, 156, 25 }, { 156, 156, 77 }, { 156, 157, 20 }, { 156, 157, 44 }, { 156, 159, 236 }, { 156, 169, 161 },
+	{ 156, 186, 272 }, { 156, 191, 42 }, { 157, 157, 83 }, { 157, 157, 203 }, { 157, 157, 227 }, { 157, 157, 232 },
+	{ 157, 159, 168 }, { 157, 161, 41 }, { 158, 158, 19 }, { 158, 158, 21 }, { 158, 159, 159 }, { 158, 159, 77 },
+	{ 158, 185, 235 }, { 159, 159, 83 }, { 159, 161, 52 }, { 159, 161, 45 }, { 159, 161, 20 }, { 159, 161, 44 },
+	{ 159, 168, 228 }, { 159, 168, 227 }, { 159, 189, 232 }, { 160, 161, 18 }, { 160, 161, 19 }, { 160, 161, 23 },
+	{ 160, 161, 39 }, { 160, 164, 43 }, { 160, 164, 252 }, { 160, 165, 54 }, { 160, 166, 88 }, { 160, 166, 167 },
+	{ 160, 167, 17 }, { 160, 167, 171 }, { 160, 170, 264 }, { 160, 170, 163 }, { 160, 172, 81 }, { 160, 172, 181 },
+	{ 160, 177, 194 }, { 160, 178, 16 }, { 160, 178, 174 }, { 160, 178, 15 }, { 160, 180, 14 }, { 160, 182, 238 },
+	{ 160, 182, 172 }, { 160, 182, 250 }, { 160, 185, 173 }, { 160, 188, 13 }, { 160, 188, 224 }, { 160, 191, 156 },
+	{ 160, 191, 150 }, { 160, 191, 190 }, { 160, 191, 149 }, { 160, 191, 170 }, { 160, 191, 166 }, { 160, 191, 86 },
+	{ 160, 191, 187 }, { 160, 191, 208 }, { 160, 191, 254 }, { 160, 191, 12 }, { 160, 191, 165 }, { 161, 161, 186 },
+	{ 161, 161, 35 }, { 161, 162, 83 }, { 161, 162, 248 }, { 161, 163, 205 }, { 161, 186, 11 }, { 161, 191, 168 },
+	{ 162, 162, 159 }, { 162, 191, 24 }, { 163, 163, 18 }, { 163, 163, 186 }, { 163, 164, 77 }, { 163, 183, 244 },
+	{ 163, 191, 53 }, { 164, 164, 83 }, { 164, 164, 248 }, { 164, 164, 82 }, { 164, 164, 169 }, { 164, 167, 36 },
+	{ 165, 165, 90 }, { 165, 166, 159 }, { 165, 166, 35 }, { 165, 166, 179 }, { 165, 169, 205 }, { 166, 166, 82 },
+	{ 166, 175, 43 }, { 166, 191, 87 }, { 167, 167, 248 }, { 167, 167, 158 }, { 167, 167, 136 }, { 167, 167, 10 },
+	{ 167, 168, 54 }, { 167, 170, 83 }, { 167, 176, 90 }, { 168, 168, 82 }, { 168, 168, 169 }, { 168, 170, 77 },
+	{ 168, 174, 88 }, { 168, 174, 167 }, { 168, 186, 197 }, { 168, 191, 137 }, { 169, 172, 159 }, { 169, 172, 9 },
+	{ 169, 178, 248 }, { 170, 170, 237 }, { 170, 170, 8 }, { 170, 171, 196 }, { 170, 173, 82 }, { 170, 176, 59 },
+	{ 170, 176, 58 }, { 170, 176, 62 }, { 170, 176, 258 }, { 170, 179, 259 }, { 170, 182, 227 }, { 170, 185, 60 },
+	{ 170, 191, 215 }, { 170, 191, 54 }, { 170, 191, 17 }, { 171, 174, 138 }, { 171, 187, 205 }, { 172, 172, 252 },
+	{ 172, 178, 83 }, { 173, 173, 136 }, { 173, 191, 146 }, { 174, 174, 252 }, { 174, 175, 75 }, { 174, 175, 179 },
+	{ 174, 175, 198 }, { 174, 176, 181 }, { 174, 176, 35 }, { 174, 179, 9 }, { 174, 185, 159 }, { 174, 185, 77 },
+	{ 175, 175, 7 }, { 175, 175, 132 }, { 175, 178, 32 }, { 175, 185, 82 }, { 175, 191, 122 }, { 176, 176, 6 },
+	{ 176, 177, 130 }, { 176, 177, 44 }, { 176, 180, 5 }, { 176, 180, 30 }, { 176, 180, 4 }, { 176, 182, 167 },
+	{ 176, 187, 218 }, { 176, 188, 129 }, { 176, 191, 142 }, { 176, 191, 192 }, { 176, 191, 36 }, { 176, 191, 228 },
+	{ 176, 191, 158 }, { 176, 191, 133 }, { 176, 191, 152 }, { 176, 191, 121 }, { 176, 191, 140 }, { 176, 191, 161 },
+	{ 176, 191, 88 }, { 176, 191, 50 }, { 176, 191, 3 }, { 176, 191, 136 }, { 176, 191, 117 }, { 176, 191, 124 },
+	{ 176, 191, 237 }, { 177, 177, 115 }, { 177, 177, 2 }, { 177, 177, 20 }, { 177, 177, 134 }, { 177, 178, 19 },
+	{ 177, 181, 64 }, { 177, 184, 127 }, { 177, 191, 56 }, { 177, 191, 38 }, { 177, 191, 198 }, { 177, 191, 114 },
+	{ 178, 178, 258 }, { 178, 179, 138 }, { 178, 179, 90 }, { 178, 179, 85 }, { 178, 179, 59 }, { 178, 179, 58 },
+	{ 178, 179, 62 }, { 178, 180, 264 }, { 178, 180, 81 }, { 178, 180, 21 }, { 178, 181, 209 }, { 178, 183, 1 },
+	{ 178, 191, 270 }, { 179, 187, 57 }, { 180, 181, 15 }, { 180, 181, 49 }, { 180, 183, 83 }, { 180, 183, 248 },
+	{ 181, 181, 8 }, { 181, 182, 115 }, { 181, 182, 9 }, { 181, 182, 62 }, { 181, 185, 259 }, { 181, 185, 59 },
+	{ 181, 185, 58 }, { 181, 191, 79 }, { 181, 191, 35 }, { 182, 182, 69 }, { 182, 183, 4 }, { 182, 185, 258 },
+	{ 182, 188, 81 }, { 182, 188, 109 }, { 182, 191, 178 }, { 182, 191, 5 }, { 182, 191, 14 }, { 183, 184, 233 },
+	{ 183, 189, 123 }, { 183, 191, 106 }, { 184, 184, 128 }, { 184, 185, 62 }, { 184, 188, 227 }, { 184, 189, 107 },
+	{ 184, 190, 167 }, { 184, 190, 209 }, { 184, 191, 164 }, { 185, 185, 248 }, { 185, 185, 39 }, { 185, 188, 83 },
+	{ 185, 189, 115 }, { 186, 186, 269 }, { 186, 186, 250 }, { 186, 186, 9 }, { 186, 186, 49 }, { 186, 186, 8 },
+	{ 186, 188, 179 }, { 186, 189, 4 }, { 186, 190, 43 }, { 186, 191, 75 }, { 186, 191, 45 }, { 187, 187, 248 },
+	{ 187, 187, 159 }, { 187, 187, 1 }, { 187, 188, 64 }, { 187, 190, 235 }, { 188, 188, 233 }, { 188, 188, 44 },
+	{ 188, 189, 197 }, { 188, 191, 272 }, { 188, 191, 100 }, { 188, 191, 82 }, { 188, 191, 231 }, { 189, 189, 90 },
+	{ 189, 189, 57 }, { 189, 189, 67 }, { 189, 189, 259 }, { 189, 189, 60 }, { 189, 189, 59 }, { 189, 189, 58 },
+	{ 189, 189, 258 }, { 189, 189, 65 }, { 189, 190, 1 }, { 189, 191, 159 }, { 189, 191, 244 }, { 189, 191, 210 },
+	{ 190, 190, 83 }, { 190, 190, 227 }, { 190, 190, 109 }, { 190, 191, 103 }, { 190, 191, 250 }, { 191, 191, 229 },
+	{ 191, 191, 147 }, { 191, 191, 233 }, { 191, 191, 197 }, { 191, 191, 118 }, { 191, 191, 2 }, { 191, 191, 126 },
+	{ 191, 191, 179 }, { 191, 191, 4 }, { 163, 163, 265 }, { 129, 129, 223 }, { 135, 135, 191 }, { 190, 190, 268 },
+	{ 205, 205, 0 }, { 185, 185, 257 }, { 190, 190, 271 }, { 184, 184, 223 }, { 194, 194, 0 }, { 179, 179, 263 },
+	{ 170, 170, 263 }, { 188, 188, 257 }, { 160, 160, 263 }, { 162, 162, 271 }, { 216, 216, 0 }, { 169, 169, 268 },
+	{ 162, 162, 261 }, { 163, 163, 268 }, { 187, 187, 271 }, { 166, 166, 271 }, { 191, 191, 245 }, { 179, 179, 261 },
+	{ 173, 173, 261 }, { 169, 169, 261 }, { 151, 151, 271 }, { 177, 177, 261 }, { 156, 156, 265 }, { 159, 159, 263 },
+	{ 175, 175, 257 }, { 190, 190, 245 }, { 181, 181, 257 }, { 147, 147, 265 }, { 165, 165, 263 }, { 171, 171, 245 },
+	{ 215, 215, 0 }, { 131, 131, 271 }, { 130, 130, 223 }, { 129, 129, 263 }, { 133, 133, 214 }, { 220, 220, 0 },
+	{ 165, 165, 261 }, { 171, 171, 261 }, { 175, 175, 261 }, { 141, 141, 271 }, { 169, 169, 271 }, { 167, 167, 265 },
+	{ 167, 167, 261 }, { 181, 181, 261 }, { 133, 133, 249 }, { 221, 221, 0 }, { 177, 177, 263 }, { 223, 223, 0 },
+	{ 164, 164, 265 }, { 190, 190, 261 }, { 145, 145, 271 }, { 206, 206, 0 }, { 181, 181, 271 }, { 172, 172, 263 },
+	{ 132, 132, 191 }, { 182, 182, 261 }, { 170, 170, 261 }, { 140, 140, 271 }, { 172, 172, 261 }, { 176, 176, 261 },
+	{ 173, 173, 263 }, { 168, 168, 261 }, { 133, 133, 223 }, { 128, 128, 191 }, { 164, 164, 261 }, { 166, 166, 265 },
+	{ 180, 180, 261 }, { 147, 147, 271 }, { 133, 133, 271 }, { 153, 153, 271 }, { 128, 128, 271 }, { 134, 134, 271 },
+	{ 130, 130, 271 }, { 132, 132, 271 }, { 174, 174, 263 }, { 134, 134, 223 }, { 174, 174, 261 }, { 162, 162, 265 },
+	{ 159, 159, 265 }, { 191, 191, 257 }, { 191, 191, 263 }, { 132, 132, 223 }, { 185, 185, 249 }, { 129, 129, 191 },
+	{ 144, 144, 263 }, { 184, 184, 261 }, { 154, 154, 263 }, { 189, 189, 257 }, { 172, 172, 265 }, { 135, 135, 271 },
+	{ 186, 186, 261 }, { 165, 165, 271 }, { 128, 131, 214 }, { 128, 140, 201 }, { 128, 141, 243 }, { 128, 143, 120 },
+	{ 128, 145, 265 }, { 128, 154, 155 }, { 128, 155, 151 }, { 128, 157, 226 }, { 128, 158, 207 }, { 128, 174, 145 },
+	{ 128, 182, 94 }, { 128, 185, 143 }, { 128, 190, 98 }, { 128, 191, 93 }, { 130, 130, 268 }, { 132, 136, 263 },
+	{ 133, 133, 191 }, { 134, 138, 214 }, { 144, 144, 273 }, { 144, 145, 268 }, { 144, 152, 221 }, { 144, 191, 191 },
+	{ 145, 152, 263 }, { 146, 148, 243 }, { 148, 151, 265 }, { 150, 153, 273 }, { 152, 155, 268 }, { 156, 191, 155 },
+	{ 157, 157, 265 }, { 157, 159, 151 }, { 160, 162, 249 }, { 160, 167, 154 }, { 160, 167, 245 }, { 160, 178, 207 },
+	{ 161, 191, 151 }, { 164, 164, 249 }, { 164, 168, 257 }, { 170, 170, 257 }, { 174, 174, 265 }, { 176, 176, 214 },
+	{ 176, 176, 268 }, { 176, 179, 257 }, { 176, 191, 265 }, { 178, 178, 223 }, { 180, 182, 263 }, { 184, 187, 263 },
+	{ 184, 191, 94 }, { 185, 185, 245 }, { 186, 186, 257 }, { 187, 191, 143 }, { 188, 188, 245 }, { 196, 202, 0 },
+	{ 208, 209, 0 }, { 211, 211, 0 }, { 218, 218, 0 }, { 151, 151, 274 }, { 160, 169, 274 }, { 173, 173, 274 },
+	{ 176, 176, 274 }, { 229, 232, 0 }, { 235, 236, 0 }, { 228, 228, 0 }, { 190, 190, 257 }, { 180, 180, 257 },
+	{ 187, 187, 257 }, { 191, 191, 98 }, { 233, 233, 0 }, { 139, 139, 214 }, { 131, 131, 191 }, { 131, 131, 268 },
+	{ 161, 161, 263 }, { 168, 168, 245 }, { 171, 171, 271 }, { 166, 166, 268 }, { 159, 159, 207 }, { 156, 156, 268 },
+	{ 207, 207, 0 }, { 143, 143, 263 }, { 163, 163, 263 }, { 172, 172, 268 }, { 190, 190, 263 }, { 144, 144, 271 },
+	{ 156, 156, 151 }, { 158, 158, 263 }, { 161, 161, 265 }, { 178, 179, 268 }, { 174, 174, 257 }, { 212, 212, 0 },
+	{ 170, 170, 265 }, { 146, 146, 271 }, { 152, 152, 271 }, { 172, 172, 245 }, { 176, 176, 223 }, { 153, 153, 265 },
+	{ 144, 144, 120 }, { 150, 150, 271 }, { 147, 147, 274 }, { 169, 169, 257 }, { 153, 153, 263 }, { 132, 132, 249 },
+	{ 166, 166, 263 }, { 139, 139, 249 }, { 160, 160, 271 }, { 128, 128, 263 }, { 155, 155, 263 }, { 154, 154, 271 },
+	{ 177, 177, 214 }, { 186, 186, 268 }, { 168, 168, 265 }, { 181, 181, 223 }, { 148, 148, 268 }, { 222, 222, 0 },
+	{ 155, 155, 265 }, { 175, 175, 263 }, { 180, 180, 223 }, { 154, 154, 273 }, { 179, 179, 223 }, { 149, 149, 268 },
+	{ 176, 176, 263 }, { 180, 180, 268 }, { 158, 158, 226 }, { 175, 175, 265 }, { 186, 186, 143 }, { 172, 172, 274 },
+	{ 175, 175, 145 }, { 174, 174, 274 }, { 140, 140, 268 }, { 163, 163, 271 }, { 132, 132, 214 }, { 139, 139, 271 },
+	{ 162, 162, 268 }, { 164, 164, 263 }, { 169, 169, 245 }, { 177, 177, 223 }, { 142, 142, 268 }, { 154, 154, 265 },
+	{ 160, 160, 151 }, { 171, 171, 274 }, { 146, 146, 268 }, { 155, 155, 155 }, { 168, 168, 154 }, { 175, 175, 274 },
+	{ 170, 170, 274 }, { 138, 138, 268 }, { 170, 170, 268 }, { 188, 188, 268 }, { 146, 146, 273 }, { 141, 141, 263 },
+	{ 156, 156, 271 }, { 173, 173, 265 }, { 142, 142, 243 }, { 171, 171, 257 }, { 161, 161, 261 }, { 195, 195, 0 },
+	{ 213, 213, 0 }, { 168, 168, 263 }, { 182, 182, 223 }, { 130, 130, 191 }, { 160, 160, 261 }, { 188, 188, 263 },
+	{ 157, 157, 268 }, { 161, 161, 268 }, { 164, 164, 268 }, { 173, 173, 268 }, { 179, 179, 207 }, { 169, 169, 263 },
+	{ 145, 145, 273 }, { 156, 156, 273 }, { 219, 219, 0 }, { 147, 147, 268 }, { 157, 157, 263 }, { 174, 174, 268 },
+	{ 136, 136, 271 }, { 140, 140, 263 }, { 139, 139, 268 }, { 167, 167, 271 }, { 142, 142, 263 }, { 182, 182, 257 },
+	{ 174, 174, 245 }, { 178, 178, 271 }, { 134, 134, 191 }, { 227, 227, 0 }, { 157, 157, 273 }, { 129, 129, 268 },
+	{ 156, 156, 263 }, { 146, 146, 265 }, { 152, 152, 265 }, { 128, 128, 268 }, { 217, 217, 0 }, { 189, 189, 245 },
+	{ 141, 141, 201 }, { 177, 177, 274 }, { 167, 167, 263 }, { 170, 170, 271 }, { 182, 182, 271 }, { 186, 186, 249 },
+	{ 177, 177, 268 }, { 180, 180, 207 }, { 214, 214, 0 }, { 152, 152, 274 }, { 137, 137, 263 }, { 138, 138, 263 },
+	{ 178, 178, 263 }, { 158, 158, 265 }, { 176, 176, 271 }, { 178, 178, 214 }, { 155, 155, 274 }, { 158, 158, 273 },
+	{ 163, 163, 261 }, { 189, 189, 261 }, { 183, 183, 257 }, { 171, 171, 268 }, { 153, 153, 221 }, { 183, 183, 261 },
+	{ 185, 185, 261 }, { 148, 148, 274 }, { 183, 183, 223 }, { 226, 226, 0 }, { 165, 165, 265 }, { 159, 159, 226 },
+	{ 237, 237, 0 }, { 172, 172, 257 }, { 138, 138, 271 }, { 164, 164, 271 }, { 180, 180, 271 }, { 131, 131, 263 },
+	{ 189, 189, 263 }, { 160, 160, 268 }, { 189, 189, 268 }, { 148, 148, 273 }, { 187, 187, 261 }, { 162, 162, 263 },
+	{ 191, 191, 268 }, { 149, 149, 273 }, { 163, 163, 249 }, { 143, 143, 268 }, { 149, 149, 243 }, { 146, 146, 274 },
+	{ 173, 173, 245 }, { 150, 150, 274 }, { 147, 147, 273 }, { 165, 165, 249 }, { 184, 184, 249 }, { 158, 158, 274 },
+	{ 169, 169, 265 }, { 159, 159, 273 }, { 203, 203, 0 }, { 210, 210, 0 }, { 130, 130, 263 }, { 160, 160, 265 },
+	{ 173, 173, 257 }, { 239, 239, 0 }, { 166, 166, 261 }, { 178, 178, 261 }, { 188, 188, 261 }, { 224, 224, 0 },
+	{ 139, 139, 263 }, { 225, 225, 0 }, { 171, 171, 265 }, { 234, 234, 0 }, { 141, 141, 268 }, { 168, 168, 268 },
+	{ 144, 144, 274 }, { 168, 168, 271 }, { 177, 177, 271 }, { 145, 145, 274 }, { 155, 155, 273 }, { 157, 157, 274 },
+	{ 240, 240, 0 },
+};
+static const uint16_t Lao_forward_state[] = {
+	0, 1, 3, 8, 14,
+};
+static const UTF8Range Lao_forward_range[] = {
+	{ 224, 224, 1 }, { 186, 186, 3 }, { 187, 187, 2 }, { 128, 132, 0 }, { 134, 134, 0 }, { 136, 141, 0 },
+	{ 144, 153, 0 }, { 156, 159, 0 }, { 129, 130, 0 }, { 132, 132, 0 }, { 134, 138, 0 }, { 140, 163, 0 },
+	{ 165, 165, 0 }, { 167, 189, 0 },
+};
+static const uint16_t Lao_reverse_state[] = {
+	0, 11, 12, 13, 14,
+};
+static const UTF8Range Lao_reverse_range[] = {
+	{ 128, 132, 2 }, { 129, 130, 1 }, { 132, 132, 1 }, { 134, 134, 2 }, { 134, 138, 1 }, { 136, 141, 2 },
+	{ 140, 163, 1 }, { 144, 153, 2 }, { 156, 159, 2 }, { 165, 165, 1 }, { 167, 189, 1 }, { 186, 186, 3 },
+	{ 187, 187, 3 }, { 224, 224, 0 },
+};
+static const uint16_t Latin_forward_state[] = {
+	0, 11, 14, 15, 16, 17, 23, 26, 27, 29, 31, 32,
+	38, 39, 40, 42, 44, 45, 47, 51, 52, 56, 58, 59,
+	60, 61, 64, 66,
+};
+static const UTF8Range Latin_forward_range[] = {
+	{ 65, 90, 0 }, { 97, 122, 0 }, { 194, 194, 26 }, { 195, 195, 25 }, { 196, 201, 24 }, { 202, 202, 23 },
+	{ 203, 203, 22 }, { 225, 225, 18 }, { 226, 226, 11 }, { 234, 234, 5 }, { 239, 239, 1 }, { 172, 172, 4 },
+	{ 188, 188, 3 }, { 189, 189, 2 }, { 129, 154, 0 }, { 161, 186, 0 }, { 128, 134, 0 }, { 156, 156, 10 },
+	{ 157, 157, 24 }, { 158, 158, 9 }, { 159, 159, 8 }, { 172, 172, 7 }, { 173, 173, 6 }, { 128, 154, 0 },
+	{ 156, 164, 0 }, { 166, 169, 0 }, { 176, 191, 0 }, { 130, 138, 0 }, { 181, 191, 0 }, { 128, 135, 0 },
+	{ 139, 191, 0 }, { 162, 191, 0 }, { 129, 129, 17 }, { 130, 130, 16 }, { 132, 132, 15 }, { 133, 133, 14 },
+	{ 134, 134, 13 }, { 177, 177, 12 }, { 160, 191, 0 }, { 128, 136, 0 }, { 142, 142, 0 }, { 160, 191, 0 },
+	{ 170, 171, 0 }, { 178, 178, 0 }, { 144, 156, 0 }, { 177, 177, 0 }, { 191, 191, 0 }, { 180, 180, 21 },
+	{ 181, 181, 20 }, { 182, 182, 19 }, { 184, 187, 24 }, { 128, 190, 0 }, { 128, 156, 0 }, { 162, 165, 0 },
+	{ 171, 183, 0 }, { 185, 191, 0 }, { 128, 165, 0 }, { 172, 191, 0 }, { 160, 164, 0 }, { 128, 184, 0 },
+	{ 128, 191, 0 }, { 128, 150, 0 }, { 152, 182, 0 }, { 184, 191, 0 }, { 170, 170, 0 }, { 186, 186, 0 },
+};
+static const uint16_t Latin_reverse_state[] = {
+	0, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+	49, 50, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62,
+	63, 64, 65, 66,
+};
+static const UTF8Range Latin_reverse_range[] = {
+	{ 65, 90, 0 }, { 97, 122, 0 }, { 128, 134, 25 }, { 128, 135, 23 }, { 128, 136, 21 }, { 128, 150, 20 },
+	{ 128, 154, 19 }, { 128, 156, 17 }, { 128, 165, 16 }, { 128, 184, 15 }, { 128, 190, 14 }, { 128, 191, 13 },
+	{ 129, 154, 12 }, { 130, 138, 11 }, { 139, 191, 23 }, { 142, 142, 10 }, { 144, 156, 9 }, { 152, 182, 20 },
+	{ 156, 164, 19 }, { 160, 164, 8 }, { 160, 191, 7 }, { 160, 191, 10 }, { 161, 186, 6 }, { 162, 165, 17 },
+	{ 162, 191, 5 }, { 166, 169, 19 }, { 170, 170, 4 }, { 170, 171, 3 }, { 171, 183, 17 }, { 172, 191, 16 },
+	{ 176, 191, 2 }, { 177, 177, 1 }, { 178, 178, 3 }, { 181, 191, 11 }, { 184, 191, 20 }, { 185, 191, 17 },
+	{ 186, 186, 4 }, { 191, 191, 1 }, { 129, 129, 22 }, { 172, 172, 24 }, { 132, 132, 22 }, { 194, 194, 0 },
+	{ 156, 156, 24 }, { 188, 188, 26 }, { 177, 177, 22 }, { 203, 203, 0 }, { 130, 130, 22 }, { 133, 133, 22 },
+	{ 159, 159, 24 }, { 189, 189, 26 }, { 157, 157, 24 }, { 184, 187, 18 }, { 196, 201, 0 }, { 182, 182, 18 },
+	{ 202, 202, 0 }, { 180, 180, 18 }, { 181, 181, 18 }, { 225, 225, 0 }, { 173, 173, 24 }, { 195, 195, 0 },
+	{ 134, 134, 22 }, { 226, 226, 0 }, { 158, 158, 24 }, { 234, 234, 0 }, { 172, 172, 26 }, { 239, 239, 0 },
+};
+static const uint16_t Lepcha_forward_state[] = {
+	0, 1, 3, 5, 7,
+};
+static const UTF8Range Lepcha_forward_range[] = {
+	{ 225, 225, 1 }, { 176, 176, 3 }, { 177, 177, 2 }, { 128, 137, 0 }, { 141, 143, 0 }, { 128, 183, 0 },
+	{ 187, 191, 0 },
+};
+static const uint16_t Lepcha_reverse_state[] = {
+	0, 4, 5, 6, 7,
+};
+static const UTF8Range Lepcha_reverse_range[] = {
+	{ 128, 137, 2 }, { 128, 183, 1 }, { 141, 143, 2 }, { 187, 191, 1 }, { 176, 176, 3 }, { 177, 177, 3 },
+	{ 225, 225, 0 },
+};
+static const uint16_t Limbu_forward_state[] = {
+	0, 1, 3, 5, 8,
+};
+static const UTF8Range Limbu_forward_range[] = {
+	{ 225, 225, 1 }, { 164, 164, 3 }, { 165, 165, 2 }, { 128, 128, 0 }, { 132, 143, 0 }, { 128, 158, 0 },
+	{ 160, 171, 0 }, { 176, 187, 0 },
+};
+static const uint16_t Limbu_reverse_state[] = {
+	0, 5, 6, 7, 8,
+};
+static const UTF8Range Limbu_reverse_range[] = {
+	{ 128, 128, 2 }, { 128, 158, 1 }, { 132, 143, 2 }, { 160, 171, 1 }, { 176, 187, 1 }, { 164, 164, 3 },
+	{ 165, 165, 3 }, { 225, 225, 0 },
+};
+static const uint16_t Linear_A_forward_state[] = {
+	0, 1, 2, 5, 7, 8, 9,
+};
+static const UTF8Range Linear_A_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 152, 155, 5 }, { 156, 156, 4 }, { 157, 157, 3 }, { 128, 149, 0 },
+	{ 160, 167, 0 }, { 128, 182, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Linear_A_reverse_state[] = {
+	0, 4, 5, 6, 7, 8, 9,
+};
+static const UTF8Range Linear_A_reverse_range[] = {
+	{ 128, 149, 3 }, { 128, 182, 2 }, { 128, 191, 1 }, { 160, 167, 3 }, { 152, 155, 4 }, { 156, 156, 4 },
+	{ 157, 157, 4 }, { 144, 144, 5 }, { 240, 240, 0 },
+};
+static const uint16_t Linear_B_forward_state[] = {
+	0, 1, 2, 6, 7, 8, 10, 15,
+};
+static const UTF8Range Linear_B_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 128, 128, 6 }, { 129, 129, 5 }, { 130, 130, 4 }, { 131, 131, 3 },
+	{ 128, 186, 0 }, { 128, 191, 0 }, { 128, 141, 0 }, { 144, 157, 0 }, { 128, 139, 0 }, { 141, 166, 0 },
+	{ 168, 186, 0 }, { 188, 189, 0 }, { 191, 191, 0 },
+};
+static const uint16_t Linear_B_reverse_state[] = {
+	0, 9, 10, 11, 12, 13, 14, 15,
+};
+static const UTF8Range Linear_B_reverse_range[] = {
+	{ 128, 139, 4 }, { 128, 141, 3 }, { 128, 186, 2 }, { 128, 191, 1 }, { 141, 166, 4 }, { 144, 157, 3 },
+	{ 168, 186, 4 }, { 188, 189, 4 }, { 191, 191, 4 }, { 130, 130, 5 }, { 131, 131, 5 }, { 129, 129, 5 },
+	{ 128, 128, 5 }, { 144, 144, 6 }, { 240, 240, 0 },
+};
+static const uint16_t Lisu_forward_state[] = {
+	0, 2, 3, 4, 5, 6, 7,
+};
+static const UTF8Range Lisu_forward_range[] = {
+	{ 234, 234, 4 }, { 240, 240, 1 }, { 145, 145, 2 }, { 190, 190, 3 }, { 176, 176, 0 }, { 147, 147, 5 },
+	{ 144, 191, 0 },
+};
+static const uint16_t Lisu_reverse_state[] = {
+	0, 2, 3, 4, 5, 6, 7,
+};
+static const UTF8Range Lisu_reverse_range[] = {
+	{ 144, 191, 4 }, { 176, 176, 1 }, { 190, 190, 2 }, { 145, 145, 3 }, { 240, 240, 0 }, { 147, 147, 5 },
+	{ 234, 234, 0 },
+};
+static const uint16_t Ll_forward_state[] = {
+	0, 25, 30, 32, 33, 34, 50, 53, 56, 59, 62, 65,
+	66, 67, 69, 71, 73, 74, 76, 79, 83, 85, 86, 87,
+	88, 89, 93, 94, 95, 96, 97, 99, 100, 102, 111, 112,
+	115, 120, 145, 173, 187, 201, 224, 232, 235, 256, 265, 266,
+	268, 275, 288, 295, 301, 305, 309, 337, 369, 370, 372, 373,
+	374, 376, 377, 378, 402, 433, 461, 478, 479, 497, 499, 503,
+	505, 512, 540, 566, 586, 617, 648, 650, 651,
+};
+static const UTF8Range Ll_forward_range[] = {
+	{ 97, 122, 0 }, { 194, 194, 79 }, { 195, 195, 78 }, { 196, 196, 77 }, { 197, 197, 76 }, { 198, 198, 75 },
+	{ 199, 199, 74 }, { 200, 200, 73 }, { 201, 201, 72 }, { 202, 202, 71 }, { 205, 205, 70 }, { 206, 206, 69 },
+	{ 207, 207, 68 }, { 208, 208, 67 }, { 209, 209, 66 }, { 210, 210, 65 }, { 211, 211, 64 }, { 212, 212, 63 },
+	{ 213, 213, 62 }, { 214, 214, 61 }, { 225, 225, 49 }, { 226, 226, 42 }, { 234, 234, 33 }, { 239, 239, 30 },
+	{ 240, 240, 1 }, { 144, 144, 25 }, { 145, 145, 23 }, { 150, 150, 22 }, { 157, 157, 5 }, { 158, 158, 2 },
+	{ 164, 164, 4 }, { 165, 165, 3 }, { 128, 131, 0 }, { 162, 191, 0 }, { 144, 144, 21 }, { 145, 145, 20 },
+	{ 146, 146, 19 }, { 147, 147, 18 }, { 148, 148, 17 }, { 149, 149, 16 }, { 150, 150, 15 }, { 151, 151, 14 },
+	{ 152, 152, 13 }, { 153, 153, 12 }, { 154, 154, 11 }, { 155, 155, 10 }, { 156, 156, 9 }, { 157, 157, 8 },
+	{ 158, 158, 7 }, { 159, 159, 6 }, { 128, 130, 0 }, { 132, 137, 0 }, { 139, 139, 0 }, { 128, 136, 0 },
+	{ 138, 143, 0 }, { 170, 191, 0 }, { 128, 142, 0 }, { 144, 149, 0 }, { 176, 191, 0 }, { 128, 148, 0 },
+	{ 150, 155, 0 }, { 182, 191, 0 }, { 130, 154, 0 }, { 156, 161, 0 }, { 188, 191, 0 }, { 138, 165, 0 },
+	{ 150, 175, 0 }, { 128, 135, 0 }, { 162, 187, 0 }, { 128, 147, 0 }, { 174, 191, 0 }, { 134, 159, 0 },
+	{ 186, 191, 0 }, { 146, 171, 0 }, { 128, 131, 0 }, { 158, 183, 0 }, { 128, 131, 0 }, { 133, 143, 0 },
+	{ 170, 191, 0 }, { 130, 155, 0 }, { 182, 185, 0 }, { 187, 187, 0 }, { 189, 191, 0 }, { 142, 148, 0 },
+	{ 150, 167, 0 }, { 154, 179, 0 }, { 185, 185, 62 }, { 163, 163, 24 }, { 128, 159, 0 }, { 144, 144, 29 },
+	{ 145, 145, 28 }, { 147, 147, 27 }, { 179, 179, 26 }, { 128, 178, 0 }, { 152, 187, 0 }, { 128, 143, 0 },
+	{ 168, 191, 0 }, { 172, 172, 32 }, { 189, 189, 31 }, { 129, 154, 0 }, { 128, 134, 0 }, { 147, 151, 0 },
+	{ 153, 153, 41 }, { 154, 154, 40 }, { 156, 156, 39 }, { 157, 157, 38 }, { 158, 158, 37 }, { 159, 159, 36 },
+	{ 172, 172, 67 }, { 173, 173, 35 }, { 174, 174, 34 }, { 128, 191, 0 }, { 128, 154, 0 }, { 160, 168, 0 },
+	{ 176, 191, 0 }, { 131, 131, 0 }, { 136, 136, 0 }, { 138, 138, 0 }, { 182, 182, 0 }, { 186, 186, 0 },
+	{ 129, 129, 0 }, { 131, 131, 0 }, { 133, 133, 0 }, { 135, 135, 0 }, { 140, 140, 0 }, { 142, 142, 0 },
+	{ 145, 145, 0 }, { 147, 149, 0 }, { 151, 151, 0 }, { 153, 153, 0 }, { 155, 155, 0 }, { 157, 157, 0 },
+	{ 159, 159, 0 }, { 161, 161, 0 }, { 163, 163, 0 }, { 165, 165, 0 }, { 167, 167, 0 }, { 169, 169, 0 },
+	{ 175, 175, 0 }, { 181, 181, 0 }, { 183, 183, 0 }, { 185, 185, 0 }, { 187, 187, 0 }, { 189, 189, 0 },
+	{ 191, 191, 0 }, { 129, 129, 0 }, { 131, 131, 0 }, { 133, 133, 0 }, { 135, 135, 0 }, { 137, 137, 0 },
+	{ 139, 139, 0 }, { 141, 141, 0 }, { 143, 143, 0 }, { 145, 145, 0 }, { 147, 147, 0 }, { 149, 149, 0 },
+	{ 151, 151, 0 }, { 153, 153, 0 }, { 155, 155, 0 }, { 157, 157, 0 }, { 159, 159, 0 }, { 161, 161, 0 },
+	{ 163, 163, 0 }, { 165, 165, 0 }, { 167, 167, 0 }, { 169, 169, 0 }, { 171, 171, 0 }, { 173, 173, 0 },
+	{ 175, 175, 0 }, { 177, 184, 0 }, { 186, 186, 0 }, { 188, 188, 0 }, { 191, 191, 0 }, { 163, 163, 0 },
+	{ 165, 165, 0 }, { 167, 167, 0 }, { 169, 169, 0 }, { 171, 171, 0 }, { 173, 173, 0 }, { 175, 177, 0 },
+	{ 179, 179, 0 }, { 181, 181, 0 }, { 183, 183, 0 }, { 185, 185, 0 }, { 187, 187, 0 }, { 189, 189, 0 },
+	{ 191, 191, 0 }, { 129, 129, 0 }, { 131, 131, 0 }, { 133, 133, 0 }, { 135, 135, 0 }, { 137, 137, 0 },
+	{ 139, 139, 0 }, { 141, 141, 0 }, { 143, 143, 0 }, { 145, 145, 0 }, { 147, 147, 0 }, { 149, 149, 0 },
+	{ 151, 151, 0 }, { 153, 153, 0 }, { 155, 155, 0 }, { 129, 129, 0 }, { 131, 131, 0 }, { 133, 133, 0 },
+	{ 135, 135, 0 }, { 137, 137, 0 }, { 139, 139, 0 }, { 141, 141, 0 }, { 143, 143, 0 }, { 145, 145, 0 },
+	{ 147, 147, 0 }, { 149, 149, 0 }, { 151, 151, 0 }, { 153, 153, 0 }, { 155, 155, 0 }, { 157, 157, 0 },
+	{ 159, 159, 0 }, { 161, 161, 0 }, { 163, 163, 0 }, { 165, 165, 0 }, { 167, 167, 0 }, { 169, 169, 0 },
+	{ 171, 171, 0 }, { 173, 173, 0 }, { 132, 132, 48 }, { 133, 133, 47 }, { 134, 134, 46 }, { 176, 176, 67 },
+	{ 177, 177, 45 }, { 178, 178, 55 }, { 179, 179, 44 }, { 180, 180, 43 }, { 128, 165, 0 }, { 167, 167, 0 },
+	{ 173, 173, 0 }, { 129, 129, 0 }, { 131, 131, 0 }, { 133, 133, 0 }, { 135, 135, 0 }, { 137, 137, 0 },
+	{ 139, 139, 0 }, { 141, 141, 0 }, { 143, 143, 0 }, { 145, 145, 0 }, { 147, 147, 0 }, { 149, 149, 0 },
+	{ 151, 151, 0 }, { 153, 153, 0 }, { 155, 155, 0 }, { 157, 157, 0 }, { 159, 159, 0 }, { 161, 161, 0 },
+	{ 163, 164, 0 }, { 172, 172, 0 }, { 174, 174, 0 }, { 179, 179, 0 }, { 128, 158, 0 }, { 161, 161, 0 },
+	{ 165, 166, 0 }, { 168, 168, 0 }, { 170, 170, 0 }, { 172, 172, 0 }, { 177, 177, 0 }, { 179, 180, 0 },
+	{ 182, 187, 0 }, { 132, 132, 0 }, { 134, 137, 0 }, { 142, 142, 0 }, { 138, 138, 0 }, { 142, 143, 0 },
+	{ 147, 147, 0 }, { 175, 175, 0 }, { 180, 180, 0 }, { 185, 185, 0 }, { 188, 189, 0 }, { 131, 131, 60 },
+	{ 143, 143, 59 }, { 178, 178, 61 }, { 180, 180, 58 }, { 181, 181, 57 }, { 182, 182, 56 }, { 184, 185, 55 },
+	{ 186, 186, 54 }, { 187, 187, 55 }, { 188, 188, 53 }, { 189, 189, 52 }, { 190, 190, 51 }, { 191, 191, 50 },
+	{ 130, 132, 0 }, { 134, 135, 0 }, { 144, 147, 0 }, { 150, 151, 0 }, { 160, 167, 0 }, { 178, 180, 0 },
+	{ 182, 183, 0 }, { 128, 135, 0 }, { 144, 151, 0 }, { 160, 167, 0 }, { 176, 180, 0 }, { 182, 183, 0 },
+	{ 190, 190, 0 }, { 128, 133, 0 }, { 144, 151, 0 }, { 160, 167, 0 }, { 176, 189, 0 }, { 128, 135, 0 },
+	{ 144, 149, 0 }, { 160, 167, 0 }, { 176, 183, 0 }, { 129, 129, 0 }, { 131, 131, 0 }, { 133, 133, 0 },
+	{ 135, 135, 0 }, { 137, 137, 0 }, { 139, 139, 0 }, { 141, 141, 0 }, { 143, 143, 0 }, { 145, 145, 0 },
+	{ 147, 147, 0 }, { 149, 157, 0 }, { 159, 159, 0 }, { 161, 161, 0 }, { 163, 163, 0 }, { 165, 165, 0 },
+	{ 167, 167, 0 }, { 169, 169, 0 }, { 171, 171, 0 }, { 173, 173, 0 }, { 175, 175, 0 }, { 177, 177, 0 },
+	{ 179, 179, 0 }, { 181, 181, 0 }, { 183, 183, 0 }, { 185, 185, 0 }, { 187, 187, 0 }, { 189, 189, 0 },
+	{ 191, 191, 0 }, { 129, 129, 0 }, { 131, 131, 0 }, { 133, 133, 0 }, { 135, 135, 0 }, { 137, 137, 0 },
+	{ 139, 139, 0 }, { 141, 141, 0 }, { 143, 143, 0 }, { 145, 145, 0 }, { 147, 147, 0 }, { 149, 149, 0 },
+	{ 151, 151, 0 }, { 153, 153, 0 }, { 155, 155, 0 }, { 157, 157, 0 }, { 159, 159, 0 }, { 161, 161, 0 },
+	{ 163, 163, 0 }, { 165, 165, 0 }, { 167, 167, 0 }, { 169, 169, 0 }, { 171, 171, 0 }, { 173, 173, 0 },
+	{ 175, 175, 0 }, { 177, 177, 0 }, { 179, 179, 0 }, { 181, 181, 0 }, { 183, 183, 0 }, { 185, 185, 0 },
+	{ 187, 187, 0 }, { 189, 189, 0 }, { 191, 191, 0 }, { 128, 154, 0 }, { 171, 183, 0 }, { 185, 191, 0 },
+	{ 128, 171, 0 }, { 184, 189, 0 }, { 144, 186, 0 }, { 189, 191, 0 }, { 128, 136, 0 }, { 160, 191, 0 },
+	{ 129, 129, 0 }, { 131, 131, 0 }, { 133, 133, 0 }, { 135, 135, 0 }, { 137, 137, 0 }, { 139, 139, 0 },
+	{ 141, 141, 0 }, { 143, 143, 0 }, { 145, 145, 0 }, { 147, 147, 0 }, { 149, 149, 0 }, { 151, 151, 0 },
+	{ 153, 153, 0 }, { 155, 155, 0 }, { 157, 157, 0 }, { 159, 159, 0 }, { 161, 161, 0 }, { 163, 163, 0 },
+	{ 165, 165, 0 }, { 167, 167, 0 }, { 169, 169, 0 }, { 171, 171, 0 }, { 173, 173, 0 }, { 175, 175, 0 },
+	{ 130, 130, 0 }, { 132, 132, 0 }, { 134, 134, 0 }, { 136, 136, 0 }, { 138, 138, 0 }, { 140, 140, 0 },
+	{ 142, 143, 0 }, { 145, 145, 0 }, { 147, 147, 0 }, { 149, 149, 0 }, { 151, 151, 0 }, { 153, 153, 0 },
+	{ 155, 155, 0 }, { 157, 157, 0 }, { 159, 159, 0 }, { 161, 161, 0 }, { 163, 163, 0 }, { 165, 165, 0 },
+	{ 167, 167, 0 }, { 169, 169, 0 }, { 171, 171, 0 }, { 173, 173, 0 }, { 175, 175, 0 }, { 177, 177, 0 },
+	{ 179, 179, 0 }, { 181, 181, 0 }, { 183, 183, 0 }, { 185, 185, 0 }, { 187, 187, 0 }, { 189, 189, 0 },
+	{ 191, 191, 0 }, { 129, 129, 0 }, { 139, 139, 0 }, { 141, 141, 0 }, { 143, 143, 0 }, { 145, 145, 0 },
+	{ 147, 147, 0 }, { 149, 149, 0 }, { 151, 151, 0 }, { 153, 153, 0 }, { 155, 155, 0 }, { 157, 157, 0 },
+	{ 159, 159, 0 }, { 161, 161, 0 }, { 163, 163, 0 }, { 165, 165, 0 }, { 167, 167, 0 }, { 169, 169, 0 },
+	{ 171, 171, 0 }, { 173, 173, 0 }, { 175, 175, 0 }, { 177, 177, 0 }, { 179, 179, 0 }, { 181, 181, 0 },
+	{ 183, 183, 0 }, { 185, 185, 0 }, { 187, 187, 0 }, { 189, 189, 0 }, { 191, 191, 0 }, { 128, 159, 0 },
+	{ 161, 161, 0 }, { 163, 163, 0 }, { 165, 165, 0 }, { 167, 167, 0 }, { 169, 169, 0 }, { 171, 171, 0 },
+	{ 173, 173, 0 }, { 175, 175, 0 }, { 177, 177, 0 }, { 179, 179, 0 }, { 181, 181, 0 }, { 183, 183, 0 },
+	{ 185, 185, 0 }, { 187, 187, 0 }, { 189, 189, 0 }, { 191, 191, 0 }, { 176, 191, 0 }, { 128, 142, 0 },
+	{ 144, 145, 0 }, { 149, 151, 0 }, { 153, 153, 0 }, { 155, 155, 0 }, { 157, 157, 0 }, { 159, 159, 0 },
+	{ 161, 161, 0 }, { 163, 163, 0 }, { 165, 165, 0 }, { 167, 167, 0 }, { 169, 169, 0 }, { 171, 171, 0 },
+	{ 173, 173, 0 }, { 175, 179, 0 }, { 181, 181, 0 }, { 184, 184, 0 }, { 187, 188, 0 }, { 144, 144, 0 },
+	{ 172, 191, 0 }, { 177, 177, 0 }, { 179, 179, 0 }, { 183, 183, 0 }, { 187, 189, 0 }, { 128, 147, 0 },
+	{ 149, 175, 0 }, { 128, 128, 0 }, { 130, 130, 0 }, { 135, 135, 0 }, { 137, 137, 0 }, { 139, 139, 0 },
+	{ 141, 141, 0 }, { 143, 191, 0 }, { 129, 129, 0 }, { 131, 131, 0 }, { 133, 133, 0 }, { 135, 135, 0 },
+	{ 137, 137, 0 }, { 139, 139, 0 }, { 141, 141, 0 }, { 143, 143, 0 }, { 145, 145, 0 }, { 147, 147, 0 },
+	{ 149, 149, 0 }, { 151, 151, 0 }, { 153, 153, 0 }, { 155, 155, 0 }, { 157, 157, 0 }, { 159, 159, 0 },
+	{ 161, 161, 0 }, { 163, 163, 0 }, { 165, 165, 0 }, { 167, 167, 0 }, { 169, 169, 0 }, { 171, 171, 0 },
+	{ 173, 173, 0 }, { 175, 175, 0 }, { 177, 177, 0 }, { 179, 185, 0 }, { 188, 188, 0 }, { 191, 191, 0 },
+	{ 134, 134, 0 }, { 137, 137, 0 }, { 140, 140, 0 }, { 142, 142, 0 }, { 144, 144, 0 }, { 146, 146, 0 },
+	{ 148, 148, 0 }, { 150, 150, 0 }, { 152, 152, 0 }, { 154, 154, 0 }, { 156, 157, 0 }, { 159, 159, 0 },
+	{ 161, 161, 0 }, { 163, 163, 0 }, { 165, 165, 0 }, { 167, 167, 0 }, { 169, 169, 0 }, { 171, 171, 0 },
+	{ 173, 173, 0 }, { 175, 176, 0 }, { 179, 179, 0 }, { 181, 181, 0 }, { 185, 185, 0 }, { 187, 187, 0 },
+	{ 189, 189, 0 }, { 191, 191, 0 }, { 128, 128, 0 }, { 131, 131, 0 }, { 133, 133, 0 }, { 136, 136, 0 },
+	{ 140, 141, 0 }, { 146, 146, 0 }, { 149, 149, 0 }, { 153, 155, 0 }, { 158, 158, 0 }, { 161, 161, 0 },
+	{ 163, 163, 0 }, { 165, 165, 0 }, { 168, 168, 0 }, { 170, 171, 0 }, { 173, 173, 0 }, { 176, 176, 0 },
+	{ 180, 180, 0 }, { 182, 182, 0 }, { 185, 186, 0 }, { 189, 191, 0 }, { 128, 128, 0 }, { 130, 130, 0 },
+	{ 132, 132, 0 }, { 134, 134, 0 }, { 136, 137, 0 }, { 139, 139, 0 }, { 141, 141, 0 }, { 143, 143, 0 },
+	{ 145, 145, 0 }, { 147, 147, 0 }, { 149, 149, 0 }, { 151, 151, 0 }, { 153, 153, 0 }, { 155, 155, 0 },
+	{ 157, 157, 0 }, { 159, 159, 0 }, { 161, 161, 0 }, { 163, 163, 0 }, { 165, 165, 0 }, { 167, 167, 0 },
+	{ 169, 169, 0 }, { 171, 171, 0 }, { 173, 173, 0 }, { 175, 175, 0 }, { 177, 177, 0 }, { 179, 179, 0 },
+	{ 181, 181, 0 }, { 183, 183, 0 }, { 186, 186, 0 }, { 188, 188, 0 }, { 190, 191, 0 }, { 129, 129, 0 },
+	{ 131, 131, 0 }, { 133, 133, 0 }, { 135, 135, 0 }, { 137, 137, 0 }, { 139, 139, 0 }, { 141, 141, 0 },
+	{ 143, 143, 0 }, { 145, 145, 0 }, { 147, 147, 0 }, { 149, 149, 0 }, { 151, 151, 0 }, { 153, 153, 0 },
+	{ 155, 155, 0 }, { 157, 157, 0 }, { 159, 159, 0 }, { 161, 161, 0 }, { 163, 163, 0 }, { 165, 165, 0 },
+	{ 167, 167, 0 }, { 169, 169, 0 }, { 171, 171, 0 }, { 173, 173, 0 }, { 175, 175, 0 }, { 177, 177, 0 },
+	{ 179, 179, 0 }, { 181, 181, 0 }, { 183, 184, 0 }, { 186, 186, 0 }, { 188, 188, 0 }, { 190, 190, 0 },
+	{ 159, 182, 0 }, { 184, 191, 0 }, { 181, 181, 0 },
+};
+static const uint16_t Ll_reverse_state[] = {
+	0, 566, 567, 568, 569, 572, 573, 574, 575, 576, 578, 579,
+	580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591,
+	592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603,
+	606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617,
+	618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629,
+	630, 631, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642,
+	643, 644, 645, 646, 647, 648, 649, 650, 651,
+};
+static const UTF8Range Ll_reverse_range[] = {
+	{ 97, 122, 0 }, { 128, 128, 79 }, { 128, 128, 78 }, { 128, 128, 77 }, { 128, 130, 74 }, { 128, 131, 72 },
+	{ 128, 131, 71 }, { 128, 131, 70 }, { 128, 133, 68 }, { 128, 134, 66 }, { 128, 135, 65 }, { 128, 135, 64 },
+	{ 128, 135, 63 }, { 128, 136, 62 }, { 128, 136, 61 }, { 128, 142, 60 }, { 128, 142, 59 }, { 128, 143, 57 },
+	{ 128, 147, 56 }, { 128, 147, 55 }, { 128, 148, 54 }, { 128, 154, 52 }, { 128, 154, 51 }, { 128, 158, 49 },
+	{ 128, 159, 47 }, { 128, 159, 46 }, { 128, 165, 45 }, { 128, 171, 44 }, { 128, 178, 43 }, { 128, 191, 42 },
+	{ 129, 129, 41 }, { 129, 129, 40 }, { 129, 129, 39 }, { 129, 129, 38 }, { 129, 129, 37 }, { 129, 129, 36 },
+	{ 129, 129, 35 }, { 129, 129, 34 }, { 129, 129, 33 }, { 129, 129, 32 }, { 129, 129, 31 }, { 129, 154, 30 },
+	{ 130, 130, 29 }, { 130, 130, 79 }, { 130, 130, 77 }, { 130, 132, 28 }, { 130, 154, 27 }, { 130, 155, 26 },
+	{ 131, 131, 25 }, { 131, 131, 41 }, { 131, 131, 40 }, { 131, 131, 39 }, { 131, 131, 38 }, { 131, 131, 37 },
+	{ 131, 131, 36 }, { 131, 131, 35 }, { 131, 131, 34 }, { 131, 131, 32 }, { 131, 131, 78 }, { 131, 131, 31 },
+	{ 132, 132, 24 }, { 132, 132, 29 }, { 132, 132, 77 }, { 132, 137, 74 }, { 133, 133, 41 }, { 133, 133, 40 },
+	{ 133, 133, 39 }, { 133, 133, 38 }, { 133, 133, 37 }, { 133, 133, 36 }, { 133, 133, 35 }, { 133, 133, 34 },
+	{ 133, 133, 32 }, { 133, 133, 78 }, { 133, 133, 31 }, { 133, 143, 70 }, { 134, 134, 29 }, { 134, 134, 23 },
+	{ 134, 134, 77 }, { 134, 135, 28 }, { 134, 137, 22 }, { 134, 159, 21 }, { 135, 135, 41 }, { 135, 135, 40 },
+	{ 135, 135, 39 }, { 135, 135, 38 }, { 135, 135, 37 }, { 135, 135, 36 }, { 135, 135, 35 }, { 135, 135, 34 },
+	{ 135, 135, 79 }, { 135, 135, 32 }, { 135, 135, 31 }, { 136, 136, 25 }, { 136, 136, 29 }, { 136, 136, 78 },
+	{ 136, 137, 77 }, { 137, 137, 40 }, { 137, 137, 39 }, { 137, 137, 38 }, { 137, 137, 37 }, { 137, 137, 36 },
+	{ 137, 137, 35 }, { 137, 137, 34 }, { 137, 137, 79 }, { 137, 137, 32 }, { 137, 137, 23 }, { 137, 137, 31 },
+	{ 138, 138, 25 }, { 138, 138, 20 }, { 138, 138, 29 }, { 138, 143, 62 }, { 138, 165, 19 }, { 139, 139, 74 },
+	{ 139, 139, 40 }, { 139, 139, 39 }, { 139, 139, 38 }, { 139, 139, 37 }, { 139, 139, 36 }, { 139, 139, 35 },
+	{ 139, 139, 34 }, { 139, 139, 33 }, { 139, 139, 79 }, { 139, 139, 32 }, { 139, 139, 77 }, { 139, 139, 31 },
+	{ 140, 140, 41 }, { 140, 140, 29 }, { 140, 140, 23 }, { 140, 141, 78 }, { 141, 141, 40 }, { 141, 141, 39 },
+	{ 141, 141, 38 }, { 141, 141, 37 }, { 141, 141, 36 }, { 141, 141, 35 }, { 141, 141, 34 }, { 141, 141, 33 },
+	{ 141, 141, 79 }, { 141, 141, 32 }, { 141, 141, 77 }, { 141, 141, 31 }, { 142, 142, 41 }, { 142, 142, 22 },
+	{ 142, 142, 23 }, { 142, 143, 20 }, { 142, 143, 29 }, { 142, 148, 18 }, { 143, 143, 40 }, { 143, 143, 39 },
+	{ 143, 143, 38 }, { 143, 143, 37 }, { 143, 143, 36 }, { 143, 143, 35 }, { 143, 143, 34 }, { 143, 143, 33 },
+	{ 143, 143, 32 }, { 143, 143, 77 }, { 143, 143, 31 }, { 143, 191, 79 }, { 144, 144, 17 }, { 144, 144, 23 },
+	{ 144, 145, 59 }, { 144, 147, 28 }, { 144, 149, 60 }, { 144, 149, 63 }, { 144, 151, 64 }, { 144, 151, 68 },
+	{ 144, 186, 16 }, { 145, 145, 41 }, { 145, 145, 40 }, { 145, 145, 39 }, { 145, 145, 38 }, { 145, 145, 37 },
+	{ 145, 145, 36 }, { 145, 145, 35 }, { 145, 145, 34 }, { 145, 145, 29 }, { 145, 145, 33 }, { 145, 145, 32 },
+	{ 145, 145, 77 }, { 145, 145, 31 }, { 146, 146, 23 }, { 146, 146, 78 }, { 146, 171, 15 }, { 147, 147, 40 },
+	{ 147, 147, 39 }, { 147, 147, 38 }, { 147, 147, 37 }, { 147, 147, 20 }, { 147, 147, 36 }, { 147, 147, 35 },
+	{ 147, 147, 34 }, { 147, 147, 29 }, { 147, 147, 33 }, { 147, 147, 32 }, { 147, 147, 77 }, { 147, 147, 31 },
+	{ 147, 149, 41 }, { 147, 151, 66 }, { 148, 148, 23 }, { 149, 149, 40 }, { 149, 149, 39 }, { 149, 149, 38 },
+	{ 149, 149, 37 }, { 149, 149, 35 }, { 149, 149, 34 }, { 149, 149, 29 }, { 149, 149, 33 }, { 149, 149, 32 },
+	{ 149, 149, 78 }, { 149, 149, 77 }, { 149, 149, 31 }, { 149, 151, 59 }, { 149, 157, 36 }, { 149, 175, 55 },
+	{ 150, 150, 23 }, { 150, 151, 28 }, { 150, 155, 54 }, { 150, 167, 18 }, { 150, 175, 14 }, { 151, 151, 41 },
+	{ 151, 151, 40 }, { 151, 151, 39 }, { 151, 151, 38 }, { 151, 151, 37 }, { 151, 151, 35 }, { 151, 151, 34 },
+	{ 151, 151, 29 }, { 151, 151, 33 }, { 151, 151, 32 }, { 151, 151, 77 }, { 151, 151, 31 }, { 152, 152, 23 },
+	{ 152, 187, 13 }, { 153, 153, 41 }, { 153, 153, 40 }, { 153, 153, 39 }, { 153, 153, 38 }, { 153, 153, 37 },
+	{ 153, 153, 35 }, { 153, 153, 34 }, { 153, 153, 29 }, { 153, 153, 33 }, { 153, 153, 59 }, { 153, 153, 32 },
+	{ 153, 153, 77 }, { 153, 153, 31 }, { 153, 155, 78 }, { 154, 154, 23 }, { 154, 179, 12 }, { 155, 155, 41 },
+	{ 155, 155, 40 }, { 155, 155, 39 }, { 155, 155, 38 }, { 155, 155, 37 }, { 155, 155, 35 }, { 155, 155, 34 },
+	{ 155, 155, 29 }, { 155, 155, 33 }, { 155, 155, 59 }, { 155, 155, 32 }, { 155, 155, 77 }, { 155, 155, 31 },
+	{ 156, 157, 23 }, { 156, 161, 27 }, { 157, 157, 41 }, { 157, 157, 40 }, { 157, 157, 38 }, { 157, 157, 37 },
+	{ 157, 157, 35 }, { 157, 157, 34 }, { 157, 157, 29 }, { 157, 157, 33 }, { 157, 157, 59 }, { 157, 157, 32 },
+	{ 157, 157, 77 }, { 157, 157, 31 }, { 158, 158, 78 }, { 158, 183, 71 }, { 159, 159, 41 }, { 159, 159, 40 },
+	{ 159, 159, 38 }, { 159, 159, 37 }, { 159, 159, 36 }, { 159, 159, 35 }, { 159, 159, 34 }, { 159, 159, 29 },
+	{ 159, 159, 33 }, { 159, 159, 59 }, { 159, 159, 32 }, { 159, 159, 23 }, { 159, 159, 77 }, { 159, 159, 31 },
+	{ 159, 182, 11 }, { 160, 167, 28 }, { 160, 167, 64 }, { 160, 167, 68 }, { 160, 167, 63 }, { 160, 168, 52 },
+	{ 160, 191, 9 }, { 161, 161, 41 }, { 161, 161, 40 }, { 161, 161, 38 }, { 161, 161, 37 }, { 161, 161, 49 },
+	{ 161, 161, 36 }, { 161, 161, 35 }, { 161, 161, 34 }, { 161, 161, 29 }, { 161, 161, 33 }, { 161, 161, 46 },
+	{ 161, 161, 59 }, { 161, 161, 32 }, { 161, 161, 23 }, { 161, 161, 78 }, { 161, 161, 77 }, { 161, 161, 31 },
+	{ 162, 187, 65 }, { 162, 191, 8 }, { 163, 163, 41 }, { 163, 163, 40 }, { 163, 163, 7 }, { 163, 163, 38 },
+	{ 163, 163, 36 }, { 163, 163, 35 }, { 163, 163, 34 }, { 163, 163, 29 }, { 163, 163, 33 }, { 163, 163, 46 },
+	{ 163, 163, 59 }, { 163, 163, 32 }, { 163, 163, 23 }, { 163, 163, 78 }, { 163, 163, 77 }, { 163, 163, 31 },
+	{ 163, 164, 37 }, { 165, 165, 41 }, { 165, 165, 40 }, { 165, 165, 7 }, { 165, 165, 38 }, { 165, 165, 36 },
+	{ 165, 165, 35 }, { 165, 165, 34 }, { 165, 165, 29 }, { 165, 165, 33 }, { 165, 165, 46 }, { 165, 165, 59 },
+	{ 165, 165, 32 }, { 165, 165, 23 }, { 165, 165, 78 }, { 165, 165, 77 }, { 165, 165, 31 }, { 165, 166, 49 },
+	{ 167, 167, 41 }, { 167, 167, 40 }, { 167, 167, 7 }, { 167, 167, 38 }, { 167, 167, 45 }, { 167, 167, 36 },
+	{ 167, 167, 35 }, { 167, 167, 34 }, { 167, 167, 29 }, { 167, 167, 33 }, { 167, 167, 46 }, { 167, 167, 59 },
+	{ 167, 167, 32 }, { 167, 167, 23 }, { 167, 167, 77 }, { 167, 167, 31 }, { 168, 168, 49 }, { 168, 168, 78 },
+	{ 168, 191, 6 }, { 169, 169, 41 }, { 169, 169, 40 }, { 169, 169, 7 }, { 169, 169, 38 }, { 169, 169, 36 },
+	{ 169, 169, 35 }, { 169, 169, 34 }, { 169, 169, 29 }, { 169, 169, 33 }, { 169, 169, 46 }, { 169, 169, 59 },
+	{ 169, 169, 32 }, { 169, 169, 23 }, { 169, 169, 77 }, { 169, 169, 31 }, { 170, 170, 49 }, { 170, 171, 78 },
+	{ 170, 191, 62 }, { 170, 191, 70 }, { 171, 171, 40 }, { 171, 171, 7 }, { 171, 171, 38 }, { 171, 171, 36 },
+	{ 171, 171, 35 }, { 171, 171, 34 }, { 171, 171, 29 }, { 171, 171, 33 }, { 171, 171, 46 }, { 171, 171, 59 },
+	{ 171, 171, 32 }, { 171, 171, 23 }, { 171, 171, 77 }, { 171, 171, 31 }, { 171, 183, 5 }, { 172, 172, 37 },
+	{ 172, 172, 49 }, { 172, 191, 17 }, { 173, 173, 40 }, { 173, 173, 7 }, { 173, 173, 38 }, { 173, 173, 45 },
+	{ 173, 173, 36 }, { 173, 173, 35 }, { 173, 173, 34 }, { 173, 173, 29 }, { 173, 173, 33 }, { 173, 173, 46 },
+	{ 173, 173, 59 }, { 173, 173, 32 }, { 173, 173, 23 }, { 173, 173, 78 }, { 173, 173, 77 }, { 173, 173, 31 },
+	{ 174, 174, 37 }, { 174, 191, 56 }, { 175, 175, 41 }, { 175, 175, 40 }, { 175, 175, 20 }, { 175, 175, 36 },
+	{ 175, 175, 35 }, { 175, 175, 34 }, { 175, 175, 29 }, { 175, 175, 33 }, { 175, 175, 46 }, { 175, 175, 32 },
+	{ 175, 175, 77 }, { 175, 175, 31 }, { 175, 176, 23 }, { 175, 177, 7 }, { 175, 179, 59 }, { 176, 176, 78 },
+	{ 176, 180, 64 }, { 176, 183, 63 }, { 176, 189, 68 }, { 176, 191, 60 }, { 176, 191, 52 }, { 176, 191, 4 },
+	{ 177, 177, 49 }, { 177, 177, 36 }, { 177, 177, 35 }, { 177, 177, 29 }, { 177, 177, 33 }, { 177, 177, 46 },
+	{ 177, 177, 3 }, { 177, 177, 32 }, { 177, 177, 77 }, { 177, 177, 31 }, { 177, 184, 40 }, { 178, 180, 28 },
+	{ 179, 179, 7 }, { 179, 179, 37 }, { 179, 179, 36 }, { 179, 179, 35 }, { 179, 179, 29 }, { 179, 179, 33 },
+	{ 179, 179, 46 }, { 179, 179, 3 }, { 179, 179, 23 }, { 179, 179, 77 }, { 179, 179, 31 }, { 179, 180, 49 },
+	{ 179, 185, 32 }, { 180, 180, 20 }, { 180, 180, 78 }, { 181, 181, 41 }, { 181, 181, 7 }, { 181, 181, 36 },
+	{ 181, 181, 35 }, { 181, 181, 29 }, { 181, 181, 33 }, { 181, 181, 46 }, { 181, 181, 59 }, { 181, 181, 23 },
+	{ 181, 181, 77 }, { 181, 181, 31 }, { 181, 181, 2 }, { 182, 182, 25 }, { 182, 182, 78 }, { 182, 183, 28 },
+	{ 182, 183, 64 }, { 182, 185, 26 }, { 182, 187, 49 }, { 182, 191, 54 }, { 183, 183, 41 }, { 183, 183, 7 },
+	{ 183, 183, 36 }, { 183, 183, 35 }, { 183, 183, 29 }, { 183, 183, 33 }, { 183, 183, 46 }, { 183, 183, 3 },
+	{ 183, 183, 77 }, { 183, 184, 31 }, { 184, 184, 59 }, { 184, 189, 1 }, { 184, 191, 11 }, { 185, 185, 41 },
+	{ 185, 185, 7 }, { 185, 185, 20 }, { 185, 185, 36 }, { 185, 185, 35 }, { 185, 185, 29 }, { 185, 185, 33 },
+	{ 185, 185, 46 }, { 185, 185, 23 }, { 185, 186, 78 }, { 185, 191, 5 }, { 186, 186, 25 }, { 186, 186, 40 },
+	{ 186, 186, 77 }, { 186, 186, 31 }, { 186, 191, 21 }, { 187, 187, 26 }, { 187, 187, 41 }, { 187, 187, 7 },
+	{ 187, 187, 36 }, { 187, 187, 35 }, { 187, 187, 29 }, { 187, 187, 33 }, { 187, 187, 46 }, { 187, 187, 23 },
+	{ 187, 188, 59 }, { 187, 189, 3 }, { 188, 188, 40 }, { 188, 188, 32 }, { 188, 188, 77 }, { 188, 188, 31 },
+	{ 188, 189, 20 }, { 188, 191, 27 }, { 189, 189, 41 }, { 189, 189, 7 }, { 189, 189, 36 }, { 189, 189, 35 },
+	{ 189, 189, 29 }, { 189, 189, 33 }, { 189, 189, 46 }, { 189, 189, 23 }, { 189, 191, 26 }, { 189, 191, 16 },
+	{ 189, 191, 78 }, { 190, 190, 64 }, { 190, 190, 31 }, { 190, 191, 77 }, { 191, 191, 41 }, { 191, 191, 40 },
+	{ 191, 191, 7 }, { 191, 191, 36 }, { 191, 191, 35 }, { 191, 191, 29 }, { 191, 191, 33 }, { 191, 191, 46 },
+	{ 191, 191, 32 }, { 191, 191, 23 }, { 143, 143, 69 }, { 194, 194, 0 }, { 205, 205, 0 }, { 172, 172, 53 },
+	{ 176, 176, 50 }, { 208, 208, 0 }, { 181, 181, 69 }, { 144, 144, 58 }, { 156, 156, 53 }, { 164, 164, 73 },
+	{ 185, 185, 10 }, { 213, 213, 0 }, { 150, 150, 76 }, { 195, 195, 0 }, { 144, 144, 75 }, { 147, 147, 58 },
+	{ 153, 153, 75 }, { 149, 149, 75 }, { 131, 131, 69 }, { 206, 206, 0 }, { 145, 145, 75 }, { 154, 154, 75 },
+	{ 132, 132, 50 }, { 150, 150, 75 }, { 133, 133, 50 }, { 199, 199, 0 }, { 134, 134, 50 }, { 159, 159, 53 },
+	{ 146, 146, 75 }, { 155, 155, 75 }, { 191, 191, 69 }, { 211, 211, 0 }, { 189, 189, 67 }, { 196, 196, 0 },
+	{ 200, 200, 0 }, { 210, 210, 0 }, { 212, 212, 0 }, { 178, 178, 50 }, { 184, 185, 69 }, { 187, 187, 69 },
+	{ 186, 186, 69 }, { 179, 179, 50 }, { 153, 153, 53 }, { 154, 154, 53 }, { 157, 157, 53 }, { 158, 158, 53 },
+	{ 174, 174, 53 }, { 179, 179, 58 }, { 180, 180, 69 }, { 180, 180, 50 }, { 209, 209, 0 }, { 163, 163, 48 },
+	{ 145, 145, 76 }, { 177, 177, 50 }, { 226, 226, 0 }, { 182, 182, 69 }, { 173, 173, 53 }, { 234, 234, 0 },
+	{ 156, 156, 75 }, { 202, 202, 0 }, { 151, 151, 75 }, { 145, 145, 58 }, { 144, 144, 76 }, { 207, 207, 0 },
+	{ 157, 157, 75 }, { 178, 178, 69 }, { 214, 214, 0 }, { 158, 158, 75 }, { 188, 188, 69 }, { 190, 190, 69 },
+	{ 152, 152, 75 }, { 172, 172, 67 }, { 239, 239, 0 }, { 189, 189, 69 }, { 225, 225, 0 }, { 147, 147, 75 },
+	{ 148, 148, 75 }, { 165, 165, 73 }, { 158, 158, 76 }, { 159, 159, 75 }, { 157, 157, 76 }, { 240, 240, 0 },
+	{ 197, 197, 0 }, { 198, 198, 0 }, { 201, 201, 0 },
+};
+static const uint16_t Lm_forward_state[] = {
+	0, 14, 16, 18, 19, 20, 23, 25, 26, 27, 29, 30,
+	43, 45, 47, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+	60, 61, 62, 65, 70, 71, 72, 73, 75, 83, 84, 86,
+	87, 88, 89, 90, 91, 92, 96, 97, 98, 101, 103, 104,
+	105, 106, 108, 113, 114,
+};
+static const UTF8Range Lm_forward_range[] = {
+	{ 202, 202, 51 }, { 203, 203, 50 }, { 205, 205, 49 }, { 213, 213, 48 }, { 217, 217, 47 }, { 219, 219, 46 },
+	{ 223, 223, 45 }, { 224, 224, 41 }, { 225, 225, 32 }, { 226, 226, 27 }, { 227, 227, 23 }, { 234, 234, 11 },
+	{ 239, 239, 9 }, { 240, 240, 1 }, { 150, 150, 5 }, { 158, 158, 2 }, { 132, 132, 4 }, { 165, 165, 3 },
+	{ 139, 139, 0 }, { 183, 189, 0 }, { 173, 173, 8 }, { 190, 190, 7 }, { 191, 191, 6 }, { 160, 161, 0 },
+	{ 163, 163, 0 }, { 147, 159, 0 }, { 128, 131, 0 }, { 189, 189, 17 }, { 190, 190, 10 }, { 158, 159, 0 },
+	{ 128, 128, 22 }, { 147, 147, 36 }, { 152, 152, 21 }, { 153, 153, 20 }, { 154, 154, 19 }, { 156, 156, 18 },
+	{ 157, 157, 17 }, { 158, 158, 16 }, { 159, 159, 15 }, { 167, 167, 14 }, { 169, 169, 17 }, { 171, 171, 13 },
+	{ 173, 173, 12 }, { 156, 159, 0 }, { 169, 169, 0 }, { 157, 157, 0 }, { 179, 180, 0 }, { 143, 143, 0 },
+	{ 166, 166, 0 }, { 184, 185, 0 }, { 136, 136, 0 }, { 176, 176, 0 }, { 151, 159, 0 }, { 156, 157, 0 },
+	{ 191, 191, 0 }, { 140, 140, 0 }, { 149, 149, 0 }, { 128, 128, 26 }, { 130, 130, 25 }, { 131, 131, 24 },
+	{ 188, 190, 0 }, { 157, 158, 0 }, { 133, 133, 0 }, { 177, 181, 0 }, { 187, 187, 0 }, { 129, 129, 31 },
+	{ 130, 130, 30 }, { 177, 177, 29 }, { 181, 181, 28 }, { 184, 184, 28 }, { 175, 175, 0 }, { 188, 189, 0 },
+	{ 144, 156, 0 }, { 177, 177, 0 }, { 191, 191, 0 }, { 131, 131, 40 }, { 159, 159, 39 }, { 161, 161, 38 },
+	{ 170, 170, 37 }, { 177, 177, 36 }, { 180, 180, 35 }, { 181, 181, 34 }, { 182, 182, 33 }, { 155, 191, 0 },
+	{ 128, 170, 0 }, { 184, 184, 0 }, { 172, 191, 0 }, { 184, 189, 0 }, { 167, 167, 0 }, { 131, 131, 0 },
+	{ 151, 151, 0 }, { 188, 188, 0 }, { 160, 160, 44 }, { 165, 165, 43 }, { 185, 185, 42 }, { 187, 187, 42 },
+	{ 134, 134, 0 }, { 177, 177, 0 }, { 154, 154, 0 }, { 164, 164, 0 }, { 168, 168, 0 }, { 180, 181, 0 },
+	{ 186, 186, 0 }, { 165, 166, 0 }, { 128, 128, 0 }, { 153, 153, 0 }, { 180, 180, 0 }, { 186, 186, 0 },
+	{ 128, 129, 0 }, { 134, 145, 0 }, { 160, 164, 0 }, { 172, 172, 0 }, { 174, 174, 0 }, { 176, 191, 0 },
+};
+static const uint16_t Lm_reverse_state[] = {
+	0, 58, 59, 60, 61, 62, 64, 65, 66, 67, 68, 69,
+	70, 71, 74, 76, 77, 78, 79, 80, 81, 82, 83, 84,
+	85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96,
+	97, 98, 99, 100, 101, 103, 104, 105, 106, 107, 108, 109,
+	110, 111, 112, 113, 114,
+};
+static const UTF8Range Lm_reverse_range[] = {
+	{ 128, 128, 51 }, { 128, 129, 50 }, { 128, 131, 47 }, { 128, 170, 45 }, { 131, 131, 44 }, { 133, 133, 42 },
+	{ 134, 134, 40 }, { 134, 145, 50 }, { 136, 136, 38 }, { 139, 139, 36 }, { 140, 140, 35 }, { 143, 143, 34 },
+	{ 144, 156, 32 }, { 147, 159, 31 }, { 149, 149, 30 }, { 151, 151, 29 }, { 151, 159, 28 }, { 153, 153, 27 },
+	{ 154, 154, 26 }, { 155, 191, 25 }, { 156, 157, 24 }, { 156, 159, 23 }, { 157, 157, 22 }, { 157, 158, 21 },
+	{ 158, 159, 19 }, { 160, 161, 18 }, { 160, 164, 50 }, { 163, 163, 18 }, { 164, 164, 26 }, { 165, 166, 17 },
+	{ 166, 166, 34 }, { 167, 167, 16 }, { 168, 168, 26 }, { 169, 169, 23 }, { 172, 172, 50 }, { 172, 191, 15 },
+	{ 174, 174, 50 }, { 175, 175, 14 }, { 176, 176, 13 }, { 176, 191, 12 }, { 177, 177, 11 }, { 177, 177, 10 },
+	{ 177, 181, 42 }, { 179, 180, 22 }, { 180, 180, 9 }, { 180, 181, 8 }, { 183, 189, 7 }, { 184, 184, 45 },
+	{ 184, 185, 6 }, { 184, 189, 5 }, { 186, 186, 8 }, { 186, 186, 9 }, { 187, 187, 42 }, { 188, 188, 4 },
+	{ 188, 189, 3 }, { 188, 190, 2 }, { 191, 191, 1 }, { 191, 191, 11 }, { 153, 153, 39 }, { 131, 131, 43 },
+	{ 177, 177, 33 }, { 131, 131, 46 }, { 147, 147, 39 }, { 177, 177, 46 }, { 159, 159, 39 }, { 132, 132, 37 },
+	{ 223, 223, 0 }, { 205, 205, 0 }, { 165, 165, 41 }, { 129, 129, 33 }, { 202, 202, 0 }, { 157, 157, 39 },
+	{ 169, 169, 39 }, { 189, 189, 20 }, { 181, 181, 33 }, { 184, 184, 33 }, { 180, 180, 46 }, { 170, 170, 46 },
+	{ 219, 219, 0 }, { 191, 191, 48 }, { 190, 190, 20 }, { 239, 239, 0 }, { 130, 130, 43 }, { 171, 171, 39 },
+	{ 173, 173, 39 }, { 154, 154, 39 }, { 182, 182, 46 }, { 160, 160, 41 }, { 213, 213, 0 }, { 156, 156, 39 },
+	{ 159, 159, 46 }, { 128, 128, 39 }, { 190, 190, 48 }, { 130, 130, 33 }, { 226, 226, 0 }, { 167, 167, 39 },
+	{ 152, 152, 39 }, { 165, 165, 37 }, { 158, 158, 49 }, { 158, 158, 39 }, { 234, 234, 0 }, { 185, 185, 41 },
+	{ 187, 187, 41 }, { 224, 224, 0 }, { 128, 128, 43 }, { 227, 227, 0 }, { 161, 161, 46 }, { 181, 181, 46 },
+	{ 225, 225, 0 }, { 173, 173, 48 }, { 150, 150, 49 }, { 240, 240, 0 }, { 203, 203, 0 }, { 217, 217, 0 },
+};
+static const uint16_t Lo_forward_state[] = {
+	0, 25, 44, 46, 47, 49, 51, 52, 55, 57, 62, 65,
+	73, 78, 97, 106, 107, 108, 109, 117, 119, 121, 122, 125,
+	130, 131, 140, 142, 144, 145, 147, 149, 153, 193, 194, 195,
+	197, 201, 204, 206, 208, 209, 211, 213, 216, 219, 221, 222,
+	228, 229, 230, 232, 233, 234, 235, 237, 238, 240, 241, 243,
+	249, 251, 254, 255, 259, 260, 261, 262, 263, 301, 303, 306,
+	308, 309, 310, 312, 314, 315, 316, 320, 322, 324, 326, 328,
+	334, 336, 337, 339, 340, 342, 344, 347, 349, 350, 352, 353,
+	355, 360, 379, 383, 385, 387, 389, 391, 393, 394, 395, 396,
+	397, 400, 405, 406, 408, 411, 413, 415, 441, 442, 447, 452,
+	456, 462, 463, 466, 467, 469, 471, 474, 475, 479, 481, 482,
+	483, 486, 487, 488, 490, 492, 493, 494, 496, 505, 507, 509,
+	511, 514, 516, 521, 525, 530, 531, 532, 533, 569, 573, 575,
+	576, 577, 580, 581, 582, 583, 585, 586, 588, 590, 591, 592,
+	596, 598, 599, 600, 603, 606, 608, 610, 612, 613, 614, 615,
+	618, 622, 627, 633, 635, 641, 643, 674, 675, 677, 678, 680,
+	688, 689, 691, 692, 696, 700, 704, 707, 714, 716, 721, 722,
+	732, 735, 742, 745, 752, 755, 762, 767, 775, 778, 780, 781,
+	783, 785, 786, 787, 789, 790, 792, 797, 798, 801, 802, 804,
+	805, 806, 807, 809,
+};
+static const UTF8Range Lo_forward_range[] = {
+	{ 194, 194, 230 }, { 198, 198, 229 }, { 199, 199, 228 }, { 202, 202, 227 }, { 215, 215, 226 }, { 216, 216, 225 },
+	{ 217, 217, 224 }, { 218, 218, 223 }, { 219, 219, 222 }, { 220, 220, 221 }, { 221, 221, 220 }, { 222, 222, 219 },
+	{ 223, 223, 218 }, { 224, 224, 186 }, { 225, 225, 152 }, { 226, 226, 146 }, { 227, 227, 140 }, { 228, 228, 139 },
+	{ 229, 232, 138 }, { 233, 233, 136 }, { 234, 234, 115 }, { 235, 236, 138 }, { 237, 237, 112 }, { 239, 239, 97 },
+	{ 240, 240, 1 }, { 144, 144, 68 }, { 145, 145, 32 }, { 146, 146, 31 }, { 147, 147, 30 }, { 148, 148, 29 },
+	{ 150, 150, 25 }, { 151, 151, 138 }, { 152, 152, 23 }, { 155, 155, 18 }, { 158, 158, 11 }, { 160, 169, 138 },
+	{ 170, 170, 10 }, { 171, 171, 9 }, { 172, 172, 7 }, { 173, 173, 138 }, { 174, 174, 5 }, { 175, 175, 4 },
+	{ 176, 176, 138 }, { 177, 177, 2 }, { 128, 140, 223 }, { 141, 141, 3 }, { 128, 138, 0 }, { 160, 167, 223 },
+	{ 168, 168, 87 }, { 128, 174, 223 }, { 175, 175, 6 }, { 128, 160, 0 }, { 128, 185, 223 }, { 186, 186, 8 },
+	{ 187, 191, 223 }, { 128, 161, 0 }, { 176, 191, 0 }, { 128, 155, 223 }, { 156, 156, 57 }, { 157, 159, 223 },
+	{ 160, 160, 89 }, { 161, 191, 223 }, { 128, 154, 223 }, { 155, 155, 87 }, { 156, 191, 223 }, { 132, 132, 17 },
+	{ 133, 133, 16 }, { 139, 139, 49 }, { 160, 162, 223 }, { 163, 163, 15 }, { 184, 184, 14 }, { 185, 185, 13 },
+	{ 186, 186, 12 }, { 128, 137, 0 }, { 139, 155, 0 }, { 161, 163, 0 }, { 165, 169, 0 }, { 171, 187, 0 },
+	{ 130, 130, 0 }, { 135, 135, 0 }, { 137, 137, 0 }, { 139, 139, 0 }, { 141, 143, 0 }, { 145, 146, 0 },
+	{ 148, 148, 0 }, { 151, 151, 0 }, { 153, 153, 0 }, { 155, 155, 0 }, { 157, 157, 0 }, { 159, 159, 0 },
+	{ 161, 162, 0 }, { 164, 164, 0 }, { 167, 170, 0 }, { 172, 178, 0 }, { 180, 183, 0 }, { 185, 188, 0 },
+	{ 190, 190, 0 }, { 128, 131, 0 }, { 133, 159, 0 }, { 161, 162, 0 }, { 164, 164, 0 }, { 167, 167, 0 },
+	{ 169, 178, 0 }, { 180, 183, 0 }, { 185, 185, 0 }, { 187, 187, 0 }, { 128, 132, 0 }, { 142, 142, 0 },
+	{ 128, 172, 0 }, { 128, 131, 223 }, { 132, 132, 165 }, { 133, 133, 22 }, { 134, 138, 223 }, { 139, 139, 21 },
+	{ 176, 176, 223 }, { 177, 177, 20 }, { 178, 178, 19 }, { 128, 136, 0 }, { 144, 153, 0 }, { 128, 170, 0 },
+	{ 176, 188, 0 }, { 128, 187, 0 }, { 144, 146, 0 }, { 164, 167, 0 }, { 176, 191, 0 }, { 128, 158, 223 },
+	{ 159, 159, 24 }, { 160, 178, 223 }, { 179, 179, 217 }, { 180, 180, 72 }, { 128, 183, 0 }, { 160, 167, 223 },
+	{ 168, 168, 40 }, { 169, 169, 165 }, { 171, 171, 28 }, { 172, 172, 55 }, { 173, 173, 27 }, { 174, 174, 177 },
+	{ 188, 188, 223 }, { 189, 189, 26 }, { 128, 138, 0 }, { 144, 144, 0 }, { 163, 183, 0 }, { 189, 191, 0 },
+	{ 144, 173, 0 }, { 144, 152, 223 }, { 153, 153, 194 }, { 128, 143, 223 }, { 144, 144, 53 }, { 128, 141, 223 },
+	{ 142, 142, 110 }, { 146, 148, 223 }, { 149, 149, 228 }, { 128, 128, 67 }, { 130, 130, 66 }, { 131, 131, 65 },
+	{ 132, 132, 64 }, { 133, 133, 63 }, { 134, 134, 62 }, { 135, 135, 61 }, { 136, 136, 60 }, { 138, 138, 59 },
+	{ 139, 139, 165 }, { 140, 140, 205 }, { 141, 141, 58 }, { 144, 144, 57 }, { 145, 145, 56 }, { 146, 146, 55 },
+	{ 147, 147, 54 }, { 150, 150, 53 }, { 151, 151, 52 }, { 152, 152, 55 }, { 153, 153, 51 }, { 154, 154, 50 },
+	{ 156, 156, 178 }, { 160, 160, 49 }, { 163, 163, 48 }, { 164, 164, 47 }, { 165, 165, 46 }, { 166, 166, 45 },
+	{ 167, 167, 44 }, { 168, 168, 43 }, { 169, 169, 42 }, { 170, 170, 41 }, { 171, 171, 40 }, { 176, 176, 39 },
+	{ 177, 177, 38 }, { 178, 178, 177 }, { 180, 180, 37 }, { 181, 181, 36 }, { 182, 182, 35 }, { 187, 187, 34 },
+	{ 190, 190, 33 }, { 176, 176, 0 }, { 160, 178, 0 }, { 128, 137, 0 }, { 152, 152, 0 }, { 134, 134, 0 },
+	{ 160, 165, 0 }, { 167, 168, 0 }, { 170, 191, 0 }, { 128, 134, 0 }, { 136, 137, 0 }, { 139, 176, 0 },
+	{ 128, 128, 0 }, { 178, 191, 0 }, { 128, 136, 0 }, { 138, 174, 0 }, { 128, 184, 0 }, { 128, 137, 0 },
+	{ 157, 157, 0 }, { 144, 144, 0 }, { 156, 191, 0 }, { 128, 128, 0 }, { 139, 178, 0 }, { 186, 186, 0 },
+	{ 128, 144, 0 }, { 161, 161, 0 }, { 163, 163, 0 }, { 160, 167, 0 }, { 170, 191, 0 }, { 129, 129, 0 },
+	{ 128, 134, 0 }, { 137, 137, 0 }, { 140, 147, 0 }, { 149, 150, 0 }, { 152, 175, 0 }, { 191, 191, 0 },
+	{ 191, 191, 0 }, { 128, 171, 0 }, { 128, 170, 0 }, { 184, 184, 0 }, { 132, 132, 0 }, { 152, 155, 0 },
+	{ 128, 174, 0 }, { 132, 133, 0 }, { 135, 135, 0 }, { 128, 175, 0 }, { 135, 138, 0 }, { 159, 161, 0 },
+	{ 128, 180, 0 }, { 144, 144, 0 }, { 157, 161, 0 }, { 128, 134, 0 }, { 136, 136, 0 }, { 138, 141, 0 },
+	{ 143, 157, 0 }, { 159, 168, 0 }, { 176, 191, 0 }, { 128, 145, 0 }, { 147, 171, 0 }, { 129, 132, 0 },
+	{ 154, 154, 0 }, { 156, 156, 0 }, { 131, 178, 0 }, { 132, 132, 0 }, { 135, 135, 0 }, { 144, 178, 0 },
+	{ 182, 182, 0 }, { 131, 166, 0 }, { 144, 168, 0 }, { 131, 175, 0 }, { 131, 183, 0 }, { 128, 128, 96 },
+	{ 129, 129, 95 }, { 130, 130, 223 }, { 131, 131, 94 }, { 138, 138, 93 }, { 139, 139, 92 }, { 140, 140, 91 },
+	{ 141, 141, 90 }, { 142, 142, 89 }, { 143, 143, 88 }, { 145, 145, 104 }, { 146, 146, 87 }, { 148, 148, 86 },
+	{ 149, 149, 155 }, { 152, 155, 223 }, { 156, 156, 85 }, { 157, 157, 84 }, { 160, 160, 83 }, { 161, 161, 82 },
+	{ 162, 162, 165 }, { 163, 163, 81 }, { 164, 164, 80 }, { 166, 166, 79 }, { 168, 168, 78 }, { 169, 169, 77 },
+	{ 170, 170, 76 }, { 171, 171, 75 }, { 172, 172, 166 }, { 173, 173, 74 }, { 174, 174, 73 }, { 176, 176, 223 },
+	{ 177, 177, 72 }, { 180, 180, 155 }, { 186, 186, 71 }, { 188, 188, 70 }, { 189, 189, 192 }, { 190, 190, 150 },
+	{ 191, 191, 69 }, { 128, 132, 0 }, { 160, 182, 0 }, { 128, 156, 0 }, { 167, 167, 0 }, { 176, 191, 0 },
+	{ 128, 169, 0 }, { 176, 177, 0 }, { 128, 136, 0 }, { 128, 145, 0 }, { 128, 149, 0 }, { 160, 178, 0 },
+	{ 128, 135, 0 }, { 137, 164, 0 }, { 128, 156, 0 }, { 160, 188, 0 }, { 128, 128, 0 }, { 144, 147, 0 },
+	{ 149, 151, 0 }, { 153, 181, 0 }, { 128, 183, 0 }, { 190, 191, 0 }, { 128, 149, 0 }, { 160, 185, 0 },
+	{ 160, 178, 0 }, { 180, 181, 0 }, { 128, 149, 0 }, { 160, 182, 0 }, { 128, 133, 0 }, { 136, 136, 0 },
+	{ 138, 181, 0 }, { 183, 184, 0 }, { 188, 188, 0 }, { 191, 191, 0 }, { 128, 149, 0 }, { 160, 167, 0 },
+	{ 128, 182, 0 }, { 128, 167, 0 }, { 176, 191, 0 }, { 128, 157, 0 }, { 128, 131, 0 }, { 136, 143, 0 },
+	{ 128, 157, 0 }, { 160, 191, 0 }, { 128, 128, 0 }, { 130, 137, 0 }, { 144, 181, 0 }, { 128, 159, 0 },
+	{ 173, 191, 0 }, { 128, 144, 0 }, { 128, 156, 0 }, { 160, 191, 0 }, { 128, 186, 0 }, { 128, 141, 0 },
+	{ 144, 157, 0 }, { 128, 139, 0 }, { 141, 166, 0 }, { 168, 186, 0 }, { 188, 189, 0 }, { 191, 191, 0 },
+	{ 164, 168, 223 }, { 169, 169, 111 }, { 170, 170, 223 }, { 171, 171, 110 }, { 172, 172, 109 }, { 173, 173, 108 },
+	{ 174, 174, 107 }, { 175, 175, 106 }, { 176, 179, 223 }, { 180, 180, 105 }, { 181, 181, 104 }, { 182, 182, 103 },
+	{ 183, 183, 102 }, { 185, 185, 101 }, { 186, 186, 223 }, { 187, 187, 137 }, { 189, 189, 100 }, { 190, 190, 99 },
+	{ 191, 191, 98 }, { 130, 135, 0 }, { 138, 143, 0 }, { 146, 151, 0 }, { 154, 156, 0 }, { 128, 157, 0 },
+	{ 160, 190, 0 }, { 166, 175, 0 }, { 177, 191, 0 }, { 176, 180, 0 }, { 182, 191, 0 }, { 128, 135, 0 },
+	{ 176, 187, 0 }, { 128, 143, 0 }, { 146, 191, 0 }, { 144, 191, 0 }, { 128, 189, 0 }, { 147, 191, 0 },
+	{ 128, 177, 0 }, { 128, 129, 0 }, { 131, 132, 0 }, { 134, 191, 0 }, { 157, 157, 0 }, { 159, 168, 0 },
+	{ 170, 182, 0 }, { 184, 188, 0 }, { 190, 190, 0 }, { 128, 153, 0 }, { 128, 173, 0 }, { 176, 191, 0 },
+	{ 128, 157, 223 }, { 158, 158, 114 }, { 159, 159, 113 }, { 128, 134, 0 }, { 139, 187, 0 }, { 128, 163, 0 },
+	{ 176, 191, 0 }, { 128, 128, 135 }, { 129, 145, 223 }, { 146, 146, 134 }, { 147, 147, 133 }, { 148, 151, 223 },
+	{ 152, 152, 132 }, { 153, 153, 131 }, { 154, 154, 225 }, { 155, 155, 156 }, { 158, 158, 130 }, { 159, 159, 129 },
+	{ 160, 160, 128 }, { 161, 161, 170 }, { 162, 162, 127 }, { 163, 163, 126 }, { 164, 164, 125 }, { 165, 165, 124 },
+	{ 166, 166, 123 }, { 167, 167, 122 }, { 168, 168, 121 }, { 169, 169, 120 }, { 170, 170, 119 }, { 171, 171, 118 },
+	{ 172, 172, 117 }, { 175, 175, 116 }, { 176, 191, 223 }, { 128, 162, 0 }, { 129, 134, 0 }, { 137, 142, 0 },
+	{ 145, 150, 0 }, { 160, 166, 0 }, { 168, 174, 0 }, { 128, 128, 0 }, { 130, 130, 0 }, { 155, 156, 0 },
+	{ 160, 170, 0 }, { 178, 178, 0 }, { 128, 175, 0 }, { 177, 177, 0 }, { 181, 182, 0 }, { 185, 189, 0 },
+	{ 128, 130, 0 }, { 132, 139, 0 }, { 160, 175, 0 }, { 177, 182, 0 }, { 186, 186, 0 }, { 190, 191, 0 },
+	{ 128, 168, 0 }, { 160, 164, 0 }, { 167, 175, 0 }, { 186, 190, 0 }, { 132, 178, 0 }, { 128, 134, 0 },
+	{ 160, 188, 0 }, { 138, 165, 0 }, { 176, 191, 0 }, { 178, 183, 0 }, { 187, 187, 0 }, { 189, 190, 0 },
+	{ 130, 179, 0 }, { 128, 129, 0 }, { 131, 133, 0 }, { 135, 138, 0 }, { 140, 162, 0 }, { 183, 183, 0 },
+	{ 187, 191, 0 }, { 143, 143, 0 }, { 174, 174, 0 }, { 128, 139, 0 }, { 144, 159, 0 }, { 170, 171, 0 },
+	{ 144, 183, 0 }, { 128, 140, 0 }, { 128, 148, 0 }, { 150, 191, 0 }, { 128, 190, 223 }, { 191, 191, 137 },
+	{ 128, 188, 0 }, { 128, 191, 223 }, { 128, 182, 223 }, { 184, 191, 223 }, { 128, 128, 145 }, { 129, 129, 176 },
+	{ 130, 130, 144 }, { 131, 131, 143 }, { 132, 132, 142 }, { 133, 133, 223 }, { 134, 134, 141 }, { 135, 135, 150 },
+	{ 144, 191, 223 }, { 128, 142, 0 }, { 160, 191, 0 }, { 133, 175, 0 }, { 177, 191, 0 }, { 128, 186, 0 },
+	{ 191, 191, 0 }, { 128, 150, 0 }, { 159, 159, 0 }, { 161, 191, 0 }, { 134, 134, 0 }, { 188, 188, 0 },
+	{ 132, 132, 151 }, { 180, 180, 150 }, { 181, 181, 149 }, { 182, 182, 148 }, { 183, 183, 147 }, { 128, 134, 0 },
+	{ 136, 142, 0 }, { 144, 150, 0 }, { 152, 158, 0 }, { 128, 150, 0 }, { 160, 166, 0 }, { 168, 174, 0 },
+	{ 176, 182, 0 }, { 184, 190, 0 }, { 128, 167, 0 }, { 176, 191, 0 }, { 181, 184, 0 }, { 128, 128, 185 },
+	{ 129, 129, 184 }, { 130, 130, 183 }, { 132, 136, 223 }, { 137, 137, 182 }, { 138, 138, 181 }, { 139, 139, 180 },
+	{ 140, 140, 179 }, { 141, 141, 178 }, { 142, 142, 177 }, { 144, 144, 176 }, { 145, 152, 223 }, { 153, 153, 175 },
+	{ 154, 154, 174 }, { 155, 155, 173 }, { 156, 156, 172 }, { 157, 157, 171 }, { 158, 158, 170 }, { 159, 159, 169 },
+	{ 160, 160, 225 }, { 161, 161, 168 }, { 162, 162, 167 }, { 163, 163, 166 }, { 164, 164, 165 }, { 165, 165, 164 },
+	{ 166, 166, 163 }, { 167, 167, 162 }, { 168, 168, 161 }, { 169, 169, 160 }, { 172, 172, 159 }, { 173, 173, 158 },
+	{ 174, 174, 157 }, { 175, 175, 156 }, { 176, 176, 155 }, { 177, 177, 154 }, { 179, 179, 153 }, { 169, 172, 0 },
+	{ 174, 179, 0 }, { 181, 182, 0 }, { 186, 186, 0 }, { 141, 143, 0 }, { 154, 183, 0 }, { 128, 163, 0 },
+	{ 128, 165, 0 }, { 131, 160, 0 }, { 174, 175, 0 }, { 186, 191, 0 }, { 133, 139, 0 }, { 133, 179, 0 },
+	{ 128, 148, 0 }, { 128, 150, 0 }, { 160, 191, 0 }, { 128, 137, 0 }, { 128, 171, 0 }, { 176, 191, 0 },
+	{ 144, 173, 0 }, { 176, 180, 0 }, { 128, 158, 0 }, { 128, 181, 0 }, { 128, 132, 0 }, { 135, 168, 0 },
+	{ 170, 170, 0 }, { 176, 191, 0 }, { 128, 130, 0 }, { 132, 184, 0 }, { 156, 156, 0 }, { 128, 179, 0 },
+	{ 128, 145, 0 }, { 160, 172, 0 }, { 174, 176, 0 }, { 128, 140, 0 }, { 142, 145, 0 }, { 160, 177, 0 },
+	{ 128, 170, 0 }, { 177, 184, 0 }, { 129, 154, 0 }, { 160, 191, 0 }, { 128, 172, 0 }, { 175, 191, 0 },
+	{ 129, 191, 0 }, { 128, 143, 0 }, { 128, 154, 0 }, { 128, 144, 0 }, { 146, 149, 0 }, { 152, 191, 0 },
+	{ 128, 128, 0 }, { 130, 133, 0 }, { 136, 150, 0 }, { 152, 191, 0 }, { 128, 136, 0 }, { 138, 141, 0 },
+	{ 144, 176, 0 }, { 178, 181, 0 }, { 184, 190, 0 }, { 128, 136, 0 }, { 138, 141, 0 }, { 144, 150, 0 },
+	{ 152, 152, 0 }, { 154, 157, 0 }, { 160, 191, 0 }, { 128, 129, 0 }, { 142, 142, 0 }, { 144, 149, 0 },
+	{ 154, 157, 0 }, { 161, 161, 0 }, { 165, 166, 0 }, { 174, 176, 0 }, { 181, 191, 0 }, { 128, 170, 0 },
+	{ 191, 191, 0 }, { 160, 160, 217 }, { 161, 161, 216 }, { 162, 162, 215 }, { 163, 163, 214 }, { 164, 164, 213 },
+	{ 165, 165, 212 }, { 166, 166, 211 }, { 167, 167, 210 }, { 168, 168, 209 }, { 169, 169, 208 }, { 170, 170, 207 },
+	{ 171, 171, 206 }, { 172, 172, 205 }, { 173, 173, 204 }, { 174, 174, 203 }, { 175, 175, 202 }, { 176, 176, 201 },
+	{ 177, 177, 200 }, { 178, 178, 199 }, { 179, 179, 198 }, { 180, 180, 197 }, { 181, 181, 196 }, { 182, 182, 195 },
+	{ 183, 183, 194 }, { 184, 184, 193 }, { 185, 185, 192 }, { 186, 186, 191 }, { 187, 187, 190 }, { 188, 188, 189 },
+	{ 189, 189, 188 }, { 190, 190, 187 }, { 136, 140, 0 }, { 128, 135, 0 }, { 137, 172, 0 }, { 128, 128, 0 },
+	{ 128, 132, 0 }, { 156, 159, 0 }, { 129, 130, 0 }, { 132, 132, 0 }, { 134, 138, 0 }, { 140, 163, 0 },
+	{ 165, 165, 0 }, { 167, 176, 0 }, { 178, 179, 0 }, { 189, 189, 0 }, { 128, 133, 0 }, { 129, 176, 0 },
+	{ 178, 179, 0 }, { 128, 134, 0 }, { 133, 150, 0 }, { 154, 177, 0 }, { 179, 187, 0 }, { 189, 189, 0 },
+	{ 142, 142, 0 }, { 148, 150, 0 }, { 159, 161, 0 }, { 186, 191, 0 }, { 132, 140, 0 }, { 142, 144, 0 },
+	{ 146, 186, 0 }, { 189, 189, 0 }, { 158, 158, 0 }, { 160, 161, 0 }, { 177, 178, 0 }, { 128, 128, 0 },
+	{ 133, 140, 0 }, { 142, 144, 0 }, { 146, 168, 0 }, { 170, 179, 0 }, { 181, 185, 0 }, { 189, 189, 0 },
+	{ 152, 154, 0 }, { 160, 161, 0 }, { 133, 140, 0 }, { 142, 144, 0 }, { 146, 168, 0 }, { 170, 185, 0 },
+	{ 189, 189, 0 }, { 144, 144, 0 }, { 131, 131, 0 }, { 133, 138, 0 }, { 142, 144, 0 }, { 146, 149, 0 },
+	{ 153, 154, 0 }, { 156, 156, 0 }, { 158, 159, 0 }, { 163, 164, 0 }, { 168, 170, 0 }, { 174, 185, 0 },
+	{ 156, 157, 0 }, { 159, 161, 0 }, { 177, 177, 0 }, { 133, 140, 0 }, { 143, 144, 0 }, { 147, 168, 0 },
+	{ 170, 176, 0 }, { 178, 179, 0 }, { 181, 185, 0 }, { 189, 189, 0 }, { 144, 144, 0 }, { 160, 161, 0 },
+	{ 185, 185, 0 }, { 133, 141, 0 }, { 143, 145, 0 }, { 147, 168, 0 }, { 170, 176, 0 }, { 178, 179, 0 },
+	{ 181, 185, 0 }, { 189, 189, 0 }, { 153, 156, 0 }, { 158, 158, 0 }, { 178, 180, 0 }, { 133, 138, 0 },
+	{ 143, 144, 0 }, { 147, 168, 0 }, { 170, 176, 0 }, { 178, 179, 0 }, { 181, 182, 0 }, { 184, 185, 0 },
+	{ 142, 142, 0 }, { 156, 157, 0 }, { 159, 161, 0 }, { 176, 177, 0 }, { 188, 188, 0 }, { 128, 128, 0 },
+	{ 133, 140, 0 }, { 143, 144, 0 }, { 147, 168, 0 }, { 170, 176, 0 }, { 178, 178, 0 }, { 182, 185, 0 },
+	{ 189, 189, 0 }, { 144, 144, 0 }, { 152, 161, 0 }, { 178, 191, 0 }, { 132, 185, 0 }, { 189, 189, 0 },
+	{ 128, 135, 0 }, { 160, 180, 0 }, { 182, 191, 0 }, { 128, 152, 0 }, { 160, 170, 0 }, { 128, 149, 0 },
+	{ 138, 170, 0 }, { 128, 165, 0 }, { 177, 177, 0 }, { 141, 191, 0 }, { 144, 144, 0 }, { 146, 175, 0 },
+	{ 128, 147, 0 }, { 149, 149, 0 }, { 174, 175, 0 }, { 186, 188, 0 }, { 191, 191, 0 }, { 128, 191, 0 },
+	{ 129, 138, 0 }, { 174, 175, 0 }, { 177, 191, 0 }, { 160, 191, 0 }, { 144, 170, 0 }, { 175, 178, 0 },
+	{ 148, 148, 0 }, { 128, 131, 0 }, { 187, 187, 0 }, { 170, 170, 0 }, { 186, 186, 0 },
+};
+static const uint16_t Lo_reverse_state[] = {
+	0, 498, 499, 500, 501, 502, 503, 506, 507, 508, 509, 510,
+	511, 512, 513, 516, 517, 518, 519, 520, 521, 522, 523, 524,
+	525, 526, 527, 528, 529, 530, 531, 533, 534, 535, 536, 537,
+	538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549,
+	550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+	562, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574,
+	575, 576, 577, 578, 579, 580, 581, 582, 584, 585, 586, 587,
+	588, 589, 590, 591, 633, 639, 640, 641, 643, 644, 645, 646,
+	647, 649, 650, 651, 652, 654, 656, 658, 659, 660, 663, 665,
+	666, 667, 668, 669, 670, 672, 673, 674, 675, 676, 677, 678,
+	679, 680, 681, 683, 686, 687, 688, 689, 690, 691, 692, 693,
+	698, 699, 701, 702, 705, 706, 707, 708, 709, 710, 712, 714,
+	715, 716, 717, 718, 720, 721, 722, 723, 724, 725, 726, 727,
+	728, 729, 730, 731, 732, 733, 736, 737, 738, 739, 740, 741,
+	742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753,
+	754, 756, 757, 758, 759, 760, 761, 762, 763, 764, 766, 767,
+	768, 769, 770, 771, 772, 773, 774, 775, 777, 778, 779, 780,
+	781, 782, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793,
+	794, 795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805,
+	806, 807, 808, 809,
+};
+static const UTF8Range Lo_reverse_range[] = {
+	{ 128, 128, 228 }, { 128, 128, 227 }, { 128, 128, 225 }, { 128, 128, 224 }, { 128, 128, 222 }, { 128, 128, 220 },
+	{ 128, 128, 218 }, { 128, 128, 217 }, { 128, 128, 216 }, { 128, 129, 214 }, { 128, 129, 213 }, { 128, 129, 212 },
+	{ 128, 130, 211 }, { 128, 130, 210 }, { 128, 131, 208 }, { 128, 131, 207 }, { 128, 131, 205 }, { 128, 132, 204 },
+	{ 128, 132, 203 }, { 128, 132, 202 }, { 128, 132, 201 }, { 128, 133, 200 }, { 128, 133, 199 }, { 128, 134, 198 },
+	{ 128, 134, 197 }, { 128, 134, 196 }, { 128, 134, 194 }, { 128, 134, 193 }, { 128, 134, 191 }, { 128, 134, 189 },
+	{ 128, 135, 188 }, { 128, 135, 187 }, { 128, 135, 186 }, { 128, 135, 185 }, { 128, 136, 183 }, { 128, 136, 182 },
+	{ 128, 136, 180 }, { 128, 136, 179 }, { 128, 136, 178 }, { 128, 137, 177 }, { 128, 137, 176 }, { 128, 137, 175 },
+	{ 128, 137, 174 }, { 128, 138, 172 }, { 128, 138, 170 }, { 128, 139, 169 }, { 128, 139, 168 }, { 128, 140, 167 },
+	{ 128, 140, 166 }, { 128, 141, 165 }, { 128, 142, 163 }, { 128, 143, 162 }, { 128, 143, 161 }, { 128, 144, 160 },
+	{ 128, 144, 159 }, { 128, 144, 158 }, { 128, 145, 157 }, { 128, 145, 156 }, { 128, 145, 155 }, { 128, 147, 154 },
+	{ 128, 148, 153 }, { 128, 148, 152 }, { 128, 149, 151 }, { 128, 149, 150 }, { 128, 149, 149 }, { 128, 149, 148 },
+	{ 128, 149, 147 }, { 128, 150, 146 }, { 128, 150, 145 }, { 128, 150, 144 }, { 128, 152, 143 }, { 128, 153, 142 },
+	{ 128, 154, 141 }, { 128, 156, 140 }, { 128, 156, 139 }, { 128, 156, 138 }, { 128, 157, 135 }, { 128, 157, 133 },
+	{ 128, 157, 132 }, { 128, 158, 131 }, { 128, 159, 130 }, { 128, 160, 128 }, { 128, 161, 126 }, { 128, 162, 125 },
+	{ 128, 163, 124 }, { 128, 163, 123 }, { 128, 165, 122 }, { 128, 165, 121 }, { 128, 167, 120 }, { 128, 167, 119 },
+	{ 128, 168, 118 }, { 128, 169, 117 }, { 128, 170, 116 }, { 128, 170, 115 }, { 128, 170, 114 }, { 128, 170, 113 },
+	{ 128, 171, 112 }, { 128, 171, 111 }, { 128, 172, 110 }, { 128, 172, 109 }, { 128, 173, 108 }, { 128, 174, 106 },
+	{ 128, 175, 105 }, { 128, 175, 104 }, { 128, 177, 103 }, { 128, 179, 102 }, { 128, 180, 101 }, { 128, 181, 100 },
+	{ 128, 182, 99 }, { 128, 183, 98 }, { 128, 183, 97 }, { 128, 184, 96 }, { 128, 186, 95 }, { 128, 186, 94 },
+	{ 128, 187, 93 }, { 128, 188, 91 }, { 128, 189, 90 }, { 128, 191, 87 }, { 129, 129, 86 }, { 129, 130, 85 },
+	{ 129, 132, 84 }, { 129, 134, 83 }, { 129, 138, 82 }, { 129, 154, 81 }, { 129, 176, 80 }, { 129, 191, 79 },
+	{ 130, 130, 78 }, { 130, 130, 222 }, { 130, 133, 220 }, { 130, 135, 77 }, { 130, 137, 224 }, { 130, 179, 76 },
+	{ 131, 131, 75 }, { 131, 132, 214 }, { 131, 133, 213 }, { 131, 160, 74 }, { 131, 166, 73 }, { 131, 175, 72 },
+	{ 131, 178, 71 }, { 131, 183, 70 }, { 132, 132, 69 }, { 132, 132, 68 }, { 132, 132, 85 }, { 132, 133, 67 },
+	{ 132, 139, 211 }, { 132, 140, 66 }, { 132, 178, 65 }, { 132, 184, 210 }, { 132, 185, 64 }, { 133, 138, 75 },
+	{ 133, 138, 63 }, { 133, 139, 62 }, { 133, 140, 217 }, { 133, 140, 61 }, { 133, 140, 60 }, { 133, 140, 216 },
+	{ 133, 141, 59 }, { 133, 150, 58 }, { 133, 159, 208 }, { 133, 175, 57 }, { 133, 179, 56 }, { 134, 134, 55 },
+	{ 134, 134, 54 }, { 134, 138, 85 }, { 134, 191, 214 }, { 135, 135, 78 }, { 135, 135, 67 }, { 135, 135, 68 },
+	{ 135, 138, 53 }, { 135, 138, 213 }, { 135, 168, 202 }, { 136, 136, 196 }, { 136, 136, 200 }, { 136, 137, 198 },
+	{ 136, 140, 52 }, { 136, 142, 191 }, { 136, 143, 207 }, { 136, 150, 220 }, { 137, 137, 78 }, { 137, 137, 197 },
+	{ 137, 142, 83 }, { 137, 164, 188 }, { 137, 172, 186 }, { 138, 141, 196 }, { 138, 141, 179 }, { 138, 141, 178 },
+	{ 138, 143, 77 }, { 138, 165, 51 }, { 138, 170, 50 }, { 138, 174, 182 }, { 138, 181, 200 }, { 139, 139, 78 },
+	{ 139, 155, 177 }, { 139, 176, 198 }, { 139, 178, 227 }, { 139, 187, 194 }, { 140, 147, 197 }, { 140, 162, 213 },
+	{ 140, 163, 85 }, { 141, 143, 78 }, { 141, 143, 49 }, { 141, 166, 169 }, { 141, 191, 48 }, { 142, 142, 47 },
+	{ 142, 142, 212 }, { 142, 142, 46 }, { 142, 142, 45 }, { 142, 144, 66 }, { 142, 144, 217 }, { 142, 144, 61 },
+	{ 142, 144, 75 }, { 142, 145, 166 }, { 143, 143, 44 }, { 143, 144, 60 }, { 143, 144, 63 }, { 143, 144, 216 },
+	{ 143, 145, 59 }, { 143, 157, 196 }, { 144, 144, 170 }, { 144, 144, 43 }, { 144, 144, 42 }, { 144, 144, 41 },
+	{ 144, 144, 40 }, { 144, 144, 39 }, { 144, 144, 38 }, { 144, 146, 37 }, { 144, 147, 225 }, { 144, 149, 36 },
+	{ 144, 150, 191 }, { 144, 150, 178 }, { 144, 153, 183 }, { 144, 157, 165 }, { 144, 159, 168 }, { 144, 168, 35 },
+	{ 144, 170, 34 }, { 144, 173, 33 }, { 144, 173, 32 }, { 144, 176, 179 }, { 144, 178, 68 }, { 144, 181, 224 },
+	{ 144, 183, 31 }, { 144, 191, 30 }, { 145, 146, 78 }, { 145, 150, 83 }, { 146, 149, 158 }, { 146, 149, 75 },
+	{ 146, 151, 77 }, { 146, 168, 217 }, { 146, 168, 61 }, { 146, 175, 38 }, { 146, 186, 66 }, { 146, 191, 162 },
+	{ 147, 168, 60 }, { 147, 168, 59 }, { 147, 168, 63 }, { 147, 168, 216 }, { 147, 171, 157 }, { 147, 191, 29 },
+	{ 148, 148, 78 }, { 148, 148, 28 }, { 148, 150, 46 }, { 149, 149, 154 }, { 149, 150, 197 }, { 149, 151, 225 },
+	{ 150, 191, 153 }, { 151, 151, 78 }, { 152, 152, 176 }, { 152, 152, 178 }, { 152, 154, 27 }, { 152, 155, 26 },
+	{ 152, 158, 191 }, { 152, 161, 39 }, { 152, 175, 197 }, { 152, 191, 158 }, { 152, 191, 220 }, { 153, 153, 78 },
+	{ 153, 154, 75 }, { 153, 156, 25 }, { 153, 181, 225 }, { 154, 154, 84 }, { 154, 156, 77 }, { 154, 157, 178 },
+	{ 154, 157, 36 }, { 154, 177, 58 }, { 154, 183, 49 }, { 155, 155, 78 }, { 155, 156, 222 }, { 156, 156, 84 },
+	{ 156, 156, 24 }, { 156, 156, 75 }, { 156, 157, 23 }, { 156, 157, 45 }, { 156, 159, 201 }, { 156, 191, 43 },
+	{ 157, 157, 78 }, { 157, 157, 175 }, { 157, 157, 22 }, { 157, 161, 42 }, { 158, 158, 21 }, { 158, 158, 25 },
+	{ 158, 159, 75 }, { 159, 159, 78 }, { 159, 159, 146 }, { 159, 161, 53 }, { 159, 161, 46 }, { 159, 161, 23 },
+	{ 159, 161, 45 }, { 159, 168, 196 }, { 159, 168, 22 }, { 160, 161, 21 }, { 160, 161, 27 }, { 160, 161, 40 },
+	{ 160, 164, 20 }, { 160, 165, 55 }, { 160, 166, 83 }, { 160, 166, 145 }, { 160, 167, 19 }, { 160, 167, 148 },
+	{ 160, 170, 222 }, { 160, 170, 143 }, { 160, 172, 155 }, { 160, 175, 211 }, { 160, 177, 166 }, { 160, 178, 18 },
+	{ 160, 178, 151 }, { 160, 178, 17 }, { 160, 180, 16 }, { 160, 182, 203 }, { 160, 182, 149 }, { 160, 185, 150 },
+	{ 160, 188, 15 }, { 160, 188, 193 }, { 160, 190, 132 }, { 160, 191, 133 }, { 160, 191, 138 }, { 160, 191, 163 },
+	{ 160, 191, 144 }, { 160, 191, 81 }, { 160, 191, 178 }, { 160, 191, 14 }, { 161, 161, 160 }, { 161, 161, 36 },
+	{ 161, 162, 78 }, { 161, 162, 208 }, { 161, 163, 177 }, { 161, 191, 146 }, { 163, 163, 160 }, { 163, 164, 75 },
+	{ 163, 183, 13 }, { 164, 164, 78 }, { 164, 164, 208 }, { 164, 167, 37 }, { 165, 165, 85 }, { 165, 166, 36 },
+	{ 165, 169, 177 }, { 166, 175, 12 }, { 167, 167, 208 }, { 167, 167, 140 }, { 167, 168, 55 }, { 167, 170, 78 },
+	{ 167, 175, 20 }, { 167, 176, 85 }, { 168, 170, 75 }, { 168, 174, 83 }, { 168, 174, 145 }, { 168, 186, 169 },
+	{ 169, 172, 11 }, { 169, 178, 208 }, { 170, 170, 202 }, { 170, 170, 10 }, { 170, 171, 168 }, { 170, 176, 60 },
+	{ 170, 176, 59 }, { 170, 176, 63 }, { 170, 176, 216 }, { 170, 179, 217 }, { 170, 182, 22 }, { 170, 185, 61 },
+	{ 170, 191, 55 }, { 170, 191, 19 }, { 171, 187, 177 }, { 172, 178, 78 }, { 173, 191, 130 }, { 174, 174, 9 },
+	{ 174, 175, 74 }, { 174, 175, 154 }, { 174, 175, 82 }, { 174, 176, 155 }, { 174, 176, 36 }, { 174, 179, 11 },
+	{ 174, 185, 75 }, { 175, 178, 34 }, { 175, 191, 109 }, { 176, 176, 8 }, { 176, 177, 117 }, { 176, 177, 45 },
+	{ 176, 180, 7 }, { 176, 180, 32 }, { 176, 182, 145 }, { 176, 187, 187 }, { 176, 188, 116 }, { 176, 191, 126 },
+	{ 176, 191, 37 }, { 176, 191, 196 }, { 176, 191, 140 }, { 176, 191, 120 }, { 176, 191, 108 }, { 176, 191, 124 },
+	{ 176, 191, 51 }, { 176, 191, 6 }, { 176, 191, 111 }, { 176, 191, 202 }, { 177, 177, 104 }, { 177, 177, 23 },
+	{ 177, 177, 121 }, { 177, 178, 21 }, { 177, 182, 211 }, { 177, 184, 114 }, { 177, 191, 12 }, { 177, 191, 57 },
+	{ 177, 191, 82 }, { 178, 178, 222 }, { 178, 178, 216 }, { 178, 179, 85 }, { 178, 179, 80 }, { 178, 179, 60 },
+	{ 178, 179, 59 }, { 178, 179, 63 }, { 178, 180, 25 }, { 178, 181, 179 }, { 178, 183, 5 }, { 178, 191, 228 },
+	{ 178, 191, 39 }, { 179, 187, 58 }, { 180, 181, 17 }, { 180, 183, 78 }, { 180, 183, 208 }, { 181, 182, 104 },
+	{ 181, 182, 11 }, { 181, 182, 63 }, { 181, 184, 4 }, { 181, 185, 217 }, { 181, 185, 60 }, { 181, 185, 59 },
+	{ 181, 191, 36 }, { 182, 182, 68 }, { 182, 185, 216 }, { 182, 191, 7 }, { 182, 191, 16 }, { 183, 183, 3 },
+	{ 183, 184, 200 }, { 184, 184, 115 }, { 184, 185, 63 }, { 184, 188, 22 }, { 184, 190, 145 }, { 184, 190, 179 },
+	{ 185, 185, 208 }, { 185, 185, 40 }, { 185, 188, 78 }, { 185, 189, 104 }, { 186, 186, 227 }, { 186, 186, 211 },
+	{ 186, 186, 11 }, { 186, 186, 10 }, { 186, 188, 154 }, { 186, 190, 20 }, { 186, 191, 74 }, { 186, 191, 46 },
+	{ 187, 187, 208 }, { 187, 187, 5 }, { 187, 187, 2 }, { 187, 191, 3 }, { 188, 188, 200 }, { 188, 188, 54 },
+	{ 188, 188, 45 }, { 188, 189, 169 }, { 189, 189, 85 }, { 189, 189, 58 }, { 189, 189, 66 }, { 189, 189, 217 },
+	{ 189, 189, 61 }, { 189, 189, 60 }, { 189, 189, 59 }, { 189, 189, 216 }, { 189, 189, 64 }, { 189, 190, 5 },
+	{ 189, 191, 13 }, { 190, 190, 78 }, { 190, 190, 22 }, { 190, 191, 97 }, { 190, 191, 211 }, { 191, 191, 197 },
+	{ 191, 191, 1 }, { 191, 191, 200 }, { 191, 191, 169 }, { 191, 191, 94 }, { 191, 191, 113 }, { 191, 191, 154 },
+	{ 163, 163, 229 }, { 198, 198, 0 }, { 159, 159, 223 }, { 132, 132, 192 }, { 163, 163, 223 }, { 135, 135, 164 },
+	{ 180, 180, 192 }, { 190, 190, 226 }, { 185, 185, 215 }, { 190, 190, 229 }, { 153, 153, 223 }, { 194, 194, 0 },
+	{ 179, 179, 221 }, { 189, 189, 215 }, { 173, 173, 171 }, { 154, 154, 223 }, { 160, 160, 221 }, { 216, 216, 0 },
+	{ 169, 169, 226 }, { 162, 162, 219 }, { 163, 163, 226 }, { 187, 187, 229 }, { 166, 166, 229 }, { 167, 167, 223 },
+	{ 179, 179, 219 }, { 172, 172, 215 }, { 173, 173, 219 }, { 159, 159, 221 }, { 169, 169, 219 }, { 151, 151, 229 },
+	{ 177, 177, 219 }, { 202, 202, 0 }, { 175, 175, 215 }, { 145, 145, 226 }, { 181, 181, 215 }, { 147, 147, 223 },
+	{ 165, 165, 221 }, { 171, 171, 171 }, { 215, 215, 0 }, { 131, 131, 229 }, { 129, 129, 221 }, { 133, 133, 184 },
+	{ 220, 220, 0 }, { 165, 165, 219 }, { 171, 171, 219 }, { 175, 175, 219 }, { 141, 141, 229 }, { 169, 169, 229 },
+	{ 158, 158, 223 }, { 167, 167, 219 }, { 181, 181, 219 }, { 133, 133, 209 }, { 221, 221, 0 }, { 177, 177, 221 },
+	{ 223, 223, 0 }, { 164, 164, 223 }, { 190, 190, 219 }, { 145, 145, 229 }, { 128, 128, 164 }, { 181, 181, 229 },
+	{ 172, 172, 221 }, { 132, 132, 164 }, { 182, 182, 219 }, { 170, 170, 219 }, { 140, 140, 229 }, { 172, 172, 219 },
+	{ 176, 176, 219 }, { 173, 173, 221 }, { 168, 168, 219 }, { 164, 164, 219 }, { 166, 166, 223 }, { 180, 180, 219 },
+	{ 147, 147, 229 }, { 133, 133, 229 }, { 153, 153, 229 }, { 128, 128, 229 }, { 134, 134, 229 }, { 130, 130, 229 },
+	{ 132, 132, 229 }, { 174, 174, 221 }, { 174, 174, 219 }, { 162, 162, 223 }, { 191, 191, 215 }, { 185, 185, 209 },
+	{ 129, 129, 164 }, { 144, 144, 221 }, { 184, 184, 219 }, { 154, 154, 221 }, { 217, 217, 0 }, { 172, 172, 223 },
+	{ 135, 135, 229 }, { 186, 186, 219 }, { 165, 165, 229 }, { 128, 131, 184 }, { 128, 140, 173 }, { 128, 141, 206 },
+	{ 128, 143, 107 }, { 128, 154, 137 }, { 128, 155, 134 }, { 128, 157, 195 }, { 128, 158, 181 }, { 128, 174, 129 },
+	{ 128, 182, 89 }, { 128, 185, 127 }, { 128, 190, 92 }, { 128, 191, 88 }, { 129, 145, 223 }, { 130, 130, 226 },
+	{ 132, 136, 221 }, { 133, 133, 164 }, { 134, 138, 184 }, { 144, 152, 190 }, { 144, 191, 164 }, { 145, 152, 221 },
+	{ 146, 148, 206 }, { 148, 151, 223 }, { 152, 155, 226 }, { 156, 191, 137 }, { 157, 159, 134 }, { 160, 162, 209 },
+	{ 160, 167, 136 }, { 160, 167, 171 }, { 160, 178, 181 }, { 161, 191, 134 }, { 164, 168, 215 }, { 170, 170, 215 },
+	{ 176, 176, 184 }, { 176, 176, 226 }, { 176, 179, 215 }, { 176, 191, 223 }, { 184, 191, 89 }, { 186, 186, 215 },
+	{ 187, 191, 127 }, { 188, 188, 171 }, { 218, 218, 0 }, { 151, 151, 230 }, { 160, 169, 230 }, { 173, 173, 230 },
+	{ 176, 176, 230 }, { 229, 232, 0 }, { 235, 236, 0 }, { 228, 228, 0 }, { 180, 180, 215 }, { 187, 187, 215 },
+	{ 191, 191, 92 }, { 233, 233, 0 }, { 139, 139, 184 }, { 131, 131, 164 }, { 131, 131, 226 }, { 168, 168, 171 },
+	{ 171, 171, 229 }, { 166, 166, 226 }, { 159, 159, 181 }, { 156, 156, 226 }, { 163, 163, 221 }, { 172, 172, 226 },
+	{ 144, 144, 229 }, { 156, 156, 134 }, { 158, 158, 221 }, { 161, 161, 223 }, { 174, 174, 215 }, { 170, 170, 223 },
+	{ 146, 146, 229 }, { 152, 152, 229 }, { 172, 172, 171 }, { 144, 144, 107 }, { 150, 150, 229 }, { 147, 147, 230 },
+	{ 169, 169, 215 }, { 153, 153, 221 }, { 132, 132, 209 }, { 166, 166, 221 }, { 139, 139, 209 }, { 160, 160, 229 },
+	{ 128, 128, 221 }, { 155, 155, 221 }, { 154, 154, 229 }, { 177, 177, 184 }, { 186, 186, 226 }, { 168, 168, 223 },
+	{ 181, 181, 192 }, { 148, 148, 226 }, { 222, 222, 0 }, { 155, 155, 223 }, { 175, 175, 221 }, { 149, 149, 226 },
+	{ 176, 176, 221 }, { 180, 180, 226 }, { 158, 158, 195 }, { 175, 175, 223 }, { 186, 186, 127 }, { 172, 172, 230 },
+	{ 175, 175, 129 }, { 174, 174, 230 }, { 140, 140, 226 }, { 132, 132, 184 }, { 139, 139, 229 }, { 162, 162, 226 },
+	{ 164, 164, 221 }, { 169, 169, 171 }, { 190, 190, 215 }, { 142, 142, 226 }, { 160, 160, 134 }, { 171, 171, 230 },
+	{ 146, 146, 226 }, { 155, 155, 137 }, { 168, 168, 136 }, { 175, 175, 230 }, { 170, 170, 230 }, { 138, 138, 226 },
+	{ 170, 170, 226 }, { 188, 188, 226 }, { 141, 141, 221 }, { 156, 156, 229 }, { 142, 142, 206 }, { 171, 171, 215 },
+	{ 161, 161, 219 }, { 168, 168, 221 }, { 182, 182, 192 }, { 130, 130, 164 }, { 160, 160, 219 }, { 179, 179, 181 },
+	{ 157, 157, 226 }, { 161, 161, 226 }, { 164, 164, 226 }, { 173, 173, 226 }, { 169, 169, 221 }, { 128, 128, 223 },
+	{ 219, 219, 0 }, { 157, 157, 221 }, { 174, 174, 226 }, { 136, 136, 229 }, { 140, 140, 221 }, { 139, 139, 226 },
+	{ 167, 167, 229 }, { 142, 142, 221 }, { 174, 174, 171 }, { 178, 178, 229 }, { 182, 182, 215 }, { 134, 134, 164 },
+	{ 227, 227, 0 }, { 129, 129, 226 }, { 156, 156, 221 }, { 146, 146, 223 }, { 152, 152, 223 }, { 128, 128, 226 },
+	{ 189, 189, 171 }, { 150, 150, 230 }, { 141, 141, 173 }, { 177, 177, 230 }, { 167, 167, 221 }, { 170, 170, 229 },
+	{ 182, 182, 229 }, { 186, 186, 209 }, { 137, 137, 221 }, { 138, 138, 221 }, { 177, 177, 226 }, { 180, 180, 181 },
+	{ 152, 152, 230 }, { 176, 176, 229 }, { 178, 178, 184 }, { 155, 155, 230 }, { 163, 163, 219 }, { 189, 189, 219 },
+	{ 183, 183, 215 }, { 171, 171, 226 }, { 153, 153, 190 }, { 183, 183, 219 }, { 148, 148, 230 }, { 183, 183, 192 },
+	{ 226, 226, 0 }, { 165, 165, 223 }, { 159, 159, 195 }, { 237, 237, 0 }, { 138, 138, 229 }, { 164, 164, 229 },
+	{ 180, 180, 229 }, { 185, 185, 219 }, { 189, 189, 226 }, { 160, 160, 226 }, { 187, 187, 219 }, { 162, 162, 221 },
+	{ 191, 191, 226 }, { 163, 163, 209 }, { 149, 149, 206 }, { 199, 199, 0 }, { 146, 146, 230 }, { 143, 143, 226 },
+	{ 184, 184, 209 }, { 158, 158, 230 }, { 161, 161, 221 }, { 169, 169, 223 }, { 130, 130, 221 }, { 160, 160, 223 },
+	{ 173, 173, 215 }, { 239, 239, 0 }, { 166, 166, 219 }, { 178, 178, 219 }, { 188, 188, 219 }, { 224, 224, 0 },
+	{ 139, 139, 221 }, { 225, 225, 0 }, { 171, 171, 223 }, { 234, 234, 0 }, { 141, 141, 226 }, { 168, 168, 226 },
+	{ 144, 144, 230 }, { 168, 168, 229 }, { 177, 177, 229 }, { 145, 145, 230 }, { 240, 240, 0 },
+};
+static const uint16_t Lt_forward_state[] = {
+	0, 2, 4, 6, 10, 14,
+};
+static const UTF8Range Lt_forward_range[] = {
+	{ 199, 199, 4 }, { 225, 225, 1 }, { 190, 190, 3 }, { 191, 191, 2 }, { 140, 140, 0 }, { 188, 188, 0 },
+	{ 136, 143, 0 }, { 152, 159, 0 }, { 168, 175, 0 }, { 188, 188, 0 }, { 133, 133, 0 }, { 136, 136, 0 },
+	{ 139, 139, 0 }, { 178, 178, 0 },
+};
+static const uint16_t Lt_reverse_state[] = {
+	0, 10, 11, 12, 13, 14,
+};
+static const UTF8Range Lt_reverse_range[] = {
+	{ 133, 133, 4 }, { 136, 136, 4 }, { 136, 143, 2 }, { 139, 139, 4 }, { 140, 140, 1 }, { 152, 159, 2 },
+	{ 168, 175, 2 }, { 178, 178, 4 }, { 188, 188, 1 }, { 188, 188, 2 }, { 191, 191, 3 }, { 190, 190, 3 },
+	{ 225, 225, 0 }, { 199, 199, 0 },
+};
+static const uint16_t Lu_forward_state[] = {
+	0, 22, 27, 28, 29, 45, 46, 47, 48, 49, 51, 53,
+	55, 57, 58, 60, 64, 70, 71, 78, 80, 82, 83, 84,
+	85, 89, 90, 91, 92, 93, 94, 95, 101, 105, 130, 157,
+	171, 185, 208, 215, 236, 245, 246, 247, 248, 260, 272, 276,
+	277, 283, 287, 315, 347, 349, 350, 353, 354, 355, 380, 411,
+	439, 455, 456, 474, 480, 484, 490, 518, 544, 563, 593, 625,
+	627,
+};
+static const UTF8Range Lu_forward_range[] = {
+	{ 65, 90, 0 }, { 195, 195, 71 }, { 196, 196, 70 }, { 197, 197, 69 }, { 198, 198, 68 }, { 199, 199, 67 },
+	{ 200, 200, 66 }, { 201, 201, 65 }, { 205, 205, 64 }, { 206, 206, 63 }, { 207, 207, 62 }, { 208, 208, 61 },
+	{ 209, 209, 60 }, { 210, 210, 59 }, { 211, 211, 58 }, { 212, 212, 57 }, { 213, 213, 56 }, { 225, 225, 45 },
+	{ 226, 226, 38 }, { 234, 234, 31 }, { 239, 239, 29 }, { 240, 240, 1 }, { 144, 144, 24 }, { 145, 145, 23 },
+	{ 150, 150, 21 }, { 157, 157, 4 }, { 158, 158, 2 }, { 164, 164, 3 }, { 128, 161, 0 }, { 144, 144, 20 },
+	{ 145, 145, 19 }, { 146, 146, 18 }, { 147, 147, 17 }, { 148, 148, 16 }, { 149, 149, 15 }, { 150, 150, 14 },
+	{ 151, 151, 13 }, { 152, 152, 12 }, { 153, 153, 11 }, { 154, 154, 10 }, { 155, 155, 9 }, { 156, 156, 8 },
+	{ 157, 157, 7 }, { 158, 158, 6 }, { 159, 159, 5 }, { 138, 138, 0 }, { 144, 168, 0 }, { 150, 174, 0 },
+	{ 156, 180, 0 }, { 128, 128, 0 }, { 162, 186, 0 }, { 128, 137, 0 }, { 168, 191, 0 }, { 128, 149, 0 },
+	{ 176, 191, 0 }, { 136, 161, 0 }, { 188, 191, 0 }, { 148, 173, 0 }, { 128, 133, 0 }, { 160, 185, 0 },
+	{ 128, 132, 0 }, { 134, 134, 0 }, { 138, 144, 0 }, { 172, 191, 0 }, { 132, 133, 0 }, { 135, 138, 0 },
+	{ 141, 148, 0 }, { 150, 156, 0 }, { 184, 185, 0 }, { 187, 190, 0 }, { 144, 169, 0 }, { 128, 129, 0 },
+	{ 156, 156, 0 }, { 158, 159, 0 }, { 162, 162, 0 }, { 165, 166, 0 }, { 169, 172, 0 }, { 174, 181, 0 },
+	{ 128, 141, 0 }, { 168, 191, 0 }, { 128, 153, 0 }, { 180, 191, 0 }, { 185, 185, 22 }, { 128, 159, 0 },
+	{ 162, 162, 55 }, { 144, 144, 28 }, { 146, 146, 27 }, { 147, 147, 26 }, { 178, 178, 25 }, { 128, 178, 0 },
+	{ 128, 147, 0 }, { 176, 191, 0 }, { 128, 167, 0 }, { 188, 188, 30 }, { 161, 186, 0 }, { 153, 153, 37 },
+	{ 154, 154, 36 }, { 156, 156, 35 }, { 157, 157, 34 }, { 158, 158, 33 }, { 159, 159, 32 }, { 130, 130, 0 },
+	{ 132, 135, 0 }, { 137, 137, 0 }, { 181, 181, 0 }, { 128, 128, 0 }, { 130, 130, 0 }, { 132, 132, 0 },
+	{ 134, 134, 0 }, { 139, 139, 0 }, { 141, 141, 0 }, { 144, 144, 0 }, { 146, 146, 0 }, { 150, 150, 0 },
+	{ 152, 152, 0 }, { 154, 154, 0 }, { 156, 156, 0 }, { 158, 158, 0 }, { 160, 160, 0 }, { 162, 162, 0 },
+	{ 164, 164, 0 }, { 166, 166, 0 }, { 168, 168, 0 }, { 170, 174, 0 }, { 176, 180, 0 }, { 182, 182, 0 },
+	{ 184, 184, 0 }, { 186, 186, 0 }, { 188, 188, 0 }, { 190, 190, 0 }, { 128, 128, 0 }, { 130, 130, 0 },
+	{ 132, 132, 0 }, { 134, 134, 0 }, { 136, 136, 0 }, { 138, 138, 0 }, { 140, 140, 0 }, { 142, 142, 0 },
+	{ 144, 144, 0 }, { 146, 146, 0 }, { 148, 148, 0 }, { 150, 150, 0 }, { 152, 152, 0 }, { 154, 154, 0 },
+	{ 156, 156, 0 }, { 158, 158, 0 }, { 160, 160, 0 }, { 162, 162, 0 }, { 164, 164, 0 }, { 166, 166, 0 },
+	{ 168, 168, 0 }, { 170, 170, 0 }, { 172, 172, 0 }, { 174, 174, 0 }, { 185, 185, 0 }, { 187, 187, 0 },
+	{ 189, 190, 0 }, { 162, 162, 0 }, { 164, 164, 0 }, { 166, 166, 0 }, { 168, 168, 0 }, { 170, 170, 0 },
+	{ 172, 172, 0 }, { 174, 174, 0 }, { 178, 178, 0 }, { 180, 180, 0 }, { 182, 182, 0 }, { 184, 184, 0 },
+	{ 186, 186, 0 }, { 188, 188, 0 }, { 190, 190, 0 }, { 128, 128, 0 }, { 130, 130, 0 }, { 132, 132, 0 },
+	{ 134, 134, 0 }, { 136, 136, 0 }, { 138, 138, 0 }, { 140, 140, 0 }, { 142, 142, 0 }, { 144, 144, 0 },
+	{ 146, 146, 0 }, { 148, 148, 0 }, { 150, 150, 0 }, { 152, 152, 0 }, { 154, 154, 0 }, { 128, 128, 0 },
+	{ 130, 130, 0 }, { 132, 132, 0 }, { 134, 134, 0 }, { 136, 136, 0 }, { 138, 138, 0 }, { 140, 140, 0 },
+	{ 142, 142, 0 }, { 144, 144, 0 }, { 146, 146, 0 }, { 148, 148, 0 }, { 150, 150, 0 }, { 152, 152, 0 },
+	{ 154, 154, 0 }, { 156, 156, 0 }, { 158, 158, 0 }, { 160, 160, 0 }, { 162, 162, 0 }, { 164, 164, 0 },
+	{ 166, 166, 0 }, { 168, 168, 0 }, { 170, 170, 0 }, { 172, 172, 0 }, { 132, 132, 44 }, { 133, 133, 43 },
+	{ 134, 134, 42 }, { 176, 176, 41 }, { 177, 177, 40 }, { 178, 178, 51 }, { 179, 179, 39 }, { 128, 128, 0 },
+	{ 130, 130, 0 }, { 132, 132, 0 }, { 134, 134, 0 }, { 136, 136, 0 }, { 138, 138, 0 }, { 140, 140, 0 },
+	{ 142, 142, 0 }, { 144, 144, 0 }, { 146, 146, 0 }, { 148, 148, 0 }, { 150, 150, 0 }, { 152, 152, 0 },
+	{ 154, 154, 0 }, { 156, 156, 0 }, { 158, 158, 0 }, { 160, 160, 0 }, { 162, 162, 0 }, { 171, 171, 0 },
+	{ 173, 173, 0 }, { 178, 178, 0 }, { 160, 160, 0 }, { 162, 164, 0 }, { 167, 167, 0 }, { 169, 169, 0 },
+	{ 171, 171, 0 }, { 173, 176, 0 }, { 178, 178, 0 }, { 181, 181, 0 }, { 190, 191, 0 }, { 128, 174, 0 },
+	{ 131, 131, 0 }, { 133, 133, 0 }, { 130, 130, 0 }, { 135, 135, 0 }, { 139, 141, 0 }, { 144, 146, 0 },
+	{ 149, 149, 0 }, { 153, 157, 0 }, { 164, 164, 0 }, { 166, 166, 0 }, { 168, 168, 0 }, { 170, 173, 0 },
+	{ 176, 179, 0 }, { 190, 191, 0 }, { 130, 130, 55 }, { 131, 131, 54 }, { 142, 142, 55 }, { 143, 143, 53 },
+	{ 178, 178, 52 }, { 184, 185, 51 }, { 186, 186, 50 }, { 187, 187, 51 }, { 188, 188, 49 }, { 189, 189, 48 },
+	{ 190, 190, 47 }, { 191, 191, 46 }, { 136, 139, 0 }, { 152, 155, 0 }, { 168, 172, 0 }, { 184, 187, 0 },
+	{ 184, 187, 0 }, { 136, 141, 0 }, { 153, 153, 0 }, { 155, 155, 0 }, { 157, 157, 0 }, { 159, 159, 0 },
+	{ 168, 175, 0 }, { 136, 143, 0 }, { 152, 157, 0 }, { 168, 175, 0 }, { 184, 191, 0 }, { 128, 128, 0 },
+	{ 130, 130, 0 }, { 132, 132, 0 }, { 134, 134, 0 }, { 136, 136, 0 }, { 138, 138, 0 }, { 140, 140, 0 },
+	{ 142, 142, 0 }, { 144, 144, 0 }, { 146, 146, 0 }, { 148, 148, 0 }, { 158, 158, 0 }, { 160, 160, 0 },
+	{ 162, 162, 0 }, { 164, 164, 0 }, { 166, 166, 0 }, { 168, 168, 0 }, { 170, 170, 0 }, { 172, 172, 0 },
+	{ 174, 174, 0 }, { 176, 176, 0 }, { 178, 178, 0 }, { 180, 180, 0 }, { 182, 182, 0 }, { 184, 184, 0 },
+	{ 186, 186, 0 }, { 188, 188, 0 }, { 190, 190, 0 }, { 128, 128, 0 }, { 130, 130, 0 }, { 132, 132, 0 },
+	{ 134, 134, 0 }, { 136, 136, 0 }, { 138, 138, 0 }, { 140, 140, 0 }, { 142, 142, 0 }, { 144, 144, 0 },
+	{ 146, 146, 0 }, { 148, 148, 0 }, { 150, 150, 0 }, { 152, 152, 0 }, { 154, 154, 0 }, { 156, 156, 0 },
+	{ 158, 158, 0 }, { 160, 160, 0 }, { 162, 162, 0 }, { 164, 164, 0 }, { 166, 166, 0 }, { 168, 168, 0 },
+	{ 170, 170, 0 }, { 172, 172, 0 }, { 174, 174, 0 }, { 176, 176, 0 }, { 178, 178, 0 }, { 180, 180, 0 },
+	{ 182, 182, 0 }, { 184, 184, 0 }, { 186, 186, 0 }, { 188, 188, 0 }, { 190, 190, 0 }, { 144, 186, 0 },
+	{ 189, 191, 0 }, { 128, 181, 0 }, { 128, 133, 0 }, { 135, 135, 0 }, { 141, 141, 0 }, { 160, 191, 0 },
+	{ 128, 150, 0 }, { 128, 128, 0 }, { 130, 130, 0 }, { 132, 132, 0 }, { 134, 134, 0 }, { 136, 136, 0 },
+	{ 138, 138, 0 }, { 140, 140, 0 }, { 142, 142, 0 }, { 144, 144, 0 }, { 146, 146, 0 }, { 148, 148, 0 },
+	{ 150, 150, 0 }, { 152, 152, 0 }, { 154, 154, 0 }, { 156, 156, 0 }, { 158, 158, 0 }, { 160, 160, 0 },
+	{ 162, 162, 0 }, { 164, 164, 0 }, { 166, 166, 0 }, { 168, 168, 0 }, { 170, 170, 0 }, { 172, 172, 0 },
+	{ 174, 174, 0 }, { 177, 191, 0 }, { 128, 129, 0 }, { 131, 131, 0 }, { 133, 133, 0 }, { 135, 135, 0 },
+	{ 137, 137, 0 }, { 139, 139, 0 }, { 141, 141, 0 }, { 144, 144, 0 }, { 146, 146, 0 }, { 148, 148, 0 },
+	{ 150, 150, 0 }, { 152, 152, 0 }, { 154, 154, 0 }, { 156, 156, 0 }, { 158, 158, 0 }, { 160, 160, 0 },
+	{ 162, 162, 0 }, { 164, 164, 0 }, { 166, 166, 0 }, { 168, 168, 0 }, { 170, 170, 0 }, { 172, 172, 0 },
+	{ 174, 174, 0 }, { 176, 176, 0 }, { 178, 178, 0 }, { 180, 180, 0 }, { 182, 182, 0 }, { 184, 184, 0 },
+	{ 186, 186, 0 }, { 188, 188, 0 }, { 190, 190, 0 }, { 128, 128, 0 }, { 138, 138, 0 }, { 140, 140, 0 },
+	{ 142, 142, 0 }, { 144, 144, 0 }, { 146, 146, 0 }, { 148, 148, 0 }, { 150, 150, 0 }, { 152, 152, 0 },
+	{ 154, 154, 0 }, { 156, 156, 0 }, { 158, 158, 0 }, { 160, 160, 0 }, { 162, 162, 0 }, { 164, 164, 0 },
+	{ 166, 166, 0 }, { 168, 168, 0 }, { 170, 170, 0 }, { 172, 172, 0 }, { 174, 174, 0 }, { 176, 176, 0 },
+	{ 178, 178, 0 }, { 180, 180, 0 }, { 182, 182, 0 }, { 184, 184, 0 }, { 186, 186, 0 }, { 188, 188, 0 },
+	{ 190, 190, 0 }, { 160, 160, 0 }, { 162, 162, 0 }, { 164, 164, 0 }, { 166, 166, 0 }, { 168, 168, 0 },
+	{ 170, 170, 0 }, { 172, 172, 0 }, { 174, 174, 0 }, { 176, 176, 0 }, { 178, 178, 0 }, { 180, 180, 0 },
+	{ 182, 182, 0 }, { 184, 184, 0 }, { 186, 186, 0 }, { 188, 188, 0 }, { 190, 190, 0 }, { 128, 175, 0 },
+	{ 143, 143, 0 }, { 146, 148, 0 }, { 152, 152, 0 }, { 154, 154, 0 }, { 156, 156, 0 }, { 158, 158, 0 },
+	{ 160, 160, 0 }, { 162, 162, 0 }, { 164, 164, 0 }, { 166, 166, 0 }, { 168, 168, 0 }, { 170, 170, 0 },
+	{ 172, 172, 0 }, { 174, 174, 0 }, { 180, 180, 0 }, { 183, 183, 0 }, { 185, 186, 0 }, { 189, 191, 0 },
+	{ 134, 134, 0 }, { 136, 138, 0 }, { 140, 140, 0 }, { 142, 143, 0 }, { 145, 161, 0 }, { 163, 171, 0 },
+	{ 176, 176, 0 }, { 178, 178, 0 }, { 182, 182, 0 }, { 191, 191, 0 }, { 129, 129, 0 }, { 131, 134, 0 },
+	{ 136, 136, 0 }, { 138, 138, 0 }, { 140, 140, 0 }, { 142, 142, 0 }, { 128, 128, 0 }, { 130, 130, 0 },
+	{ 132, 132, 0 }, { 134, 134, 0 }, { 136, 136, 0 }, { 138, 138, 0 }, { 140, 140, 0 }, { 142, 142, 0 },
+	{ 144, 144, 0 }, { 146, 146, 0 }, { 148, 148, 0 }, { 150, 150, 0 }, { 152, 152, 0 }, { 154, 154, 0 },
+	{ 156, 156, 0 }, { 158, 158, 0 }, { 160, 160, 0 }, { 162, 162, 0 }, { 164, 164, 0 }, { 166, 166, 0 },
+	{ 168, 168, 0 }, { 170, 170, 0 }, { 172, 172, 0 }, { 174, 174, 0 }, { 176, 176, 0 }, { 178, 178, 0 },
+	{ 186, 187, 0 }, { 189, 190, 0 }, { 132, 132, 0 }, { 135, 135, 0 }, { 138, 138, 0 }, { 141, 141, 0 },
+	{ 143, 143, 0 }, { 145, 145, 0 }, { 147, 147, 0 }, { 149, 149, 0 }, { 151, 151, 0 }, { 153, 153, 0 },
+	{ 155, 155, 0 }, { 158, 158, 0 }, { 160, 160, 0 }, { 162, 162, 0 }, { 164, 164, 0 }, { 166, 166, 0 },
+	{ 168, 168, 0 }, { 170, 170, 0 }, { 172, 172, 0 }, { 174, 174, 0 }, { 177, 177, 0 }, { 180, 180, 0 },
+	{ 182, 184, 0 }, { 186, 186, 0 }, { 188, 188, 0 }, { 190, 190, 0 }, { 129, 130, 0 }, { 132, 132, 0 },
+	{ 134, 135, 0 }, { 137, 139, 0 }, { 142, 145, 0 }, { 147, 148, 0 }, { 150, 152, 0 }, { 156, 157, 0 },
+	{ 159, 160, 0 }, { 162, 162, 0 }, { 164, 164, 0 }, { 166, 167, 0 }, { 169, 169, 0 }, { 172, 172, 0 },
+	{ 174, 175, 0 }, { 177, 179, 0 }, { 181, 181, 0 }, { 183, 184, 0 }, { 188, 188, 0 }, { 129, 129, 0 },
+	{ 131, 131, 0 }, { 133, 133, 0 }, { 135, 135, 0 }, { 138, 138, 0 }, { 140, 140, 0 }, { 142, 142, 0 },
+	{ 144, 144, 0 }, { 146, 146, 0 }, { 148, 148, 0 }, { 150, 150, 0 }, { 152, 152, 0 }, { 154, 154, 0 },
+	{ 156, 156, 0 }, { 158, 158, 0 }, { 160, 160, 0 }, { 162, 162, 0 }, { 164, 164, 0 }, { 166, 166, 0 },
+	{ 168, 168, 0 }, { 170, 170, 0 }, { 172, 172, 0 }, { 174, 174, 0 }, { 176, 176, 0 }, { 178, 178, 0 },
+	{ 180, 180, 0 }, { 182, 182, 0 }, { 184, 185, 0 }, { 187, 187, 0 }, { 189, 189, 0 }, { 128, 128, 0 },
+	{ 130, 130, 0 }, { 132, 132, 0 }, { 134, 134, 0 }, { 136, 136, 0 }, { 138, 138, 0 }, { 140, 140, 0 },
+	{ 142, 142, 0 }, { 144, 144, 0 }, { 146, 146, 0 }, { 148, 148, 0 }, { 150, 150, 0 }, { 152, 152, 0 },
+	{ 154, 154, 0 }, { 156, 156, 0 }, { 158, 158, 0 }, { 160, 160, 0 }, { 162, 162, 0 }, { 164, 164, 0 },
+	{ 166, 166, 0 }, { 168, 168, 0 }, { 170, 170, 0 }, { 172, 172, 0 }, { 174, 174, 0 }, { 176, 176, 0 },
+	{ 178, 178, 0 }, { 180, 180, 0 }, { 182, 182, 0 }, { 185, 185, 0 }, { 187, 187, 0 }, { 189, 189, 0 },
+	{ 191, 191, 0 }, { 128, 150, 0 }, { 152, 158, 0 },
+};
+static const uint16_t Lu_reverse_state[] = {
+	0, 552, 553, 554, 555, 556, 557, 558, 561, 562, 563, 564,
+	565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576,
+	577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588,
+	589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 600,
+	601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612,
+	615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626,
+	627,
+};
+static const UTF8Range Lu_reverse_range[] = {
+	{ 65, 90, 0 }, { 128, 128, 69 }, { 128, 128, 67 }, { 128, 128, 66 }, { 128, 128, 65 }, { 128, 128, 64 },
+	{ 128, 128, 62 }, { 128, 128, 60 }, { 128, 128, 59 }, { 128, 128, 58 }, { 128, 128, 57 }, { 128, 128, 56 },
+	{ 128, 128, 55 }, { 128, 129, 54 }, { 128, 129, 53 }, { 128, 132, 52 }, { 128, 133, 51 }, { 128, 133, 50 },
+	{ 128, 137, 49 }, { 128, 141, 48 }, { 128, 147, 46 }, { 128, 149, 45 }, { 128, 150, 44 }, { 128, 150, 43 },
+	{ 128, 153, 42 }, { 128, 159, 40 }, { 128, 161, 38 }, { 128, 167, 37 }, { 128, 174, 36 }, { 128, 175, 35 },
+	{ 128, 178, 34 }, { 128, 181, 33 }, { 129, 129, 32 }, { 129, 129, 31 }, { 129, 130, 30 }, { 130, 130, 29 },
+	{ 130, 130, 67 }, { 130, 130, 66 }, { 130, 130, 65 }, { 130, 130, 64 }, { 130, 130, 62 }, { 130, 130, 28 },
+	{ 130, 130, 60 }, { 130, 130, 59 }, { 130, 130, 58 }, { 130, 130, 56 }, { 130, 130, 55 }, { 131, 131, 27 },
+	{ 131, 131, 53 }, { 131, 131, 31 }, { 131, 134, 32 }, { 132, 132, 67 }, { 132, 132, 66 }, { 132, 132, 65 },
+	{ 132, 132, 64 }, { 132, 132, 62 }, { 132, 132, 60 }, { 132, 132, 59 }, { 132, 132, 58 }, { 132, 132, 56 },
+	{ 132, 132, 26 }, { 132, 132, 30 }, { 132, 132, 55 }, { 132, 133, 25 }, { 132, 135, 29 }, { 133, 133, 24 },
+	{ 133, 133, 53 }, { 133, 133, 31 }, { 134, 134, 52 }, { 134, 134, 67 }, { 134, 134, 66 }, { 134, 134, 65 },
+	{ 134, 134, 64 }, { 134, 134, 62 }, { 134, 134, 60 }, { 134, 134, 59 }, { 134, 134, 58 }, { 134, 134, 23 },
+	{ 134, 134, 56 }, { 134, 134, 55 }, { 134, 135, 30 }, { 135, 135, 28 }, { 135, 135, 50 }, { 135, 135, 53 },
+	{ 135, 135, 26 }, { 135, 135, 31 }, { 135, 138, 25 }, { 136, 136, 66 }, { 136, 136, 65 }, { 136, 136, 64 },
+	{ 136, 136, 62 }, { 136, 136, 60 }, { 136, 136, 59 }, { 136, 136, 58 }, { 136, 136, 32 }, { 136, 136, 56 },
+	{ 136, 136, 55 }, { 136, 138, 23 }, { 136, 139, 22 }, { 136, 141, 21 }, { 136, 143, 20 }, { 136, 161, 19 },
+	{ 137, 137, 29 }, { 137, 137, 53 }, { 137, 139, 30 }, { 138, 138, 18 }, { 138, 138, 66 }, { 138, 138, 65 },
+	{ 138, 138, 64 }, { 138, 138, 62 }, { 138, 138, 60 }, { 138, 138, 59 }, { 138, 138, 58 }, { 138, 138, 57 },
+	{ 138, 138, 32 }, { 138, 138, 56 }, { 138, 138, 26 }, { 138, 138, 31 }, { 138, 138, 55 }, { 138, 144, 52 },
+	{ 139, 139, 67 }, { 139, 139, 53 }, { 139, 141, 28 }, { 140, 140, 66 }, { 140, 140, 65 }, { 140, 140, 64 },
+	{ 140, 140, 62 }, { 140, 140, 60 }, { 140, 140, 59 }, { 140, 140, 58 }, { 140, 140, 57 }, { 140, 140, 23 },
+	{ 140, 140, 32 }, { 140, 140, 56 }, { 140, 140, 31 }, { 140, 140, 55 }, { 141, 141, 67 }, { 141, 141, 50 },
+	{ 141, 141, 53 }, { 141, 141, 26 }, { 141, 148, 25 }, { 142, 142, 66 }, { 142, 142, 65 }, { 142, 142, 64 },
+	{ 142, 142, 62 }, { 142, 142, 60 }, { 142, 142, 59 }, { 142, 142, 58 }, { 142, 142, 57 }, { 142, 142, 32 },
+	{ 142, 142, 56 }, { 142, 142, 31 }, { 142, 142, 55 }, { 142, 143, 23 }, { 142, 145, 30 }, { 143, 143, 17 },
+	{ 143, 143, 26 }, { 144, 144, 67 }, { 144, 144, 66 }, { 144, 144, 65 }, { 144, 144, 64 }, { 144, 144, 62 },
+	{ 144, 144, 60 }, { 144, 144, 59 }, { 144, 144, 58 }, { 144, 144, 53 }, { 144, 144, 57 }, { 144, 144, 56 },
+	{ 144, 144, 31 }, { 144, 144, 55 }, { 144, 146, 28 }, { 144, 168, 16 }, { 144, 169, 15 }, { 144, 186, 14 },
+	{ 145, 145, 26 }, { 145, 161, 23 }, { 146, 146, 67 }, { 146, 146, 66 }, { 146, 146, 65 }, { 146, 146, 64 },
+	{ 146, 146, 62 }, { 146, 146, 60 }, { 146, 146, 59 }, { 146, 146, 58 }, { 146, 146, 53 }, { 146, 146, 57 },
+	{ 146, 146, 56 }, { 146, 146, 31 }, { 146, 146, 55 }, { 146, 148, 17 }, { 147, 147, 26 }, { 147, 148, 30 },
+	{ 148, 148, 66 }, { 148, 148, 65 }, { 148, 148, 64 }, { 148, 148, 62 }, { 148, 148, 60 }, { 148, 148, 59 },
+	{ 148, 148, 58 }, { 148, 148, 53 }, { 148, 148, 57 }, { 148, 148, 56 }, { 148, 148, 31 }, { 148, 148, 55 },
+	{ 148, 173, 13 }, { 149, 149, 28 }, { 149, 149, 26 }, { 150, 150, 67 }, { 150, 150, 66 }, { 150, 150, 65 },
+	{ 150, 150, 64 }, { 150, 150, 62 }, { 150, 150, 59 }, { 150, 150, 58 }, { 150, 150, 53 }, { 150, 150, 57 },
+	{ 150, 150, 56 }, { 150, 150, 31 }, { 150, 150, 55 }, { 150, 152, 30 }, { 150, 156, 25 }, { 150, 174, 12 },
+	{ 151, 151, 26 }, { 152, 152, 67 }, { 152, 152, 66 }, { 152, 152, 65 }, { 152, 152, 64 }, { 152, 152, 62 },
+	{ 152, 152, 59 }, { 152, 152, 58 }, { 152, 152, 53 }, { 152, 152, 57 }, { 152, 152, 17 }, { 152, 152, 56 },
+	{ 152, 152, 31 }, { 152, 152, 55 }, { 152, 155, 22 }, { 152, 157, 20 }, { 152, 158, 43 }, { 153, 153, 21 },
+	{ 153, 153, 26 }, { 153, 157, 28 }, { 154, 154, 67 }, { 154, 154, 66 }, { 154, 154, 65 }, { 154, 154, 64 },
+	{ 154, 154, 62 }, { 154, 154, 59 }, { 154, 154, 58 }, { 154, 154, 53 }, { 154, 154, 57 }, { 154, 154, 17 },
+	{ 154, 154, 56 }, { 154, 154, 31 }, { 154, 154, 55 }, { 155, 155, 21 }, { 155, 155, 26 }, { 156, 156, 54 },
+	{ 156, 156, 67 }, { 156, 156, 66 }, { 156, 156, 64 }, { 156, 156, 62 }, { 156, 156, 59 }, { 156, 156, 58 },
+	{ 156, 156, 53 }, { 156, 156, 57 }, { 156, 156, 17 }, { 156, 156, 56 }, { 156, 156, 31 }, { 156, 156, 55 },
+	{ 156, 157, 30 }, { 156, 180, 11 }, { 157, 157, 21 }, { 158, 158, 67 }, { 158, 158, 66 }, { 158, 158, 64 },
+	{ 158, 158, 62 }, { 158, 158, 60 }, { 158, 158, 59 }, { 158, 158, 58 }, { 158, 158, 53 }, { 158, 158, 57 },
+	{ 158, 158, 17 }, { 158, 158, 56 }, { 158, 158, 26 }, { 158, 158, 31 }, { 158, 158, 55 }, { 158, 159, 54 },
+	{ 159, 159, 21 }, { 159, 160, 30 }, { 160, 160, 67 }, { 160, 160, 66 }, { 160, 160, 64 }, { 160, 160, 62 },
+	{ 160, 160, 10 }, { 160, 160, 60 }, { 160, 160, 59 }, { 160, 160, 58 }, { 160, 160, 53 }, { 160, 160, 57 },
+	{ 160, 160, 9 }, { 160, 160, 17 }, { 160, 160, 56 }, { 160, 160, 26 }, { 160, 160, 31 }, { 160, 160, 55 },
+	{ 160, 185, 51 }, { 160, 191, 7 }, { 161, 186, 5 }, { 162, 162, 54 }, { 162, 162, 67 }, { 162, 162, 66 },
+	{ 162, 162, 4 }, { 162, 162, 64 }, { 162, 162, 62 }, { 162, 162, 60 }, { 162, 162, 59 }, { 162, 162, 58 },
+	{ 162, 162, 53 }, { 162, 162, 57 }, { 162, 162, 9 }, { 162, 162, 17 }, { 162, 162, 56 }, { 162, 162, 26 },
+	{ 162, 162, 30 }, { 162, 162, 31 }, { 162, 162, 55 }, { 162, 164, 10 }, { 162, 186, 69 }, { 163, 171, 23 },
+	{ 164, 164, 67 }, { 164, 164, 66 }, { 164, 164, 4 }, { 164, 164, 64 }, { 164, 164, 28 }, { 164, 164, 60 },
+	{ 164, 164, 59 }, { 164, 164, 58 }, { 164, 164, 53 }, { 164, 164, 57 }, { 164, 164, 9 }, { 164, 164, 17 },
+	{ 164, 164, 56 }, { 164, 164, 26 }, { 164, 164, 30 }, { 164, 164, 31 }, { 164, 164, 55 }, { 165, 166, 54 },
+	{ 166, 166, 67 }, { 166, 166, 66 }, { 166, 166, 4 }, { 166, 166, 64 }, { 166, 166, 28 }, { 166, 166, 60 },
+	{ 166, 166, 59 }, { 166, 166, 58 }, { 166, 166, 53 }, { 166, 166, 57 }, { 166, 166, 9 }, { 166, 166, 17 },
+	{ 166, 166, 56 }, { 166, 166, 26 }, { 166, 166, 31 }, { 166, 166, 55 }, { 166, 167, 30 }, { 167, 167, 10 },
+	{ 168, 168, 67 }, { 168, 168, 66 }, { 168, 168, 4 }, { 168, 168, 64 }, { 168, 168, 28 }, { 168, 168, 60 },
+	{ 168, 168, 59 }, { 168, 168, 58 }, { 168, 168, 53 }, { 168, 168, 57 }, { 168, 168, 9 }, { 168, 168, 17 },
+	{ 168, 168, 56 }, { 168, 168, 26 }, { 168, 168, 31 }, { 168, 168, 55 }, { 168, 172, 22 }, { 168, 175, 21 },
+	{ 168, 175, 20 }, { 168, 191, 49 }, { 168, 191, 48 }, { 169, 169, 10 }, { 169, 169, 30 }, { 169, 172, 54 },
+	{ 170, 170, 66 }, { 170, 170, 4 }, { 170, 170, 64 }, { 170, 170, 60 }, { 170, 170, 59 }, { 170, 170, 58 },
+	{ 170, 170, 53 }, { 170, 170, 57 }, { 170, 170, 9 }, { 170, 170, 17 }, { 170, 170, 56 }, { 170, 170, 26 },
+	{ 170, 170, 31 }, { 170, 170, 55 }, { 170, 173, 28 }, { 170, 174, 67 }, { 171, 171, 62 }, { 171, 171, 10 },
+	{ 172, 172, 66 }, { 172, 172, 4 }, { 172, 172, 64 }, { 172, 172, 60 }, { 172, 172, 59 }, { 172, 172, 58 },
+	{ 172, 172, 53 }, { 172, 172, 57 }, { 172, 172, 9 }, { 172, 172, 17 }, { 172, 172, 56 }, { 172, 172, 26 },
+	{ 172, 172, 30 }, { 172, 172, 31 }, { 172, 172, 55 }, { 172, 191, 52 }, { 173, 173, 62 }, { 173, 176, 10 },
+	{ 174, 174, 66 }, { 174, 174, 4 }, { 174, 174, 60 }, { 174, 174, 59 }, { 174, 174, 58 }, { 174, 174, 53 },
+	{ 174, 174, 57 }, { 174, 174, 9 }, { 174, 174, 17 }, { 174, 174, 56 }, { 174, 174, 26 }, { 174, 174, 31 },
+	{ 174, 174, 55 }, { 174, 175, 30 }, { 174, 181, 54 }, { 176, 176, 60 }, { 176, 176, 59 }, { 176, 176, 53 },
+	{ 176, 176, 57 }, { 176, 176, 9 }, { 176, 176, 3 }, { 176, 176, 56 }, { 176, 176, 31 }, { 176, 176, 55 },
+	{ 176, 179, 28 }, { 176, 180, 67 }, { 176, 191, 45 }, { 176, 191, 2 }, { 177, 177, 26 }, { 177, 179, 30 },
+	{ 177, 191, 58 }, { 178, 178, 4 }, { 178, 178, 62 }, { 178, 178, 10 }, { 178, 178, 60 }, { 178, 178, 59 },
+	{ 178, 178, 53 }, { 178, 178, 57 }, { 178, 178, 9 }, { 178, 178, 3 }, { 178, 178, 56 }, { 178, 178, 31 },
+	{ 178, 178, 55 }, { 180, 180, 4 }, { 180, 180, 60 }, { 180, 180, 59 }, { 180, 180, 53 }, { 180, 180, 57 },
+	{ 180, 180, 9 }, { 180, 180, 17 }, { 180, 180, 26 }, { 180, 180, 31 }, { 180, 180, 55 }, { 180, 191, 42 },
+	{ 181, 181, 29 }, { 181, 181, 10 }, { 181, 181, 30 }, { 182, 182, 67 }, { 182, 182, 4 }, { 182, 182, 60 },
+	{ 182, 182, 59 }, { 182, 182, 53 }, { 182, 182, 57 }, { 182, 182, 9 }, { 182, 182, 3 }, { 182, 182, 31 },
+	{ 182, 182, 55 }, { 182, 184, 26 }, { 183, 183, 17 }, { 183, 184, 30 }, { 184, 184, 67 }, { 184, 184, 4 },
+	{ 184, 184, 60 }, { 184, 184, 59 }, { 184, 184, 53 }, { 184, 184, 57 }, { 184, 184, 9 }, { 184, 185, 25 },
+	{ 184, 185, 31 }, { 184, 187, 22 }, { 184, 187, 1 }, { 184, 191, 20 }, { 185, 185, 66 }, { 185, 185, 55 },
+	{ 185, 186, 17 }, { 186, 186, 67 }, { 186, 186, 4 }, { 186, 186, 60 }, { 186, 186, 59 }, { 186, 186, 53 },
+	{ 186, 186, 57 }, { 186, 186, 9 }, { 186, 186, 26 }, { 186, 187, 56 }, { 187, 187, 66 }, { 187, 187, 31 },
+	{ 187, 187, 55 }, { 187, 190, 25 }, { 188, 188, 67 }, { 188, 188, 4 }, { 188, 188, 60 }, { 188, 188, 59 },
+	{ 188, 188, 53 }, { 188, 188, 57 }, { 188, 188, 9 }, { 188, 188, 26 }, { 188, 188, 30 }, { 188, 191, 19 },
+	{ 189, 189, 31 }, { 189, 189, 55 }, { 189, 190, 66 }, { 189, 190, 56 }, { 189, 191, 14 }, { 189, 191, 17 },
+	{ 190, 190, 67 }, { 190, 190, 4 }, { 190, 190, 60 }, { 190, 190, 59 }, { 190, 190, 53 }, { 190, 190, 57 },
+	{ 190, 190, 9 }, { 190, 190, 26 }, { 190, 191, 10 }, { 190, 191, 28 }, { 191, 191, 3 }, { 191, 191, 55 },
+	{ 190, 190, 61 }, { 146, 146, 47 }, { 205, 205, 0 }, { 156, 156, 68 }, { 188, 188, 6 }, { 239, 239, 0 },
+	{ 130, 130, 61 }, { 142, 142, 61 }, { 162, 162, 8 }, { 145, 145, 71 }, { 209, 209, 0 }, { 177, 177, 63 },
+	{ 156, 156, 70 }, { 157, 157, 70 }, { 151, 151, 70 }, { 178, 178, 61 }, { 147, 147, 70 }, { 158, 158, 70 },
+	{ 207, 207, 0 }, { 159, 159, 70 }, { 152, 152, 70 }, { 188, 188, 61 }, { 189, 189, 61 }, { 191, 191, 61 },
+	{ 206, 206, 0 }, { 133, 133, 63 }, { 148, 148, 70 }, { 199, 199, 0 }, { 134, 134, 63 }, { 132, 132, 63 },
+	{ 159, 159, 68 }, { 198, 198, 0 }, { 197, 197, 0 }, { 201, 201, 0 }, { 143, 143, 61 }, { 178, 178, 47 },
+	{ 208, 208, 0 }, { 176, 176, 63 }, { 144, 144, 47 }, { 164, 164, 39 }, { 158, 158, 71 }, { 185, 185, 41 },
+	{ 150, 150, 71 }, { 144, 144, 70 }, { 195, 195, 0 }, { 213, 213, 0 }, { 153, 153, 70 }, { 147, 147, 47 },
+	{ 144, 144, 71 }, { 145, 145, 70 }, { 154, 154, 70 }, { 131, 131, 61 }, { 150, 150, 70 }, { 149, 149, 70 },
+	{ 211, 211, 0 }, { 146, 146, 70 }, { 196, 196, 0 }, { 200, 200, 0 }, { 210, 210, 0 }, { 212, 212, 0 },
+	{ 178, 178, 63 }, { 184, 185, 61 }, { 187, 187, 61 }, { 186, 186, 61 }, { 225, 225, 0 }, { 179, 179, 63 },
+	{ 226, 226, 0 }, { 153, 153, 68 }, { 154, 154, 68 }, { 157, 157, 68 }, { 158, 158, 68 }, { 234, 234, 0 },
+	{ 155, 155, 70 }, { 157, 157, 71 }, { 240, 240, 0 },
+};
+static const uint16_t Lycian_forward_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Lycian_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 138, 138, 3 }, { 128, 156, 0 },
+};
+static const uint16_t Lycian_reverse_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Lycian_reverse_range[] = {
+	{ 128, 156, 1 }, { 138, 138, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Lydian_forward_state[] = {
+	0, 1, 2, 3, 5,
+};
+static const UTF8Range Lydian_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 164, 164, 3 }, { 160, 185, 0 }, { 191, 191, 0 },
+};
+static const uint16_t Lydian_reverse_state[] = {
+	0, 2, 3, 4, 5,
+};
+static const UTF8Range Lydian_reverse_range[] = {
+	{ 160, 185, 1 }, { 191, 191, 1 }, { 164, 164, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t M_forward_state[] = {
+	0, 20, 21, 23, 29, 34, 35, 36, 37, 42, 48, 51,
+	53, 55, 56, 59, 62, 63, 64, 69, 71, 73, 75, 76,
+	77, 111, 112, 115, 117, 121, 123, 125, 126, 128, 131, 134,
+	136, 139, 140, 141, 142, 144, 146, 147, 149, 150, 157, 158,
+	160, 163, 165, 167, 169, 171, 173, 175, 183, 184, 185, 186,
+	187, 192, 193, 194, 195, 197, 199, 200, 215, 217, 220, 224,
+	227, 228, 230, 232, 233, 234, 237, 239, 244, 245, 246, 248,
+	250, 251, 252, 256, 257, 258, 259, 260, 282, 284, 289, 290,
+	291, 293, 295, 297, 298, 299, 302, 303, 305, 307, 308, 310,
+	311, 313, 315, 316, 319, 324, 325, 356, 357, 361, 362, 367,
+	368, 370, 371, 373, 378, 379, 384, 387, 392, 394, 398, 400,
+	405, 410, 416, 422, 425, 428, 431, 433, 434, 438, 440, 441,
+	442, 444, 448, 450, 451, 454, 456, 457, 458, 459,
+};
+static const UTF8Range M_forward_range[] = {
+	{ 204, 204, 152 }, { 205, 205, 151 }, { 210, 210, 150 }, { 214, 214, 149 }, { 215, 215, 148 }, { 216, 216, 147 },
+	{ 217, 217, 146 }, { 219, 219, 145 }, { 220, 220, 144 }, { 221, 221, 143 }, { 222, 222, 142 }, { 223, 223, 141 },
+	{ 224, 224, 114 }, { 225, 225, 91 }, { 226, 226, 86 }, { 227, 227, 83 }, { 234, 234, 67 }, { 239, 239, 64 },
+	{ 240, 240, 3 }, { 243, 243, 1 }, { 160, 160, 2 }, { 132, 134, 152 }, { 135, 135, 151 }, { 144, 144, 55 },
+	{ 145, 145, 24 }, { 150, 150, 18 }, { 155, 155, 16 }, { 157, 157, 9 }, { 158, 158, 4 }, { 128, 128, 8 },
+	{ 132, 132, 22 }, { 139, 139, 7 }, { 163, 163, 6 }, { 165, 165, 5 }, { 132, 138, 0 }, { 144, 150, 0 },
+	{ 172, 175, 0 }, { 128, 134, 0 }, { 136, 152, 0 }, { 155, 161, 0 }, { 163, 164, 0 }, { 166, 170, 0 },
+	{ 133, 133, 15 }, { 134, 134, 14 }, { 137, 137, 13 }, { 168, 168, 12 }, { 169, 169, 11 }, { 170, 170, 10 },
+	{ 132, 132, 0 }, { 155, 159, 0 }, { 161, 175, 0 }, { 128, 172, 0 }, { 181, 181, 0 }, { 128, 182, 0 },
+	{ 187, 191, 0 }, { 130, 132, 0 }, { 128, 130, 0 }, { 133, 139, 0 }, { 170, 173, 0 }, { 165, 169, 0 },
+	{ 173, 178, 0 }, { 187, 191, 0 }, { 178, 178, 17 }, { 157, 158, 0 }, { 171, 171, 23 }, { 172, 172, 22 },
+	{ 189, 189, 21 }, { 190, 190, 20 }, { 191, 191, 19 }, { 164, 164, 0 }, { 176, 177, 0 }, { 128, 135, 0 },
+	{ 143, 146, 0 }, { 143, 143, 0 }, { 145, 191, 0 }, { 176, 182, 0 }, { 176, 180, 0 }, { 128, 128, 54 },
+	{ 129, 129, 53 }, { 130, 130, 52 }, { 132, 132, 51 }, { 133, 133, 50 }, { 134, 134, 49 }, { 135, 135, 48 },
+	{ 136, 136, 47 }, { 139, 139, 46 }, { 140, 140, 126 }, { 141, 141, 45 }, { 144, 144, 44 }, { 145, 145, 43 },
+	{ 146, 146, 100 }, { 147, 147, 42 }, { 150, 150, 41 }, { 151, 151, 40 }, { 152, 152, 100 }, { 153, 153, 99 },
+	{ 154, 154, 39 }, { 156, 156, 38 }, { 160, 160, 37 }, { 164, 164, 36 }, { 165, 165, 35 }, { 167, 167, 34 },
+	{ 168, 168, 33 }, { 169, 169, 32 }, { 170, 170, 31 }, { 176, 176, 30 }, { 178, 178, 29 }, { 180, 180, 28 },
+	{ 181, 181, 27 }, { 182, 182, 26 }, { 187, 187, 25 }, { 179, 182, 0 }, { 138, 142, 0 }, { 144, 145, 0 },
+	{ 147, 151, 0 }, { 128, 133, 0 }, { 135, 135, 0 }, { 177, 182, 0 }, { 186, 186, 0 }, { 188, 189, 0 },
+	{ 191, 191, 0 }, { 146, 167, 0 }, { 169, 182, 0 }, { 175, 182, 0 }, { 184, 191, 0 }, { 138, 153, 0 },
+	{ 135, 135, 0 }, { 145, 155, 0 }, { 129, 138, 0 }, { 179, 185, 0 }, { 187, 190, 0 }, { 145, 151, 0 },
+	{ 154, 160, 0 }, { 164, 164, 0 }, { 128, 128, 0 }, { 130, 131, 0 }, { 176, 181, 0 }, { 183, 184, 0 },
+	{ 187, 190, 0 }, { 172, 186, 0 }, { 157, 171, 0 }, { 171, 183, 0 }, { 128, 128, 0 }, { 156, 157, 0 },
+	{ 175, 181, 0 }, { 184, 191, 0 }, { 128, 131, 0 }, { 128, 134, 0 }, { 158, 158, 0 }, { 181, 191, 0 },
+	{ 128, 132, 0 }, { 135, 136, 0 }, { 139, 141, 0 }, { 151, 151, 0 }, { 162, 163, 0 }, { 166, 172, 0 },
+	{ 176, 180, 0 }, { 159, 170, 0 }, { 172, 183, 0 }, { 190, 190, 0 }, { 128, 128, 0 }, { 137, 140, 0 },
+	{ 142, 143, 0 }, { 128, 130, 0 }, { 179, 191, 0 }, { 133, 134, 0 }, { 179, 179, 0 }, { 128, 130, 0 },
+	{ 167, 180, 0 }, { 128, 130, 0 }, { 176, 186, 0 }, { 128, 134, 0 }, { 191, 191, 0 }, { 128, 130, 0 },
+	{ 184, 191, 0 }, { 135, 135, 63 }, { 139, 139, 62 }, { 141, 141, 61 }, { 168, 168, 60 }, { 171, 171, 59 },
+	{ 180, 180, 58 }, { 186, 186, 57 }, { 189, 189, 56 }, { 134, 144, 0 }, { 171, 172, 0 }, { 164, 167, 0 },
+	{ 165, 166, 0 }, { 129, 131, 0 }, { 133, 134, 0 }, { 140, 143, 0 }, { 184, 186, 0 }, { 191, 191, 0 },
+	{ 182, 186, 0 }, { 160, 160, 0 }, { 189, 189, 0 }, { 172, 172, 66 }, { 184, 184, 65 }, { 128, 143, 0 },
+	{ 160, 175, 0 }, { 158, 158, 0 }, { 153, 153, 82 }, { 154, 154, 81 }, { 155, 155, 80 }, { 160, 160, 79 },
+	{ 162, 162, 78 }, { 163, 163, 77 }, { 164, 164, 76 }, { 165, 165, 75 }, { 166, 166, 74 }, { 167, 167, 73 },
+	{ 168, 168, 72 }, { 169, 169, 71 }, { 170, 170, 70 }, { 171, 171, 69 }, { 175, 175, 68 }, { 163, 170, 0 },
+	{ 172, 173, 0 }, { 129, 129, 0 }, { 171, 175, 0 }, { 181, 182, 0 }, { 176, 176, 0 }, { 178, 180, 0 },
+	{ 183, 184, 0 }, { 190, 191, 0 }, { 131, 131, 0 }, { 140, 141, 0 }, { 187, 189, 0 }, { 169, 182, 0 },
+	{ 128, 128, 0 }, { 165, 165, 0 }, { 128, 131, 0 }, { 179, 191, 0 }, { 135, 147, 0 }, { 166, 173, 0 },
+	{ 128, 133, 0 }, { 160, 177, 0 }, { 191, 191, 0 }, { 128, 129, 0 }, { 180, 191, 0 }, { 130, 130, 0 },
+	{ 134, 134, 0 }, { 139, 139, 0 }, { 163, 167, 0 }, { 172, 172, 0 }, { 176, 177, 0 }, { 158, 159, 0 },
+	{ 175, 178, 0 }, { 180, 189, 0 }, { 128, 128, 85 }, { 130, 130, 84 }, { 153, 154, 0 }, { 170, 175, 0 },
+	{ 131, 131, 90 }, { 179, 179, 89 }, { 181, 181, 88 }, { 183, 183, 87 }, { 160, 191, 0 }, { 191, 191, 0 },
+	{ 175, 177, 0 }, { 144, 176, 0 }, { 128, 128, 113 }, { 129, 129, 112 }, { 130, 130, 111 }, { 141, 141, 110 },
+	{ 156, 156, 109 }, { 157, 157, 108 }, { 158, 158, 107 }, { 159, 159, 106 }, { 160, 160, 105 }, { 162, 162, 104 },
+	{ 164, 164, 103 }, { 168, 168, 102 }, { 169, 169, 101 }, { 170, 170, 100 }, { 171, 171, 99 }, { 172, 172, 98 },
+	{ 173, 173, 97 }, { 174, 174, 96 }, { 175, 175, 95 }, { 176, 176, 94 }, { 179, 179, 93 }, { 183, 183, 92 },
+	{ 128, 185, 0 }, { 187, 191, 0 }, { 144, 146, 0 }, { 148, 168, 0 }, { 173, 173, 0 }, { 180, 180, 0 },
+	{ 183, 185, 0 }, { 164, 183, 0 }, { 166, 179, 0 }, { 128, 130, 0 }, { 161, 173, 0 }, { 128, 132, 0 },
+	{ 171, 179, 0 }, { 128, 132, 0 }, { 180, 191, 0 }, { 128, 128, 0 }, { 176, 191, 0 }, { 149, 158, 0 },
+	{ 160, 188, 0 }, { 191, 191, 0 }, { 151, 155, 0 }, { 160, 171, 0 }, { 176, 187, 0 }, { 133, 134, 0 },
+	{ 169, 169, 0 }, { 139, 141, 0 }, { 128, 147, 0 }, { 157, 157, 0 }, { 180, 191, 0 }, { 146, 147, 0 },
+	{ 178, 179, 0 }, { 146, 148, 0 }, { 178, 180, 0 }, { 157, 159, 0 }, { 130, 141, 0 }, { 143, 143, 0 },
+	{ 154, 157, 0 }, { 150, 153, 0 }, { 158, 160, 0 }, { 162, 164, 0 }, { 167, 173, 0 }, { 177, 180, 0 },
+	{ 171, 190, 0 }, { 160, 160, 140 }, { 161, 161, 139 }, { 163, 163, 138 }, { 164, 164, 137 }, { 165, 165, 136 },
+	{ 166, 166, 135 }, { 167, 167, 134 }, { 168, 168, 135 }, { 169, 169, 133 }, { 170, 170, 135 }, { 171, 171, 132 },
+	{ 172, 172, 135 }, { 173, 173, 131 }, { 174, 174, 130 }, { 175, 175, 129 }, { 176, 176, 128 }, { 177, 177, 127 },
+	{ 178, 178, 135 }, { 179, 179, 127 }, { 180, 180, 126 }, { 181, 181, 125 }, { 182, 182, 124 }, { 183, 183, 123 },
+	{ 184, 184, 122 }, { 185, 185, 121 }, { 186, 186, 120 }, { 187, 187, 119 }, { 188, 188, 118 }, { 189, 189, 117 },
+	{ 190, 190, 116 }, { 191, 191, 115 }, { 134, 134, 0 }, { 128, 132, 0 }, { 134, 135, 0 }, { 141, 151, 0 },
+	{ 153, 188, 0 }, { 177, 191, 0 }, { 152, 153, 0 }, { 181, 181, 0 }, { 183, 183, 0 }, { 185, 185, 0 },
+	{ 190, 191, 0 }, { 136, 141, 0 }, { 177, 177, 0 }, { 180, 188, 0 }, { 135, 142, 0 }, { 177, 177, 0 },
+	{ 180, 186, 0 }, { 138, 138, 0 }, { 143, 148, 0 }, { 150, 150, 0 }, { 152, 159, 0 }, { 178, 179, 0 },
+	{ 129, 131, 0 }, { 128, 132, 0 }, { 134, 136, 0 }, { 138, 141, 0 }, { 151, 151, 0 }, { 162, 163, 0 },
+	{ 128, 131, 0 }, { 187, 188, 0 }, { 190, 191, 0 }, { 128, 132, 0 }, { 134, 136, 0 }, { 138, 141, 0 },
+	{ 149, 150, 0 }, { 162, 163, 0 }, { 128, 132, 0 }, { 190, 191, 0 }, { 128, 130, 0 }, { 134, 136, 0 },
+	{ 138, 141, 0 }, { 151, 151, 0 }, { 130, 130, 0 }, { 190, 191, 0 }, { 128, 132, 0 }, { 135, 136, 0 },
+	{ 139, 141, 0 }, { 149, 151, 0 }, { 162, 163, 0 }, { 128, 133, 0 }, { 135, 137, 0 }, { 139, 141, 0 },
+	{ 162, 163, 0 }, { 186, 191, 0 }, { 128, 130, 0 }, { 135, 136, 0 }, { 139, 141, 0 }, { 145, 145, 0 },
+	{ 176, 177, 0 }, { 181, 181, 0 }, { 128, 132, 0 }, { 135, 136, 0 }, { 139, 141, 0 }, { 151, 151, 0 },
+	{ 162, 163, 0 }, { 190, 190, 0 }, { 129, 131, 0 }, { 188, 188, 0 }, { 190, 191, 0 }, { 128, 143, 0 },
+	{ 145, 151, 0 }, { 162, 163, 0 }, { 128, 131, 0 }, { 186, 188, 0 }, { 190, 191, 0 }, { 147, 161, 0 },
+	{ 163, 191, 0 }, { 153, 155, 0 }, { 150, 153, 0 }, { 155, 163, 0 }, { 165, 167, 0 }, { 169, 173, 0 },
+	{ 171, 179, 0 }, { 189, 189, 0 }, { 166, 176, 0 }, { 128, 138, 0 }, { 145, 145, 0 }, { 176, 191, 0 },
+	{ 150, 156, 0 }, { 159, 164, 0 }, { 167, 168, 0 }, { 170, 173, 0 }, { 139, 159, 0 }, { 176, 176, 0 },
+	{ 144, 154, 0 }, { 129, 130, 0 }, { 132, 133, 0 }, { 135, 135, 0 }, { 145, 189, 0 }, { 191, 191, 0 },
+	{ 131, 137, 0 }, { 128, 175, 0 }, { 128, 191, 0 },
+};
+static const uint16_t M_reverse_state[] = {
+	0, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305,
+	308, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320,
+	321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332,
+	333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344,
+	345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356,
+	357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368,
+	369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380,
+	381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 395, 396,
+	397, 398, 399, 400, 402, 403, 404, 406, 407, 408, 409, 410,
+	411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422,
+	423, 424, 425, 426, 428, 429, 430, 431, 432, 433, 434, 436,
+	437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448,
+	449, 451, 452, 453, 454, 455, 456, 457, 458, 459,
+};
+static const UTF8Range M_reverse_range[] = {
+	{ 128, 128, 150 }, { 128, 128, 149 }, { 128, 128, 148 }, { 128, 128, 146 }, { 128, 128, 144 }, { 128, 129, 143 },
+	{ 128, 130, 141 }, { 128, 130, 140 }, { 128, 130, 139 }, { 128, 130, 138 }, { 128, 130, 137 }, { 128, 130, 136 },
+	{ 128, 130, 134 }, { 128, 130, 133 }, { 128, 131, 132 }, { 128, 131, 131 }, { 128, 131, 130 }, { 128, 131, 129 },
+	{ 128, 132, 128 }, { 128, 132, 127 }, { 128, 132, 126 }, { 128, 132, 125 }, { 128, 132, 124 }, { 128, 132, 123 },
+	{ 128, 132, 122 }, { 128, 132, 121 }, { 128, 132, 120 }, { 128, 133, 119 }, { 128, 133, 118 }, { 128, 133, 117 },
+	{ 128, 134, 115 }, { 128, 134, 114 }, { 128, 134, 113 }, { 128, 135, 111 }, { 128, 138, 110 }, { 128, 143, 108 },
+	{ 128, 143, 107 }, { 128, 147, 106 }, { 128, 172, 105 }, { 128, 175, 102 }, { 128, 182, 101 }, { 128, 185, 100 },
+	{ 128, 191, 99 }, { 129, 129, 98 }, { 129, 130, 97 }, { 129, 131, 95 }, { 129, 131, 94 }, { 129, 131, 93 },
+	{ 129, 138, 92 }, { 130, 130, 91 }, { 130, 130, 90 }, { 130, 131, 150 }, { 130, 132, 89 }, { 130, 141, 88 },
+	{ 131, 131, 87 }, { 131, 137, 86 }, { 132, 132, 85 }, { 132, 133, 97 }, { 132, 138, 84 }, { 133, 134, 83 },
+	{ 133, 134, 95 }, { 133, 134, 82 }, { 133, 139, 141 }, { 134, 134, 91 }, { 134, 134, 81 }, { 134, 135, 125 },
+	{ 134, 136, 124 }, { 134, 136, 123 }, { 134, 136, 134 }, { 134, 144, 80 }, { 135, 135, 119 }, { 135, 135, 79 },
+	{ 135, 135, 97 }, { 135, 136, 128 }, { 135, 136, 121 }, { 135, 136, 133 }, { 135, 136, 120 }, { 135, 137, 117 },
+	{ 135, 142, 78 }, { 135, 147, 77 }, { 136, 141, 76 }, { 136, 152, 115 }, { 137, 140, 148 }, { 138, 138, 75 },
+	{ 138, 141, 124 }, { 138, 141, 123 }, { 138, 141, 134 }, { 138, 142, 74 }, { 138, 153, 73 }, { 139, 139, 91 },
+	{ 139, 141, 128 }, { 139, 141, 72 }, { 139, 141, 121 }, { 139, 141, 117 }, { 139, 141, 133 }, { 139, 141, 120 },
+	{ 139, 159, 71 }, { 140, 141, 87 }, { 140, 143, 95 }, { 141, 151, 125 }, { 142, 143, 148 }, { 143, 143, 70 },
+	{ 143, 143, 88 }, { 143, 146, 111 }, { 143, 148, 75 }, { 144, 145, 74 }, { 144, 146, 69 }, { 144, 150, 68 },
+	{ 144, 154, 67 }, { 144, 176, 65 }, { 145, 145, 133 }, { 145, 145, 64 }, { 145, 151, 63 }, { 145, 151, 107 },
+	{ 145, 155, 79 }, { 145, 189, 62 }, { 145, 191, 70 }, { 146, 147, 61 }, { 146, 148, 60 }, { 146, 167, 59 },
+	{ 147, 151, 74 }, { 147, 161, 58 }, { 148, 168, 69 }, { 149, 150, 123 }, { 149, 151, 121 }, { 149, 158, 57 },
+	{ 150, 150, 75 }, { 150, 153, 56 }, { 150, 153, 55 }, { 150, 156, 54 }, { 151, 151, 128 }, { 151, 151, 124 },
+	{ 151, 151, 134 }, { 151, 151, 120 }, { 151, 155, 53 }, { 152, 153, 52 }, { 152, 159, 75 }, { 153, 154, 50 },
+	{ 153, 155, 49 }, { 153, 188, 125 }, { 154, 157, 88 }, { 154, 160, 63 }, { 155, 159, 85 }, { 155, 161, 115 },
+	{ 155, 163, 55 }, { 156, 157, 149 }, { 157, 157, 106 }, { 157, 158, 47 }, { 157, 159, 46 }, { 157, 171, 45 },
+	{ 158, 158, 114 }, { 158, 158, 44 }, { 158, 159, 43 }, { 158, 160, 56 }, { 159, 164, 54 }, { 159, 170, 42 },
+	{ 160, 160, 41 }, { 160, 171, 40 }, { 160, 175, 108 }, { 160, 177, 118 }, { 160, 188, 57 }, { 160, 191, 39 },
+	{ 161, 173, 136 }, { 161, 175, 85 }, { 162, 163, 128 }, { 162, 163, 124 }, { 162, 163, 123 }, { 162, 163, 121 },
+	{ 162, 163, 117 }, { 162, 163, 120 }, { 162, 163, 107 }, { 162, 164, 56 }, { 163, 164, 115 }, { 163, 167, 91 },
+	{ 163, 170, 38 }, { 163, 191, 58 }, { 164, 164, 37 }, { 164, 164, 63 }, { 164, 167, 36 }, { 164, 183, 35 },
+	{ 165, 165, 146 }, { 165, 166, 34 }, { 165, 167, 55 }, { 165, 169, 33 }, { 166, 170, 115 }, { 166, 172, 128 },
+	{ 166, 173, 32 }, { 166, 176, 31 }, { 166, 179, 30 }, { 167, 168, 54 }, { 167, 173, 56 }, { 167, 180, 139 },
+	{ 169, 169, 82 }, { 169, 173, 55 }, { 169, 182, 59 }, { 169, 182, 29 }, { 170, 173, 141 }, { 170, 173, 54 },
+	{ 170, 175, 28 }, { 171, 172, 27 }, { 171, 175, 98 }, { 171, 179, 127 }, { 171, 179, 26 }, { 171, 183, 25 },
+	{ 171, 190, 24 }, { 172, 172, 91 }, { 172, 173, 38 }, { 172, 175, 23 }, { 172, 183, 22 }, { 172, 186, 21 },
+	{ 173, 173, 69 }, { 173, 178, 33 }, { 175, 177, 20 }, { 175, 178, 19 }, { 175, 181, 18 }, { 175, 182, 17 },
+	{ 176, 176, 16 }, { 176, 176, 71 }, { 176, 177, 37 }, { 176, 177, 15 }, { 176, 177, 133 }, { 176, 180, 14 },
+	{ 176, 180, 128 }, { 176, 181, 13 }, { 176, 182, 12 }, { 176, 186, 138 }, { 176, 187, 40 }, { 176, 191, 11 },
+	{ 176, 191, 64 }, { 177, 177, 10 }, { 177, 177, 9 }, { 177, 180, 56 }, { 177, 182, 8 }, { 177, 191, 7 },
+	{ 178, 179, 61 }, { 178, 179, 75 }, { 178, 180, 16 }, { 178, 180, 60 }, { 179, 179, 83 }, { 179, 182, 6 },
+	{ 179, 185, 92 }, { 179, 191, 140 }, { 179, 191, 131 }, { 180, 180, 69 }, { 180, 186, 9 }, { 180, 188, 10 },
+	{ 180, 189, 19 }, { 180, 191, 143 }, { 180, 191, 126 }, { 180, 191, 5 }, { 181, 181, 105 }, { 181, 181, 52 },
+	{ 181, 181, 133 }, { 181, 182, 98 }, { 181, 191, 4 }, { 182, 186, 3 }, { 183, 183, 52 }, { 183, 184, 13 },
+	{ 183, 184, 16 }, { 183, 185, 69 }, { 184, 186, 95 }, { 184, 191, 17 }, { 184, 191, 18 }, { 184, 191, 137 },
+	{ 185, 185, 52 }, { 186, 186, 8 }, { 186, 188, 129 }, { 186, 191, 117 }, { 187, 188, 130 }, { 187, 189, 87 },
+	{ 187, 190, 92 }, { 187, 190, 13 }, { 187, 191, 101 }, { 187, 191, 33 }, { 187, 191, 100 }, { 188, 188, 93 },
+	{ 188, 189, 8 }, { 189, 189, 2 }, { 189, 189, 26 }, { 190, 190, 22 }, { 190, 190, 120 }, { 190, 191, 16 },
+	{ 190, 191, 52 }, { 190, 191, 130 }, { 190, 191, 122 }, { 190, 191, 90 }, { 190, 191, 93 }, { 190, 191, 129 },
+	{ 191, 191, 8 }, { 191, 191, 113 }, { 191, 191, 95 }, { 191, 191, 118 }, { 191, 191, 1 }, { 191, 191, 57 },
+	{ 191, 191, 62 }, { 181, 181, 66 }, { 135, 135, 96 }, { 141, 141, 96 }, { 144, 144, 151 }, { 158, 158, 145 },
+	{ 187, 187, 151 }, { 189, 189, 135 }, { 180, 180, 151 }, { 184, 184, 135 }, { 186, 186, 135 }, { 146, 146, 151 },
+	{ 152, 152, 151 }, { 170, 170, 145 }, { 132, 132, 116 }, { 172, 172, 112 }, { 164, 164, 151 }, { 171, 171, 112 },
+	{ 155, 155, 147 }, { 170, 170, 147 }, { 176, 176, 151 }, { 150, 150, 151 }, { 153, 153, 147 }, { 179, 179, 66 },
+	{ 160, 160, 151 }, { 136, 136, 151 }, { 139, 139, 116 }, { 128, 128, 145 }, { 154, 154, 151 }, { 223, 223, 0 },
+	{ 186, 186, 96 }, { 128, 128, 51 }, { 168, 168, 147 }, { 175, 175, 145 }, { 222, 222, 0 }, { 164, 164, 147 },
+	{ 133, 133, 142 }, { 171, 171, 96 }, { 176, 176, 145 }, { 180, 180, 96 }, { 191, 191, 112 }, { 175, 175, 147 },
+	{ 183, 183, 66 }, { 164, 164, 145 }, { 139, 139, 96 }, { 139, 139, 151 }, { 154, 154, 147 }, { 172, 172, 109 },
+	{ 156, 156, 151 }, { 141, 141, 145 }, { 178, 178, 48 }, { 155, 155, 152 }, { 161, 161, 135 }, { 130, 130, 51 },
+	{ 227, 227, 0 }, { 188, 188, 135 }, { 168, 168, 145 }, { 219, 219, 0 }, { 160, 160, 135 }, { 129, 129, 145 },
+	{ 169, 169, 145 }, { 163, 163, 135 }, { 178, 178, 151 }, { 156, 156, 145 }, { 157, 157, 145 }, { 214, 214, 0 },
+	{ 167, 167, 151 }, { 220, 220, 0 }, { 131, 131, 66 }, { 226, 226, 0 }, { 216, 216, 0 }, { 163, 163, 116 },
+	{ 179, 179, 145 }, { 189, 189, 112 }, { 217, 217, 0 }, { 160, 160, 145 }, { 170, 170, 151 }, { 182, 182, 151 },
+	{ 183, 183, 135 }, { 187, 187, 135 }, { 165, 165, 147 }, { 185, 185, 135 }, { 169, 169, 151 }, { 189, 189, 96 },
+	{ 191, 191, 135 }, { 162, 162, 145 }, { 133, 133, 151 }, { 165, 165, 116 }, { 170, 170, 142 }, { 210, 210, 0 },
+	{ 169, 169, 147 }, { 130, 130, 145 }, { 137, 137, 142 }, { 174, 174, 135 }, { 160, 160, 147 }, { 168, 168, 151 },
+	{ 166, 166, 135 }, { 168, 168, 135 }, { 170, 170, 135 }, { 172, 172, 135 }, { 178, 178, 135 }, { 182, 182, 135 },
+	{ 168, 168, 96 }, { 144, 144, 152 }, { 215, 215, 0 }, { 171, 171, 147 }, { 132, 134, 103 }, { 204, 204, 0 },
+	{ 183, 183, 145 }, { 168, 168, 142 }, { 135, 135, 103 }, { 205, 205, 0 }, { 160, 160, 104 }, { 243, 243, 0 },
+	{ 169, 169, 142 }, { 159, 159, 145 }, { 165, 165, 135 }, { 184, 184, 109 }, { 239, 239, 0 }, { 221, 221, 0 },
+	{ 190, 190, 112 }, { 150, 150, 152 }, { 129, 129, 151 }, { 145, 145, 151 }, { 128, 128, 116 }, { 158, 158, 152 },
+	{ 171, 171, 135 }, { 163, 163, 147 }, { 181, 181, 151 }, { 167, 167, 135 }, { 173, 173, 135 }, { 176, 176, 135 },
+	{ 177, 177, 135 }, { 179, 179, 135 }, { 181, 181, 135 }, { 190, 190, 135 }, { 172, 172, 145 }, { 173, 173, 145 },
+	{ 141, 141, 151 }, { 164, 164, 135 }, { 140, 140, 151 }, { 180, 180, 135 }, { 166, 166, 147 }, { 147, 147, 151 },
+	{ 169, 169, 135 }, { 175, 175, 135 }, { 224, 224, 0 }, { 174, 174, 145 }, { 128, 128, 151 }, { 130, 130, 151 },
+	{ 132, 132, 151 }, { 134, 134, 151 }, { 134, 134, 142 }, { 157, 157, 152 }, { 162, 162, 147 }, { 153, 153, 151 },
+	{ 171, 171, 145 }, { 225, 225, 0 }, { 167, 167, 147 }, { 234, 234, 0 }, { 135, 135, 151 }, { 151, 151, 151 },
+	{ 165, 165, 151 }, { 145, 145, 152 }, { 240, 240, 0 },
+};
+static const uint16_t Mahajani_forward_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Mahajani_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 133, 133, 3 }, { 144, 182, 0 },
+};
+static const uint16_t Mahajani_reverse_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Mahajani_reverse_range[] = {
+	{ 144, 182, 1 }, { 133, 133, 2 }, { 145, 145, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Makasar_forward_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Makasar_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 187, 187, 3 }, { 160, 184, 0 },
+};
+static const uint16_t Makasar_reverse_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Makasar_reverse_range[] = {
+	{ 160, 184, 1 }, { 187, 187, 2 }, { 145, 145, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Malayalam_forward_state[] = {
+	0, 1, 3, 8, 11,
+};
+static const UTF8Range Malayalam_forward_range[] = {
+	{ 224, 224, 1 }, { 180, 180, 3 }, { 181, 181, 2 }, { 128, 132, 0 }, { 134, 136, 0 }, { 138, 143, 0 },
+	{ 148, 163, 0 }, { 166, 191, 0 }, { 128, 140, 0 }, { 142, 144, 0 }, { 146, 191, 0 },
+};
+static const uint16_t Malayalam_reverse_state[] = {
+	0, 8, 9, 10, 11,
+};
+static const UTF8Range Malayalam_reverse_range[] = {
+	{ 128, 132, 2 }, { 128, 140, 1 }, { 134, 136, 2 }, { 138, 143, 2 }, { 142, 144, 1 }, { 146, 191, 1 },
+	{ 148, 163, 2 }, { 166, 191, 2 }, { 180, 180, 3 }, { 181, 181, 3 }, { 224, 224, 0 },
+};
+static const uint16_t Mandaic_forward_state[] = {
+	0, 1, 2, 4,
+};
+static const UTF8Range Mandaic_forward_range[] = {
+	{ 224, 224, 1 }, { 161, 161, 2 }, { 128, 155, 0 }, { 158, 158, 0 },
+};
+static const uint16_t Mandaic_reverse_state[] = {
+	0, 2, 3, 4,
+};
+static const UTF8Range Mandaic_reverse_range[] = {
+	{ 128, 155, 1 }, { 158, 158, 1 }, { 161, 161, 2 }, { 224, 224, 0 },
+};
+static const uint16_t Manichaean_forward_state[] = {
+	0, 1, 2, 3, 5,
+};
+static const UTF8Range Manichaean_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 171, 171, 3 }, { 128, 166, 0 }, { 171, 182, 0 },
+};
+static const uint16_t Manichaean_reverse_state[] = {
+	0, 2, 3, 4, 5,
+};
+static const UTF8Range Manichaean_reverse_range[] = {
+	{ 128, 166, 1 }, { 171, 182, 1 }, { 171, 171, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Marchen_forward_state[] = {
+	0, 1, 2, 4, 7, 8,
+};
+static const UTF8Range Marchen_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 177, 177, 4 }, { 178, 178, 3 }, { 128, 143, 0 }, { 146, 167, 0 },
+	{ 169, 182, 0 }, { 176, 191, 0 },
+};
+static const uint16_t Marchen_reverse_state[] = {
+	0, 4, 5, 6, 7, 8,
+};
+static const UTF8Range Marchen_reverse_range[] = {
+	{ 128, 143, 2 }, { 146, 167, 2 }, { 169, 182, 2 }, { 176, 191, 1 }, { 177, 177, 3 }, { 178, 178, 3 },
+	{ 145, 145, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Masaram_Gondi_forward_state[] = {
+	0, 1, 2, 4, 6, 12,
+};
+static const UTF8Range Masaram_Gondi_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 180, 180, 4 }, { 181, 181, 3 }, { 128, 135, 0 }, { 144, 153, 0 },
+	{ 128, 134, 0 }, { 136, 137, 0 }, { 139, 182, 0 }, { 186, 186, 0 }, { 188, 189, 0 }, { 191, 191, 0 },
+};
+static const uint16_t Masaram_Gondi_reverse_state[] = {
+	0, 8, 9, 10, 11, 12,
+};
+static const UTF8Range Masaram_Gondi_reverse_range[] = {
+	{ 128, 134, 2 }, { 128, 135, 1 }, { 136, 137, 2 }, { 139, 182, 2 }, { 144, 153, 1 }, { 186, 186, 2 },
+	{ 188, 189, 2 }, { 191, 191, 2 }, { 181, 181, 3 }, { 180, 180, 3 }, { 145, 145, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Mc_forward_state[] = {
+	0, 5, 8, 9, 11, 14, 15, 16, 17, 46, 47, 50,
+	53, 55, 56, 57, 58, 61, 64, 66, 68, 71, 74, 77,
+	78, 81, 83, 84, 89, 90, 93, 95, 98, 99, 100, 103,
+	105, 115, 119, 122, 125, 127, 131, 132, 133, 135, 137, 138,
+	139, 153, 155, 157, 161, 165, 167, 171, 176, 177, 181, 183,
+	185, 189, 192, 196, 218, 219, 222, 223, 227, 231, 232, 233,
+	237, 238, 240, 243, 244, 246, 250, 252, 255, 258,
+};
+static const UTF8Range Mc_forward_range[] = {
+	{ 224, 224, 63 }, { 225, 225, 48 }, { 227, 227, 46 }, { 234, 234, 36 }, { 240, 240, 1 }, { 145, 145, 8 },
+	{ 150, 150, 4 }, { 157, 157, 2 }, { 133, 133, 3 }, { 165, 166, 0 }, { 173, 178, 0 }, { 189, 189, 7 },
+	{ 190, 190, 6 }, { 191, 191, 5 }, { 176, 177, 0 }, { 128, 135, 0 }, { 145, 191, 0 }, { 128, 128, 35 },
+	{ 130, 130, 34 }, { 132, 132, 33 }, { 133, 133, 32 }, { 134, 134, 31 }, { 135, 135, 30 }, { 136, 136, 29 },
+	{ 139, 139, 28 }, { 140, 140, 78 }, { 141, 141, 27 }, { 144, 144, 26 }, { 145, 145, 25 }, { 146, 146, 24 },
+	{ 147, 147, 23 }, { 150, 150, 22 }, { 152, 152, 21 }, { 154, 154, 20 }, { 156, 156, 19 }, { 160, 160, 18 },
+	{ 164, 164, 17 }, { 165, 165, 35 }, { 167, 167, 16 }, { 168, 168, 15 }, { 169, 169, 14 }, { 170, 170, 13 },
+	{ 176, 176, 12 }, { 178, 178, 11 }, { 182, 182, 10 }, { 187, 187, 9 }, { 181, 182, 0 }, { 138, 142, 0 },
+	{ 147, 148, 0 }, { 150, 150, 0 }, { 169, 169, 0 }, { 177, 177, 0 }, { 180, 180, 0 }, { 175, 175, 0 },
+	{ 190, 190, 0 }, { 151, 151, 0 }, { 151, 152, 0 }, { 185, 185, 0 }, { 145, 147, 0 }, { 156, 159, 0 },
+	{ 164, 164, 0 }, { 176, 181, 0 }, { 183, 184, 0 }, { 189, 189, 0 }, { 172, 174, 0 }, { 184, 184, 0 },
+	{ 160, 161, 0 }, { 166, 166, 0 }, { 172, 172, 0 }, { 174, 175, 0 }, { 182, 182, 0 }, { 176, 178, 0 },
+	{ 187, 188, 0 }, { 190, 190, 0 }, { 175, 177, 0 }, { 184, 187, 0 }, { 190, 190, 0 }, { 129, 129, 0 },
+	{ 176, 178, 0 }, { 185, 185, 0 }, { 187, 190, 0 }, { 128, 129, 0 }, { 133, 133, 0 }, { 181, 183, 0 },
+	{ 129, 132, 0 }, { 135, 136, 0 }, { 139, 141, 0 }, { 151, 151, 0 }, { 162, 163, 0 }, { 160, 162, 0 },
+	{ 172, 174, 0 }, { 178, 179, 0 }, { 181, 181, 0 }, { 128, 128, 0 }, { 142, 142, 0 }, { 130, 130, 0 },
+	{ 179, 181, 0 }, { 191, 191, 0 }, { 133, 134, 0 }, { 172, 172, 0 }, { 130, 130, 0 }, { 176, 178, 0 },
+	{ 183, 184, 0 }, { 128, 128, 0 }, { 130, 130, 0 }, { 160, 160, 45 }, { 162, 162, 44 }, { 163, 163, 43 },
+	{ 165, 165, 42 }, { 166, 166, 41 }, { 167, 167, 75 }, { 168, 168, 40 }, { 169, 169, 39 }, { 171, 171, 38 },
+	{ 175, 175, 37 }, { 163, 164, 0 }, { 166, 167, 0 }, { 169, 170, 0 }, { 172, 172, 0 }, { 171, 171, 0 },
+	{ 174, 175, 0 }, { 181, 181, 0 }, { 141, 141, 0 }, { 187, 187, 0 }, { 189, 189, 0 }, { 175, 176, 0 },
+	{ 179, 180, 0 }, { 131, 131, 0 }, { 180, 181, 0 }, { 186, 187, 0 }, { 190, 191, 0 }, { 146, 147, 0 },
+	{ 128, 131, 0 }, { 128, 129, 0 }, { 180, 191, 0 }, { 163, 164, 0 }, { 167, 167, 0 }, { 128, 128, 47 },
+	{ 174, 175, 0 }, { 128, 128, 62 }, { 129, 129, 61 }, { 130, 130, 60 }, { 158, 158, 59 }, { 159, 159, 58 },
+	{ 164, 164, 57 }, { 168, 168, 56 }, { 169, 169, 55 }, { 172, 172, 54 }, { 173, 173, 53 }, { 174, 174, 52 },
+	{ 175, 175, 51 }, { 176, 176, 50 }, { 179, 179, 49 }, { 161, 161, 0 }, { 183, 183, 0 }, { 164, 171, 0 },
+	{ 180, 181, 0 }, { 167, 167, 0 }, { 170, 172, 0 }, { 174, 174, 0 }, { 178, 179, 0 }, { 130, 130, 0 },
+	{ 161, 161, 0 }, { 166, 167, 0 }, { 170, 170, 0 }, { 128, 129, 0 }, { 131, 132, 0 }, { 132, 132, 0 },
+	{ 181, 181, 0 }, { 187, 187, 0 }, { 189, 191, 0 }, { 149, 149, 0 }, { 151, 151, 0 }, { 161, 161, 0 },
+	{ 163, 164, 0 }, { 173, 178, 0 }, { 153, 154, 0 }, { 163, 166, 0 }, { 169, 171, 0 }, { 176, 177, 0 },
+	{ 179, 184, 0 }, { 128, 133, 0 }, { 135, 136, 0 }, { 182, 182, 0 }, { 190, 191, 0 }, { 131, 132, 0 },
+	{ 135, 140, 0 }, { 143, 143, 0 }, { 154, 156, 0 }, { 150, 151, 0 }, { 162, 164, 0 }, { 167, 173, 0 },
+	{ 171, 172, 0 }, { 177, 177, 0 }, { 184, 184, 0 }, { 187, 188, 0 }, { 164, 164, 80 }, { 165, 165, 79 },
+	{ 166, 166, 78 }, { 167, 167, 77 }, { 168, 168, 76 }, { 169, 169, 75 }, { 170, 170, 76 }, { 171, 171, 74 },
+	{ 172, 172, 73 }, { 173, 173, 77 }, { 174, 174, 72 }, { 175, 175, 71 }, { 176, 176, 70 }, { 177, 177, 69 },
+	{ 178, 178, 73 }, { 179, 179, 68 }, { 180, 180, 78 }, { 181, 181, 67 }, { 182, 182, 66 }, { 183, 183, 65 },
+	{ 188, 188, 72 }, { 189, 189, 64 }, { 191, 191, 0 }, { 143, 145, 0 }, { 152, 159, 0 }, { 178, 179, 0 },
+	{ 130, 131, 0 }, { 128, 128, 0 }, { 134, 136, 0 }, { 138, 140, 0 }, { 151, 151, 0 }, { 128, 132, 0 },
+	{ 135, 136, 0 }, { 138, 139, 0 }, { 149, 150, 0 }, { 129, 132, 0 }, { 129, 131, 0 }, { 129, 130, 0 },
+	{ 134, 136, 0 }, { 138, 140, 0 }, { 151, 151, 0 }, { 190, 191, 0 }, { 130, 131, 0 }, { 190, 190, 0 },
+	{ 128, 128, 0 }, { 137, 137, 0 }, { 139, 140, 0 }, { 128, 128, 0 }, { 131, 131, 0 }, { 190, 191, 0 },
+	{ 128, 128, 0 }, { 135, 136, 0 }, { 139, 140, 0 }, { 151, 151, 0 }, { 130, 131, 0 }, { 190, 191, 0 },
+	{ 128, 128, 0 }, { 137, 140, 0 }, { 142, 143, 0 }, { 131, 131, 0 }, { 187, 187, 0 }, { 190, 191, 0 },
+};
+static const uint16_t Mc_reverse_state[] = {
+	0, 170, 171, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+	182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+	194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205,
+	206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217,
+	218, 220, 221, 224, 226, 227, 228, 229, 230, 231, 232, 233,
+	234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245,
+	247, 249, 250, 251, 252, 253, 255, 256, 257, 258,
+};
+static const UTF8Range Mc_reverse_range[] = {
+	{ 128, 128, 78 }, { 128, 128, 77 }, { 128, 128, 75 }, { 128, 128, 74 }, { 128, 128, 72 }, { 128, 128, 71 },
+	{ 128, 128, 70 }, { 128, 129, 69 }, { 128, 129, 68 }, { 128, 129, 66 }, { 128, 131, 65 }, { 128, 132, 64 },
+	{ 128, 133, 63 }, { 128, 135, 61 }, { 129, 129, 60 }, { 129, 130, 59 }, { 129, 131, 58 }, { 129, 132, 57 },
+	{ 129, 132, 56 }, { 130, 130, 55 }, { 130, 130, 54 }, { 130, 130, 77 }, { 130, 130, 53 }, { 130, 131, 52 },
+	{ 130, 131, 51 }, { 130, 131, 50 }, { 131, 131, 49 }, { 131, 131, 48 }, { 131, 131, 47 }, { 131, 132, 66 },
+	{ 131, 132, 46 }, { 132, 132, 45 }, { 133, 133, 69 }, { 133, 134, 44 }, { 134, 136, 75 }, { 134, 136, 59 },
+	{ 135, 136, 57 }, { 135, 136, 63 }, { 135, 136, 64 }, { 135, 136, 71 }, { 135, 140, 46 }, { 137, 137, 74 },
+	{ 137, 140, 70 }, { 138, 139, 64 }, { 138, 140, 75 }, { 138, 140, 59 }, { 138, 142, 43 }, { 139, 140, 74 },
+	{ 139, 140, 71 }, { 139, 141, 57 }, { 141, 141, 42 }, { 142, 142, 78 }, { 142, 143, 70 }, { 143, 143, 46 },
+	{ 143, 145, 41 }, { 145, 147, 40 }, { 145, 191, 39 }, { 146, 147, 38 }, { 147, 148, 43 }, { 149, 149, 37 },
+	{ 149, 150, 64 }, { 150, 150, 43 }, { 150, 151, 36 }, { 151, 151, 35 }, { 151, 151, 57 }, { 151, 151, 37 },
+	{ 151, 151, 75 }, { 151, 151, 59 }, { 151, 151, 71 }, { 151, 152, 34 }, { 152, 159, 41 }, { 153, 154, 33 },
+	{ 154, 156, 46 }, { 156, 159, 40 }, { 160, 161, 32 }, { 160, 162, 31 }, { 161, 161, 30 }, { 161, 161, 53 },
+	{ 161, 161, 37 }, { 162, 163, 57 }, { 162, 164, 36 }, { 163, 164, 29 }, { 163, 164, 28 }, { 163, 164, 37 },
+	{ 163, 166, 27 }, { 164, 164, 40 }, { 164, 171, 26 }, { 165, 166, 24 }, { 166, 166, 32 }, { 166, 167, 29 },
+	{ 166, 167, 53 }, { 167, 167, 28 }, { 167, 167, 23 }, { 167, 173, 36 }, { 169, 169, 22 }, { 169, 170, 29 },
+	{ 169, 171, 27 }, { 170, 170, 53 }, { 170, 172, 23 }, { 171, 171, 21 }, { 171, 172, 20 }, { 172, 172, 19 },
+	{ 172, 172, 18 }, { 172, 172, 29 }, { 172, 174, 17 }, { 172, 174, 16 }, { 173, 178, 24 }, { 173, 178, 37 },
+	{ 174, 174, 23 }, { 174, 175, 19 }, { 174, 175, 21 }, { 174, 175, 14 }, { 175, 175, 13 }, { 175, 176, 12 },
+	{ 175, 177, 11 }, { 176, 177, 10 }, { 176, 177, 27 }, { 176, 178, 9 }, { 176, 178, 8 }, { 176, 178, 54 },
+	{ 176, 181, 7 }, { 177, 177, 22 }, { 177, 177, 20 }, { 178, 179, 16 }, { 178, 179, 23 }, { 178, 179, 41 },
+	{ 179, 180, 12 }, { 179, 181, 55 }, { 179, 184, 27 }, { 180, 180, 22 }, { 180, 181, 49 }, { 180, 181, 26 },
+	{ 180, 191, 68 }, { 181, 181, 16 }, { 181, 181, 21 }, { 181, 181, 45 }, { 181, 182, 6 }, { 181, 183, 5 },
+	{ 182, 182, 19 }, { 182, 182, 4 }, { 183, 183, 30 }, { 183, 184, 7 }, { 183, 184, 54 }, { 184, 184, 17 },
+	{ 184, 184, 20 }, { 184, 187, 11 }, { 185, 185, 3 }, { 185, 185, 8 }, { 186, 187, 49 }, { 187, 187, 42 },
+	{ 187, 187, 45 }, { 187, 187, 47 }, { 187, 188, 9 }, { 187, 188, 20 }, { 187, 190, 8 }, { 189, 189, 7 },
+	{ 189, 189, 42 }, { 189, 191, 45 }, { 190, 190, 13 }, { 190, 190, 9 }, { 190, 190, 11 }, { 190, 190, 51 },
+	{ 190, 191, 49 }, { 190, 191, 4 }, { 190, 191, 2 }, { 190, 191, 48 }, { 190, 191, 50 }, { 190, 191, 47 },
+	{ 191, 191, 55 }, { 191, 191, 1 }, { 189, 189, 76 }, { 174, 174, 76 }, { 188, 188, 76 }, { 168, 168, 79 },
+	{ 158, 158, 67 }, { 144, 144, 79 }, { 187, 187, 79 }, { 164, 164, 79 }, { 146, 146, 79 }, { 152, 152, 79 },
+	{ 191, 191, 62 }, { 150, 150, 79 }, { 168, 168, 73 }, { 176, 176, 79 }, { 128, 128, 15 }, { 227, 227, 0 },
+	{ 136, 136, 79 }, { 160, 160, 79 }, { 132, 132, 79 }, { 154, 154, 79 }, { 128, 128, 67 }, { 171, 171, 73 },
+	{ 178, 178, 79 }, { 175, 175, 67 }, { 133, 133, 25 }, { 157, 157, 80 }, { 176, 176, 67 }, { 164, 164, 67 },
+	{ 160, 160, 73 }, { 175, 175, 73 }, { 179, 179, 67 }, { 139, 139, 79 }, { 156, 156, 79 }, { 168, 168, 67 },
+	{ 169, 169, 79 }, { 170, 170, 79 }, { 129, 129, 67 }, { 169, 169, 67 }, { 165, 165, 73 }, { 189, 189, 62 },
+	{ 167, 167, 79 }, { 183, 183, 76 }, { 169, 169, 73 }, { 182, 182, 79 }, { 133, 133, 79 }, { 172, 172, 67 },
+	{ 130, 130, 67 }, { 164, 164, 76 }, { 168, 168, 76 }, { 170, 170, 76 }, { 166, 166, 73 }, { 140, 140, 79 },
+	{ 166, 166, 76 }, { 180, 180, 76 }, { 172, 172, 76 }, { 178, 178, 76 }, { 182, 182, 76 }, { 174, 174, 67 },
+	{ 130, 130, 79 }, { 134, 134, 79 }, { 177, 177, 76 }, { 141, 141, 79 }, { 176, 176, 76 }, { 175, 175, 76 },
+	{ 147, 147, 79 }, { 190, 190, 62 }, { 150, 150, 80 }, { 159, 159, 67 }, { 179, 179, 76 }, { 163, 163, 73 },
+	{ 173, 173, 67 }, { 225, 225, 0 }, { 162, 162, 73 }, { 145, 145, 79 }, { 165, 165, 76 }, { 167, 167, 76 },
+	{ 173, 173, 76 }, { 167, 167, 73 }, { 169, 169, 76 }, { 234, 234, 0 }, { 171, 171, 76 }, { 181, 181, 76 },
+	{ 224, 224, 0 }, { 128, 128, 79 }, { 165, 165, 79 }, { 135, 135, 79 }, { 145, 145, 80 }, { 240, 240, 0 },
+};
+static const uint16_t Me_forward_state[] = {
+	0, 4, 5, 6, 7, 9, 10, 11, 12,
+};
+static const UTF8Range Me_forward_range[] = {
+	{ 210, 210, 7 }, { 225, 225, 5 }, { 226, 226, 3 }, { 234, 234, 1 }, { 153, 153, 2 }, { 176, 178, 0 },
+	{ 131, 131, 4 }, { 157, 160, 0 }, { 162, 164, 0 }, { 170, 170, 6 }, { 190, 190, 0 }, { 136, 137, 0 },
+};
+static const uint16_t Me_reverse_state[] = {
+	0, 5, 6, 7, 8, 9, 10, 11, 12,
+};
+static const UTF8Range Me_reverse_range[] = {
+	{ 136, 137, 7 }, { 157, 160, 5 }, { 162, 164, 5 }, { 176, 178, 3 }, { 190, 190, 1 }, { 170, 170, 2 },
+	{ 225, 225, 0 }, { 153, 153, 4 }, { 234, 234, 0 }, { 131, 131, 6 }, { 226, 226, 0 }, { 210, 210, 0 },
+};
+static const uint16_t Medefaidrin_forward_state[] = {
+	0, 1, 2, 4, 5, 6,
+};
+static const UTF8Range Medefaidrin_forward_range[] = {
+	{ 240, 240, 1 }, { 150, 150, 2 }, { 185, 185, 4 }, { 186, 186, 3 }, { 128, 154, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Medefaidrin_reverse_state[] = {
+	0, 2, 3, 4, 5, 6,
+};
+static const UTF8Range Medefaidrin_reverse_range[] = {
+	{ 128, 154, 2 }, { 128, 191, 1 }, { 185, 185, 3 }, { 186, 186, 3 }, { 150, 150, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Meetei_Mayek_forward_state[] = {
+	0, 1, 3, 5, 6,
+};
+static const UTF8Range Meetei_Mayek_forward_range[] = {
+	{ 234, 234, 1 }, { 171, 171, 3 }, { 175, 175, 2 }, { 128, 173, 0 }, { 176, 185, 0 }, { 160, 182, 0 },
+};
+static const uint16_t Meetei_Mayek_reverse_state[] = {
+	0, 3, 4, 5, 6,
+};
+static const UTF8Range Meetei_Mayek_reverse_range[] = {
+	{ 128, 173, 2 }, { 160, 182, 1 }, { 176, 185, 2 }, { 171, 171, 3 }, { 175, 175, 3 }, { 234, 234, 0 },
+};
+static const uint16_t Mende_Kikakui_forward_state[] = {
+	0, 1, 2, 4, 6, 7,
+};
+static const UTF8Range Mende_Kikakui_forward_range[] = {
+	{ 240, 240, 1 }, { 158, 158, 2 }, { 160, 162, 4 }, { 163, 163, 3 }, { 128, 132, 0 }, { 135, 150, 0 },
+	{ 128, 191, 0 },
+};
+static const uint16_t Mende_Kikakui_reverse_state[] = {
+	0, 3, 4, 5, 6, 7,
+};
+static const UTF8Range Mende_Kikakui_reverse_range[] = {
+	{ 128, 132, 2 }, { 128, 191, 1 }, { 135, 150, 2 }, { 160, 162, 3 }, { 163, 163, 3 }, { 158, 158, 4 },
+	{ 240, 240, 0 },
+};
+static const uint16_t Meroitic_Cursive_forward_state[] = {
+	0, 1, 2, 4, 6, 8,
+};
+static const UTF8Range Meroitic_Cursive_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 166, 166, 4 }, { 167, 167, 3 }, { 128, 143, 0 }, { 146, 191, 0 },
+	{ 160, 183, 0 }, { 188, 191, 0 },
+};
+static const uint16_t Meroitic_Cursive_reverse_state[] = {
+	0, 4, 5, 6, 7, 8,
+};
+static const UTF8Range Meroitic_Cursive_reverse_range[] = {
+	{ 128, 143, 2 }, { 146, 191, 2 }, { 160, 183, 1 }, { 188, 191, 1 }, { 166, 166, 3 }, { 167, 167, 3 },
+	{ 144, 144, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Meroitic_Hieroglyphs_forward_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Meroitic_Hieroglyphs_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 166, 166, 3 }, { 128, 159, 0 },
+};
+static const uint16_t Meroitic_Hieroglyphs_reverse_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Meroitic_Hieroglyphs_reverse_range[] = {
+	{ 128, 159, 1 }, { 166, 166, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Miao_forward_state[] = {
+	0, 1, 2, 5, 7, 9, 10,
+};
+static const UTF8Range Miao_forward_range[] = {
+	{ 240, 240, 1 }, { 150, 150, 2 }, { 188, 188, 5 }, { 189, 189, 4 }, { 190, 190, 3 }, { 128, 135, 0 },
+	{ 143, 159, 0 }, { 128, 138, 0 }, { 143, 191, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Miao_reverse_state[] = {
+	0, 5, 6, 7, 8, 9, 10,
+};
+static const UTF8Range Miao_reverse_range[] = {
+	{ 128, 135, 3 }, { 128, 138, 2 }, { 128, 191, 1 }, { 143, 159, 3 }, { 143, 191, 2 }, { 188, 188, 4 },
+	{ 189, 189, 4 }, { 190, 190, 4 }, { 150, 150, 5 }, { 240, 240, 0 },
+};
+static const uint16_t Mn_forward_state[] = {
+	0, 20, 21, 23, 29, 34, 35, 36, 37, 42, 48, 51,
+	53, 55, 56, 59, 61, 62, 63, 68, 69, 70, 71, 72,
+	73, 107, 108, 111, 113, 117, 121, 124, 126, 129, 132, 135,
+	136, 138, 140, 143, 147, 150, 152, 155, 157, 160, 163, 164,
+	167, 169, 173, 175, 177, 178, 181, 184, 186, 188, 196, 197,
+	198, 199, 200, 205, 206, 207, 208, 210, 212, 213, 227, 230,
+	233, 237, 240, 243, 244, 248, 249, 250, 253, 258, 259, 260,
+	262, 264, 265, 266, 270, 271, 272, 273, 276, 298, 300, 306,
+	308, 312, 316, 318, 322, 323, 325, 332, 334, 338, 340, 341,
+	344, 346, 348, 350, 351, 355, 358, 362, 393, 394, 398, 399,
+	403, 404, 406, 407, 409, 412, 413, 416, 418, 421, 426, 429,
+	431, 432, 436, 439, 444, 450, 452, 456, 458, 462, 465, 467,
+	468, 472, 474, 475, 476, 478, 482, 484, 485, 488, 490, 491,
+	492, 493,
+};
+static const UTF8Range Mn_forward_range[] = {
+	{ 204, 204, 156 }, { 205, 205, 155 }, { 210, 210, 154 }, { 214, 214, 153 }, { 215, 215, 152 }, { 216, 216, 151 },
+	{ 217, 217, 150 }, { 219, 219, 149 }, { 220, 220, 148 }, { 221, 221, 147 }, { 222, 222, 146 }, { 223, 223, 145 },
+	{ 224, 224, 115 }, { 225, 225, 92 }, { 226, 226, 87 }, { 227, 227, 84 }, { 234, 234, 69 }, { 239, 239, 66 },
+	{ 240, 240, 3 }, { 243, 243, 1 }, { 160, 160, 2 }, { 132, 134, 156 }, { 135, 135, 155 }, { 144, 144, 57 },
+	{ 145, 145, 24 }, { 150, 150, 18 }, { 155, 155, 16 }, { 157, 157, 9 }, { 158, 158, 4 }, { 128, 128, 8 },
+	{ 132, 132, 22 }, { 139, 139, 7 }, { 163, 163, 6 }, { 165, 165, 5 }, { 132, 138, 0 }, { 144, 150, 0 },
+	{ 172, 175, 0 }, { 128, 134, 0 }, { 136, 152, 0 }, { 155, 161, 0 }, { 163, 164, 0 }, { 166, 170, 0 },
+	{ 133, 133, 15 }, { 134, 134, 14 }, { 137, 137, 13 }, { 168, 168, 12 }, { 169, 169, 11 }, { 170, 170, 10 },
+	{ 132, 132, 0 }, { 155, 159, 0 }, { 161, 175, 0 }, { 128, 172, 0 }, { 181, 181, 0 }, { 128, 182, 0 },
+	{ 187, 191, 0 }, { 130, 132, 0 }, { 128, 130, 0 }, { 133, 139, 0 }, { 170, 173, 0 }, { 167, 169, 0 },
+	{ 187, 191, 0 }, { 178, 178, 17 }, { 157, 158, 0 }, { 171, 171, 23 }, { 172, 172, 22 }, { 189, 189, 21 },
+	{ 190, 190, 20 }, { 191, 191, 19 }, { 164, 164, 0 }, { 143, 146, 0 }, { 143, 143, 0 }, { 176, 182, 0 },
+	{ 176, 180, 0 }, { 128, 128, 56 }, { 129, 129, 55 }, { 130, 130, 54 }, { 132, 132, 53 }, { 133, 133, 52 },
+	{ 134, 134, 51 }, { 135, 135, 50 }, { 136, 136, 49 }, { 139, 139, 48 }, { 140, 140, 127 }, { 141, 141, 47 },
+	{ 144, 144, 46 }, { 145, 145, 45 }, { 146, 146, 44 }, { 147, 147, 43 }, { 150, 150, 42 }, { 151, 151, 41 },
+	{ 152, 152, 40 }, { 153, 153, 100 }, { 154, 154, 39 }, { 156, 156, 38 }, { 160, 160, 37 }, { 164, 164, 36 },
+	{ 165, 165, 35 }, { 167, 167, 34 }, { 168, 168, 33 }, { 169, 169, 32 }, { 170, 170, 31 }, { 176, 176, 30 },
+	{ 178, 178, 29 }, { 180, 180, 28 }, { 181, 181, 27 }, { 182, 182, 26 }, { 187, 187, 25 }, { 179, 180, 0 },
+	{ 144, 145, 0 }, { 149, 149, 0 }, { 151, 151, 0 }, { 128, 133, 0 }, { 135, 135, 0 }, { 177, 182, 0 },
+	{ 186, 186, 0 }, { 188, 189, 0 }, { 191, 191, 0 }, { 146, 167, 0 }, { 170, 176, 0 }, { 178, 179, 0 },
+	{ 181, 182, 0 }, { 176, 182, 0 }, { 184, 189, 0 }, { 191, 191, 0 }, { 138, 150, 0 }, { 152, 153, 0 },
+	{ 135, 135, 0 }, { 145, 150, 0 }, { 153, 155, 0 }, { 129, 138, 0 }, { 179, 184, 0 }, { 187, 190, 0 },
+	{ 148, 151, 0 }, { 154, 155, 0 }, { 160, 160, 0 }, { 131, 131, 0 }, { 187, 188, 0 }, { 190, 190, 0 },
+	{ 175, 183, 0 }, { 185, 186, 0 }, { 157, 159, 0 }, { 162, 165, 0 }, { 167, 171, 0 }, { 171, 171, 0 },
+	{ 173, 173, 0 }, { 176, 181, 0 }, { 183, 183, 0 }, { 179, 186, 0 }, { 189, 189, 0 }, { 191, 191, 0 },
+	{ 128, 128, 0 }, { 156, 157, 0 }, { 178, 181, 0 }, { 188, 189, 0 }, { 191, 191, 0 }, { 128, 128, 0 },
+	{ 130, 131, 0 }, { 179, 184, 0 }, { 186, 186, 0 }, { 191, 191, 0 }, { 130, 132, 0 }, { 134, 134, 0 },
+	{ 158, 158, 0 }, { 184, 191, 0 }, { 128, 128, 0 }, { 166, 172, 0 }, { 176, 180, 0 }, { 159, 159, 0 },
+	{ 163, 170, 0 }, { 175, 177, 0 }, { 180, 180, 0 }, { 182, 183, 0 }, { 190, 190, 0 }, { 137, 140, 0 },
+	{ 143, 143, 0 }, { 128, 129, 0 }, { 182, 190, 0 }, { 179, 179, 0 }, { 128, 130, 0 }, { 167, 171, 0 },
+	{ 173, 180, 0 }, { 128, 129, 0 }, { 179, 182, 0 }, { 185, 186, 0 }, { 128, 134, 0 }, { 191, 191, 0 },
+	{ 129, 129, 0 }, { 184, 191, 0 }, { 135, 135, 65 }, { 139, 139, 64 }, { 141, 141, 63 }, { 168, 168, 62 },
+	{ 171, 171, 61 }, { 180, 180, 60 }, { 186, 186, 59 }, { 189, 189, 58 }, { 134, 144, 0 }, { 171, 172, 0 },
+	{ 164, 167, 0 }, { 165, 166, 0 }, { 129, 131, 0 }, { 133, 134, 0 }, { 140, 143, 0 }, { 184, 186, 0 },
+	{ 191, 191, 0 }, { 182, 186, 0 }, { 160, 160, 0 }, { 189, 189, 0 }, { 172, 172, 68 }, { 184, 184, 67 },
+	{ 128, 143, 0 }, { 160, 175, 0 }, { 158, 158, 0 }, { 153, 153, 83 }, { 154, 154, 82 }, { 155, 155, 81 },
+	{ 160, 160, 80 }, { 163, 163, 79 }, { 164, 164, 78 }, { 165, 165, 77 }, { 166, 166, 76 }, { 167, 167, 75 },
+	{ 168, 168, 74 }, { 169, 169, 73 }, { 170, 170, 72 }, { 171, 171, 71 }, { 175, 175, 70 }, { 165, 165, 0 },
+	{ 168, 168, 0 }, { 173, 173, 0 }, { 129, 129, 0 }, { 172, 173, 0 }, { 182, 182, 0 }, { 176, 176, 0 },
+	{ 178, 180, 0 }, { 183, 184, 0 }, { 190, 191, 0 }, { 131, 131, 0 }, { 140, 140, 0 }, { 188, 188, 0 },
+	{ 169, 174, 0 }, { 177, 178, 0 }, { 181, 182, 0 }, { 165, 165, 0 }, { 128, 130, 0 }, { 179, 179, 0 },
+	{ 182, 185, 0 }, { 188, 189, 0 }, { 135, 145, 0 }, { 166, 173, 0 }, { 132, 133, 0 }, { 160, 177, 0 },
+	{ 191, 191, 0 }, { 130, 130, 0 }, { 134, 134, 0 }, { 139, 139, 0 }, { 165, 166, 0 }, { 172, 172, 0 },
+	{ 176, 177, 0 }, { 158, 159, 0 }, { 175, 175, 0 }, { 180, 189, 0 }, { 128, 128, 86 }, { 130, 130, 85 },
+	{ 153, 154, 0 }, { 170, 173, 0 }, { 131, 131, 91 }, { 179, 179, 90 }, { 181, 181, 89 }, { 183, 183, 88 },
+	{ 160, 191, 0 }, { 191, 191, 0 }, { 175, 177, 0 }, { 144, 156, 0 }, { 161, 161, 0 }, { 165, 176, 0 },
+	{ 128, 128, 114 }, { 129, 129, 113 }, { 130, 130, 112 }, { 141, 141, 111 }, { 156, 156, 110 }, { 157, 157, 109 },
+	{ 158, 158, 108 }, { 159, 159, 107 }, { 160, 160, 106 }, { 162, 162, 105 }, { 164, 164, 104 }, { 168, 168, 103 },
+	{ 169, 169, 102 }, { 170, 170, 101 }, { 171, 171, 100 }, { 172, 172, 99 }, { 173, 173, 98 }, { 174, 174, 97 },
+	{ 175, 175, 96 }, { 176, 176, 95 }, { 179, 179, 94 }, { 183, 183, 93 }, { 128, 185, 0 }, { 187, 191, 0 },
+	{ 144, 146, 0 }, { 148, 160, 0 }, { 162, 168, 0 }, { 173, 173, 0 }, { 180, 180, 0 }, { 184, 185, 0 },
+	{ 172, 179, 0 }, { 182, 183, 0 }, { 166, 166, 0 }, { 168, 169, 0 }, { 173, 173, 0 }, { 175, 177, 0 },
+	{ 128, 129, 0 }, { 162, 165, 0 }, { 168, 169, 0 }, { 171, 173, 0 }, { 130, 130, 0 }, { 171, 179, 0 },
+	{ 128, 131, 0 }, { 180, 180, 0 }, { 182, 186, 0 }, { 188, 188, 0 }, { 128, 128, 0 }, { 176, 189, 0 },
+	{ 191, 191, 0 }, { 150, 150, 0 }, { 152, 158, 0 }, { 160, 160, 0 }, { 162, 162, 0 }, { 165, 172, 0 },
+	{ 179, 188, 0 }, { 191, 191, 0 }, { 151, 152, 0 }, { 155, 155, 0 }, { 160, 162, 0 }, { 167, 168, 0 },
+	{ 178, 178, 0 }, { 185, 187, 0 }, { 133, 134, 0 }, { 169, 169, 0 }, { 139, 141, 0 }, { 134, 134, 0 },
+	{ 137, 147, 0 }, { 157, 157, 0 }, { 180, 181, 0 }, { 183, 189, 0 }, { 146, 147, 0 }, { 178, 179, 0 },
+	{ 146, 148, 0 }, { 178, 180, 0 }, { 157, 159, 0 }, { 130, 130, 0 }, { 133, 134, 0 }, { 141, 141, 0 },
+	{ 157, 157, 0 }, { 152, 153, 0 }, { 158, 160, 0 }, { 177, 180, 0 }, { 173, 176, 0 }, { 178, 183, 0 },
+	{ 185, 186, 0 }, { 189, 190, 0 }, { 160, 160, 144 }, { 161, 161, 143 }, { 163, 163, 142 }, { 164, 164, 141 },
+	{ 165, 165, 140 }, { 166, 166, 139 }, { 167, 167, 138 }, { 168, 168, 137 }, { 169, 169, 136 }, { 170, 170, 137 },
+	{ 171, 171, 135 }, { 172, 172, 134 }, { 173, 173, 133 }, { 174, 174, 132 }, { 175, 175, 131 }, { 176, 176, 130 },
+	{ 177, 177, 129 }, { 178, 178, 134 }, { 179, 179, 128 }, { 180, 180, 127 }, { 181, 181, 126 }, { 182, 182, 125 },
+	{ 183, 183, 124 }, { 184, 184, 123 }, { 185, 185, 122 }, { 186, 186, 121 }, { 187, 187, 120 }, { 188, 188, 119 },
+	{ 189, 189, 118 }, { 190, 190, 117 }, { 191, 191, 116 }, { 134, 134, 0 }, { 128, 132, 0 }, { 134, 135, 0 },
+	{ 141, 151, 0 }, { 153, 188, 0 }, { 177, 190, 0 }, { 152, 153, 0 }, { 181, 181, 0 }, { 183, 183, 0 },
+	{ 185, 185, 0 }, { 136, 141, 0 }, { 177, 177, 0 }, { 180, 188, 0 }, { 135, 142, 0 }, { 177, 177, 0 },
+	{ 180, 186, 0 }, { 138, 138, 0 }, { 146, 148, 0 }, { 150, 150, 0 }, { 129, 129, 0 }, { 129, 132, 0 },
+	{ 141, 141, 0 }, { 162, 163, 0 }, { 128, 129, 0 }, { 187, 188, 0 }, { 134, 134, 0 }, { 140, 141, 0 },
+	{ 162, 163, 0 }, { 128, 128, 0 }, { 134, 136, 0 }, { 138, 141, 0 }, { 149, 150, 0 }, { 162, 163, 0 },
+	{ 128, 128, 0 }, { 132, 132, 0 }, { 190, 191, 0 }, { 128, 128, 0 }, { 141, 141, 0 }, { 130, 130, 0 },
+	{ 129, 132, 0 }, { 141, 141, 0 }, { 149, 150, 0 }, { 162, 163, 0 }, { 129, 129, 0 }, { 188, 188, 0 },
+	{ 191, 191, 0 }, { 129, 133, 0 }, { 135, 136, 0 }, { 141, 141, 0 }, { 162, 163, 0 }, { 186, 191, 0 },
+	{ 129, 130, 0 }, { 135, 136, 0 }, { 139, 141, 0 }, { 145, 145, 0 }, { 176, 177, 0 }, { 181, 181, 0 },
+	{ 129, 130, 0 }, { 188, 188, 0 }, { 129, 132, 0 }, { 141, 141, 0 }, { 162, 163, 0 }, { 190, 190, 0 },
+	{ 129, 129, 0 }, { 188, 188, 0 }, { 129, 136, 0 }, { 141, 141, 0 }, { 145, 151, 0 }, { 162, 163, 0 },
+	{ 128, 130, 0 }, { 186, 186, 0 }, { 188, 188, 0 }, { 147, 161, 0 }, { 163, 191, 0 }, { 153, 155, 0 },
+	{ 150, 153, 0 }, { 155, 163, 0 }, { 165, 167, 0 }, { 169, 173, 0 }, { 171, 179, 0 }, { 189, 189, 0 },
+	{ 166, 176, 0 }, { 128, 138, 0 }, { 145, 145, 0 }, { 176, 191, 0 }, { 150, 156, 0 }, { 159, 164, 0 },
+	{ 167, 168, 0 }, { 170, 173, 0 }, { 139, 159, 0 }, { 176, 176, 0 }, { 144, 154, 0 }, { 129, 130, 0 },
+	{ 132, 133, 0 }, { 135, 135, 0 }, { 145, 189, 0 }, { 191, 191, 0 }, { 131, 135, 0 }, { 128, 175, 0 },
+	{ 128, 191, 0 },
+};
+static const uint16_t Mn_reverse_state[] = {
+	0, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340,
+	341, 342, 343, 344, 345, 346, 347, 349, 350, 351, 352, 353,
+	354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365,
+	366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377,
+	378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389,
+	390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401,
+	402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413,
+	414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425,
+	426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437,
+	438, 439, 440, 441, 442, 443, 445, 446, 447, 449, 450, 451,
+	452, 454, 455, 456, 458, 459, 460, 461, 462, 463, 464, 465,
+	466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 478,
+	479, 480, 481, 482, 483, 484, 485, 487, 488, 489, 490, 491,
+	492, 493,
+};
+static const UTF8Range Mn_reverse_range[] = {
+	{ 128, 128, 154 }, { 128, 128, 153 }, { 128, 128, 152 }, { 128, 128, 150 }, { 128, 128, 148 }, { 128, 128, 147 },
+	{ 128, 128, 146 }, { 128, 129, 145 }, { 128, 129, 144 }, { 128, 129, 143 }, { 128, 129, 142 }, { 128, 130, 140 },
+	{ 128, 130, 139 }, { 128, 130, 137 }, { 128, 130, 136 }, { 128, 131, 135 }, { 128, 132, 134 }, { 128, 133, 133 },
+	{ 128, 134, 131 }, { 128, 134, 130 }, { 128, 138, 129 }, { 128, 143, 127 }, { 128, 172, 126 }, { 128, 175, 123 },
+	{ 128, 182, 122 }, { 128, 185, 121 }, { 128, 191, 120 }, { 129, 129, 119 }, { 129, 129, 118 }, { 129, 129, 117 },
+	{ 129, 129, 116 }, { 129, 129, 115 }, { 129, 130, 114 }, { 129, 130, 113 }, { 129, 130, 112 }, { 129, 131, 110 },
+	{ 129, 132, 109 }, { 129, 132, 108 }, { 129, 132, 107 }, { 129, 133, 106 }, { 129, 136, 105 }, { 129, 138, 104 },
+	{ 130, 130, 103 }, { 130, 130, 102 }, { 130, 130, 101 }, { 130, 130, 100 }, { 130, 131, 153 }, { 130, 132, 99 },
+	{ 130, 132, 98 }, { 131, 131, 97 }, { 131, 131, 96 }, { 131, 135, 95 }, { 132, 132, 94 }, { 132, 132, 147 },
+	{ 132, 133, 93 }, { 132, 133, 112 }, { 132, 138, 92 }, { 133, 134, 110 }, { 133, 134, 91 }, { 133, 134, 101 },
+	{ 133, 139, 140 }, { 134, 134, 98 }, { 134, 134, 103 }, { 134, 134, 90 }, { 134, 134, 89 }, { 134, 134, 88 },
+	{ 134, 135, 134 }, { 134, 136, 148 }, { 134, 144, 87 }, { 135, 135, 133 }, { 135, 135, 86 }, { 135, 135, 112 },
+	{ 135, 136, 106 }, { 135, 136, 114 }, { 135, 142, 85 }, { 135, 145, 84 }, { 136, 141, 83 }, { 136, 152, 131 },
+	{ 137, 140, 82 }, { 137, 147, 90 }, { 138, 138, 81 }, { 138, 141, 148 }, { 138, 150, 80 }, { 139, 139, 103 },
+	{ 139, 141, 79 }, { 139, 141, 114 }, { 139, 159, 78 }, { 140, 140, 96 }, { 140, 141, 88 }, { 140, 143, 110 },
+	{ 141, 141, 101 }, { 141, 141, 109 }, { 141, 141, 146 }, { 141, 141, 108 }, { 141, 141, 106 }, { 141, 141, 107 },
+	{ 141, 141, 105 }, { 141, 151, 134 }, { 143, 143, 76 }, { 143, 143, 82 }, { 143, 146, 75 }, { 144, 145, 74 },
+	{ 144, 146, 73 }, { 144, 150, 72 }, { 144, 154, 71 }, { 144, 156, 69 }, { 145, 145, 114 }, { 145, 145, 68 },
+	{ 145, 150, 86 }, { 145, 151, 105 }, { 145, 189, 67 }, { 146, 147, 66 }, { 146, 148, 65 }, { 146, 148, 81 },
+	{ 146, 167, 64 }, { 147, 161, 63 }, { 148, 151, 62 }, { 148, 160, 73 }, { 149, 149, 74 }, { 149, 150, 148 },
+	{ 149, 150, 108 }, { 150, 150, 61 }, { 150, 150, 81 }, { 150, 153, 60 }, { 150, 156, 59 }, { 151, 151, 74 },
+	{ 151, 152, 58 }, { 152, 153, 80 }, { 152, 153, 57 }, { 152, 153, 56 }, { 152, 158, 61 }, { 153, 154, 54 },
+	{ 153, 155, 86 }, { 153, 155, 53 }, { 153, 188, 134 }, { 154, 155, 62 }, { 155, 155, 58 }, { 155, 159, 94 },
+	{ 155, 161, 131 }, { 155, 163, 60 }, { 156, 157, 154 }, { 157, 157, 90 }, { 157, 157, 101 }, { 157, 158, 51 },
+	{ 157, 159, 50 }, { 157, 159, 49 }, { 158, 158, 98 }, { 158, 158, 48 }, { 158, 159, 47 }, { 158, 160, 57 },
+	{ 159, 159, 46 }, { 159, 164, 59 }, { 160, 160, 62 }, { 160, 160, 45 }, { 160, 160, 61 }, { 160, 162, 44 },
+	{ 160, 175, 127 }, { 160, 177, 93 }, { 160, 191, 43 }, { 161, 161, 69 }, { 161, 175, 94 }, { 162, 162, 61 },
+	{ 162, 163, 109 }, { 162, 163, 88 }, { 162, 163, 148 }, { 162, 163, 108 }, { 162, 163, 106 }, { 162, 163, 107 },
+	{ 162, 163, 105 }, { 162, 165, 50 }, { 162, 165, 143 }, { 162, 168, 73 }, { 163, 164, 131 }, { 163, 170, 46 },
+	{ 163, 191, 63 }, { 164, 164, 42 }, { 164, 167, 41 }, { 165, 165, 40 }, { 165, 165, 39 }, { 165, 166, 38 },
+	{ 165, 166, 103 }, { 165, 167, 60 }, { 165, 172, 61 }, { 165, 176, 69 }, { 166, 166, 37 }, { 166, 170, 131 },
+	{ 166, 172, 152 }, { 166, 173, 36 }, { 166, 176, 35 }, { 167, 168, 44 }, { 167, 168, 59 }, { 167, 169, 34 },
+	{ 167, 171, 50 }, { 167, 171, 139 }, { 168, 168, 40 }, { 168, 169, 37 }, { 168, 169, 143 }, { 169, 169, 91 },
+	{ 169, 173, 60 }, { 169, 174, 33 }, { 170, 173, 140 }, { 170, 173, 32 }, { 170, 173, 59 }, { 170, 176, 64 },
+	{ 171, 171, 31 }, { 171, 172, 30 }, { 171, 173, 143 }, { 171, 179, 102 }, { 171, 179, 29 }, { 172, 172, 103 },
+	{ 172, 173, 118 }, { 172, 175, 28 }, { 172, 179, 27 }, { 173, 173, 31 }, { 173, 173, 40 }, { 173, 173, 73 },
+	{ 173, 173, 37 }, { 173, 176, 26 }, { 173, 180, 139 }, { 175, 175, 25 }, { 175, 177, 24 }, { 175, 177, 23 },
+	{ 175, 177, 37 }, { 175, 183, 22 }, { 176, 176, 21 }, { 176, 176, 78 }, { 176, 177, 20 }, { 176, 177, 114 },
+	{ 176, 180, 19 }, { 176, 180, 152 }, { 176, 181, 31 }, { 176, 182, 18 }, { 176, 182, 17 }, { 176, 189, 16 },
+	{ 176, 191, 68 }, { 177, 177, 15 }, { 177, 177, 14 }, { 177, 178, 33 }, { 177, 180, 57 }, { 177, 182, 13 },
+	{ 177, 190, 12 }, { 178, 178, 44 }, { 178, 179, 64 }, { 178, 179, 66 }, { 178, 180, 21 }, { 178, 180, 65 },
+	{ 178, 181, 11 }, { 178, 183, 26 }, { 179, 179, 10 }, { 179, 179, 137 }, { 179, 180, 9 }, { 179, 182, 144 },
+	{ 179, 184, 104 }, { 179, 184, 8 }, { 179, 186, 7 }, { 179, 188, 61 }, { 180, 180, 24 }, { 180, 180, 73 },
+	{ 180, 180, 135 }, { 180, 181, 6 }, { 180, 186, 14 }, { 180, 188, 15 }, { 180, 189, 25 }, { 181, 181, 126 },
+	{ 181, 181, 56 }, { 181, 181, 114 }, { 181, 182, 64 }, { 181, 182, 33 }, { 182, 182, 118 }, { 182, 183, 24 },
+	{ 182, 183, 27 }, { 182, 185, 137 }, { 182, 186, 5 }, { 182, 186, 135 }, { 182, 190, 145 }, { 183, 183, 31 },
+	{ 183, 183, 56 }, { 183, 184, 21 }, { 183, 189, 6 }, { 184, 185, 73 }, { 184, 186, 110 }, { 184, 189, 17 },
+	{ 184, 191, 4 }, { 184, 191, 119 }, { 185, 185, 56 }, { 185, 186, 22 }, { 185, 186, 144 }, { 185, 186, 26 },
+	{ 185, 187, 44 }, { 186, 186, 13 }, { 186, 186, 8 }, { 186, 186, 136 }, { 186, 191, 106 }, { 187, 188, 3 },
+	{ 187, 188, 142 }, { 187, 190, 104 }, { 187, 191, 122 }, { 187, 191, 34 }, { 187, 191, 121 }, { 188, 188, 96 },
+	{ 188, 188, 135 }, { 188, 188, 116 }, { 188, 188, 113 }, { 188, 188, 115 }, { 188, 188, 136 }, { 188, 189, 13 },
+	{ 188, 189, 11 }, { 188, 189, 137 }, { 189, 189, 7 }, { 189, 189, 2 }, { 189, 189, 29 }, { 189, 190, 26 },
+	{ 190, 190, 3 }, { 190, 190, 24 }, { 190, 190, 107 }, { 190, 191, 21 }, { 190, 191, 147 }, { 191, 191, 13 },
+	{ 191, 191, 17 }, { 191, 191, 7 }, { 191, 191, 11 }, { 191, 191, 8 }, { 191, 191, 130 }, { 191, 191, 110 },
+	{ 191, 191, 93 }, { 191, 191, 1 }, { 191, 191, 16 }, { 191, 191, 61 }, { 191, 191, 116 }, { 191, 191, 67 },
+	{ 181, 181, 70 }, { 135, 135, 111 }, { 164, 164, 155 }, { 144, 144, 155 }, { 141, 141, 111 }, { 158, 158, 151 },
+	{ 152, 152, 155 }, { 146, 146, 155 }, { 187, 187, 155 }, { 133, 133, 155 }, { 150, 150, 155 }, { 189, 189, 149 },
+	{ 180, 180, 155 }, { 184, 184, 149 }, { 186, 186, 149 }, { 170, 170, 151 }, { 176, 176, 155 }, { 132, 132, 132 },
+	{ 172, 172, 77 }, { 171, 171, 77 }, { 155, 155, 138 }, { 170, 170, 138 }, { 160, 160, 155 }, { 179, 179, 70 },
+	{ 136, 136, 155 }, { 153, 153, 138 }, { 128, 128, 151 }, { 176, 176, 151 }, { 139, 139, 132 }, { 223, 223, 0 },
+	{ 186, 186, 111 }, { 154, 154, 155 }, { 128, 128, 55 }, { 168, 168, 138 }, { 133, 133, 141 }, { 222, 222, 0 },
+	{ 164, 164, 138 }, { 175, 175, 151 }, { 171, 171, 111 }, { 167, 167, 138 }, { 175, 175, 138 }, { 180, 180, 111 },
+	{ 191, 191, 77 }, { 183, 183, 70 }, { 164, 164, 151 }, { 139, 139, 111 }, { 139, 139, 155 }, { 154, 154, 138 },
+	{ 172, 172, 128 }, { 141, 141, 151 }, { 156, 156, 155 }, { 178, 178, 52 }, { 155, 155, 156 }, { 161, 161, 149 },
+	{ 130, 130, 55 }, { 227, 227, 0 }, { 188, 188, 149 }, { 129, 129, 151 }, { 168, 168, 151 }, { 219, 219, 0 },
+	{ 160, 160, 149 }, { 169, 169, 151 }, { 167, 167, 155 }, { 163, 163, 149 }, { 178, 178, 155 }, { 156, 156, 151 },
+	{ 157, 157, 151 }, { 214, 214, 0 }, { 220, 220, 0 }, { 131, 131, 70 }, { 226, 226, 0 }, { 216, 216, 0 },
+	{ 163, 163, 132 }, { 179, 179, 151 }, { 182, 182, 155 }, { 190, 190, 77 }, { 189, 189, 77 }, { 150, 150, 156 },
+	{ 217, 217, 0 }, { 160, 160, 151 }, { 170, 170, 155 }, { 183, 183, 149 }, { 135, 135, 155 }, { 187, 187, 149 },
+	{ 165, 165, 138 }, { 185, 185, 149 }, { 169, 169, 155 }, { 189, 189, 111 }, { 179, 179, 149 }, { 191, 191, 149 },
+	{ 159, 159, 151 }, { 162, 162, 151 }, { 165, 165, 132 }, { 163, 163, 138 }, { 170, 170, 141 }, { 210, 210, 0 },
+	{ 169, 169, 138 }, { 165, 165, 155 }, { 145, 145, 155 }, { 137, 137, 141 }, { 174, 174, 149 }, { 130, 130, 151 },
+	{ 173, 173, 151 }, { 160, 160, 138 }, { 168, 168, 155 }, { 165, 165, 149 }, { 171, 171, 149 }, { 167, 167, 149 },
+	{ 173, 173, 149 }, { 181, 181, 149 }, { 168, 168, 111 }, { 144, 144, 156 }, { 215, 215, 0 }, { 168, 168, 149 },
+	{ 170, 170, 149 }, { 169, 169, 149 }, { 166, 166, 149 }, { 172, 172, 149 }, { 178, 178, 149 }, { 182, 182, 149 },
+	{ 171, 171, 138 }, { 128, 128, 155 }, { 132, 134, 124 }, { 204, 204, 0 }, { 183, 183, 151 }, { 168, 168, 141 },
+	{ 135, 135, 124 }, { 205, 205, 0 }, { 160, 160, 125 }, { 243, 243, 0 }, { 169, 169, 141 }, { 184, 184, 128 },
+	{ 239, 239, 0 }, { 221, 221, 0 }, { 129, 129, 155 }, { 128, 128, 132 }, { 158, 158, 156 }, { 181, 181, 155 },
+	{ 190, 190, 149 }, { 172, 172, 151 }, { 164, 164, 149 }, { 166, 166, 138 }, { 234, 234, 0 }, { 132, 132, 155 },
+	{ 134, 134, 141 }, { 157, 157, 156 }, { 140, 140, 155 }, { 180, 180, 149 }, { 174, 174, 151 }, { 130, 130, 155 },
+	{ 134, 134, 155 }, { 175, 175, 149 }, { 176, 176, 149 }, { 177, 177, 149 }, { 224, 224, 0 }, { 153, 153, 155 },
+	{ 171, 171, 151 }, { 225, 225, 0 }, { 141, 141, 155 }, { 147, 147, 155 }, { 151, 151, 155 }, { 145, 145, 156 },
+	{ 240, 240, 0 },
+};
+static const uint16_t Modi_forward_state[] = {
+	0, 1, 2, 4, 6, 7,
+};
+static const UTF8Range Modi_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 152, 152, 4 }, { 153, 153, 3 }, { 128, 132, 0 }, { 144, 153, 0 },
+	{ 128, 191, 0 },
+};
+static const uint16_t Modi_reverse_state[] = {
+	0, 3, 4, 5, 6, 7,
+};
+static const UTF8Range Modi_reverse_range[] = {
+	{ 128, 132, 2 }, { 128, 191, 1 }, { 144, 153, 2 }, { 152, 152, 3 }, { 153, 153, 3 }, { 145, 145, 4 },
+	{ 240, 240, 0 },
+};
+static const uint16_t Mongolian_forward_state[] = {
+	0, 2, 3, 4, 5, 8, 9, 10, 15,
+};
+static const UTF8Range Mongolian_forward_range[] = {
+	{ 225, 225, 4 }, { 240, 240, 1 }, { 145, 145, 2 }, { 153, 153, 3 }, { 160, 172, 0 }, { 160, 160, 7 },
+	{ 161, 161, 6 }, { 162, 162, 5 }, { 128, 170, 0 }, { 128, 184, 0 }, { 128, 129, 0 }, { 132, 132, 0 },
+	{ 134, 142, 0 }, { 144, 153, 0 }, { 160, 191, 0 },
+};
+static const uint16_t Mongolian_reverse_state[] = {
+	0, 8, 9, 10, 11, 12, 13, 14, 15,
+};
+static const UTF8Range Mongolian_reverse_range[] = {
+	{ 128, 129, 6 }, { 128, 170, 5 }, { 128, 184, 4 }, { 132, 132, 6 }, { 134, 142, 6 }, { 144, 153, 6 },
+	{ 160, 172, 1 }, { 160, 191, 6 }, { 153, 153, 2 }, { 145, 145, 3 }, { 240, 240, 0 }, { 161, 161, 7 },
+	{ 162, 162, 7 }, { 160, 160, 7 }, { 225, 225, 0 },
+};
+static const uint16_t Mro_forward_state[] = {
+	0, 1, 2, 3, 6,
+};
+static const UTF8Range Mro_forward_range[] = {
+	{ 240, 240, 1 }, { 150, 150, 2 }, { 169, 169, 3 }, { 128, 158, 0 }, { 160, 169, 0 }, { 174, 175, 0 },
+};
+static const uint16_t Mro_reverse_state[] = {
+	0, 3, 4, 5, 6,
+};
+static const UTF8Range Mro_reverse_range[] = {
+	{ 128, 158, 1 }, { 160, 169, 1 }, { 174, 175, 1 }, { 169, 169, 2 }, { 150, 150, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Multani_forward_state[] = {
+	0, 1, 2, 3, 8,
+};
+static const UTF8Range Multani_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 138, 138, 3 }, { 128, 134, 0 }, { 136, 136, 0 }, { 138, 141, 0 },
+	{ 143, 157, 0 }, { 159, 169, 0 },
+};
+static const uint16_t Multani_reverse_state[] = {
+	0, 5, 6, 7, 8,
+};
+static const UTF8Range Multani_reverse_range[] = {
+	{ 128, 134, 1 }, { 136, 136, 1 }, { 138, 141, 1 }, { 143, 157, 1 }, { 159, 169, 1 }, { 138, 138, 2 },
+	{ 145, 145, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Myanmar_forward_state[] = {
+	0, 2, 4, 5, 6, 8, 9, 10,
+};
+static const UTF8Range Myanmar_forward_range[] = {
+	{ 225, 225, 4 }, { 234, 234, 1 }, { 167, 167, 3 }, { 169, 169, 2 }, { 160, 191, 0 }, { 160, 190, 0 },
+	{ 128, 129, 6 }, { 130, 130, 5 }, { 128, 159, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Myanmar_reverse_state[] = {
+	0, 4, 5, 6, 7, 8, 9, 10,
+};
+static const UTF8Range Myanmar_reverse_range[] = {
+	{ 128, 159, 5 }, { 128, 191, 4 }, { 160, 190, 2 }, { 160, 191, 1 }, { 169, 169, 3 }, { 167, 167, 3 },
+	{ 234, 234, 0 }, { 128, 129, 6 }, { 130, 130, 6 }, { 225, 225, 0 },
+};
+static const uint16_t N_forward_state[] = {
+	0, 12, 19, 21, 22, 29, 31, 34, 35, 36, 39, 40,
+	41, 44, 45, 47, 49, 50, 51, 67, 68, 69, 70, 71,
+	73, 74, 99, 100, 101, 102, 103, 104, 105, 107, 108, 109,
+	111, 113, 114, 115, 116, 117, 119, 120, 122, 123, 124, 125,
+	126, 127, 128, 136, 138, 139, 144, 146, 148, 149, 152, 162,
+	163, 164, 165, 166, 167, 168, 170, 171, 173, 185, 187, 188,
+	189, 191, 192, 193, 206, 207, 208, 210, 212, 213, 215, 217,
+	218, 219, 220, 221, 224,
+};
+static const UTF8Range N_forward_range[] = {
+	{ 48, 57, 0 }, { 194, 194, 87 }, { 217, 217, 86 }, { 219, 219, 85 }, { 223, 223, 84 }, { 224, 224, 75 },
+	{ 225, 225, 68 }, { 226, 226, 58 }, { 227, 227, 53 }, { 234, 234, 50 }, { 239, 239, 49 }, { 240, 240, 1 },
+	{ 144, 144, 25 }, { 145, 145, 18 }, { 146, 146, 15 }, { 150, 150, 12 }, { 157, 157, 9 }, { 158, 158, 4 },
+	{ 159, 159, 2 }, { 132, 132, 3 }, { 175, 175, 85 }, { 128, 140, 0 }, { 133, 133, 84 }, { 139, 139, 85 },
+	{ 163, 163, 8 }, { 165, 165, 77 }, { 177, 177, 7 }, { 178, 178, 6 }, { 180, 180, 5 }, { 129, 173, 0 },
+	{ 175, 189, 0 }, { 128, 171, 0 }, { 173, 175, 0 }, { 177, 180, 0 }, { 177, 191, 0 }, { 135, 143, 0 },
+	{ 139, 139, 76 }, { 141, 141, 11 }, { 159, 159, 10 }, { 142, 191, 0 }, { 160, 184, 0 }, { 169, 169, 86 },
+	{ 173, 173, 14 }, { 186, 186, 13 }, { 128, 150, 0 }, { 144, 153, 0 }, { 155, 161, 0 }, { 144, 144, 17 },
+	{ 145, 145, 16 }, { 128, 174, 0 }, { 128, 191, 0 }, { 129, 129, 24 }, { 131, 131, 85 }, { 132, 132, 61 },
+	{ 135, 135, 23 }, { 139, 139, 85 }, { 145, 145, 77 }, { 147, 147, 77 }, { 153, 153, 77 }, { 155, 155, 84 },
+	{ 156, 156, 22 }, { 163, 163, 21 }, { 165, 165, 77 }, { 177, 177, 20 }, { 181, 181, 77 }, { 182, 182, 86 },
+	{ 191, 191, 19 }, { 128, 148, 0 }, { 144, 172, 0 }, { 160, 178, 0 }, { 176, 187, 0 }, { 144, 153, 0 },
+	{ 161, 180, 0 }, { 146, 175, 0 }, { 132, 132, 48 }, { 133, 133, 47 }, { 134, 134, 46 }, { 139, 139, 45 },
+	{ 140, 140, 44 }, { 141, 141, 43 }, { 143, 143, 42 }, { 146, 146, 86 }, { 161, 161, 41 }, { 162, 162, 40 },
+	{ 163, 163, 39 }, { 164, 164, 38 }, { 166, 166, 37 }, { 167, 167, 36 }, { 169, 169, 35 }, { 170, 170, 34 },
+	{ 171, 171, 33 }, { 173, 173, 32 }, { 174, 174, 31 }, { 179, 179, 30 }, { 180, 180, 85 }, { 185, 185, 29 },
+	{ 188, 188, 28 }, { 189, 189, 27 }, { 191, 191, 26 }, { 133, 139, 0 }, { 145, 148, 0 }, { 157, 166, 0 },
+	{ 160, 190, 0 }, { 186, 191, 0 }, { 169, 175, 0 }, { 152, 159, 0 }, { 184, 191, 0 }, { 171, 175, 0 },
+	{ 157, 159, 0 }, { 128, 136, 0 }, { 189, 190, 0 }, { 128, 143, 0 }, { 146, 191, 0 }, { 188, 189, 0 },
+	{ 150, 155, 0 }, { 187, 191, 0 }, { 167, 175, 0 }, { 152, 159, 0 }, { 185, 191, 0 }, { 145, 149, 0 },
+	{ 129, 129, 0 }, { 138, 138, 0 }, { 160, 163, 0 }, { 161, 187, 0 }, { 138, 139, 0 }, { 128, 184, 0 },
+	{ 135, 179, 0 }, { 188, 188, 77 }, { 152, 152, 86 }, { 155, 155, 83 }, { 160, 160, 52 }, { 163, 163, 77 },
+	{ 164, 164, 84 }, { 167, 167, 51 }, { 169, 169, 77 }, { 175, 175, 85 }, { 144, 153, 0 }, { 176, 185, 0 },
+	{ 176, 181, 0 }, { 128, 128, 57 }, { 134, 134, 56 }, { 136, 136, 86 }, { 137, 137, 55 }, { 138, 138, 54 },
+	{ 128, 137, 0 }, { 177, 191, 0 }, { 136, 143, 0 }, { 145, 159, 0 }, { 146, 149, 0 }, { 135, 135, 0 },
+	{ 161, 169, 0 }, { 184, 186, 0 }, { 129, 129, 67 }, { 130, 130, 84 }, { 133, 133, 66 }, { 134, 134, 65 },
+	{ 145, 145, 64 }, { 146, 146, 63 }, { 147, 147, 62 }, { 157, 157, 61 }, { 158, 158, 60 }, { 179, 179, 59 },
+	{ 189, 189, 0 }, { 128, 147, 0 }, { 182, 191, 0 }, { 170, 191, 0 }, { 128, 155, 0 }, { 160, 191, 0 },
+	{ 128, 130, 0 }, { 133, 137, 0 }, { 144, 191, 0 }, { 176, 176, 0 }, { 180, 185, 0 }, { 129, 129, 84 },
+	{ 130, 130, 77 }, { 141, 141, 74 }, { 155, 155, 73 }, { 159, 159, 72 }, { 160, 160, 77 }, { 165, 165, 71 },
+	{ 167, 167, 70 }, { 170, 170, 69 }, { 173, 173, 77 }, { 174, 174, 85 }, { 177, 177, 69 }, { 128, 137, 0 },
+	{ 144, 153, 0 }, { 144, 154, 0 }, { 134, 143, 0 }, { 160, 169, 0 }, { 176, 185, 0 }, { 174, 176, 0 },
+	{ 169, 188, 0 }, { 165, 165, 83 }, { 167, 167, 82 }, { 169, 169, 83 }, { 171, 171, 83 }, { 173, 173, 81 },
+	{ 175, 175, 80 }, { 177, 177, 79 }, { 179, 179, 83 }, { 181, 181, 78 }, { 183, 183, 83 }, { 185, 185, 77 },
+	{ 187, 187, 77 }, { 188, 188, 76 }, { 160, 179, 0 }, { 144, 153, 0 }, { 152, 158, 0 }, { 166, 184, 0 },
+	{ 166, 175, 0 }, { 184, 190, 0 }, { 166, 178, 0 }, { 166, 175, 0 }, { 178, 183, 0 }, { 166, 175, 0 },
+	{ 180, 185, 0 }, { 166, 175, 0 }, { 128, 137, 0 }, { 176, 185, 0 }, { 160, 169, 0 }, { 178, 179, 0 },
+	{ 185, 185, 0 }, { 188, 190, 0 },
+};
+static const uint16_t N_reverse_state[] = {
+	0, 99, 100, 101, 102, 103, 105, 106, 107, 108, 116, 117,
+	118, 119, 120, 121, 122, 123, 124, 125, 131, 132, 133, 134,
+	135, 136, 137, 138, 140, 141, 147, 148, 149, 150, 151, 152,
+	153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 176, 177,
+	178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189,
+	190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201,
+	202, 203, 204, 205, 211, 212, 213, 214, 216, 217, 218, 219,
+	220, 221, 222, 223, 224,
+};
+static const UTF8Range N_reverse_range[] = {
+	{ 48, 57, 0 }, { 128, 130, 86 }, { 128, 136, 83 }, { 128, 137, 81 }, { 128, 137, 79 }, { 128, 137, 75 },
+	{ 128, 140, 73 }, { 128, 143, 72 }, { 128, 147, 71 }, { 128, 148, 70 }, { 128, 150, 68 }, { 128, 155, 67 },
+	{ 128, 171, 66 }, { 128, 174, 64 }, { 128, 184, 63 }, { 128, 191, 62 }, { 129, 129, 61 }, { 129, 173, 60 },
+	{ 133, 137, 86 }, { 133, 139, 59 }, { 134, 143, 58 }, { 135, 135, 57 }, { 135, 143, 56 }, { 135, 179, 55 },
+	{ 136, 143, 54 }, { 138, 138, 61 }, { 138, 139, 53 }, { 142, 191, 51 }, { 144, 153, 50 }, { 144, 153, 49 },
+	{ 144, 153, 48 }, { 144, 153, 79 }, { 144, 153, 45 }, { 144, 154, 44 }, { 144, 172, 43 }, { 144, 191, 42 },
+	{ 145, 148, 41 }, { 145, 149, 40 }, { 145, 159, 54 }, { 146, 149, 39 }, { 146, 175, 38 }, { 146, 191, 72 },
+	{ 150, 155, 37 }, { 152, 158, 36 }, { 152, 159, 35 }, { 152, 159, 34 }, { 155, 161, 50 }, { 157, 159, 33 },
+	{ 157, 166, 32 }, { 160, 163, 31 }, { 160, 169, 30 }, { 160, 169, 29 }, { 160, 178, 28 }, { 160, 179, 27 },
+	{ 160, 184, 26 }, { 160, 190, 25 }, { 160, 191, 24 }, { 161, 169, 57 }, { 161, 180, 49 }, { 161, 187, 23 },
+	{ 166, 175, 22 }, { 166, 175, 21 }, { 166, 175, 20 }, { 166, 175, 19 }, { 166, 178, 18 }, { 166, 184, 36 },
+	{ 167, 175, 17 }, { 169, 175, 16 }, { 169, 188, 15 }, { 170, 191, 14 }, { 171, 175, 13 }, { 173, 175, 66 },
+	{ 174, 176, 12 }, { 175, 189, 60 }, { 176, 176, 11 }, { 176, 181, 10 }, { 176, 185, 48 }, { 176, 185, 30 },
+	{ 176, 185, 9 }, { 176, 187, 8 }, { 177, 180, 66 }, { 177, 191, 7 }, { 177, 191, 81 }, { 178, 179, 6 },
+	{ 178, 183, 21 }, { 180, 185, 11 }, { 180, 185, 20 }, { 182, 191, 5 }, { 184, 186, 57 }, { 184, 190, 22 },
+	{ 184, 191, 35 }, { 185, 185, 6 }, { 185, 191, 34 }, { 186, 191, 4 }, { 187, 191, 3 }, { 188, 189, 2 },
+	{ 188, 190, 6 }, { 189, 189, 1 }, { 189, 190, 83 }, { 179, 179, 87 }, { 166, 166, 84 }, { 163, 163, 84 },
+	{ 179, 179, 84 }, { 132, 132, 77 }, { 157, 157, 87 }, { 194, 194, 0 }, { 177, 177, 78 }, { 156, 156, 77 },
+	{ 131, 131, 77 }, { 139, 139, 78 }, { 139, 139, 77 }, { 174, 174, 80 }, { 175, 175, 74 }, { 175, 175, 76 },
+	{ 180, 180, 84 }, { 219, 219, 0 }, { 160, 160, 76 }, { 129, 129, 87 }, { 155, 155, 80 }, { 171, 171, 84 },
+	{ 147, 147, 87 }, { 141, 141, 80 }, { 174, 174, 84 }, { 162, 162, 84 }, { 175, 175, 47 }, { 155, 155, 76 },
+	{ 165, 165, 47 }, { 169, 169, 47 }, { 171, 171, 47 }, { 179, 179, 47 }, { 183, 183, 47 }, { 167, 167, 47 },
+	{ 173, 173, 47 }, { 177, 177, 47 }, { 139, 139, 84 }, { 145, 145, 87 }, { 185, 185, 84 }, { 141, 141, 52 },
+	{ 139, 139, 52 }, { 188, 188, 47 }, { 163, 163, 77 }, { 136, 136, 82 }, { 146, 146, 84 }, { 152, 152, 76 },
+	{ 169, 169, 69 }, { 182, 182, 77 }, { 217, 217, 0 }, { 159, 159, 80 }, { 140, 140, 84 }, { 188, 188, 84 },
+	{ 170, 170, 84 }, { 161, 161, 84 }, { 173, 173, 84 }, { 181, 181, 47 }, { 164, 164, 84 }, { 129, 129, 77 },
+	{ 134, 134, 82 }, { 143, 143, 84 }, { 189, 189, 84 }, { 133, 133, 87 }, { 177, 177, 77 }, { 167, 167, 80 },
+	{ 130, 130, 80 }, { 145, 145, 77 }, { 147, 147, 77 }, { 153, 153, 77 }, { 160, 160, 80 }, { 163, 163, 76 },
+	{ 165, 165, 78 }, { 165, 165, 77 }, { 169, 169, 76 }, { 173, 173, 80 }, { 181, 181, 77 }, { 185, 185, 47 },
+	{ 187, 187, 47 }, { 188, 188, 46 }, { 239, 239, 0 }, { 224, 224, 0 }, { 167, 167, 76 }, { 135, 135, 77 },
+	{ 173, 173, 69 }, { 159, 159, 52 }, { 157, 157, 85 }, { 134, 134, 84 }, { 137, 137, 82 }, { 132, 132, 84 },
+	{ 163, 163, 78 }, { 128, 128, 82 }, { 165, 165, 80 }, { 191, 191, 84 }, { 180, 180, 78 }, { 141, 141, 84 },
+	{ 144, 144, 65 }, { 133, 133, 84 }, { 145, 145, 65 }, { 146, 146, 85 }, { 178, 178, 78 }, { 146, 146, 87 },
+	{ 186, 186, 69 }, { 150, 150, 85 }, { 191, 191, 77 }, { 158, 158, 87 }, { 167, 167, 84 }, { 132, 132, 74 },
+	{ 159, 159, 85 }, { 129, 129, 80 }, { 130, 130, 87 }, { 133, 133, 78 }, { 155, 155, 77 }, { 164, 164, 76 },
+	{ 223, 223, 0 }, { 234, 234, 0 }, { 145, 145, 85 }, { 158, 158, 85 }, { 170, 170, 80 }, { 177, 177, 80 },
+	{ 225, 225, 0 }, { 138, 138, 82 }, { 227, 227, 0 }, { 169, 169, 84 }, { 144, 144, 85 }, { 240, 240, 0 },
+	{ 134, 134, 87 }, { 226, 226, 0 },
+};
+static const uint16_t Nabataean_forward_state[] = {
+	0, 1, 2, 3, 5,
+};
+static const UTF8Range Nabataean_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 162, 162, 3 }, { 128, 158, 0 }, { 167, 175, 0 },
+};
+static const uint16_t Nabataean_reverse_state[] = {
+	0, 2, 3, 4, 5,
+};
+static const UTF8Range Nabataean_reverse_range[] = {
+	{ 128, 158, 1 }, { 167, 175, 1 }, { 162, 162, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Nandinagari_forward_state[] = {
+	0, 1, 2, 4, 6, 8,
+};
+static const UTF8Range Nandinagari_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 166, 166, 4 }, { 167, 167, 3 }, { 128, 151, 0 }, { 154, 164, 0 },
+	{ 160, 167, 0 }, { 170, 191, 0 },
+};
+static const uint16_t Nandinagari_reverse_state[] = {
+	0, 4, 5, 6, 7, 8,
+};
+static const UTF8Range Nandinagari_reverse_range[] = {
+	{ 128, 151, 2 }, { 154, 164, 2 }, { 160, 167, 1 }, { 170, 191, 1 }, { 166, 166, 3 }, { 167, 167, 3 },
+	{ 145, 145, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Nd_forward_state[] = {
+	0, 9, 15, 16, 19, 20, 21, 23, 38, 39, 41, 42,
+	48, 50, 60, 62, 63, 76, 77, 78, 79, 80, 81,
+};
+static const UTF8Range Nd_forward_range[] = {
+	{ 48, 57, 0 }, { 217, 217, 21 }, { 219, 219, 20 }, { 223, 223, 19 }, { 224, 224, 16 }, { 225, 225, 13 },
+	{ 234, 234, 11 }, { 239, 239, 10 }, { 240, 240, 1 }, { 144, 144, 9 }, { 145, 145, 7 }, { 150, 150, 6 },
+	{ 157, 157, 4 }, { 158, 158, 3 }, { 159, 159, 2 }, { 175, 175, 20 }, { 133, 133, 19 }, { 139, 139, 20 },
+	{ 165, 165, 17 }, { 159, 159, 5 }, { 142, 191, 0 }, { 169, 169, 21 }, { 173, 173, 17 }, { 129, 129, 18 },
+	{ 131, 131, 20 }, { 132, 132, 8 }, { 135, 135, 17 }, { 139, 139, 20 }, { 145, 145, 17 }, { 147, 147, 17 },
+	{ 153, 153, 17 }, { 155, 155, 19 }, { 156, 156, 20 }, { 163, 163, 21 }, { 165, 165, 17 }, { 177, 177, 17 },
+	{ 181, 181, 17 }, { 182, 182, 21 }, { 182, 191, 0 }, { 146, 146, 21 }, { 180, 180, 20 }, { 188, 188, 17 },
+	{ 152, 152, 21 }, { 163, 163, 17 }, { 164, 164, 19 }, { 167, 167, 12 }, { 169, 169, 17 }, { 175, 175, 20 },
+	{ 144, 153, 0 }, { 176, 185, 0 }, { 129, 129, 19 }, { 130, 130, 17 }, { 159, 159, 21 }, { 160, 160, 17 },
+	{ 165, 165, 15 }, { 167, 167, 17 }, { 170, 170, 14 }, { 173, 173, 17 }, { 174, 174, 20 }, { 177, 177, 14 },
+	{ 128, 137, 0 }, { 144, 153, 0 }, { 134, 143, 0 }, { 165, 165, 18 }, { 167, 167, 18 }, { 169, 169, 18 },
+	{ 171, 171, 18 }, { 173, 173, 18 }, { 175, 175, 18 }, { 177, 177, 18 }, { 179, 179, 18 }, { 181, 181, 18 },
+	{ 183, 183, 18 }, { 185, 185, 17 }, { 187, 187, 17 }, { 188, 188, 21 }, { 144, 153, 0 }, { 166, 175, 0 },
+	{ 128, 137, 0 }, { 176, 185, 0 }, { 160, 169, 0 },
+};
+static const uint16_t Nd_reverse_state[] = {
+	0, 13, 14, 23, 24, 35, 43, 44, 62, 63, 64, 65,
+	66, 67, 68, 69, 74, 75, 76, 77, 78, 80, 81,
+};
+static const UTF8Range Nd_reverse_range[] = {
+	{ 48, 57, 0 }, { 128, 137, 20 }, { 128, 137, 15 }, { 134, 143, 14 }, { 142, 191, 12 }, { 144, 153, 11 },
+	{ 144, 153, 20 }, { 144, 153, 7 }, { 160, 169, 5 }, { 166, 175, 4 }, { 176, 185, 11 }, { 176, 185, 2 },
+	{ 182, 191, 1 }, { 132, 132, 17 }, { 131, 131, 17 }, { 139, 139, 18 }, { 139, 139, 17 }, { 156, 156, 17 },
+	{ 174, 174, 21 }, { 175, 175, 3 }, { 175, 175, 16 }, { 180, 180, 6 }, { 219, 219, 0 }, { 159, 159, 19 },
+	{ 129, 129, 17 }, { 165, 165, 9 }, { 167, 167, 9 }, { 169, 169, 9 }, { 171, 171, 9 }, { 173, 173, 9 },
+	{ 175, 175, 9 }, { 177, 177, 9 }, { 179, 179, 9 }, { 181, 181, 9 }, { 183, 183, 9 }, { 146, 146, 6 },
+	{ 152, 152, 16 }, { 159, 159, 21 }, { 163, 163, 17 }, { 169, 169, 10 }, { 182, 182, 17 }, { 188, 188, 9 },
+	{ 217, 217, 0 }, { 144, 144, 19 }, { 130, 130, 21 }, { 135, 135, 17 }, { 145, 145, 17 }, { 147, 147, 17 },
+	{ 153, 153, 17 }, { 160, 160, 21 }, { 163, 163, 16 }, { 165, 165, 18 }, { 165, 165, 17 }, { 167, 167, 21 },
+	{ 169, 169, 16 }, { 173, 173, 10 }, { 173, 173, 21 }, { 177, 177, 17 }, { 181, 181, 17 }, { 185, 185, 9 },
+	{ 187, 187, 9 }, { 188, 188, 8 }, { 239, 239, 0 }, { 224, 224, 0 }, { 150, 150, 19 }, { 167, 167, 16 },
+	{ 159, 159, 13 }, { 157, 157, 19 }, { 165, 165, 21 }, { 129, 129, 21 }, { 133, 133, 18 }, { 155, 155, 17 },
+	{ 164, 164, 16 }, { 223, 223, 0 }, { 234, 234, 0 }, { 145, 145, 19 }, { 158, 158, 19 }, { 240, 240, 0 },
+	{ 170, 170, 21 }, { 177, 177, 21 }, { 225, 225, 0 },
+};
+static const uint16_t New_Tai_Lue_forward_state[] = {
+	0, 1, 3, 6, 8,
+};
+static const UTF8Range New_Tai_Lue_forward_range[] = {
+	{ 225, 225, 1 }, { 166, 166, 3 }, { 167, 167, 2 }, { 128, 137, 0 }, { 144, 154, 0 }, { 158, 159, 0 },
+	{ 128, 171, 0 }, { 176, 191, 0 },
+};
+static const uint16_t New_Tai_Lue_reverse_state[] = {
+	0, 5, 6, 7, 8,
+};
+static const UTF8Range New_Tai_Lue_reverse_range[] = {
+	{ 128, 137, 2 }, { 128, 171, 1 }, { 144, 154, 2 }, { 158, 159, 2 }, { 176, 191, 1 }, { 166, 166, 3 },
+	{ 167, 167, 3 }, { 225, 225, 0 },
+};
+static const uint16_t Newa_forward_state[] = {
+	0, 1, 2, 4, 6, 7,
+};
+static const UTF8Range Newa_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 144, 144, 4 }, { 145, 145, 3 }, { 128, 155, 0 }, { 157, 161, 0 },
+	{ 128, 191, 0 },
+};
+static const uint16_t Newa_reverse_state[] = {
+	0, 3, 4, 5, 6, 7,
+};
+static const UTF8Range Newa_reverse_range[] = {
+	{ 128, 155, 2 }, { 128, 191, 1 }, { 157, 161, 2 }, { 144, 144, 3 }, { 145, 145, 3 }, { 145, 145, 4 },
+	{ 240, 240, 0 },
+};
+static const uint16_t Nko_forward_state[] = {
+	0, 1, 3,
+};
+static const UTF8Range Nko_forward_range[] = {
+	{ 223, 223, 1 }, { 128, 186, 0 }, { 189, 191, 0 },
+};
+static const uint16_t Nko_reverse_state[] = {
+	0, 2, 3,
+};
+static const UTF8Range Nko_reverse_range[] = {
+	{ 128, 186, 1 }, { 189, 191, 1 }, { 223, 223, 0 },
+};
+static const uint16_t Nl_forward_state[] = {
+	0, 5, 7, 9, 10, 11, 14, 15, 17, 18, 19, 20,
+	21, 24, 26, 28, 29, 30, 31,
+};
+static const UTF8Range Nl_forward_range[] = {
+	{ 225, 225, 16 }, { 226, 226, 13 }, { 227, 227, 11 }, { 234, 234, 9 }, { 240, 240, 1 }, { 144, 144, 5 },
+	{ 146, 146, 2 }, { 144, 144, 4 }, { 145, 145, 3 }, { 128, 174, 0 }, { 128, 191, 0 }, { 133, 133, 8 },
+	{ 141, 141, 7 }, { 143, 143, 6 }, { 145, 149, 0 }, { 129, 129, 0 }, { 138, 138, 0 }, { 128, 180, 0 },
+	{ 155, 155, 10 }, { 166, 175, 0 }, { 128, 128, 12 }, { 135, 135, 0 }, { 161, 169, 0 }, { 184, 186, 0 },
+	{ 133, 133, 15 }, { 134, 134, 14 }, { 128, 130, 0 }, { 133, 136, 0 }, { 160, 191, 0 }, { 155, 155, 17 },
+	{ 174, 176, 0 },
+};
+static const uint16_t Nl_reverse_state[] = {
+	0, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+	25, 26, 27, 28, 29, 30, 31,
+};
+static const UTF8Range Nl_reverse_range[] = {
+	{ 128, 130, 16 }, { 128, 174, 13 }, { 128, 180, 11 }, { 128, 191, 10 }, { 129, 129, 9 }, { 133, 136, 16 },
+	{ 135, 135, 7 }, { 138, 138, 9 }, { 145, 149, 6 }, { 160, 191, 5 }, { 161, 169, 7 }, { 166, 175, 3 },
+	{ 174, 176, 1 }, { 184, 186, 7 }, { 155, 155, 2 }, { 225, 225, 0 }, { 155, 155, 4 }, { 234, 234, 0 },
+	{ 133, 133, 17 }, { 143, 143, 12 }, { 128, 128, 8 }, { 227, 227, 0 }, { 141, 141, 12 }, { 144, 144, 14 },
+	{ 133, 133, 12 }, { 144, 144, 15 }, { 145, 145, 14 }, { 146, 146, 15 }, { 240, 240, 0 }, { 134, 134, 17 },
+	{ 226, 226, 0 },
+};
+static const uint16_t No_forward_state[] = {
+	0, 7, 13, 14, 15, 19, 21, 24, 25, 26, 28, 29,
+	30, 32, 33, 34, 40, 41, 42, 43, 44, 45, 46, 67,
+	68, 69, 70, 71, 72, 73, 75, 76, 77, 79, 81, 82,
+	83, 84, 85, 87, 88, 89, 90, 91, 92, 93, 94, 98,
+	100, 102, 103, 104, 114, 115, 116, 117, 118, 119, 120, 121,
+	122, 123, 125, 128, 129, 130, 131, 137, 138, 140, 141, 142,
+	143, 144, 147,
+};
+static const UTF8Range No_forward_range[] = {
+	{ 194, 194, 73 }, { 224, 224, 66 }, { 225, 225, 62 }, { 226, 226, 51 }, { 227, 227, 46 }, { 234, 234, 44 },
+	{ 240, 240, 1 }, { 144, 144, 22 }, { 145, 145, 15 }, { 150, 150, 12 }, { 157, 157, 9 }, { 158, 158, 4 },
+	{ 159, 159, 2 }, { 132, 132, 3 }, { 128, 140, 0 }, { 163, 163, 8 }, { 177, 177, 7 }, { 178, 178, 6 },
+	{ 180, 180, 5 }, { 129, 173, 0 }, { 175, 189, 0 }, { 128, 171, 0 }, { 173, 175, 0 }, { 177, 180, 0 },
+	{ 177, 191, 0 }, { 135, 143, 0 }, { 139, 139, 11 }, { 141, 141, 10 }, { 160, 184, 0 }, { 160, 179, 0 },
+	{ 173, 173, 14 }, { 186, 186, 13 }, { 128, 150, 0 }, { 155, 161, 0 }, { 129, 129, 21 }, { 135, 135, 20 },
+	{ 156, 156, 19 }, { 163, 163, 18 }, { 177, 177, 17 }, { 191, 191, 16 }, { 128, 148, 0 }, { 154, 172, 0 },
+	{ 170, 178, 0 }, { 186, 187, 0 }, { 161, 180, 0 }, { 146, 165, 0 }, { 132, 132, 43 }, { 133, 133, 42 },
+	{ 134, 134, 41 }, { 139, 139, 40 }, { 140, 140, 39 }, { 161, 161, 38 }, { 162, 162, 37 }, { 163, 163, 36 },
+	{ 164, 164, 35 }, { 166, 166, 34 }, { 167, 167, 33 }, { 169, 169, 32 }, { 170, 170, 31 }, { 171, 171, 30 },
+	{ 173, 173, 29 }, { 174, 174, 28 }, { 179, 179, 27 }, { 185, 185, 26 }, { 188, 188, 25 }, { 189, 189, 24 },
+	{ 191, 191, 23 }, { 133, 139, 0 }, { 145, 148, 0 }, { 157, 166, 0 }, { 160, 190, 0 }, { 186, 191, 0 },
+	{ 169, 175, 0 }, { 152, 159, 0 }, { 184, 191, 0 }, { 171, 175, 0 }, { 157, 159, 0 }, { 128, 136, 0 },
+	{ 189, 190, 0 }, { 128, 143, 0 }, { 146, 191, 0 }, { 188, 189, 0 }, { 150, 155, 0 }, { 187, 191, 0 },
+	{ 167, 175, 0 }, { 152, 159, 0 }, { 185, 191, 0 }, { 160, 163, 0 }, { 161, 187, 0 }, { 138, 139, 0 },
+	{ 181, 184, 0 }, { 135, 179, 0 }, { 160, 160, 45 }, { 176, 181, 0 }, { 134, 134, 50 }, { 136, 136, 49 },
+	{ 137, 137, 48 }, { 138, 138, 47 }, { 128, 137, 0 }, { 177, 191, 0 }, { 136, 143, 0 }, { 145, 159, 0 },
+	{ 160, 169, 0 }, { 146, 149, 0 }, { 129, 129, 61 }, { 130, 130, 60 }, { 133, 133, 59 }, { 134, 134, 58 },
+	{ 145, 145, 57 }, { 146, 146, 56 }, { 147, 147, 55 }, { 157, 157, 54 }, { 158, 158, 53 }, { 179, 179, 52 },
+	{ 189, 189, 0 }, { 128, 147, 0 }, { 182, 191, 0 }, { 170, 191, 0 }, { 128, 155, 0 }, { 160, 191, 0 },
+	{ 137, 137, 0 }, { 144, 159, 0 }, { 128, 137, 0 }, { 176, 176, 0 }, { 180, 185, 0 }, { 141, 141, 65 },
+	{ 159, 159, 64 }, { 167, 167, 63 }, { 154, 154, 0 }, { 176, 185, 0 }, { 169, 188, 0 }, { 167, 167, 72 },
+	{ 173, 173, 71 }, { 175, 175, 70 }, { 177, 177, 69 }, { 181, 181, 68 }, { 188, 188, 67 }, { 170, 179, 0 },
+	{ 152, 158, 0 }, { 176, 184, 0 }, { 184, 190, 0 }, { 176, 178, 0 }, { 178, 183, 0 }, { 180, 185, 0 },
+	{ 178, 179, 0 }, { 185, 185, 0 }, { 188, 190, 0 },
+};
+static const uint16_t No_reverse_state[] = {
+	0, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84,
+	85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96,
+	97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108,
+	109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+	121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+	133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144,
+	145, 146, 147,
+};
+static const UTF8Range No_reverse_range[] = {
+	{ 128, 136, 71 }, { 128, 137, 69 }, { 128, 137, 67 }, { 128, 140, 65 }, { 128, 143, 64 }, { 128, 147, 63 },
+	{ 128, 148, 61 }, { 128, 150, 59 }, { 128, 155, 58 }, { 128, 171, 56 }, { 129, 173, 55 }, { 133, 139, 54 },
+	{ 135, 143, 53 }, { 135, 179, 52 }, { 136, 143, 51 }, { 137, 137, 50 }, { 138, 139, 49 }, { 144, 159, 48 },
+	{ 145, 148, 47 }, { 145, 159, 51 }, { 146, 149, 46 }, { 146, 165, 45 }, { 146, 191, 64 }, { 150, 155, 44 },
+	{ 152, 158, 42 }, { 152, 159, 41 }, { 152, 159, 40 }, { 154, 154, 38 }, { 154, 172, 37 }, { 155, 161, 36 },
+	{ 157, 159, 35 }, { 157, 166, 34 }, { 160, 163, 33 }, { 160, 169, 32 }, { 160, 179, 30 }, { 160, 184, 29 },
+	{ 160, 190, 28 }, { 160, 191, 27 }, { 161, 180, 26 }, { 161, 187, 25 }, { 167, 175, 24 }, { 169, 175, 23 },
+	{ 169, 188, 22 }, { 170, 178, 21 }, { 170, 179, 20 }, { 170, 191, 19 }, { 171, 175, 18 }, { 173, 175, 56 },
+	{ 175, 189, 55 }, { 176, 176, 17 }, { 176, 178, 16 }, { 176, 181, 14 }, { 176, 184, 42 }, { 176, 185, 13 },
+	{ 177, 180, 56 }, { 177, 191, 12 }, { 177, 191, 69 }, { 178, 179, 11 }, { 178, 183, 10 }, { 180, 185, 17 },
+	{ 180, 185, 9 }, { 181, 184, 8 }, { 182, 191, 7 }, { 184, 190, 6 }, { 184, 191, 41 }, { 185, 185, 11 },
+	{ 185, 191, 40 }, { 186, 187, 5 }, { 186, 191, 4 }, { 187, 191, 3 }, { 188, 189, 2 }, { 188, 190, 11 },
+	{ 189, 189, 1 }, { 189, 190, 71 }, { 179, 179, 68 }, { 166, 166, 72 }, { 163, 163, 72 }, { 179, 179, 72 },
+	{ 156, 156, 62 }, { 177, 177, 43 }, { 157, 157, 68 }, { 133, 133, 72 }, { 167, 167, 43 }, { 173, 173, 43 },
+	{ 194, 194, 0 }, { 177, 177, 57 }, { 159, 159, 39 }, { 160, 160, 15 }, { 234, 234, 0 }, { 175, 175, 43 },
+	{ 129, 129, 68 }, { 171, 171, 72 }, { 147, 147, 68 }, { 188, 188, 43 }, { 163, 163, 62 }, { 141, 141, 39 },
+	{ 174, 174, 72 }, { 162, 162, 72 }, { 139, 139, 72 }, { 135, 135, 62 }, { 145, 145, 68 }, { 185, 185, 72 },
+	{ 141, 141, 31 }, { 139, 139, 31 }, { 157, 157, 73 }, { 136, 136, 70 }, { 140, 140, 72 }, { 188, 188, 72 },
+	{ 170, 170, 72 }, { 173, 173, 60 }, { 177, 177, 62 }, { 167, 167, 39 }, { 225, 225, 0 }, { 161, 161, 72 },
+	{ 173, 173, 72 }, { 181, 181, 43 }, { 224, 224, 0 }, { 164, 164, 72 }, { 129, 129, 62 }, { 134, 134, 70 },
+	{ 189, 189, 72 }, { 133, 133, 68 }, { 134, 134, 72 }, { 134, 134, 68 }, { 137, 137, 70 }, { 132, 132, 72 },
+	{ 163, 163, 57 }, { 191, 191, 72 }, { 180, 180, 57 }, { 178, 178, 57 }, { 158, 158, 73 }, { 146, 146, 68 },
+	{ 186, 186, 60 }, { 150, 150, 73 }, { 191, 191, 62 }, { 145, 145, 73 }, { 158, 158, 68 }, { 167, 167, 72 },
+	{ 132, 132, 66 }, { 159, 159, 73 }, { 130, 130, 68 }, { 226, 226, 0 }, { 138, 138, 70 }, { 227, 227, 0 },
+	{ 169, 169, 72 }, { 144, 144, 73 }, { 240, 240, 0 },
+};
+static const uint16_t Nushu_forward_state[] = {
+	0, 1, 3, 6, 7, 8, 9, 10, 11,
+};
+static const UTF8Range Nushu_forward_range[] = {
+	{ 240, 240, 1 }, { 150, 150, 6 }, { 155, 155, 2 }, { 133, 133, 5 }, { 134, 138, 4 }, { 139, 139, 3 },
+	{ 128, 187, 0 }, { 128, 191, 0 }, { 176, 191, 0 }, { 191, 191, 7 }, { 161, 161, 0 },
+};
+static const uint16_t Nushu_reverse_state[] = {
+	0, 4, 5, 6, 7, 8, 9, 10, 11,
+};
+static const UTF8Range Nushu_reverse_range[] = {
+	{ 128, 187, 5 }, { 128, 191, 4 }, { 161, 161, 2 }, { 176, 191, 1 }, { 133, 133, 6 }, { 191, 191, 3 },
+	{ 150, 150, 7 }, { 134, 138, 6 }, { 139, 139, 6 }, { 155, 155, 7 }, { 240, 240, 0 },
+};
+static const uint16_t Nyiakeng_Puachue_Hmong_forward_state[] = {
+	0, 1, 2, 4, 6, 8,
+};
+static const UTF8Range Nyiakeng_Puachue_Hmong_forward_range[] = {
+	{ 240, 240, 1 }, { 158, 158, 2 }, { 132, 132, 4 }, { 133, 133, 3 }, { 128, 137, 0 }, { 142, 143, 0 },
+	{ 128, 172, 0 }, { 176, 189, 0 },
+};
+static const uint16_t Nyiakeng_Puachue_Hmong_reverse_state[] = {
+	0, 4, 5, 6, 7, 8,
+};
+static const UTF8Range Nyiakeng_Puachue_Hmong_reverse_range[] = {
+	{ 128, 137, 2 }, { 128, 172, 1 }, { 142, 143, 2 }, { 176, 189, 1 }, { 132, 132, 3 }, { 133, 133, 3 },
+	{ 158, 158, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Ogham_forward_state[] = {
+	0, 1, 2, 3,
+};
+static const UTF8Range Ogham_forward_range[] = {
+	{ 225, 225, 1 }, { 154, 154, 2 }, { 128, 156, 0 },
+};
+static const uint16_t Ogham_reverse_state[] = {
+	0, 1, 2, 3,
+};
+static const UTF8Range Ogham_reverse_range[] = {
+	{ 128, 156, 1 }, { 154, 154, 2 }, { 225, 225, 0 },
+};
+static const uint16_t Ol_Chiki_forward_state[] = {
+	0, 1, 2, 3,
+};
+static const UTF8Range Ol_Chiki_forward_range[] = {
+	{ 225, 225, 1 }, { 177, 177, 2 }, { 144, 191, 0 },
+};
+static const uint16_t Ol_Chiki_reverse_state[] = {
+	0, 1, 2, 3,
+};
+static const UTF8Range Ol_Chiki_reverse_range[] = {
+	{ 144, 191, 1 }, { 177, 177, 2 }, { 225, 225, 0 },
+};
+static const uint16_t Old_Hungarian_forward_state[] = {
+	0, 1, 2, 4, 6, 7,
+};
+static const UTF8Range Old_Hungarian_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 178, 178, 4 }, { 179, 179, 3 }, { 128, 178, 0 }, { 186, 191, 0 },
+	{ 128, 178, 0 },
+};
+static const uint16_t Old_Hungarian_reverse_state[] = {
+	0, 3, 4, 5, 6, 7,
+};
+static const UTF8Range Old_Hungarian_reverse_range[] = {
+	{ 128, 178, 2 }, { 128, 178, 1 }, { 186, 191, 2 }, { 178, 178, 3 }, { 179, 179, 3 }, { 144, 144, 4 },
+	{ 240, 240, 0 },
+};
+static const uint16_t Old_Italic_forward_state[] = {
+	0, 1, 2, 3, 5,
+};
+static const UTF8Range Old_Italic_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 140, 140, 3 }, { 128, 163, 0 }, { 173, 175, 0 },
+};
+static const uint16_t Old_Italic_reverse_state[] = {
+	0, 2, 3, 4, 5,
+};
+static const UTF8Range Old_Italic_reverse_range[] = {
+	{ 128, 163, 1 }, { 173, 175, 1 }, { 140, 140, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Old_North_Arabian_forward_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Old_North_Arabian_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 170, 170, 3 }, { 128, 159, 0 },
+};
+static const uint16_t Old_North_Arabian_reverse_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Old_North_Arabian_reverse_range[] = {
+	{ 128, 159, 1 }, { 170, 170, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Old_Permic_forward_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Old_Permic_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 141, 141, 3 }, { 144, 186, 0 },
+};
+static const uint16_t Old_Permic_reverse_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Old_Permic_reverse_range[] = {
+	{ 144, 186, 1 }, { 141, 141, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Old_Persian_forward_state[] = {
+	0, 1, 2, 4, 6, 7,
+};
+static const UTF8Range Old_Persian_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 142, 142, 4 }, { 143, 143, 3 }, { 128, 131, 0 }, { 136, 149, 0 },
+	{ 160, 191, 0 },
+};
+static const uint16_t Old_Persian_reverse_state[] = {
+	0, 3, 4, 5, 6, 7,
+};
+static const UTF8Range Old_Persian_reverse_range[] = {
+	{ 128, 131, 2 }, { 136, 149, 2 }, { 160, 191, 1 }, { 142, 142, 3 }, { 143, 143, 3 }, { 144, 144, 4 },
+	{ 240, 240, 0 },
+};
+static const uint16_t Old_Sogdian_forward_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Old_Sogdian_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 188, 188, 3 }, { 128, 167, 0 },
+};
+static const uint16_t Old_Sogdian_reverse_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Old_Sogdian_reverse_range[] = {
+	{ 128, 167, 1 }, { 188, 188, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Old_South_Arabian_forward_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Old_South_Arabian_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 169, 169, 3 }, { 160, 191, 0 },
+};
+static const uint16_t Old_South_Arabian_reverse_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Old_South_Arabian_reverse_range[] = {
+	{ 160, 191, 1 }, { 169, 169, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Old_Turkic_forward_state[] = {
+	0, 1, 2, 4, 5, 6,
+};
+static const UTF8Range Old_Turkic_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 176, 176, 4 }, { 177, 177, 3 }, { 128, 136, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Old_Turkic_reverse_state[] = {
+	0, 2, 3, 4, 5, 6,
+};
+static const UTF8Range Old_Turkic_reverse_range[] = {
+	{ 128, 136, 2 }, { 128, 191, 1 }, { 176, 176, 3 }, { 177, 177, 3 }, { 144, 144, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Oriya_forward_state[] = {
+	0, 1, 3, 10, 18,
+};
+static const UTF8Range Oriya_forward_range[] = {
+	{ 224, 224, 1 }, { 172, 172, 3 }, { 173, 173, 2 }, { 128, 132, 0 }, { 135, 136, 0 }, { 139, 141, 0 },
+	{ 149, 151, 0 }, { 156, 157, 0 }, { 159, 163, 0 }, { 166, 183, 0 }, { 129, 131, 0 }, { 133, 140, 0 },
+	{ 143, 144, 0 }, { 147, 168, 0 }, { 170, 176, 0 }, { 178, 179, 0 }, { 181, 185, 0 }, { 188, 191, 0 },
+};
+static const uint16_t Oriya_reverse_state[] = {
+	0, 15, 16, 17, 18,
+};
+static const UTF8Range Oriya_reverse_range[] = {
+	{ 128, 132, 2 }, { 129, 131, 1 }, { 133, 140, 1 }, { 135, 136, 2 }, { 139, 141, 2 }, { 143, 144, 1 },
+	{ 147, 168, 1 }, { 149, 151, 2 }, { 156, 157, 2 }, { 159, 163, 2 }, { 166, 183, 2 }, { 170, 176, 1 },
+	{ 178, 179, 1 }, { 181, 185, 1 }, { 188, 191, 1 }, { 172, 172, 3 }, { 173, 173, 3 }, { 224, 224, 0 },
+};
+static const uint16_t Osage_forward_state[] = {
+	0, 1, 2, 4, 6, 7,
+};
+static const UTF8Range Osage_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 146, 146, 4 }, { 147, 147, 3 }, { 128, 147, 0 }, { 152, 187, 0 },
+	{ 176, 191, 0 },
+};
+static const uint16_t Osage_reverse_state[] = {
+	0, 3, 4, 5, 6, 7,
+};
+static const UTF8Range Osage_reverse_range[] = {
+	{ 128, 147, 2 }, { 152, 187, 2 }, { 176, 191, 1 }, { 146, 146, 3 }, { 147, 147, 3 }, { 144, 144, 4 },
+	{ 240, 240, 0 },
+};
+static const uint16_t Osmanya_forward_state[] = {
+	0, 1, 2, 3, 5,
+};
+static const UTF8Range Osmanya_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 146, 146, 3 }, { 128, 157, 0 }, { 160, 169, 0 },
+};
+static const uint16_t Osmanya_reverse_state[] = {
+	0, 2, 3, 4, 5,
+};
+static const UTF8Range Osmanya_reverse_range[] = {
+	{ 128, 157, 1 }, { 160, 169, 1 }, { 146, 146, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t P_forward_state[] = {
+	0, 27, 34, 35, 36, 37, 38, 44, 45, 46, 47, 48,
+	49, 70, 71, 73, 75, 76, 77, 78, 79, 80, 82, 83,
+	84, 87, 88, 89, 93, 95, 96, 98, 99, 111, 112, 113,
+	114, 115, 116, 118, 120, 121, 122, 123, 124, 129, 132, 139,
+	144, 146, 158, 159, 161, 162, 164, 165, 166, 169, 170, 171,
+	173, 174, 177, 178, 183, 195, 197, 199, 201, 203, 204, 206,
+	207, 209, 210, 214, 216, 234, 236, 237, 238, 239, 240, 242,
+	243, 244, 245, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+	268, 270, 271, 274, 276, 277, 278, 279, 280, 281, 282, 284,
+	285, 286, 287, 288, 289, 290, 294, 298, 300, 301, 302, 303,
+	309,
+};
+static const UTF8Range P_forward_range[] = {
+	{ 33, 35, 0 }, { 37, 42, 0 }, { 44, 47, 0 }, { 58, 59, 0 }, { 63, 64, 0 }, { 91, 93, 0 },
+	{ 95, 95, 0 }, { 123, 123, 0 }, { 125, 125, 0 }, { 194, 194, 119 }, { 205, 205, 118 }, { 206, 206, 117 },
+	{ 213, 213, 116 }, { 214, 214, 115 }, { 215, 215, 114 }, { 216, 216, 113 }, { 217, 217, 112 }, { 219, 219, 111 },
+	{ 220, 220, 110 }, { 223, 223, 109 }, { 224, 224, 95 }, { 225, 225, 76 }, { 226, 226, 64 }, { 227, 227, 61 },
+	{ 234, 234, 49 }, { 239, 239, 44 }, { 240, 240, 1 }, { 144, 144, 32 }, { 145, 145, 12 }, { 146, 146, 10 },
+	{ 150, 150, 6 }, { 155, 155, 5 }, { 157, 157, 3 }, { 158, 158, 2 }, { 165, 165, 83 }, { 170, 170, 4 },
+	{ 135, 139, 0 }, { 178, 178, 54 }, { 169, 169, 55 }, { 171, 171, 9 }, { 172, 172, 8 }, { 173, 173, 101 },
+	{ 186, 186, 7 }, { 191, 191, 18 }, { 151, 154, 0 }, { 183, 187, 0 }, { 181, 181, 0 }, { 145, 145, 11 },
+	{ 176, 180, 0 }, { 129, 129, 31 }, { 130, 130, 30 }, { 131, 131, 29 }, { 133, 133, 28 }, { 135, 135, 27 },
+	{ 136, 136, 26 }, { 138, 138, 25 }, { 145, 145, 24 }, { 147, 147, 23 }, { 151, 151, 22 }, { 153, 153, 21 },
+	{ 156, 156, 20 }, { 160, 160, 93 }, { 165, 165, 19 }, { 167, 167, 18 }, { 168, 168, 17 }, { 169, 169, 16 },
+	{ 170, 170, 15 }, { 177, 177, 14 }, { 187, 187, 13 }, { 191, 191, 17 }, { 183, 184, 0 }, { 129, 133, 0 },
+	{ 176, 177, 0 }, { 154, 156, 0 }, { 158, 162, 0 }, { 128, 134, 0 }, { 191, 191, 0 }, { 162, 162, 0 },
+	{ 132, 134, 0 }, { 188, 190, 0 }, { 129, 131, 0 }, { 160, 172, 0 }, { 129, 151, 0 }, { 134, 134, 0 },
+	{ 139, 143, 0 }, { 154, 155, 0 }, { 157, 157, 0 }, { 169, 169, 0 }, { 184, 189, 0 }, { 133, 136, 0 },
+	{ 141, 141, 0 }, { 155, 155, 0 }, { 157, 159, 0 }, { 128, 131, 0 }, { 180, 181, 0 }, { 128, 129, 0 },
+	{ 187, 188, 0 }, { 190, 191, 0 }, { 135, 141, 0 }, { 132, 132, 43 }, { 142, 142, 54 }, { 143, 143, 42 },
+	{ 149, 149, 41 }, { 161, 161, 40 }, { 164, 164, 39 }, { 169, 169, 38 }, { 171, 171, 37 }, { 172, 172, 36 },
+	{ 174, 174, 35 }, { 186, 186, 34 }, { 189, 189, 33 }, { 149, 153, 0 }, { 173, 173, 0 }, { 153, 156, 0 },
+	{ 185, 191, 0 }, { 176, 182, 0 }, { 144, 152, 0 }, { 191, 191, 0 }, { 159, 159, 0 }, { 191, 191, 0 },
+	{ 151, 151, 0 }, { 175, 175, 0 }, { 144, 144, 0 }, { 128, 130, 0 }, { 180, 180, 78 }, { 184, 184, 48 },
+	{ 185, 185, 47 }, { 188, 188, 46 }, { 189, 189, 45 }, { 155, 155, 0 }, { 157, 157, 0 }, { 159, 165, 0 },
+	{ 129, 131, 0 }, { 133, 138, 0 }, { 140, 143, 0 }, { 154, 155, 0 }, { 159, 160, 0 }, { 187, 189, 0 },
+	{ 191, 191, 0 }, { 128, 146, 0 }, { 148, 161, 0 }, { 163, 163, 0 }, { 168, 168, 0 }, { 170, 171, 0 },
+	{ 144, 153, 0 }, { 176, 191, 0 }, { 147, 147, 78 }, { 152, 152, 60 }, { 153, 153, 59 }, { 155, 155, 58 },
+	{ 161, 161, 57 }, { 163, 163, 56 }, { 164, 164, 55 }, { 165, 165, 54 }, { 167, 167, 53 }, { 169, 169, 52 },
+	{ 171, 171, 51 }, { 175, 175, 50 }, { 171, 171, 0 }, { 158, 159, 0 }, { 176, 177, 0 }, { 156, 159, 0 },
+	{ 129, 141, 0 }, { 158, 159, 0 }, { 159, 159, 0 }, { 174, 175, 0 }, { 142, 143, 0 }, { 184, 186, 0 },
+	{ 188, 188, 0 }, { 180, 183, 0 }, { 178, 183, 0 }, { 179, 179, 0 }, { 190, 190, 0 }, { 141, 143, 0 },
+	{ 128, 128, 63 }, { 130, 130, 62 }, { 131, 131, 93 }, { 160, 160, 0 }, { 129, 131, 0 }, { 136, 145, 0 },
+	{ 148, 159, 0 }, { 176, 176, 0 }, { 189, 189, 0 }, { 128, 128, 75 }, { 129, 129, 74 }, { 130, 130, 73 },
+	{ 140, 140, 72 }, { 157, 157, 71 }, { 159, 159, 70 }, { 166, 166, 69 }, { 167, 167, 68 }, { 179, 179, 67 },
+	{ 181, 181, 103 }, { 184, 184, 66 }, { 185, 185, 65 }, { 128, 143, 0 }, { 146, 146, 0 }, { 128, 174, 0 },
+	{ 176, 191, 0 }, { 185, 188, 0 }, { 190, 191, 0 }, { 152, 155, 0 }, { 188, 189, 0 }, { 131, 152, 0 },
+	{ 133, 134, 0 }, { 166, 175, 0 }, { 168, 181, 0 }, { 136, 139, 0 }, { 169, 170, 0 }, { 141, 142, 0 },
+	{ 128, 131, 0 }, { 133, 145, 0 }, { 147, 158, 0 }, { 189, 190, 0 }, { 144, 167, 0 }, { 176, 191, 0 },
+	{ 129, 129, 94 }, { 131, 131, 93 }, { 141, 141, 92 }, { 144, 144, 91 }, { 153, 153, 90 }, { 154, 154, 89 },
+	{ 155, 155, 88 }, { 156, 156, 87 }, { 159, 159, 86 }, { 160, 160, 85 }, { 165, 165, 84 }, { 168, 168, 83 },
+	{ 170, 170, 82 }, { 173, 173, 81 }, { 175, 175, 80 }, { 176, 176, 79 }, { 177, 177, 78 }, { 179, 179, 77 },
+	{ 128, 135, 0 }, { 147, 147, 0 }, { 190, 191, 0 }, { 187, 191, 0 }, { 188, 191, 0 }, { 154, 160, 0 },
+	{ 160, 166, 0 }, { 168, 173, 0 }, { 158, 159, 0 }, { 132, 133, 0 }, { 128, 138, 0 }, { 148, 150, 0 },
+	{ 152, 154, 0 }, { 181, 182, 0 }, { 171, 173, 0 }, { 155, 156, 0 }, { 174, 174, 0 }, { 128, 128, 0 },
+	{ 160, 168, 0 }, { 187, 187, 0 }, { 138, 143, 0 }, { 160, 160, 108 }, { 161, 161, 107 }, { 165, 165, 106 },
+	{ 167, 167, 105 }, { 169, 169, 104 }, { 171, 171, 103 }, { 177, 177, 102 }, { 178, 178, 101 }, { 183, 183, 100 },
+	{ 185, 185, 99 }, { 188, 188, 98 }, { 190, 190, 97 }, { 191, 191, 96 }, { 144, 148, 0 }, { 153, 154, 0 },
+	{ 133, 133, 0 }, { 132, 146, 0 }, { 148, 148, 0 }, { 186, 189, 0 }, { 143, 143, 0 }, { 154, 155, 0 },
+	{ 180, 180, 0 }, { 132, 132, 0 }, { 183, 183, 0 }, { 176, 176, 0 }, { 182, 182, 0 }, { 189, 189, 0 },
+	{ 164, 165, 0 }, { 176, 176, 0 }, { 158, 158, 0 }, { 176, 190, 0 }, { 183, 185, 0 }, { 128, 141, 0 },
+	{ 148, 148, 0 }, { 170, 173, 0 }, { 137, 138, 0 }, { 140, 141, 0 }, { 155, 155, 0 }, { 158, 159, 0 },
+	{ 128, 128, 0 }, { 131, 131, 0 }, { 134, 134, 0 }, { 179, 180, 0 }, { 137, 138, 0 }, { 190, 190, 0 },
+	{ 154, 159, 0 }, { 135, 135, 0 }, { 190, 190, 0 }, { 161, 161, 0 }, { 167, 167, 0 }, { 171, 171, 0 },
+	{ 182, 183, 0 }, { 187, 187, 0 }, { 191, 191, 0 },
+};
+static const uint16_t P_reverse_state[] = {
+	0, 178, 180, 183, 184, 185, 186, 187, 188, 189, 192, 193,
+	194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205,
+	206, 207, 208, 209, 210, 212, 213, 215, 216, 217, 218, 219,
+	220, 221, 222, 223, 225, 226, 227, 228, 229, 232, 233, 234,
+	236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247,
+	248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259,
+	260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+	272, 273, 274, 275, 276, 277, 279, 280, 281, 282, 283, 284,
+	285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296,
+	297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+	309,
+};
+static const UTF8Range P_reverse_range[] = {
+	{ 33, 35, 0 }, { 37, 42, 0 }, { 44, 47, 0 }, { 58, 59, 0 }, { 63, 64, 0 }, { 91, 93, 0 },
+	{ 95, 95, 0 }, { 123, 123, 0 }, { 125, 125, 0 }, { 128, 128, 118 }, { 128, 128, 117 }, { 128, 129, 114 },
+	{ 128, 130, 112 }, { 128, 131, 111 }, { 128, 131, 109 }, { 128, 134, 108 }, { 128, 135, 107 }, { 128, 138, 106 },
+	{ 128, 141, 105 }, { 128, 143, 104 }, { 128, 146, 102 }, { 128, 174, 101 }, { 129, 131, 100 }, { 129, 131, 99 },
+	{ 129, 131, 97 }, { 129, 133, 96 }, { 129, 141, 94 }, { 129, 151, 93 }, { 131, 131, 117 }, { 131, 152, 92 },
+	{ 132, 132, 89 }, { 132, 133, 88 }, { 132, 134, 87 }, { 132, 146, 86 }, { 133, 133, 85 }, { 133, 134, 84 },
+	{ 133, 136, 83 }, { 133, 138, 99 }, { 133, 145, 109 }, { 134, 134, 82 }, { 134, 134, 117 }, { 135, 135, 81 },
+	{ 135, 139, 79 }, { 135, 141, 78 }, { 136, 139, 77 }, { 136, 145, 97 }, { 137, 138, 76 }, { 137, 138, 75 },
+	{ 138, 143, 74 }, { 139, 143, 73 }, { 140, 141, 76 }, { 140, 143, 99 }, { 141, 141, 83 }, { 141, 142, 72 },
+	{ 141, 143, 71 }, { 142, 143, 70 }, { 143, 143, 69 }, { 144, 144, 68 }, { 144, 148, 67 }, { 144, 152, 66 },
+	{ 144, 153, 65 }, { 144, 167, 64 }, { 146, 146, 104 }, { 147, 147, 107 }, { 147, 158, 109 }, { 148, 148, 86 },
+	{ 148, 148, 63 }, { 148, 150, 62 }, { 148, 159, 97 }, { 148, 161, 102 }, { 149, 153, 61 }, { 151, 151, 60 },
+	{ 151, 154, 59 }, { 152, 154, 62 }, { 152, 155, 58 }, { 153, 154, 67 }, { 153, 156, 57 }, { 154, 155, 73 },
+	{ 154, 155, 99 }, { 154, 155, 69 }, { 154, 156, 56 }, { 154, 159, 55 }, { 154, 160, 54 }, { 155, 155, 83 },
+	{ 155, 155, 53 }, { 155, 155, 76 }, { 155, 156, 52 }, { 156, 159, 51 }, { 157, 157, 73 }, { 157, 157, 53 },
+	{ 157, 159, 83 }, { 158, 158, 50 }, { 158, 159, 49 }, { 158, 159, 94 }, { 158, 159, 47 }, { 158, 159, 76 },
+	{ 158, 162, 56 }, { 159, 159, 46 }, { 159, 159, 44 }, { 159, 160, 99 }, { 159, 165, 53 }, { 160, 160, 43 },
+	{ 160, 166, 42 }, { 160, 168, 41 }, { 160, 172, 100 }, { 161, 161, 40 }, { 162, 162, 39 }, { 163, 163, 102 },
+	{ 164, 165, 38 }, { 166, 175, 84 }, { 167, 167, 40 }, { 168, 168, 102 }, { 168, 173, 42 }, { 168, 181, 37 },
+	{ 169, 169, 36 }, { 169, 170, 77 }, { 170, 171, 102 }, { 170, 173, 35 }, { 171, 171, 34 }, { 171, 171, 40 },
+	{ 171, 173, 33 }, { 173, 173, 32 }, { 174, 174, 31 }, { 174, 175, 30 }, { 175, 175, 29 }, { 176, 176, 97 },
+	{ 176, 176, 28 }, { 176, 176, 38 }, { 176, 177, 96 }, { 176, 177, 49 }, { 176, 180, 26 }, { 176, 182, 25 },
+	{ 176, 190, 24 }, { 176, 191, 65 }, { 176, 191, 101 }, { 176, 191, 64 }, { 178, 183, 23 }, { 179, 179, 22 },
+	{ 179, 180, 117 }, { 180, 180, 21 }, { 180, 181, 111 }, { 180, 183, 20 }, { 181, 181, 19 }, { 181, 182, 18 },
+	{ 182, 182, 17 }, { 182, 183, 40 }, { 183, 183, 16 }, { 183, 184, 15 }, { 183, 185, 14 }, { 183, 187, 13 },
+	{ 184, 186, 70 }, { 184, 189, 12 }, { 185, 188, 11 }, { 185, 191, 10 }, { 186, 189, 86 }, { 187, 187, 9 },
+	{ 187, 187, 40 }, { 187, 188, 8 }, { 187, 189, 99 }, { 187, 191, 7 }, { 188, 188, 70 }, { 188, 189, 58 },
+	{ 188, 190, 6 }, { 188, 191, 5 }, { 189, 189, 97 }, { 189, 189, 4 }, { 189, 190, 109 }, { 190, 190, 22 },
+	{ 190, 190, 75 }, { 190, 190, 3 }, { 190, 191, 8 }, { 190, 191, 11 }, { 190, 191, 2 }, { 191, 191, 1 },
+	{ 191, 191, 66 }, { 191, 191, 46 }, { 191, 191, 99 }, { 191, 191, 40 }, { 168, 168, 115 }, { 191, 191, 115 },
+	{ 147, 147, 95 }, { 177, 177, 119 }, { 180, 180, 103 }, { 205, 205, 0 }, { 167, 167, 90 }, { 175, 175, 119 },
+	{ 156, 156, 115 }, { 176, 176, 119 }, { 130, 130, 115 }, { 131, 131, 98 }, { 131, 131, 119 }, { 160, 160, 115 },
+	{ 172, 172, 113 }, { 179, 179, 110 }, { 136, 136, 115 }, { 172, 172, 91 }, { 223, 223, 0 }, { 187, 187, 115 },
+	{ 177, 177, 90 }, { 169, 169, 90 }, { 156, 156, 119 }, { 171, 171, 91 }, { 161, 161, 95 }, { 183, 183, 90 },
+	{ 153, 153, 95 }, { 155, 155, 95 }, { 160, 160, 90 }, { 171, 171, 113 }, { 145, 145, 27 }, { 146, 146, 116 },
+	{ 171, 171, 90 }, { 181, 181, 110 }, { 149, 149, 113 }, { 164, 164, 95 }, { 169, 169, 91 }, { 153, 153, 119 },
+	{ 186, 186, 113 }, { 155, 155, 119 }, { 175, 175, 95 }, { 217, 217, 0 }, { 138, 138, 115 }, { 157, 157, 110 },
+	{ 165, 165, 90 }, { 167, 167, 115 }, { 191, 191, 91 }, { 194, 194, 0 }, { 141, 141, 119 }, { 170, 170, 119 },
+	{ 130, 130, 98 }, { 142, 142, 113 }, { 165, 165, 95 }, { 178, 178, 45 }, { 155, 155, 116 }, { 164, 164, 113 },
+	{ 165, 165, 48 }, { 168, 168, 119 }, { 158, 158, 116 }, { 171, 171, 95 }, { 161, 161, 90 }, { 169, 169, 95 },
+	{ 154, 154, 119 }, { 189, 189, 103 }, { 173, 173, 119 }, { 213, 213, 0 }, { 170, 170, 115 }, { 174, 174, 113 },
+	{ 167, 167, 110 }, { 186, 186, 91 }, { 161, 161, 113 }, { 189, 189, 113 }, { 159, 159, 119 }, { 219, 219, 0 },
+	{ 128, 128, 110 }, { 184, 184, 103 }, { 169, 169, 113 }, { 191, 191, 90 }, { 143, 143, 113 }, { 185, 185, 90 },
+	{ 163, 163, 95 }, { 152, 152, 95 }, { 130, 130, 110 }, { 145, 145, 115 }, { 129, 129, 119 }, { 214, 214, 0 },
+	{ 216, 216, 0 }, { 140, 140, 110 }, { 129, 129, 115 }, { 170, 170, 80 }, { 157, 157, 116 }, { 206, 206, 0 },
+	{ 147, 147, 115 }, { 135, 135, 115 }, { 159, 159, 110 }, { 190, 190, 90 }, { 188, 188, 90 }, { 165, 165, 115 },
+	{ 165, 165, 119 }, { 173, 173, 91 }, { 178, 178, 90 }, { 224, 224, 0 }, { 150, 150, 116 }, { 166, 166, 110 },
+	{ 151, 151, 115 }, { 167, 167, 95 }, { 234, 234, 0 }, { 177, 177, 115 }, { 128, 128, 98 }, { 227, 227, 0 },
+	{ 188, 188, 103 }, { 153, 153, 115 }, { 184, 184, 110 }, { 185, 185, 103 }, { 239, 239, 0 }, { 185, 185, 110 },
+	{ 220, 220, 0 }, { 160, 160, 119 }, { 179, 179, 119 }, { 169, 169, 115 }, { 129, 129, 110 }, { 226, 226, 0 },
+	{ 133, 133, 115 }, { 132, 132, 113 }, { 144, 144, 116 }, { 131, 131, 115 }, { 145, 145, 116 }, { 240, 240, 0 },
+	{ 215, 215, 0 }, { 144, 144, 119 }, { 225, 225, 0 },
+};
+static const uint16_t Pahawh_Hmong_forward_state[] = {
+	0, 1, 2, 5, 6, 11, 12,
+};
+static const UTF8Range Pahawh_Hmong_forward_range[] = {
+	{ 240, 240, 1 }, { 150, 150, 2 }, { 172, 172, 5 }, { 173, 173, 4 }, { 174, 174, 3 }, { 128, 143, 0 },
+	{ 128, 133, 0 }, { 144, 153, 0 }, { 155, 161, 0 }, { 163, 183, 0 }, { 189, 191, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Pahawh_Hmong_reverse_state[] = {
+	0, 7, 8, 9, 10, 11, 12,
+};
+static const UTF8Range Pahawh_Hmong_reverse_range[] = {
+	{ 128, 133, 3 }, { 128, 143, 2 }, { 128, 191, 1 }, { 144, 153, 3 }, { 155, 161, 3 }, { 163, 183, 3 },
+	{ 189, 191, 3 }, { 172, 172, 4 }, { 174, 174, 4 }, { 173, 173, 4 }, { 150, 150, 5 }, { 240, 240, 0 },
+};
+static const uint16_t Palmyrene_forward_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Palmyrene_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 161, 161, 3 }, { 160, 191, 0 },
+};
+static const uint16_t Palmyrene_reverse_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Palmyrene_reverse_range[] = {
+	{ 160, 191, 1 }, { 161, 161, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Pau_Cin_Hau_forward_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Pau_Cin_Hau_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 171, 171, 3 }, { 128, 184, 0 },
+};
+static const uint16_t Pau_Cin_Hau_reverse_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Pau_Cin_Hau_reverse_range[] = {
+	{ 128, 184, 1 }, { 171, 171, 2 }, { 145, 145, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Pc_forward_state[] = {
+	0, 3, 6, 7, 8, 10, 12, 13,
+};
+static const UTF8Range Pc_forward_range[] = {
+	{ 95, 95, 0 }, { 226, 226, 4 }, { 239, 239, 1 }, { 184, 184, 3 }, { 185, 185, 2 }, { 188, 188, 6 },
+	{ 141, 143, 0 }, { 179, 180, 0 }, { 128, 128, 6 }, { 129, 129, 5 }, { 128, 128, 0 }, { 148, 148, 0 },
+	{ 191, 191, 0 },
+};
+static const uint16_t Pc_reverse_state[] = {
+	0, 6, 8, 9, 10, 11, 12, 13,
+};
+static const UTF8Range Pc_reverse_range[] = {
+	{ 95, 95, 0 }, { 128, 128, 5 }, { 141, 143, 3 }, { 148, 148, 5 }, { 179, 180, 2 }, { 191, 191, 1 },
+	{ 128, 128, 6 }, { 188, 188, 4 }, { 184, 184, 4 }, { 185, 185, 4 }, { 239, 239, 0 }, { 129, 129, 6 },
+	{ 226, 226, 0 },
+};
+static const uint16_t Pd_forward_state[] = {
+	0, 7, 8, 9, 10, 13, 14, 16, 17, 19, 20, 22,
+	25, 28, 29, 31, 32, 33, 35,
+};
+static const UTF8Range Pd_forward_range[] = {
+	{ 45, 45, 0 }, { 214, 214, 17 }, { 225, 225, 14 }, { 226, 226, 11 }, { 227, 227, 8 }, { 239, 239, 4 },
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 186, 186, 3 }, { 173, 173, 0 }, { 184, 184, 7 }, { 185, 185, 6 },
+	{ 188, 188, 5 }, { 141, 141, 0 }, { 152, 152, 0 }, { 163, 163, 0 }, { 177, 178, 0 }, { 128, 128, 10 },
+	{ 130, 130, 9 }, { 160, 160, 0 }, { 156, 156, 0 }, { 176, 176, 0 }, { 128, 128, 13 }, { 184, 184, 12 },
+	{ 185, 185, 16 }, { 151, 151, 0 }, { 154, 154, 0 }, { 186, 187, 0 }, { 144, 149, 0 }, { 144, 144, 16 },
+	{ 160, 160, 15 }, { 134, 134, 0 }, { 128, 128, 0 }, { 138, 138, 0 }, { 190, 190, 0 },
+};
+static const uint16_t Pd_reverse_state[] = {
+	0, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+	28, 29, 30, 31, 33, 34, 35,
+};
+static const UTF8Range Pd_reverse_range[] = {
+	{ 45, 45, 0 }, { 128, 128, 15 }, { 134, 134, 14 }, { 138, 138, 13 }, { 141, 141, 11 }, { 144, 149, 10 },
+	{ 151, 151, 9 }, { 152, 152, 8 }, { 154, 154, 9 }, { 156, 156, 6 }, { 160, 160, 5 }, { 163, 163, 8 },
+	{ 173, 173, 2 }, { 176, 176, 6 }, { 177, 178, 1 }, { 186, 187, 9 }, { 190, 190, 13 }, { 184, 184, 12 },
+	{ 186, 186, 3 }, { 144, 144, 4 }, { 240, 240, 0 }, { 130, 130, 7 }, { 128, 128, 7 }, { 227, 227, 0 },
+	{ 185, 185, 12 }, { 184, 184, 16 }, { 128, 128, 16 }, { 188, 188, 12 }, { 239, 239, 0 }, { 214, 214, 0 },
+	{ 160, 160, 17 }, { 144, 144, 17 }, { 185, 185, 16 }, { 226, 226, 0 }, { 225, 225, 0 },
+};
+static const uint16_t Pe_forward_state[] = {
+	0, 8, 13, 16, 18, 25, 31, 32, 33, 43, 51, 55,
+	58, 69, 75, 82, 85, 86, 88, 89, 90, 91, 93,
+};
+static const UTF8Range Pe_forward_range[] = {
+	{ 41, 41, 0 }, { 93, 93, 0 }, { 125, 125, 0 }, { 224, 224, 20 }, { 225, 225, 18 }, { 226, 226, 9 },
+	{ 227, 227, 7 }, { 239, 239, 1 }, { 180, 180, 6 }, { 184, 184, 5 }, { 185, 185, 4 }, { 188, 188, 3 },
+	{ 189, 189, 2 }, { 157, 157, 0 }, { 160, 160, 0 }, { 163, 163, 0 }, { 137, 137, 0 }, { 189, 189, 0 },
+	{ 128, 128, 0 }, { 130, 130, 0 }, { 132, 132, 0 }, { 136, 136, 0 }, { 154, 154, 0 }, { 156, 156, 0 },
+	{ 158, 158, 0 }, { 152, 152, 0 }, { 182, 182, 0 }, { 184, 184, 0 }, { 186, 186, 0 }, { 188, 188, 0 },
+	{ 190, 190, 0 }, { 190, 190, 0 }, { 128, 128, 8 }, { 137, 137, 0 }, { 139, 139, 0 }, { 141, 141, 0 },
+	{ 143, 143, 0 }, { 145, 145, 0 }, { 149, 149, 0 }, { 151, 151, 0 }, { 153, 153, 0 }, { 155, 155, 0 },
+	{ 158, 159, 0 }, { 129, 129, 17 }, { 130, 130, 16 }, { 140, 140, 15 }, { 157, 157, 14 }, { 159, 159, 13 },
+	{ 166, 166, 12 }, { 167, 167, 11 }, { 184, 184, 10 }, { 163, 163, 0 }, { 165, 165, 0 }, { 167, 167, 0 },
+	{ 169, 169, 0 }, { 153, 153, 0 }, { 155, 155, 0 }, { 189, 189, 0 }, { 132, 132, 0 }, { 134, 134, 0 },
+	{ 136, 136, 0 }, { 138, 138, 0 }, { 140, 140, 0 }, { 142, 142, 0 }, { 144, 144, 0 }, { 146, 146, 0 },
+	{ 148, 148, 0 }, { 150, 150, 0 }, { 152, 152, 0 }, { 134, 134, 0 }, { 167, 167, 0 }, { 169, 169, 0 },
+	{ 171, 171, 0 }, { 173, 173, 0 }, { 175, 175, 0 }, { 169, 169, 0 }, { 171, 171, 0 }, { 173, 173, 0 },
+	{ 175, 175, 0 }, { 177, 177, 0 }, { 179, 179, 0 }, { 181, 181, 0 }, { 137, 137, 0 }, { 139, 139, 0 },
+	{ 170, 170, 0 }, { 142, 142, 0 }, { 134, 134, 0 }, { 190, 190, 0 }, { 154, 154, 19 }, { 156, 156, 0 },
+	{ 188, 188, 21 }, { 187, 187, 0 }, { 189, 189, 0 },
+};
+static const uint16_t Pe_reverse_state[] = {
+	0, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82,
+	83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93,
+};
+static const UTF8Range Pe_reverse_range[] = {
+	{ 41, 41, 0 }, { 93, 93, 0 }, { 125, 125, 0 }, { 128, 128, 20 }, { 130, 130, 20 }, { 132, 132, 20 },
+	{ 132, 132, 18 }, { 134, 134, 18 }, { 134, 134, 17 }, { 134, 134, 16 }, { 136, 136, 20 }, { 136, 136, 18 },
+	{ 137, 137, 15 }, { 137, 137, 13 }, { 137, 137, 12 }, { 138, 138, 18 }, { 139, 139, 13 }, { 139, 139, 12 },
+	{ 140, 140, 18 }, { 141, 141, 13 }, { 142, 142, 18 }, { 142, 142, 11 }, { 143, 143, 13 }, { 144, 144, 18 },
+	{ 145, 145, 13 }, { 146, 146, 18 }, { 148, 148, 18 }, { 149, 149, 13 }, { 150, 150, 18 }, { 151, 151, 13 },
+	{ 152, 152, 10 }, { 152, 152, 18 }, { 153, 153, 13 }, { 153, 153, 9 }, { 154, 154, 20 }, { 155, 155, 13 },
+	{ 155, 155, 9 }, { 156, 156, 20 }, { 156, 156, 7 }, { 157, 157, 6 }, { 158, 158, 20 }, { 158, 159, 13 },
+	{ 160, 160, 6 }, { 163, 163, 6 }, { 163, 163, 5 }, { 165, 165, 5 }, { 167, 167, 5 }, { 167, 167, 17 },
+	{ 169, 169, 5 }, { 169, 169, 17 }, { 169, 169, 4 }, { 170, 170, 12 }, { 171, 171, 17 }, { 171, 171, 4 },
+	{ 173, 173, 17 }, { 173, 173, 4 }, { 175, 175, 17 }, { 175, 175, 4 }, { 177, 177, 4 }, { 179, 179, 4 },
+	{ 181, 181, 4 }, { 182, 182, 10 }, { 184, 184, 10 }, { 186, 186, 10 }, { 187, 187, 2 }, { 188, 188, 10 },
+	{ 189, 189, 15 }, { 189, 189, 9 }, { 189, 189, 2 }, { 190, 190, 10 }, { 190, 190, 1 }, { 190, 190, 16 },
+	{ 180, 180, 21 }, { 188, 188, 3 }, { 224, 224, 0 }, { 157, 157, 19 }, { 184, 184, 19 }, { 189, 189, 21 },
+	{ 154, 154, 8 }, { 225, 225, 0 }, { 167, 167, 19 }, { 184, 184, 21 }, { 130, 130, 19 }, { 140, 140, 19 },
+	{ 128, 128, 14 }, { 227, 227, 0 }, { 188, 188, 21 }, { 129, 129, 19 }, { 159, 159, 19 }, { 166, 166, 19 },
+	{ 226, 226, 0 }, { 185, 185, 21 }, { 239, 239, 0 },
+};
+static const uint16_t Pf_forward_state[] = {
+	0, 2, 4, 10, 13, 14,
+};
+static const UTF8Range Pf_forward_range[] = {
+	{ 194, 194, 4 }, { 226, 226, 1 }, { 128, 128, 3 }, { 184, 184, 2 }, { 131, 131, 0 }, { 133, 133, 0 },
+	{ 138, 138, 0 }, { 141, 141, 0 }, { 157, 157, 0 }, { 161, 161, 0 }, { 153, 153, 0 }, { 157, 157, 0 },
+	{ 186, 186, 0 }, { 187, 187, 0 },
+};
+static const uint16_t Pf_reverse_state[] = {
+	0, 10, 11, 12, 13, 14,
+};
+static const UTF8Range Pf_reverse_range[] = {
+	{ 131, 131, 3 }, { 133, 133, 3 }, { 138, 138, 3 }, { 141, 141, 3 }, { 153, 153, 2 }, { 157, 157, 3 },
+	{ 157, 157, 2 }, { 161, 161, 3 }, { 186, 186, 2 }, { 187, 187, 1 }, { 194, 194, 0 }, { 128, 128, 4 },
+	{ 184, 184, 4 }, { 226, 226, 0 },
+};
+static const uint16_t Phags_Pa_forward_state[] = {
+	0, 1, 2, 3,
+};
+static const UTF8Range Phags_Pa_forward_range[] = {
+	{ 234, 234, 1 }, { 161, 161, 2 }, { 128, 183, 0 },
+};
+static const uint16_t Phags_Pa_reverse_state[] = {
+	0, 1, 2, 3,
+};
+static const UTF8Range Phags_Pa_reverse_range[] = {
+	{ 128, 183, 1 }, { 161, 161, 2 }, { 234, 234, 0 },
+};
+static const uint16_t Phoenician_forward_state[] = {
+	0, 1, 2, 3, 5,
+};
+static const UTF8Range Phoenician_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 164, 164, 3 }, { 128, 155, 0 }, { 159, 159, 0 },
+};
+static const uint16_t Phoenician_reverse_state[] = {
+	0, 2, 3, 4, 5,
+};
+static const UTF8Range Phoenician_reverse_range[] = {
+	{ 128, 155, 1 }, { 159, 159, 1 }, { 164, 164, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Pi_forward_state[] = {
+	0, 2, 4, 10, 14, 15,
+};
+static const UTF8Range Pi_forward_range[] = {
+	{ 194, 194, 4 }, { 226, 226, 1 }, { 128, 128, 3 }, { 184, 184, 2 }, { 130, 130, 0 }, { 132, 132, 0 },
+	{ 137, 137, 0 }, { 140, 140, 0 }, { 156, 156, 0 }, { 160, 160, 0 }, { 152, 152, 0 }, { 155, 156, 0 },
+	{ 159, 159, 0 }, { 185, 185, 0 }, { 171, 171, 0 },
+};
+static const uint16_t Pi_reverse_state[] = {
+	0, 11, 12, 13, 14, 15,
+};
+static const UTF8Range Pi_reverse_range[] = {
+	{ 130, 130, 3 }, { 132, 132, 3 }, { 137, 137, 3 }, { 140, 140, 3 }, { 152, 152, 2 }, { 155, 156, 2 },
+	{ 156, 156, 3 }, { 159, 159, 2 }, { 160, 160, 3 }, { 171, 171, 1 }, { 185, 185, 2 }, { 194, 194, 0 },
+	{ 128, 128, 4 }, { 184, 184, 4 }, { 226, 226, 0 },
+};
+static const uint16_t Po_forward_state[] = {
+	0, 26, 33, 34, 35, 36, 37, 43, 44, 45, 46, 47,
+	48, 69, 70, 72, 74, 75, 76, 77, 78, 79, 81, 82,
+	83, 86, 87, 88, 92, 94, 95, 97, 98, 109, 110, 111,
+	112, 113, 115, 117, 118, 119, 120, 121, 125, 127, 135, 142,
+	145, 157, 158, 160, 161, 163, 164, 165, 168, 169, 170, 172,
+	173, 175, 177, 183, 186, 196, 198, 202, 206, 222, 224, 225,
+	226, 227, 228, 230, 231, 232, 234, 236, 237, 238, 239, 240,
+	241, 242, 255, 257, 258, 260, 262, 263, 264, 265, 266, 267,
+	268, 270, 271, 272, 273, 274, 275, 276, 280, 284, 285, 286,
+	287, 288, 292,
+};
+static const UTF8Range Po_forward_range[] = {
+	{ 33, 35, 0 }, { 37, 39, 0 }, { 42, 42, 0 }, { 44, 44, 0 }, { 46, 47, 0 }, { 58, 59, 0 },
+	{ 63, 64, 0 }, { 92, 92, 0 }, { 194, 194, 109 }, { 205, 205, 108 }, { 206, 206, 107 }, { 213, 213, 106 },
+	{ 214, 214, 105 }, { 215, 215, 104 }, { 216, 216, 103 }, { 217, 217, 102 }, { 219, 219, 101 }, { 220, 220, 100 },
+	{ 223, 223, 99 }, { 224, 224, 85 }, { 225, 225, 68 }, { 226, 226, 62 }, { 227, 227, 60 }, { 234, 234, 48 },
+	{ 239, 239, 43 }, { 240, 240, 1 }, { 144, 144, 32 }, { 145, 145, 12 }, { 146, 146, 10 }, { 150, 150, 6 },
+	{ 155, 155, 5 }, { 157, 157, 3 }, { 158, 158, 2 }, { 165, 165, 75 }, { 170, 170, 4 }, { 135, 139, 0 },
+	{ 178, 178, 53 }, { 169, 169, 54 }, { 171, 171, 9 }, { 172, 172, 8 }, { 173, 173, 91 }, { 186, 186, 7 },
+	{ 191, 191, 18 }, { 151, 154, 0 }, { 183, 187, 0 }, { 181, 181, 0 }, { 145, 145, 11 }, { 176, 180, 0 },
+	{ 129, 129, 31 }, { 130, 130, 30 }, { 131, 131, 29 }, { 133, 133, 28 }, { 135, 135, 27 }, { 136, 136, 26 },
+	{ 138, 138, 25 }, { 145, 145, 24 }, { 147, 147, 23 }, { 151, 151, 22 }, { 153, 153, 21 }, { 156, 156, 20 },
+	{ 160, 160, 83 }, { 165, 165, 19 }, { 167, 167, 18 }, { 168, 168, 17 }, { 169, 169, 16 }, { 170, 170, 15 },
+	{ 177, 177, 14 }, { 187, 187, 13 }, { 191, 191, 17 }, { 183, 184, 0 }, { 129, 133, 0 }, { 176, 177, 0 },
+	{ 154, 156, 0 }, { 158, 162, 0 }, { 128, 134, 0 }, { 191, 191, 0 }, { 162, 162, 0 }, { 132, 134, 0 },
+	{ 188, 190, 0 }, { 129, 131, 0 }, { 160, 172, 0 }, { 129, 151, 0 }, { 134, 134, 0 }, { 139, 143, 0 },
+	{ 154, 155, 0 }, { 157, 157, 0 }, { 169, 169, 0 }, { 184, 189, 0 }, { 133, 136, 0 }, { 141, 141, 0 },
+	{ 155, 155, 0 }, { 157, 159, 0 }, { 128, 131, 0 }, { 180, 181, 0 }, { 128, 129, 0 }, { 187, 188, 0 },
+	{ 190, 191, 0 }, { 135, 141, 0 }, { 132, 132, 42 }, { 142, 142, 53 }, { 143, 143, 41 }, { 149, 149, 40 },
+	{ 161, 161, 39 }, { 164, 164, 38 }, { 169, 169, 37 }, { 171, 171, 36 }, { 172, 172, 35 }, { 174, 174, 34 },
+	{ 189, 189, 33 }, { 149, 153, 0 }, { 153, 156, 0 }, { 185, 191, 0 }, { 176, 182, 0 }, { 144, 152, 0 },
+	{ 191, 191, 0 }, { 159, 159, 0 }, { 191, 191, 0 }, { 151, 151, 0 }, { 175, 175, 0 }, { 144, 144, 0 },
+	{ 128, 130, 0 }, { 184, 184, 47 }, { 185, 185, 46 }, { 188, 188, 45 }, { 189, 189, 44 }, { 161, 161, 0 },
+	{ 164, 165, 0 }, { 129, 131, 0 }, { 133, 135, 0 }, { 138, 138, 0 }, { 140, 140, 0 }, { 142, 143, 0 },
+	{ 154, 155, 0 }, { 159, 160, 0 }, { 188, 188, 0 }, { 133, 134, 0 }, { 137, 140, 0 }, { 144, 146, 0 },
+	{ 148, 151, 0 }, { 159, 161, 0 }, { 168, 168, 0 }, { 170, 171, 0 }, { 144, 150, 0 }, { 153, 153, 0 },
+	{ 176, 176, 0 }, { 147, 147, 70 }, { 152, 152, 59 }, { 153, 153, 58 }, { 155, 155, 57 }, { 161, 161, 56 },
+	{ 163, 163, 55 }, { 164, 164, 54 }, { 165, 165, 53 }, { 167, 167, 52 }, { 169, 169, 51 }, { 171, 171, 50 },
+	{ 175, 175, 49 }, { 171, 171, 0 }, { 158, 159, 0 }, { 176, 177, 0 }, { 156, 159, 0 }, { 129, 141, 0 },
+	{ 158, 159, 0 }, { 159, 159, 0 }, { 174, 175, 0 }, { 142, 143, 0 }, { 184, 186, 0 }, { 188, 188, 0 },
+	{ 180, 183, 0 }, { 178, 183, 0 }, { 179, 179, 0 }, { 190, 190, 0 }, { 141, 143, 0 }, { 128, 128, 61 },
+	{ 131, 131, 83 }, { 129, 131, 0 }, { 189, 189, 0 }, { 128, 128, 67 }, { 129, 129, 66 }, { 179, 179, 65 },
+	{ 181, 181, 93 }, { 184, 184, 64 }, { 185, 185, 63 }, { 129, 129, 0 }, { 131, 143, 0 }, { 146, 146, 0 },
+	{ 128, 129, 0 }, { 134, 136, 0 }, { 139, 139, 0 }, { 142, 150, 0 }, { 152, 153, 0 }, { 155, 155, 0 },
+	{ 158, 159, 0 }, { 170, 174, 0 }, { 176, 185, 0 }, { 188, 191, 0 }, { 185, 188, 0 }, { 190, 191, 0 },
+	{ 129, 131, 0 }, { 135, 145, 0 }, { 147, 147, 0 }, { 149, 158, 0 }, { 150, 151, 0 }, { 160, 167, 0 },
+	{ 176, 184, 0 }, { 187, 190, 0 }, { 129, 129, 84 }, { 131, 131, 83 }, { 141, 141, 82 }, { 153, 153, 81 },
+	{ 155, 155, 80 }, { 156, 156, 79 }, { 159, 159, 78 }, { 160, 160, 77 }, { 165, 165, 76 }, { 168, 168, 75 },
+	{ 170, 170, 74 }, { 173, 173, 73 }, { 175, 175, 72 }, { 176, 176, 71 }, { 177, 177, 70 }, { 179, 179, 69 },
+	{ 128, 135, 0 }, { 147, 147, 0 }, { 190, 191, 0 }, { 187, 191, 0 }, { 188, 191, 0 }, { 154, 160, 0 },
+	{ 160, 166, 0 }, { 168, 173, 0 }, { 158, 159, 0 }, { 132, 133, 0 }, { 128, 133, 0 }, { 135, 138, 0 },
+	{ 148, 150, 0 }, { 152, 154, 0 }, { 181, 182, 0 }, { 171, 173, 0 }, { 174, 174, 0 }, { 160, 168, 0 },
+	{ 187, 187, 0 }, { 138, 143, 0 }, { 160, 160, 98 }, { 161, 161, 97 }, { 165, 165, 96 }, { 167, 167, 95 },
+	{ 169, 169, 94 }, { 171, 171, 93 }, { 177, 177, 92 }, { 178, 178, 91 }, { 183, 183, 90 }, { 185, 185, 89 },
+	{ 188, 188, 88 }, { 190, 190, 87 }, { 191, 191, 86 }, { 144, 148, 0 }, { 153, 154, 0 }, { 133, 133, 0 },
+	{ 132, 146, 0 }, { 148, 148, 0 }, { 143, 143, 0 }, { 154, 155, 0 }, { 180, 180, 0 }, { 132, 132, 0 },
+	{ 183, 183, 0 }, { 176, 176, 0 }, { 182, 182, 0 }, { 189, 189, 0 }, { 164, 165, 0 }, { 176, 176, 0 },
+	{ 158, 158, 0 }, { 176, 190, 0 }, { 183, 185, 0 }, { 128, 141, 0 }, { 148, 148, 0 }, { 170, 173, 0 },
+	{ 137, 138, 0 }, { 140, 141, 0 }, { 155, 155, 0 }, { 158, 159, 0 }, { 128, 128, 0 }, { 131, 131, 0 },
+	{ 134, 134, 0 }, { 179, 180, 0 }, { 137, 137, 0 }, { 154, 159, 0 }, { 135, 135, 0 }, { 190, 190, 0 },
+	{ 161, 161, 0 }, { 167, 167, 0 }, { 182, 183, 0 }, { 191, 191, 0 },
+};
+static const uint16_t Po_reverse_state[] = {
+	0, 172, 174, 176, 177, 178, 179, 180, 181, 182, 185, 186,
+	187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198,
+	199, 200, 201, 202, 203, 205, 206, 208, 209, 210, 211, 212,
+	213, 214, 216, 217, 218, 219, 220, 223, 224, 225, 227, 228,
+	229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240,
+	241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252,
+	253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 265,
+	266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277,
+	278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289,
+	290, 291, 292,
+};
+static const UTF8Range Po_reverse_range[] = {
+	{ 33, 35, 0 }, { 37, 39, 0 }, { 42, 42, 0 }, { 44, 44, 0 }, { 46, 47, 0 }, { 58, 59, 0 },
+	{ 63, 64, 0 }, { 92, 92, 0 }, { 128, 128, 109 }, { 128, 129, 106 }, { 128, 129, 104 }, { 128, 130, 102 },
+	{ 128, 131, 101 }, { 128, 133, 99 }, { 128, 134, 98 }, { 128, 135, 97 }, { 128, 141, 96 }, { 129, 129, 95 },
+	{ 129, 131, 94 }, { 129, 131, 92 }, { 129, 131, 90 }, { 129, 131, 89 }, { 129, 133, 88 }, { 129, 141, 86 },
+	{ 129, 151, 85 }, { 131, 131, 109 }, { 131, 143, 95 }, { 132, 132, 82 }, { 132, 133, 81 }, { 132, 134, 80 },
+	{ 132, 146, 79 }, { 133, 133, 78 }, { 133, 134, 77 }, { 133, 135, 92 }, { 133, 136, 76 }, { 134, 134, 75 },
+	{ 134, 134, 109 }, { 134, 136, 104 }, { 135, 135, 74 }, { 135, 138, 99 }, { 135, 139, 72 }, { 135, 141, 71 },
+	{ 135, 145, 89 }, { 137, 137, 70 }, { 137, 138, 69 }, { 137, 140, 77 }, { 138, 138, 92 }, { 138, 143, 68 },
+	{ 139, 139, 104 }, { 139, 143, 67 }, { 140, 140, 92 }, { 140, 141, 69 }, { 141, 141, 76 }, { 141, 143, 66 },
+	{ 142, 143, 92 }, { 142, 143, 65 }, { 142, 150, 104 }, { 143, 143, 64 }, { 144, 144, 63 }, { 144, 146, 77 },
+	{ 144, 148, 62 }, { 144, 150, 61 }, { 144, 152, 60 }, { 146, 146, 95 }, { 147, 147, 89 }, { 147, 147, 97 },
+	{ 148, 148, 79 }, { 148, 148, 59 }, { 148, 150, 58 }, { 148, 151, 77 }, { 149, 153, 57 }, { 149, 158, 89 },
+	{ 150, 151, 56 }, { 151, 151, 55 }, { 151, 154, 54 }, { 152, 153, 104 }, { 152, 154, 58 }, { 153, 153, 61 },
+	{ 153, 154, 62 }, { 153, 156, 53 }, { 154, 155, 67 }, { 154, 155, 92 }, { 154, 155, 64 }, { 154, 156, 52 },
+	{ 154, 159, 51 }, { 154, 160, 50 }, { 155, 155, 76 }, { 155, 155, 104 }, { 155, 155, 69 }, { 156, 159, 49 },
+	{ 157, 157, 67 }, { 157, 159, 76 }, { 158, 158, 48 }, { 158, 159, 47 }, { 158, 159, 86 }, { 158, 159, 104 },
+	{ 158, 159, 45 }, { 158, 159, 69 }, { 158, 162, 52 }, { 159, 159, 44 }, { 159, 159, 42 }, { 159, 160, 92 },
+	{ 159, 161, 77 }, { 160, 166, 41 }, { 160, 167, 56 }, { 160, 168, 40 }, { 160, 172, 94 }, { 161, 161, 39 },
+	{ 161, 161, 38 }, { 162, 162, 37 }, { 164, 165, 39 }, { 164, 165, 36 }, { 167, 167, 38 }, { 168, 168, 77 },
+	{ 168, 173, 41 }, { 169, 169, 35 }, { 170, 171, 77 }, { 170, 173, 34 }, { 170, 174, 104 }, { 171, 171, 33 },
+	{ 171, 173, 32 }, { 174, 174, 31 }, { 174, 175, 30 }, { 175, 175, 29 }, { 176, 176, 61 }, { 176, 176, 28 },
+	{ 176, 176, 36 }, { 176, 177, 88 }, { 176, 177, 47 }, { 176, 180, 26 }, { 176, 182, 25 }, { 176, 184, 56 },
+	{ 176, 185, 104 }, { 176, 190, 24 }, { 178, 183, 23 }, { 179, 179, 22 }, { 179, 180, 109 }, { 180, 180, 21 },
+	{ 180, 181, 101 }, { 180, 183, 20 }, { 181, 181, 19 }, { 181, 182, 18 }, { 182, 182, 17 }, { 182, 183, 38 },
+	{ 183, 183, 16 }, { 183, 184, 15 }, { 183, 185, 14 }, { 183, 187, 13 }, { 184, 186, 65 }, { 184, 189, 12 },
+	{ 185, 188, 11 }, { 185, 191, 10 }, { 187, 187, 9 }, { 187, 188, 8 }, { 187, 190, 56 }, { 187, 191, 7 },
+	{ 188, 188, 92 }, { 188, 188, 65 }, { 188, 190, 6 }, { 188, 191, 104 }, { 188, 191, 5 }, { 189, 189, 90 },
+	{ 189, 189, 4 }, { 190, 190, 22 }, { 190, 190, 3 }, { 190, 191, 8 }, { 190, 191, 11 }, { 190, 191, 2 },
+	{ 191, 191, 1 }, { 191, 191, 60 }, { 191, 191, 44 }, { 191, 191, 38 }, { 168, 168, 107 }, { 191, 191, 107 },
+	{ 147, 147, 87 }, { 177, 177, 100 }, { 205, 205, 0 }, { 167, 167, 83 }, { 175, 175, 100 }, { 156, 156, 107 },
+	{ 176, 176, 100 }, { 130, 130, 107 }, { 131, 131, 91 }, { 131, 131, 100 }, { 160, 160, 107 }, { 172, 172, 103 },
+	{ 179, 179, 105 }, { 136, 136, 107 }, { 172, 172, 84 }, { 223, 223, 0 }, { 187, 187, 107 }, { 177, 177, 83 },
+	{ 169, 169, 83 }, { 156, 156, 100 }, { 171, 171, 84 }, { 161, 161, 87 }, { 183, 183, 83 }, { 153, 153, 87 },
+	{ 155, 155, 87 }, { 160, 160, 83 }, { 171, 171, 103 }, { 145, 145, 27 }, { 146, 146, 108 }, { 171, 171, 83 },
+	{ 181, 181, 105 }, { 149, 149, 103 }, { 164, 164, 87 }, { 169, 169, 84 }, { 153, 153, 100 }, { 155, 155, 100 },
+	{ 175, 175, 87 }, { 217, 217, 0 }, { 138, 138, 107 }, { 165, 165, 83 }, { 167, 167, 107 }, { 191, 191, 84 },
+	{ 194, 194, 0 }, { 189, 189, 93 }, { 141, 141, 100 }, { 170, 170, 100 }, { 142, 142, 103 }, { 165, 165, 87 },
+	{ 178, 178, 43 }, { 155, 155, 108 }, { 164, 164, 103 }, { 165, 165, 46 }, { 168, 168, 100 }, { 158, 158, 108 },
+	{ 171, 171, 87 }, { 161, 161, 83 }, { 169, 169, 87 }, { 173, 173, 100 }, { 213, 213, 0 }, { 170, 170, 107 },
+	{ 174, 174, 103 }, { 186, 186, 84 }, { 161, 161, 103 }, { 128, 128, 105 }, { 189, 189, 103 }, { 159, 159, 100 },
+	{ 219, 219, 0 }, { 169, 169, 103 }, { 184, 184, 93 }, { 191, 191, 83 }, { 143, 143, 103 }, { 185, 185, 83 },
+	{ 163, 163, 87 }, { 152, 152, 87 }, { 145, 145, 107 }, { 129, 129, 100 }, { 216, 216, 0 }, { 214, 214, 0 },
+	{ 129, 129, 107 }, { 170, 170, 73 }, { 157, 157, 108 }, { 206, 206, 0 }, { 147, 147, 107 }, { 135, 135, 107 },
+	{ 185, 185, 93 }, { 190, 190, 83 }, { 188, 188, 83 }, { 165, 165, 107 }, { 165, 165, 100 }, { 173, 173, 84 },
+	{ 178, 178, 83 }, { 224, 224, 0 }, { 150, 150, 108 }, { 151, 151, 107 }, { 167, 167, 87 }, { 234, 234, 0 },
+	{ 177, 177, 107 }, { 129, 129, 105 }, { 128, 128, 91 }, { 227, 227, 0 }, { 188, 188, 93 }, { 239, 239, 0 },
+	{ 153, 153, 107 }, { 185, 185, 105 }, { 220, 220, 0 }, { 179, 179, 100 }, { 169, 169, 107 }, { 160, 160, 100 },
+	{ 225, 225, 0 }, { 133, 133, 107 }, { 132, 132, 103 }, { 144, 144, 108 }, { 184, 184, 105 }, { 226, 226, 0 },
+	{ 131, 131, 107 }, { 145, 145, 108 }, { 240, 240, 0 }, { 215, 215, 0 },
+};
+static const uint16_t Ps_forward_state[] = {
+	0, 8, 13, 16, 18, 24, 31, 32, 33, 43, 53, 54,
+	58, 61, 72, 78, 85, 88, 89, 91, 93, 94, 95, 96,
+	98,
+};
+static const UTF8Range Ps_forward_range[] = {
+	{ 40, 40, 0 }, { 91, 91, 0 }, { 123, 123, 0 }, { 224, 224, 22 }, { 225, 225, 20 }, { 226, 226, 9 },
+	{ 227, 227, 7 }, { 239, 239, 1 }, { 180, 180, 6 }, { 184, 184, 5 }, { 185, 185, 4 }, { 188, 188, 3 },
+	{ 189, 189, 2 }, { 155, 155, 0 }, { 159, 159, 0 }, { 162, 162, 0 }, { 136, 136, 0 }, { 187, 187, 0 },
+	{ 129, 129, 0 }, { 131, 131, 0 }, { 135, 135, 0 }, { 153, 153, 0 }, { 155, 155, 0 }, { 157, 157, 0 },
+	{ 151, 151, 0 }, { 181, 181, 0 }, { 183, 183, 0 }, { 185, 185, 0 }, { 187, 187, 0 }, { 189, 189, 0 },
+	{ 191, 191, 0 }, { 191, 191, 0 }, { 128, 128, 8 }, { 136, 136, 0 }, { 138, 138, 0 }, { 140, 140, 0 },
+	{ 142, 142, 0 }, { 144, 144, 0 }, { 148, 148, 0 }, { 150, 150, 0 }, { 152, 152, 0 }, { 154, 154, 0 },
+	{ 157, 157, 0 }, { 128, 128, 19 }, { 129, 129, 18 }, { 130, 130, 17 }, { 140, 140, 16 }, { 157, 157, 15 },
+	{ 159, 159, 14 }, { 166, 166, 13 }, { 167, 167, 12 }, { 184, 184, 11 }, { 185, 185, 10 }, { 130, 130, 0 },
+	{ 162, 162, 0 }, { 164, 164, 0 }, { 166, 166, 0 }, { 168, 168, 0 }, { 152, 152, 0 }, { 154, 154, 0 },
+	{ 188, 188, 0 }, { 131, 131, 0 }, { 133, 133, 0 }, { 135, 135, 0 }, { 137, 137, 0 }, { 139, 139, 0 },
+	{ 141, 141, 0 }, { 143, 143, 0 }, { 145, 145, 0 }, { 147, 147, 0 }, { 149, 149, 0 }, { 151, 151, 0 },
+	{ 133, 133, 0 }, { 166, 166, 0 }, { 168, 168, 0 }, { 170, 170, 0 }, { 172, 172, 0 }, { 174, 174, 0 },
+	{ 168, 168, 0 }, { 170, 170, 0 }, { 172, 172, 0 }, { 174, 174, 0 }, { 176, 176, 0 }, { 178, 178, 0 },
+	{ 180, 180, 0 }, { 136, 136, 0 }, { 138, 138, 0 }, { 169, 169, 0 }, { 141, 141, 0 }, { 133, 133, 0 },
+	{ 189, 189, 0 }, { 154, 154, 0 }, { 158, 158, 0 }, { 154, 154, 21 }, { 155, 155, 0 }, { 188, 188, 23 },
+	{ 186, 186, 0 }, { 188, 188, 0 },
+};
+static const uint16_t Ps_reverse_state[] = {
+	0, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+	86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97,
+	98,
+};
+static const UTF8Range Ps_reverse_range[] = {
+	{ 40, 40, 0 }, { 91, 91, 0 }, { 123, 123, 0 }, { 129, 129, 22 }, { 130, 130, 20 }, { 131, 131, 22 },
+	{ 131, 131, 19 }, { 133, 133, 19 }, { 133, 133, 18 }, { 133, 133, 17 }, { 135, 135, 22 }, { 135, 135, 19 },
+	{ 136, 136, 16 }, { 136, 136, 14 }, { 136, 136, 13 }, { 137, 137, 19 }, { 138, 138, 14 }, { 138, 138, 13 },
+	{ 139, 139, 19 }, { 140, 140, 14 }, { 141, 141, 19 }, { 141, 141, 12 }, { 142, 142, 14 }, { 143, 143, 19 },
+	{ 144, 144, 14 }, { 145, 145, 19 }, { 147, 147, 19 }, { 148, 148, 14 }, { 149, 149, 19 }, { 150, 150, 14 },
+	{ 151, 151, 11 }, { 151, 151, 19 }, { 152, 152, 14 }, { 152, 152, 10 }, { 153, 153, 22 }, { 154, 154, 14 },
+	{ 154, 154, 10 }, { 154, 154, 9 }, { 155, 155, 8 }, { 155, 155, 22 }, { 155, 155, 6 }, { 157, 157, 22 },
+	{ 157, 157, 14 }, { 158, 158, 9 }, { 159, 159, 8 }, { 162, 162, 8 }, { 162, 162, 5 }, { 164, 164, 5 },
+	{ 166, 166, 5 }, { 166, 166, 18 }, { 168, 168, 5 }, { 168, 168, 18 }, { 168, 168, 4 }, { 169, 169, 13 },
+	{ 170, 170, 18 }, { 170, 170, 4 }, { 172, 172, 18 }, { 172, 172, 4 }, { 174, 174, 18 }, { 174, 174, 4 },
+	{ 176, 176, 4 }, { 178, 178, 4 }, { 180, 180, 4 }, { 181, 181, 11 }, { 183, 183, 11 }, { 185, 185, 11 },
+	{ 186, 186, 2 }, { 187, 187, 16 }, { 187, 187, 11 }, { 188, 188, 10 }, { 188, 188, 2 }, { 189, 189, 11 },
+	{ 189, 189, 17 }, { 191, 191, 11 }, { 191, 191, 1 }, { 180, 180, 23 }, { 188, 188, 3 }, { 224, 224, 0 },
+	{ 157, 157, 21 }, { 184, 184, 21 }, { 154, 154, 7 }, { 225, 225, 0 }, { 189, 189, 23 }, { 128, 128, 21 },
+	{ 167, 167, 21 }, { 184, 184, 23 }, { 130, 130, 21 }, { 140, 140, 21 }, { 128, 128, 15 }, { 227, 227, 0 },
+	{ 188, 188, 23 }, { 129, 129, 21 }, { 159, 159, 21 }, { 166, 166, 21 }, { 185, 185, 21 }, { 226, 226, 0 },
+	{ 185, 185, 23 }, { 239, 239, 0 },
+};
+static const uint16_t Psalter_Pahlavi_forward_state[] = {
+	0, 1, 2, 3, 6,
+};
+static const UTF8Range Psalter_Pahlavi_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 174, 174, 3 }, { 128, 145, 0 }, { 153, 156, 0 }, { 169, 175, 0 },
+};
+static const uint16_t Psalter_Pahlavi_reverse_state[] = {
+	0, 3, 4, 5, 6,
+};
+static const UTF8Range Psalter_Pahlavi_reverse_range[] = {
+	{ 128, 145, 1 }, { 153, 156, 1 }, { 169, 175, 1 }, { 174, 174, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Rejang_forward_state[] = {
+	0, 1, 3, 5, 6,
+};
+static const UTF8Range Rejang_forward_range[] = {
+	{ 234, 234, 1 }, { 164, 164, 3 }, { 165, 165, 2 }, { 128, 147, 0 }, { 159, 159, 0 }, { 176, 191, 0 },
+};
+static const uint16_t Rejang_reverse_state[] = {
+	0, 3, 4, 5, 6,
+};
+static const UTF8Range Rejang_reverse_range[] = {
+	{ 128, 147, 2 }, { 159, 159, 2 }, { 176, 191, 1 }, { 164, 164, 3 }, { 165, 165, 3 }, { 234, 234, 0 },
+};
+static const uint16_t Runic_forward_state[] = {
+	0, 1, 3, 5, 6,
+};
+static const UTF8Range Runic_forward_range[] = {
+	{ 225, 225, 1 }, { 154, 154, 3 }, { 155, 155, 2 }, { 128, 170, 0 }, { 174, 184, 0 }, { 160, 191, 0 },
+};
+static const uint16_t Runic_reverse_state[] = {
+	0, 3, 4, 5, 6,
+};
+static const UTF8Range Runic_reverse_range[] = {
+	{ 128, 170, 2 }, { 160, 191, 1 }, { 174, 184, 2 }, { 154, 154, 3 }, { 155, 155, 3 }, { 225, 225, 0 },
+};
+static const uint16_t S_forward_state[] = {
+	0, 26, 33, 63, 65, 67, 70, 74, 76, 78, 81, 84,
+	86, 88, 91, 94, 96, 97, 98, 99, 101, 104, 106, 111,
+	112, 113, 115, 116, 135, 137, 139, 140, 141, 143, 145, 147,
+	150, 151, 153, 154, 157, 159, 161, 162, 163, 164, 166, 167,
+	168, 170, 171, 177, 178, 179, 180, 184, 185, 186, 194, 197,
+	200, 204, 207, 208, 209, 210, 211, 218, 220, 221, 223, 224,
+	226, 227, 228, 229, 237, 238, 241, 243, 244, 246, 247, 252,
+	281, 283, 284, 286, 287, 288, 290, 292, 295, 297, 300, 301,
+	302, 303, 304, 305, 306, 309, 310, 312, 315, 326, 328, 331,
+	340, 345, 347, 349, 350, 351, 352, 353, 354, 355, 365, 369,
+	370, 377, 379, 380, 381, 382, 383, 385, 387, 390, 393, 394,
+	395, 396, 397, 398, 403, 405, 411,
+};
+static const UTF8Range S_forward_range[] = {
+	{ 36, 36, 0 }, { 43, 43, 0 }, { 60, 62, 0 }, { 94, 94, 0 }, { 96, 96, 0 }, { 124, 124, 0 },
+	{ 126, 126, 0 }, { 194, 194, 137 }, { 195, 195, 136 }, { 203, 203, 135 }, { 205, 205, 134 }, { 206, 206, 133 },
+	{ 207, 207, 132 }, { 210, 210, 131 }, { 214, 214, 130 }, { 216, 216, 129 }, { 219, 219, 128 }, { 223, 223, 127 },
+	{ 224, 224, 117 }, { 225, 225, 107 }, { 226, 226, 83 }, { 227, 227, 75 }, { 228, 228, 74 }, { 234, 234, 66 },
+	{ 239, 239, 57 }, { 240, 240, 1 }, { 144, 144, 50 }, { 145, 145, 48 }, { 150, 150, 45 }, { 155, 155, 43 },
+	{ 157, 157, 27 }, { 158, 158, 22 }, { 159, 159, 2 }, { 128, 128, 21 }, { 129, 129, 101 }, { 130, 130, 20 },
+	{ 131, 131, 19 }, { 132, 132, 18 }, { 133, 133, 101 }, { 134, 134, 17 }, { 135, 135, 16 }, { 136, 136, 15 },
+	{ 137, 137, 14 }, { 140, 154, 101 }, { 155, 155, 13 }, { 156, 156, 101 }, { 157, 157, 85 }, { 158, 158, 101 },
+	{ 159, 159, 12 }, { 160, 160, 11 }, { 161, 161, 10 }, { 162, 162, 9 }, { 164, 164, 101 }, { 165, 165, 8 },
+	{ 166, 166, 101 }, { 167, 167, 7 }, { 168, 168, 101 }, { 169, 169, 6 }, { 170, 170, 5 }, { 171, 171, 4 },
+	{ 172, 173, 101 }, { 174, 174, 3 }, { 175, 175, 98 }, { 128, 146, 0 }, { 148, 191, 0 }, { 128, 130, 0 },
+	{ 144, 150, 0 }, { 128, 134, 0 }, { 144, 168, 0 }, { 176, 182, 0 }, { 128, 147, 0 }, { 160, 173, 0 },
+	{ 176, 180, 0 }, { 184, 186, 0 }, { 128, 139, 0 }, { 141, 191, 0 }, { 128, 184, 0 }, { 186, 191, 0 },
+	{ 128, 135, 0 }, { 144, 173, 0 }, { 176, 177, 0 }, { 128, 135, 0 }, { 144, 153, 0 }, { 160, 191, 0 },
+	{ 128, 139, 0 }, { 144, 191, 0 }, { 128, 152, 0 }, { 160, 171, 0 }, { 128, 151, 0 }, { 160, 172, 0 },
+	{ 176, 188, 0 }, { 128, 136, 0 }, { 144, 145, 0 }, { 160, 165, 0 }, { 128, 130, 0 }, { 144, 187, 0 },
+	{ 166, 191, 0 }, { 128, 173, 0 }, { 141, 191, 0 }, { 129, 143, 0 }, { 145, 181, 0 }, { 128, 147, 0 },
+	{ 160, 174, 0 }, { 177, 191, 0 }, { 128, 171, 0 }, { 176, 191, 0 }, { 133, 133, 26 }, { 139, 139, 122 },
+	{ 178, 178, 25 }, { 180, 180, 24 }, { 187, 187, 23 }, { 176, 177, 0 }, { 174, 174, 0 }, { 172, 172, 0 },
+	{ 176, 176, 0 }, { 143, 143, 0 }, { 128, 130, 101 }, { 131, 131, 42 }, { 132, 132, 41 }, { 133, 133, 40 },
+	{ 134, 134, 39 }, { 135, 135, 38 }, { 136, 136, 101 }, { 137, 137, 37 }, { 140, 140, 101 }, { 141, 141, 36 },
+	{ 155, 155, 35 }, { 156, 156, 34 }, { 157, 157, 33 }, { 158, 158, 32 }, { 159, 159, 31 }, { 160, 167, 101 },
+	{ 168, 168, 30 }, { 169, 169, 29 }, { 170, 170, 28 }, { 128, 131, 0 }, { 133, 134, 0 }, { 173, 180, 0 },
+	{ 182, 191, 0 }, { 183, 186, 0 }, { 131, 131, 0 }, { 137, 137, 0 }, { 169, 169, 0 }, { 143, 143, 0 },
+	{ 175, 175, 0 }, { 149, 149, 0 }, { 181, 181, 0 }, { 129, 129, 0 }, { 155, 155, 0 }, { 187, 187, 0 },
+	{ 128, 150, 0 }, { 128, 129, 0 }, { 133, 133, 0 }, { 128, 168, 0 }, { 131, 132, 0 }, { 140, 169, 0 },
+	{ 174, 191, 0 }, { 128, 164, 0 }, { 170, 172, 0 }, { 128, 166, 0 }, { 169, 191, 0 }, { 128, 181, 0 },
+	{ 178, 178, 44 }, { 156, 156, 0 }, { 172, 172, 47 }, { 173, 173, 46 }, { 133, 133, 0 }, { 188, 191, 0 },
+	{ 156, 156, 122 }, { 191, 191, 49 }, { 149, 177, 0 }, { 132, 132, 56 }, { 133, 133, 55 }, { 134, 134, 54 },
+	{ 135, 135, 53 }, { 161, 161, 52 }, { 171, 171, 51 }, { 136, 136, 0 }, { 183, 184, 0 }, { 144, 188, 0 },
+	{ 128, 137, 0 }, { 140, 142, 0 }, { 144, 156, 0 }, { 160, 160, 0 }, { 185, 191, 0 }, { 183, 191, 0 },
+	{ 172, 172, 65 }, { 174, 174, 64 }, { 175, 175, 63 }, { 183, 183, 62 }, { 185, 185, 61 }, { 188, 188, 60 },
+	{ 189, 189, 59 }, { 191, 191, 58 }, { 160, 166, 0 }, { 168, 174, 0 }, { 188, 189, 0 }, { 128, 128, 0 },
+	{ 156, 156, 0 }, { 158, 158, 0 }, { 132, 132, 0 }, { 139, 139, 0 }, { 156, 158, 0 }, { 190, 190, 0 },
+	{ 162, 162, 0 }, { 164, 166, 0 }, { 169, 169, 0 }, { 188, 189, 0 }, { 128, 129, 0 }, { 178, 191, 0 },
+	{ 169, 169, 0 }, { 146, 146, 73 }, { 147, 147, 72 }, { 156, 156, 71 }, { 158, 158, 70 }, { 160, 160, 69 },
+	{ 169, 169, 68 }, { 173, 173, 67 }, { 155, 155, 0 }, { 170, 171, 0 }, { 183, 185, 0 }, { 168, 171, 0 },
+	{ 182, 185, 0 }, { 137, 138, 0 }, { 128, 150, 0 }, { 160, 161, 0 }, { 128, 134, 0 }, { 144, 191, 0 },
+	{ 183, 183, 101 }, { 128, 128, 82 }, { 130, 130, 81 }, { 134, 134, 80 }, { 135, 135, 79 }, { 136, 136, 78 },
+	{ 137, 137, 77 }, { 138, 138, 76 }, { 139, 143, 101 }, { 138, 176, 0 }, { 128, 135, 0 }, { 144, 144, 0 },
+	{ 160, 191, 0 }, { 128, 158, 0 }, { 170, 191, 0 }, { 128, 163, 0 }, { 144, 145, 0 }, { 150, 159, 0 },
+	{ 155, 156, 0 }, { 132, 132, 0 }, { 146, 147, 0 }, { 160, 160, 0 }, { 182, 183, 0 }, { 190, 191, 0 },
+	{ 129, 129, 106 }, { 130, 130, 105 }, { 132, 132, 104 }, { 133, 133, 103 }, { 134, 134, 102 }, { 135, 139, 101 },
+	{ 140, 140, 100 }, { 141, 143, 101 }, { 144, 144, 99 }, { 145, 145, 98 }, { 146, 146, 97 }, { 147, 147, 96 },
+	{ 148, 156, 101 }, { 157, 157, 95 }, { 158, 158, 94 }, { 159, 159, 93 }, { 160, 165, 101 }, { 166, 166, 92 },
+	{ 167, 167, 91 }, { 168, 172, 101 }, { 173, 173, 90 }, { 174, 174, 89 }, { 175, 175, 101 }, { 179, 179, 88 },
+	{ 185, 185, 87 }, { 186, 186, 86 }, { 187, 187, 85 }, { 188, 190, 101 }, { 191, 191, 84 }, { 128, 149, 0 },
+	{ 176, 187, 0 }, { 128, 179, 0 }, { 128, 153, 0 }, { 155, 191, 0 }, { 144, 145, 0 }, { 165, 170, 0 },
+	{ 128, 149, 0 }, { 151, 191, 0 }, { 128, 179, 0 }, { 182, 191, 0 }, { 128, 151, 0 }, { 156, 187, 0 },
+	{ 190, 191, 0 }, { 128, 130, 0 }, { 153, 191, 0 }, { 128, 132, 0 }, { 135, 165, 0 }, { 176, 191, 0 },
+	{ 148, 191, 0 }, { 128, 167, 0 }, { 128, 169, 0 }, { 156, 191, 0 }, { 128, 138, 0 }, { 128, 166, 0 },
+	{ 128, 135, 0 }, { 140, 168, 0 }, { 171, 191, 0 }, { 128, 191, 0 }, { 138, 139, 0 }, { 144, 191, 0 },
+	{ 128, 132, 0 }, { 138, 141, 0 }, { 143, 143, 0 }, { 128, 129, 0 }, { 131, 134, 0 }, { 136, 137, 0 },
+	{ 148, 148, 0 }, { 150, 152, 0 }, { 158, 163, 0 }, { 165, 165, 0 }, { 167, 167, 0 }, { 169, 169, 0 },
+	{ 174, 174, 0 }, { 186, 187, 0 }, { 138, 140, 0 }, { 160, 191, 0 }, { 132, 132, 0 }, { 146, 146, 0 },
+	{ 186, 188, 0 }, { 130, 130, 116 }, { 142, 142, 115 }, { 153, 153, 114 }, { 159, 159, 113 }, { 165, 165, 112 },
+	{ 167, 167, 111 }, { 173, 173, 110 }, { 190, 190, 109 }, { 191, 191, 108 }, { 128, 129, 0 }, { 141, 143, 0 },
+	{ 157, 159, 0 }, { 173, 175, 0 }, { 189, 190, 0 }, { 189, 189, 0 }, { 191, 191, 0 }, { 161, 170, 0 },
+	{ 180, 188, 0 }, { 158, 191, 0 }, { 128, 128, 0 }, { 155, 155, 0 }, { 173, 173, 0 }, { 144, 153, 0 },
+	{ 158, 159, 0 }, { 167, 167, 126 }, { 171, 171, 125 }, { 173, 173, 124 }, { 175, 175, 123 }, { 177, 177, 122 },
+	{ 181, 181, 121 }, { 184, 184, 122 }, { 188, 188, 120 }, { 190, 190, 119 }, { 191, 191, 118 }, { 128, 133, 0 },
+	{ 135, 140, 0 }, { 142, 143, 0 }, { 149, 152, 0 }, { 190, 191, 0 }, { 129, 131, 0 }, { 147, 147, 0 },
+	{ 149, 151, 0 }, { 154, 159, 0 }, { 180, 180, 0 }, { 182, 182, 0 }, { 184, 184, 0 }, { 143, 143, 0 },
+	{ 185, 185, 0 }, { 191, 191, 0 }, { 179, 186, 0 }, { 176, 176, 0 }, { 177, 177, 0 }, { 178, 179, 0 },
+	{ 186, 187, 0 }, { 182, 182, 0 }, { 190, 191, 0 }, { 158, 158, 0 }, { 169, 169, 0 }, { 189, 190, 0 },
+	{ 134, 136, 0 }, { 139, 139, 0 }, { 142, 143, 0 }, { 141, 143, 0 }, { 130, 130, 0 }, { 182, 182, 0 },
+	{ 132, 133, 0 }, { 181, 181, 0 }, { 130, 133, 0 }, { 146, 159, 0 }, { 165, 171, 0 }, { 173, 173, 0 },
+	{ 175, 191, 0 }, { 151, 151, 0 }, { 183, 183, 0 }, { 162, 166, 0 }, { 168, 169, 0 }, { 172, 172, 0 },
+	{ 174, 177, 0 }, { 180, 180, 0 }, { 184, 184, 0 },
+};
+static const uint16_t S_reverse_state[] = {
+	0, 248, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261,
+	262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273,
+	274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285,
+	286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297,
+	298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309,
+	310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321,
+	322, 323, 324, 325, 326, 327, 349, 350, 351, 352, 353, 355,
+	356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367,
+	368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 380,
+	381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392,
+	393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404,
+	405, 406, 407, 408, 409, 410, 411,
+};
+static const UTF8Range S_reverse_range[] = {
+	{ 36, 36, 0 }, { 43, 43, 0 }, { 60, 62, 0 }, { 94, 94, 0 }, { 96, 96, 0 }, { 124, 124, 0 },
+	{ 126, 126, 0 }, { 128, 128, 136 }, { 128, 128, 134 }, { 128, 129, 131 }, { 128, 129, 130 }, { 128, 129, 128 },
+	{ 128, 129, 127 }, { 128, 130, 125 }, { 128, 130, 124 }, { 128, 130, 123 }, { 128, 131, 122 }, { 128, 132, 121 },
+	{ 128, 132, 120 }, { 128, 133, 118 }, { 128, 134, 117 }, { 128, 134, 115 }, { 128, 135, 114 }, { 128, 135, 113 },
+	{ 128, 135, 111 }, { 128, 135, 110 }, { 128, 136, 109 }, { 128, 137, 107 }, { 128, 138, 106 }, { 128, 139, 105 },
+	{ 128, 139, 104 }, { 128, 146, 103 }, { 128, 147, 102 }, { 128, 147, 101 }, { 128, 149, 100 }, { 128, 149, 99 },
+	{ 128, 150, 98 }, { 128, 150, 97 }, { 128, 151, 96 }, { 128, 151, 95 }, { 128, 152, 94 }, { 128, 153, 93 },
+	{ 128, 158, 92 }, { 128, 163, 91 }, { 128, 164, 90 }, { 128, 166, 89 }, { 128, 166, 88 }, { 128, 167, 87 },
+	{ 128, 168, 86 }, { 128, 169, 85 }, { 128, 171, 84 }, { 128, 173, 83 }, { 128, 179, 82 }, { 128, 179, 81 },
+	{ 128, 181, 80 }, { 128, 184, 79 }, { 128, 191, 77 }, { 129, 129, 76 }, { 129, 131, 75 }, { 129, 143, 74 },
+	{ 130, 130, 73 }, { 130, 133, 72 }, { 131, 131, 71 }, { 131, 132, 70 }, { 131, 134, 128 }, { 132, 132, 69 },
+	{ 132, 132, 68 }, { 132, 132, 67 }, { 132, 133, 66 }, { 133, 133, 131 }, { 133, 133, 64 }, { 133, 134, 122 },
+	{ 134, 136, 63 }, { 135, 140, 118 }, { 135, 165, 121 }, { 136, 136, 62 }, { 136, 137, 128 }, { 137, 137, 61 },
+	{ 137, 138, 60 }, { 138, 139, 59 }, { 138, 140, 58 }, { 138, 141, 120 }, { 138, 176, 57 }, { 139, 139, 69 },
+	{ 139, 139, 63 }, { 140, 142, 107 }, { 140, 168, 110 }, { 140, 169, 70 }, { 141, 143, 127 }, { 141, 143, 56 },
+	{ 141, 191, 105 }, { 141, 191, 55 }, { 142, 143, 118 }, { 142, 143, 63 }, { 143, 143, 53 }, { 143, 143, 52 },
+	{ 143, 143, 120 }, { 143, 143, 51 }, { 144, 144, 111 }, { 144, 145, 109 }, { 144, 145, 50 }, { 144, 145, 49 },
+	{ 144, 150, 125 }, { 144, 153, 113 }, { 144, 153, 48 }, { 144, 156, 107 }, { 144, 168, 117 }, { 144, 173, 114 },
+	{ 144, 187, 124 }, { 144, 188, 47 }, { 144, 191, 104 }, { 144, 191, 46 }, { 144, 191, 59 }, { 145, 181, 74 },
+	{ 146, 146, 67 }, { 146, 147, 68 }, { 146, 159, 72 }, { 147, 147, 75 }, { 148, 148, 128 }, { 148, 191, 103 },
+	{ 148, 191, 45 }, { 149, 149, 44 }, { 149, 151, 75 }, { 149, 152, 118 }, { 149, 177, 42 }, { 150, 152, 128 },
+	{ 150, 159, 50 }, { 151, 151, 41 }, { 151, 191, 99 }, { 153, 191, 123 }, { 154, 159, 75 }, { 155, 155, 76 },
+	{ 155, 155, 40 }, { 155, 155, 39 }, { 155, 156, 38 }, { 155, 191, 93 }, { 156, 156, 36 }, { 156, 156, 136 },
+	{ 156, 158, 69 }, { 156, 187, 95 }, { 156, 191, 35 }, { 157, 159, 127 }, { 158, 158, 136 }, { 158, 158, 34 },
+	{ 158, 159, 33 }, { 158, 163, 128 }, { 158, 191, 32 }, { 160, 160, 107 }, { 160, 160, 68 }, { 160, 161, 97 },
+	{ 160, 165, 109 }, { 160, 166, 31 }, { 160, 171, 94 }, { 160, 172, 96 }, { 160, 173, 102 }, { 160, 174, 101 },
+	{ 160, 191, 113 }, { 160, 191, 111 }, { 160, 191, 58 }, { 161, 170, 30 }, { 162, 162, 29 }, { 162, 166, 28 },
+	{ 164, 166, 29 }, { 165, 165, 128 }, { 165, 170, 27 }, { 165, 171, 72 }, { 166, 191, 26 }, { 167, 167, 128 },
+	{ 168, 169, 28 }, { 168, 171, 25 }, { 168, 174, 31 }, { 169, 169, 61 }, { 169, 169, 29 }, { 169, 169, 24 },
+	{ 169, 169, 128 }, { 169, 169, 34 }, { 169, 191, 89 }, { 170, 171, 40 }, { 170, 172, 90 }, { 170, 191, 92 },
+	{ 171, 191, 110 }, { 172, 172, 23 }, { 172, 172, 28 }, { 173, 173, 22 }, { 173, 173, 72 }, { 173, 175, 127 },
+	{ 173, 180, 21 }, { 174, 174, 20 }, { 174, 174, 128 }, { 174, 177, 28 }, { 174, 191, 70 }, { 175, 175, 52 },
+	{ 175, 191, 72 }, { 176, 176, 23 }, { 176, 176, 19 }, { 176, 177, 114 }, { 176, 177, 18 }, { 176, 180, 102 },
+	{ 176, 182, 117 }, { 176, 187, 100 }, { 176, 188, 96 }, { 176, 191, 84 }, { 176, 191, 121 }, { 177, 177, 17 },
+	{ 177, 191, 101 }, { 178, 179, 16 }, { 178, 191, 15 }, { 179, 186, 14 }, { 180, 180, 75 }, { 180, 180, 28 },
+	{ 180, 188, 30 }, { 181, 181, 44 }, { 181, 181, 13 }, { 182, 182, 75 }, { 182, 182, 12 }, { 182, 182, 11 },
+	{ 182, 183, 68 }, { 182, 185, 25 }, { 182, 191, 21 }, { 182, 191, 81 }, { 183, 183, 41 }, { 183, 184, 10 },
+	{ 183, 185, 9 }, { 183, 186, 8 }, { 183, 191, 7 }, { 184, 184, 75 }, { 184, 184, 28 }, { 184, 186, 102 },
+	{ 185, 185, 51 }, { 185, 191, 6 }, { 186, 187, 128 }, { 186, 187, 16 }, { 186, 188, 67 }, { 186, 191, 79 },
+	{ 187, 187, 76 }, { 188, 189, 31 }, { 188, 189, 5 }, { 188, 191, 4 }, { 189, 189, 3 }, { 189, 190, 127 },
+	{ 189, 190, 34 }, { 190, 190, 69 }, { 190, 191, 68 }, { 190, 191, 95 }, { 190, 191, 2 }, { 190, 191, 12 },
+	{ 191, 191, 3 }, { 191, 191, 1 }, { 139, 139, 54 }, { 156, 156, 43 }, { 177, 177, 119 }, { 184, 184, 119 },
+	{ 190, 190, 119 }, { 190, 190, 135 }, { 172, 172, 65 }, { 183, 183, 137 }, { 133, 133, 108 }, { 132, 132, 108 },
+	{ 168, 168, 132 }, { 169, 169, 116 }, { 161, 161, 108 }, { 207, 207, 0 }, { 223, 223, 0 }, { 205, 205, 0 },
+	{ 175, 175, 119 }, { 174, 174, 137 }, { 167, 167, 119 }, { 171, 171, 119 }, { 187, 187, 54 }, { 173, 173, 119 },
+	{ 180, 180, 54 }, { 169, 169, 132 }, { 153, 153, 135 }, { 178, 178, 54 }, { 172, 172, 137 }, { 160, 160, 116 },
+	{ 135, 135, 126 }, { 179, 179, 129 }, { 194, 194, 0 }, { 185, 185, 137 }, { 173, 173, 135 }, { 191, 191, 137 },
+	{ 167, 167, 135 }, { 130, 130, 135 }, { 219, 219, 0 }, { 146, 146, 129 }, { 178, 178, 37 }, { 155, 155, 133 },
+	{ 130, 130, 112 }, { 159, 159, 135 }, { 173, 173, 116 }, { 195, 195, 0 }, { 191, 191, 43 }, { 145, 145, 133 },
+	{ 156, 156, 132 }, { 158, 158, 129 }, { 146, 146, 116 }, { 135, 135, 108 }, { 142, 142, 135 }, { 185, 185, 129 },
+	{ 134, 134, 112 }, { 181, 181, 119 }, { 157, 157, 132 }, { 133, 133, 54 }, { 158, 158, 133 }, { 132, 132, 126 },
+	{ 214, 214, 0 }, { 138, 138, 112 }, { 130, 130, 129 }, { 134, 134, 129 }, { 158, 158, 116 }, { 158, 158, 132 },
+	{ 171, 171, 108 }, { 216, 216, 0 }, { 173, 173, 65 }, { 150, 150, 133 }, { 206, 206, 0 }, { 129, 129, 129 },
+	{ 128, 128, 112 }, { 188, 188, 137 }, { 134, 134, 132 }, { 159, 159, 132 }, { 203, 203, 0 }, { 210, 210, 0 },
+	{ 131, 131, 126 }, { 188, 188, 119 }, { 155, 155, 132 }, { 128, 130, 132 }, { 129, 129, 126 }, { 133, 133, 126 },
+	{ 135, 139, 129 }, { 136, 136, 132 }, { 139, 143, 112 }, { 140, 140, 132 }, { 140, 154, 126 }, { 141, 143, 129 },
+	{ 148, 156, 129 }, { 156, 156, 126 }, { 158, 158, 126 }, { 160, 165, 129 }, { 160, 167, 132 }, { 164, 164, 126 },
+	{ 166, 166, 126 }, { 168, 168, 126 }, { 168, 172, 129 }, { 172, 173, 126 }, { 175, 175, 129 }, { 183, 183, 78 },
+	{ 188, 190, 129 }, { 228, 228, 0 }, { 165, 165, 126 }, { 131, 131, 132 }, { 173, 173, 129 }, { 157, 157, 126 },
+	{ 187, 187, 129 }, { 134, 134, 126 }, { 128, 128, 126 }, { 147, 147, 129 }, { 135, 135, 132 }, { 157, 157, 129 },
+	{ 144, 144, 129 }, { 132, 132, 132 }, { 133, 133, 132 }, { 135, 135, 112 }, { 136, 136, 112 }, { 186, 186, 129 },
+	{ 159, 159, 126 }, { 167, 167, 129 }, { 155, 155, 126 }, { 156, 156, 116 }, { 141, 141, 132 }, { 174, 174, 129 },
+	{ 191, 191, 129 }, { 130, 130, 126 }, { 169, 169, 126 }, { 174, 174, 126 }, { 160, 160, 126 }, { 167, 167, 126 },
+	{ 145, 145, 129 }, { 175, 175, 126 }, { 134, 134, 108 }, { 144, 144, 133 }, { 137, 137, 126 }, { 140, 140, 129 },
+	{ 137, 137, 112 }, { 227, 227, 0 }, { 161, 161, 126 }, { 162, 162, 126 }, { 147, 147, 116 }, { 234, 234, 0 },
+	{ 170, 170, 126 }, { 191, 191, 119 }, { 224, 224, 0 }, { 133, 133, 129 }, { 159, 159, 129 }, { 170, 170, 132 },
+	{ 166, 166, 129 }, { 136, 136, 126 }, { 171, 171, 126 }, { 159, 159, 133 }, { 191, 191, 135 }, { 132, 132, 129 },
+	{ 226, 226, 0 }, { 175, 175, 137 }, { 137, 137, 132 }, { 157, 157, 133 }, { 240, 240, 0 }, { 165, 165, 135 },
+	{ 225, 225, 0 }, { 189, 189, 137 }, { 239, 239, 0 },
+};
+static const uint16_t Samaritan_forward_state[] = {
+	0, 1, 2, 4,
+};
+static const UTF8Range Samaritan_forward_range[] = {
+	{ 224, 224, 1 }, { 160, 160, 2 }, { 128, 173, 0 }, { 176, 190, 0 },
+};
+static const uint16_t Samaritan_reverse_state[] = {
+	0, 2, 3, 4,
+};
+static const UTF8Range Samaritan_reverse_range[] = {
+	{ 128, 173, 1 }, { 176, 190, 1 }, { 160, 160, 2 }, { 224, 224, 0 },
+};
+static const uint16_t Saurashtra_forward_state[] = {
+	0, 1, 3, 5, 6,
+};
+static const UTF8Range Saurashtra_forward_range[] = {
+	{ 234, 234, 1 }, { 162, 162, 3 }, { 163, 163, 2 }, { 128, 133, 0 }, { 142, 153, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Saurashtra_reverse_state[] = {
+	0, 3, 4, 5, 6,
+};
+static const UTF8Range Saurashtra_reverse_range[] = {
+	{ 128, 133, 2 }, { 128, 191, 1 }, { 142, 153, 2 }, { 162, 162, 3 }, { 163, 163, 3 }, { 234, 234, 0 },
+};
+static const uint16_t Sc_forward_state[] = {
+	0, 11, 13, 15, 16, 17, 18, 22, 24, 25, 26, 27,
+	28, 29, 30, 31, 32, 33, 37, 38, 39, 40, 42, 43,
+	44, 45, 46,
+};
+static const UTF8Range Sc_forward_range[] = {
+	{ 36, 36, 0 }, { 194, 194, 25 }, { 214, 214, 24 }, { 216, 216, 23 }, { 223, 223, 22 }, { 224, 224, 17 },
+	{ 225, 225, 15 }, { 226, 226, 13 }, { 234, 234, 11 }, { 239, 239, 6 }, { 240, 240, 1 }, { 145, 145, 4 },
+	{ 158, 158, 2 }, { 139, 139, 18 }, { 178, 178, 3 }, { 176, 176, 0 }, { 191, 191, 5 }, { 157, 160, 0 },
+	{ 183, 183, 10 }, { 185, 185, 9 }, { 188, 188, 8 }, { 191, 191, 7 }, { 160, 161, 0 }, { 165, 166, 0 },
+	{ 132, 132, 0 }, { 169, 169, 0 }, { 188, 188, 0 }, { 160, 160, 12 }, { 184, 184, 0 }, { 130, 130, 14 },
+	{ 160, 191, 0 }, { 159, 159, 16 }, { 155, 155, 0 }, { 167, 167, 21 }, { 171, 171, 20 }, { 175, 175, 19 },
+	{ 184, 184, 18 }, { 191, 191, 0 }, { 185, 185, 0 }, { 177, 177, 0 }, { 178, 179, 0 }, { 187, 187, 0 },
+	{ 190, 191, 0 }, { 139, 139, 0 }, { 143, 143, 0 }, { 162, 165, 0 },
+};
+static const uint16_t Sc_reverse_state[] = {
+	0, 20, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43,
+	44, 45, 46,
+};
+static const UTF8Range Sc_reverse_range[] = {
+	{ 36, 36, 0 }, { 132, 132, 24 }, { 139, 139, 23 }, { 143, 143, 22 }, { 155, 155, 20 }, { 157, 160, 17 },
+	{ 160, 161, 16 }, { 160, 191, 14 }, { 162, 165, 13 }, { 165, 166, 16 }, { 169, 169, 12 }, { 176, 176, 10 },
+	{ 177, 177, 8 }, { 178, 179, 7 }, { 184, 184, 5 }, { 185, 185, 4 }, { 187, 187, 7 }, { 188, 188, 3 },
+	{ 190, 191, 2 }, { 191, 191, 1 }, { 139, 139, 11 }, { 184, 184, 9 }, { 223, 223, 0 }, { 183, 183, 25 },
+	{ 175, 175, 9 }, { 160, 160, 6 }, { 234, 234, 0 }, { 167, 167, 9 }, { 171, 171, 9 }, { 224, 224, 0 },
+	{ 178, 178, 11 }, { 158, 158, 19 }, { 185, 185, 25 }, { 194, 194, 0 }, { 130, 130, 15 }, { 226, 226, 0 },
+	{ 191, 191, 25 }, { 191, 191, 18 }, { 145, 145, 19 }, { 240, 240, 0 }, { 159, 159, 21 }, { 225, 225, 0 },
+	{ 214, 214, 0 }, { 216, 216, 0 }, { 188, 188, 25 }, { 239, 239, 0 },
+};
+static const uint16_t Sharada_forward_state[] = {
+	0, 1, 2, 4, 5, 6,
+};
+static const UTF8Range Sharada_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 134, 134, 4 }, { 135, 135, 3 }, { 128, 159, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Sharada_reverse_state[] = {
+	0, 2, 3, 4, 5, 6,
+};
+static const UTF8Range Sharada_reverse_range[] = {
+	{ 128, 159, 2 }, { 128, 191, 1 }, { 134, 134, 3 }, { 135, 135, 3 }, { 145, 145, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Shavian_forward_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Shavian_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 145, 145, 3 }, { 144, 191, 0 },
+};
+static const uint16_t Shavian_reverse_state[] = {
+	0, 1, 2, 3, 4,
+};
+static const UTF8Range Shavian_reverse_range[] = {
+	{ 144, 191, 1 }, { 145, 145, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Siddham_forward_state[] = {
+	0, 1, 2, 4, 5, 7,
+};
+static const UTF8Range Siddham_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 150, 150, 4 }, { 151, 151, 3 }, { 128, 157, 0 }, { 128, 181, 0 },
+	{ 184, 191, 0 },
+};
+static const uint16_t Siddham_reverse_state[] = {
+	0, 3, 4, 5, 6, 7,
+};
+static const UTF8Range Siddham_reverse_range[] = {
+	{ 128, 157, 2 }, { 128, 181, 1 }, { 184, 191, 1 }, { 150, 150, 3 }, { 151, 151, 3 }, { 145, 145, 4 },
+	{ 240, 240, 0 },
+};
+static const uint16_t SignWriting_forward_state[] = {
+	0, 1, 2, 4, 7, 8,
+};
+static const UTF8Range SignWriting_forward_range[] = {
+	{ 240, 240, 1 }, { 157, 157, 2 }, { 160, 169, 4 }, { 170, 170, 3 }, { 128, 139, 0 }, { 155, 159, 0 },
+	{ 161, 175, 0 }, { 128, 191, 0 },
+};
+static const uint16_t SignWriting_reverse_state[] = {
+	0, 4, 5, 6, 7, 8,
+};
+static const UTF8Range SignWriting_reverse_range[] = {
+	{ 128, 139, 2 }, { 128, 191, 1 }, { 155, 159, 2 }, { 161, 175, 2 }, { 160, 169, 3 }, { 170, 170, 3 },
+	{ 157, 157, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Sinhala_forward_state[] = {
+	0, 2, 3, 4, 5, 7, 14, 19,
+};
+static const UTF8Range Sinhala_forward_range[] = {
+	{ 224, 224, 4 }, { 240, 240, 1 }, { 145, 145, 2 }, { 135, 135, 3 }, { 161, 180, 0 }, { 182, 182, 6 },
+	{ 183, 183, 5 }, { 128, 134, 0 }, { 138, 138, 0 }, { 143, 148, 0 }, { 150, 150, 0 }, { 152, 159, 0 },
+	{ 166, 175, 0 }, { 178, 180, 0 }, { 129, 131, 0 }, { 133, 150, 0 }, { 154, 177, 0 }, { 179, 187, 0 },
+	{ 189, 189, 0 },
+};
+static const uint16_t Sinhala_reverse_state[] = {
+	0, 13, 14, 15, 16, 17, 18, 19,
+};
+static const UTF8Range Sinhala_reverse_range[] = {
+	{ 128, 134, 5 }, { 129, 131, 4 }, { 133, 150, 4 }, { 138, 138, 5 }, { 143, 148, 5 }, { 150, 150, 5 },
+	{ 152, 159, 5 }, { 154, 177, 4 }, { 161, 180, 1 }, { 166, 175, 5 }, { 178, 180, 5 }, { 179, 187, 4 },
+	{ 189, 189, 4 }, { 135, 135, 2 }, { 145, 145, 3 }, { 240, 240, 0 }, { 182, 182, 6 }, { 183, 183, 6 },
+	{ 224, 224, 0 },
+};
+static const uint16_t Sk_forward_state[] = {
+	0, 11, 12, 13, 14, 19, 20, 21, 22, 23, 24, 27,
+	29, 30, 32, 33, 34, 36, 41, 43, 44, 45, 50, 54,
+};
+static const UTF8Range Sk_forward_range[] = {
+	{ 94, 94, 0 }, { 96, 96, 0 }, { 194, 194, 22 }, { 203, 203, 21 }, { 205, 205, 20 }, { 206, 206, 19 },
+	{ 225, 225, 16 }, { 227, 227, 14 }, { 234, 234, 10 }, { 239, 239, 4 }, { 240, 240, 1 }, { 159, 159, 2 },
+	{ 143, 143, 3 }, { 187, 191, 0 }, { 174, 174, 9 }, { 175, 175, 8 }, { 188, 188, 7 }, { 189, 189, 6 },
+	{ 191, 191, 5 }, { 163, 163, 0 }, { 128, 128, 0 }, { 190, 190, 0 }, { 128, 129, 0 }, { 178, 191, 0 },
+	{ 156, 156, 13 }, { 158, 158, 12 }, { 173, 173, 11 }, { 155, 155, 0 }, { 170, 171, 0 }, { 137, 138, 0 },
+	{ 128, 150, 0 }, { 160, 161, 0 }, { 130, 130, 15 }, { 155, 156, 0 }, { 190, 190, 18 }, { 191, 191, 17 },
+	{ 128, 129, 0 }, { 141, 143, 0 }, { 157, 159, 0 }, { 173, 175, 0 }, { 189, 190, 0 }, { 189, 189, 0 },
+	{ 191, 191, 0 }, { 132, 133, 0 }, { 181, 181, 0 }, { 130, 133, 0 }, { 146, 159, 0 }, { 165, 171, 0 },
+	{ 173, 173, 0 }, { 175, 191, 0 }, { 168, 168, 0 }, { 175, 175, 0 }, { 180, 180, 0 }, { 184, 184, 0 },
+};
+static const uint16_t Sk_reverse_state[] = {
+	0, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42,
+	43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54,
+};
+static const UTF8Range Sk_reverse_range[] = {
+	{ 94, 94, 0 }, { 96, 96, 0 }, { 128, 128, 21 }, { 128, 129, 20 }, { 128, 129, 18 }, { 128, 150, 16 },
+	{ 130, 133, 15 }, { 132, 133, 14 }, { 137, 138, 13 }, { 141, 143, 18 }, { 146, 159, 15 }, { 155, 155, 12 },
+	{ 155, 156, 10 }, { 157, 159, 18 }, { 160, 161, 16 }, { 163, 163, 9 }, { 165, 171, 15 }, { 168, 168, 8 },
+	{ 170, 171, 12 }, { 173, 173, 15 }, { 173, 175, 18 }, { 175, 175, 8 }, { 175, 191, 15 }, { 178, 191, 7 },
+	{ 180, 180, 8 }, { 181, 181, 6 }, { 184, 184, 8 }, { 187, 191, 3 }, { 189, 189, 2 }, { 189, 190, 18 },
+	{ 190, 190, 1 }, { 191, 191, 2 }, { 188, 188, 22 }, { 190, 190, 19 }, { 143, 143, 4 }, { 159, 159, 5 },
+	{ 240, 240, 0 }, { 205, 205, 0 }, { 174, 174, 22 }, { 194, 194, 0 }, { 191, 191, 22 }, { 130, 130, 11 },
+	{ 227, 227, 0 }, { 173, 173, 17 }, { 158, 158, 17 }, { 206, 206, 0 }, { 203, 203, 0 }, { 156, 156, 17 },
+	{ 234, 234, 0 }, { 191, 191, 19 }, { 225, 225, 0 }, { 175, 175, 22 }, { 189, 189, 22 }, { 239, 239, 0 },
+};
+static const uint16_t Sm_forward_state[] = {
+	0, 11, 13, 14, 15, 20, 21, 23, 25, 27, 30, 35,
+	37, 39, 41, 43, 44, 65, 67, 68, 71, 73, 76, 77,
+	79, 80, 81, 82, 83, 84, 85, 89, 95, 97, 98, 99,
+	102, 103, 104, 106, 108,
+};
+static const UTF8Range Sm_forward_range[] = {
+	{ 43, 43, 0 }, { 60, 62, 0 }, { 124, 124, 0 }, { 126, 126, 0 }, { 194, 194, 39 }, { 195, 195, 38 },
+	{ 207, 207, 37 }, { 216, 216, 36 }, { 226, 226, 16 }, { 239, 239, 10 }, { 240, 240, 1 }, { 157, 157, 4 },
+	{ 158, 158, 2 }, { 187, 187, 3 }, { 176, 177, 0 }, { 155, 155, 9 }, { 156, 156, 8 }, { 157, 157, 7 },
+	{ 158, 158, 6 }, { 159, 159, 5 }, { 131, 131, 0 }, { 137, 137, 0 }, { 169, 169, 0 }, { 143, 143, 0 },
+	{ 175, 175, 0 }, { 149, 149, 0 }, { 181, 181, 0 }, { 129, 129, 0 }, { 155, 155, 0 }, { 187, 187, 0 },
+	{ 172, 172, 15 }, { 185, 185, 14 }, { 188, 188, 13 }, { 189, 189, 12 }, { 191, 191, 11 }, { 162, 162, 0 },
+	{ 169, 172, 0 }, { 156, 156, 0 }, { 158, 158, 0 }, { 139, 139, 0 }, { 156, 158, 0 }, { 162, 162, 0 },
+	{ 164, 166, 0 }, { 169, 169, 0 }, { 129, 129, 35 }, { 130, 130, 34 }, { 132, 132, 33 }, { 133, 133, 32 },
+	{ 134, 134, 31 }, { 135, 135, 30 }, { 136, 139, 29 }, { 140, 140, 28 }, { 141, 141, 27 }, { 142, 142, 26 },
+	{ 143, 143, 25 }, { 150, 150, 24 }, { 151, 151, 23 }, { 153, 153, 22 }, { 159, 159, 21 }, { 164, 165, 29 },
+	{ 166, 166, 20 }, { 167, 167, 19 }, { 168, 171, 29 }, { 172, 172, 18 }, { 173, 173, 17 }, { 128, 132, 0 },
+	{ 135, 140, 0 }, { 176, 191, 0 }, { 128, 151, 0 }, { 156, 187, 0 }, { 190, 191, 0 }, { 128, 130, 0 },
+	{ 153, 191, 0 }, { 128, 132, 0 }, { 135, 165, 0 }, { 176, 191, 0 }, { 175, 175, 0 }, { 129, 129, 0 },
+	{ 184, 191, 0 }, { 183, 183, 0 }, { 156, 161, 0 }, { 155, 179, 0 }, { 188, 188, 0 }, { 160, 161, 0 },
+	{ 128, 191, 0 }, { 142, 143, 0 }, { 146, 146, 0 }, { 148, 148, 0 }, { 180, 191, 0 }, { 144, 148, 0 },
+	{ 154, 155, 0 }, { 160, 160, 0 }, { 163, 163, 0 }, { 166, 166, 0 }, { 174, 174, 0 }, { 128, 132, 0 },
+	{ 139, 139, 0 }, { 152, 152, 0 }, { 138, 140, 0 }, { 132, 132, 0 }, { 146, 146, 0 }, { 186, 188, 0 },
+	{ 134, 136, 0 }, { 182, 182, 0 }, { 151, 151, 0 }, { 183, 183, 0 }, { 172, 172, 0 }, { 177, 177, 0 },
+};
+static const uint16_t Sm_reverse_state[] = {
+	0, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+	78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89,
+	90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 102, 103,
+	104, 105, 106, 107, 108,
+};
+static const UTF8Range Sm_reverse_range[] = {
+	{ 43, 43, 0 }, { 60, 62, 0 }, { 124, 124, 0 }, { 126, 126, 0 }, { 128, 130, 38 }, { 128, 132, 37 },
+	{ 128, 132, 36 }, { 128, 132, 35 }, { 128, 151, 34 }, { 128, 191, 33 }, { 129, 129, 30 }, { 129, 129, 29 },
+	{ 131, 131, 28 }, { 132, 132, 27 }, { 134, 136, 26 }, { 135, 140, 37 }, { 135, 165, 36 }, { 137, 137, 25 },
+	{ 138, 140, 24 }, { 139, 139, 22 }, { 139, 139, 35 }, { 142, 143, 21 }, { 143, 143, 20 }, { 144, 148, 19 },
+	{ 146, 146, 21 }, { 146, 146, 27 }, { 148, 148, 21 }, { 149, 149, 18 }, { 151, 151, 17 }, { 152, 152, 16 },
+	{ 153, 191, 38 }, { 154, 155, 19 }, { 155, 155, 30 }, { 155, 179, 15 }, { 156, 156, 14 }, { 156, 158, 22 },
+	{ 156, 161, 13 }, { 156, 187, 34 }, { 158, 158, 14 }, { 160, 160, 19 }, { 160, 161, 12 }, { 162, 162, 11 },
+	{ 162, 162, 10 }, { 163, 163, 19 }, { 164, 166, 10 }, { 166, 166, 19 }, { 169, 169, 25 }, { 169, 169, 9 },
+	{ 169, 172, 11 }, { 172, 172, 8 }, { 174, 174, 19 }, { 175, 175, 20 }, { 175, 175, 7 }, { 176, 177, 5 },
+	{ 176, 191, 4 }, { 176, 191, 36 }, { 177, 177, 8 }, { 180, 191, 21 }, { 181, 181, 18 }, { 182, 182, 3 },
+	{ 183, 183, 2 }, { 183, 183, 17 }, { 184, 191, 29 }, { 186, 188, 27 }, { 187, 187, 30 }, { 188, 188, 1 },
+	{ 190, 191, 34 }, { 141, 141, 39 }, { 150, 150, 39 }, { 207, 207, 0 }, { 172, 172, 39 }, { 187, 187, 6 },
+	{ 158, 158, 32 }, { 153, 153, 39 }, { 194, 194, 0 }, { 172, 172, 23 }, { 185, 185, 23 }, { 191, 191, 23 },
+	{ 140, 140, 39 }, { 143, 143, 39 }, { 189, 189, 23 }, { 142, 142, 39 }, { 132, 132, 39 }, { 195, 195, 0 },
+	{ 156, 156, 31 }, { 134, 134, 39 }, { 157, 157, 31 }, { 135, 135, 39 }, { 188, 188, 23 }, { 239, 239, 0 },
+	{ 130, 130, 39 }, { 158, 158, 31 }, { 216, 216, 0 }, { 129, 129, 39 }, { 159, 159, 31 }, { 151, 151, 39 },
+	{ 155, 155, 31 }, { 157, 157, 32 }, { 240, 240, 0 }, { 136, 139, 39 }, { 164, 165, 39 }, { 168, 171, 39 },
+	{ 167, 167, 39 }, { 133, 133, 39 }, { 159, 159, 39 }, { 173, 173, 39 }, { 166, 166, 39 }, { 226, 226, 0 },
+};
+static const uint16_t So_forward_state[] = {
+	0, 14, 21, 53, 55, 57, 60, 64, 66, 68, 71, 74,
+	76, 78, 81, 82, 85, 87, 88, 89, 90, 92, 95, 97,
+	100, 101, 102, 103, 117, 119, 121, 122, 123, 125, 126, 129,
+	131, 133, 134, 135, 136, 138, 139, 140, 142, 144, 150, 151,
+	152, 153, 157, 158, 159, 161, 165, 166, 170, 171, 174, 175,
+	176, 177, 184, 185, 188, 190, 191, 193, 198, 229, 231, 232,
+	234, 235, 236, 238, 241, 242, 243, 244, 246, 248, 250, 251,
+	252, 253, 254, 255, 257, 259, 261, 265, 269, 276, 279, 290,
+	296, 298, 299, 300, 301, 302, 303, 311, 315, 316, 323, 325,
+	326, 328, 329, 330, 331, 334, 335, 336, 337, 341,
+};
+static const UTF8Range So_forward_range[] = {
+	{ 194, 194, 116 }, { 210, 210, 115 }, { 214, 214, 114 }, { 216, 216, 113 }, { 219, 219, 112 }, { 223, 223, 111 },
+	{ 224, 224, 102 }, { 225, 225, 95 }, { 226, 226, 68 }, { 227, 227, 61 }, { 228, 228, 60 }, { 234, 234, 55 },
+	{ 239, 239, 52 }, { 240, 240, 1 }, { 144, 144, 45 }, { 145, 145, 43 }, { 150, 150, 40 }, { 155, 155, 38 },
+	{ 157, 157, 27 }, { 158, 158, 23 }, { 159, 159, 2 }, { 128, 128, 22 }, { 129, 129, 82 }, { 130, 130, 21 },
+	{ 131, 131, 20 }, { 132, 132, 19 }, { 133, 133, 82 }, { 134, 134, 18 }, { 135, 135, 17 }, { 136, 136, 16 },
+	{ 137, 137, 15 }, { 140, 142, 82 }, { 143, 143, 14 }, { 144, 154, 82 }, { 155, 155, 13 }, { 156, 156, 82 },
+	{ 157, 157, 70 }, { 158, 158, 82 }, { 159, 159, 12 }, { 160, 160, 11 }, { 161, 161, 10 }, { 162, 162, 9 },
+	{ 164, 164, 82 }, { 165, 165, 8 }, { 166, 166, 82 }, { 167, 167, 7 }, { 168, 168, 82 }, { 169, 169, 6 },
+	{ 170, 170, 5 }, { 171, 171, 4 }, { 172, 173, 82 }, { 174, 174, 3 }, { 175, 175, 85 }, { 128, 146, 0 },
+	{ 148, 191, 0 }, { 128, 130, 0 }, { 144, 150, 0 }, { 128, 134, 0 }, { 144, 168, 0 }, { 176, 182, 0 },
+	{ 128, 147, 0 }, { 160, 173, 0 }, { 176, 180, 0 }, { 184, 186, 0 }, { 128, 139, 0 }, { 141, 191, 0 },
+	{ 128, 184, 0 }, { 186, 191, 0 }, { 128, 135, 0 }, { 144, 173, 0 }, { 176, 177, 0 }, { 128, 135, 0 },
+	{ 144, 153, 0 }, { 160, 191, 0 }, { 128, 139, 0 }, { 144, 191, 0 }, { 128, 152, 0 }, { 160, 171, 0 },
+	{ 128, 151, 0 }, { 160, 172, 0 }, { 176, 188, 0 }, { 128, 186, 0 }, { 128, 136, 0 }, { 144, 145, 0 },
+	{ 160, 165, 0 }, { 128, 130, 0 }, { 144, 187, 0 }, { 166, 191, 0 }, { 128, 173, 0 }, { 141, 191, 0 },
+	{ 129, 143, 0 }, { 145, 181, 0 }, { 128, 147, 0 }, { 160, 174, 0 }, { 177, 191, 0 }, { 128, 171, 0 },
+	{ 176, 191, 0 }, { 133, 133, 26 }, { 178, 178, 25 }, { 180, 180, 24 }, { 174, 174, 0 }, { 172, 172, 0 },
+	{ 143, 143, 0 }, { 128, 130, 82 }, { 131, 131, 37 }, { 132, 132, 36 }, { 133, 133, 35 }, { 134, 134, 34 },
+	{ 135, 135, 33 }, { 136, 136, 82 }, { 137, 137, 32 }, { 140, 140, 82 }, { 141, 141, 31 }, { 160, 167, 82 },
+	{ 168, 168, 30 }, { 169, 169, 29 }, { 170, 170, 28 }, { 128, 131, 0 }, { 133, 134, 0 }, { 173, 180, 0 },
+	{ 182, 191, 0 }, { 183, 186, 0 }, { 128, 150, 0 }, { 128, 129, 0 }, { 133, 133, 0 }, { 128, 168, 0 },
+	{ 131, 132, 0 }, { 140, 169, 0 }, { 174, 191, 0 }, { 128, 164, 0 }, { 170, 172, 0 }, { 128, 166, 0 },
+	{ 169, 191, 0 }, { 128, 181, 0 }, { 178, 178, 39 }, { 156, 156, 0 }, { 172, 172, 42 }, { 173, 173, 41 },
+	{ 133, 133, 0 }, { 188, 191, 0 }, { 156, 156, 107 }, { 191, 191, 44 }, { 149, 156, 0 }, { 161, 177, 0 },
+	{ 132, 132, 51 }, { 133, 133, 50 }, { 134, 134, 49 }, { 135, 135, 48 }, { 161, 161, 47 }, { 171, 171, 46 },
+	{ 136, 136, 0 }, { 183, 184, 0 }, { 144, 188, 0 }, { 128, 137, 0 }, { 140, 142, 0 }, { 144, 156, 0 },
+	{ 160, 160, 0 }, { 185, 191, 0 }, { 183, 191, 0 }, { 183, 183, 54 }, { 191, 191, 53 }, { 164, 164, 0 },
+	{ 168, 168, 0 }, { 173, 174, 0 }, { 188, 189, 0 }, { 189, 189, 0 }, { 146, 146, 59 }, { 147, 147, 58 },
+	{ 160, 160, 57 }, { 169, 169, 56 }, { 183, 185, 0 }, { 168, 171, 0 }, { 182, 183, 0 }, { 185, 185, 0 },
+	{ 128, 134, 0 }, { 144, 191, 0 }, { 183, 183, 82 }, { 128, 128, 67 }, { 134, 134, 66 }, { 135, 135, 65 },
+	{ 136, 136, 64 }, { 137, 137, 63 }, { 138, 138, 62 }, { 139, 143, 82 }, { 138, 176, 0 }, { 128, 135, 0 },
+	{ 144, 144, 0 }, { 160, 191, 0 }, { 128, 158, 0 }, { 170, 191, 0 }, { 128, 163, 0 }, { 144, 145, 0 },
+	{ 150, 159, 0 }, { 132, 132, 0 }, { 146, 147, 0 }, { 160, 160, 0 }, { 182, 183, 0 }, { 190, 191, 0 },
+	{ 132, 132, 94 }, { 133, 133, 93 }, { 134, 134, 92 }, { 135, 135, 91 }, { 140, 140, 90 }, { 141, 141, 89 },
+	{ 142, 142, 88 }, { 143, 143, 87 }, { 144, 144, 86 }, { 145, 145, 85 }, { 146, 146, 84 }, { 147, 147, 83 },
+	{ 148, 149, 82 }, { 150, 150, 81 }, { 151, 151, 80 }, { 152, 152, 82 }, { 153, 153, 79 }, { 154, 156, 82 },
+	{ 157, 157, 78 }, { 158, 158, 77 }, { 160, 163, 82 }, { 172, 172, 76 }, { 173, 173, 75 }, { 174, 174, 74 },
+	{ 175, 175, 82 }, { 179, 179, 73 }, { 185, 185, 72 }, { 186, 186, 71 }, { 187, 187, 70 }, { 188, 190, 82 },
+	{ 191, 191, 69 }, { 128, 149, 0 }, { 176, 187, 0 }, { 128, 179, 0 }, { 128, 153, 0 }, { 155, 191, 0 },
+	{ 144, 145, 0 }, { 165, 170, 0 }, { 128, 149, 0 }, { 151, 191, 0 }, { 133, 134, 0 }, { 141, 179, 0 },
+	{ 182, 191, 0 }, { 128, 175, 0 }, { 148, 191, 0 }, { 128, 167, 0 }, { 128, 174, 0 }, { 176, 191, 0 },
+	{ 128, 128, 0 }, { 130, 183, 0 }, { 128, 182, 0 }, { 184, 191, 0 }, { 128, 191, 0 }, { 128, 169, 0 },
+	{ 156, 191, 0 }, { 128, 138, 0 }, { 128, 166, 0 }, { 128, 155, 0 }, { 162, 191, 0 }, { 128, 154, 0 },
+	{ 180, 191, 0 }, { 128, 187, 0 }, { 189, 191, 0 }, { 128, 135, 0 }, { 140, 159, 0 }, { 162, 168, 0 },
+	{ 171, 191, 0 }, { 128, 141, 0 }, { 144, 145, 0 }, { 147, 147, 0 }, { 149, 179, 0 }, { 138, 139, 0 },
+	{ 149, 153, 0 }, { 156, 159, 0 }, { 161, 162, 0 }, { 164, 165, 0 }, { 167, 173, 0 }, { 175, 191, 0 },
+	{ 138, 138, 0 }, { 140, 141, 0 }, { 143, 143, 0 }, { 128, 129, 0 }, { 131, 134, 0 }, { 136, 137, 0 },
+	{ 148, 148, 0 }, { 150, 151, 0 }, { 158, 163, 0 }, { 165, 165, 0 }, { 167, 167, 0 }, { 169, 169, 0 },
+	{ 174, 174, 0 }, { 186, 187, 0 }, { 130, 130, 101 }, { 142, 142, 100 }, { 153, 153, 99 }, { 165, 165, 98 },
+	{ 167, 167, 97 }, { 173, 173, 96 }, { 161, 170, 0 }, { 180, 188, 0 }, { 158, 191, 0 }, { 128, 128, 0 },
+	{ 173, 173, 0 }, { 144, 153, 0 }, { 158, 159, 0 }, { 167, 167, 110 }, { 173, 173, 109 }, { 175, 175, 108 },
+	{ 177, 177, 107 }, { 181, 181, 106 }, { 188, 188, 105 }, { 190, 190, 104 }, { 191, 191, 103 }, { 128, 133, 0 },
+	{ 135, 140, 0 }, { 142, 143, 0 }, { 149, 152, 0 }, { 190, 191, 0 }, { 129, 131, 0 }, { 147, 147, 0 },
+	{ 149, 151, 0 }, { 154, 159, 0 }, { 180, 180, 0 }, { 182, 182, 0 }, { 184, 184, 0 }, { 143, 143, 0 },
+	{ 185, 185, 0 }, { 191, 191, 0 }, { 179, 184, 0 }, { 186, 186, 0 }, { 176, 176, 0 }, { 186, 186, 0 },
+	{ 182, 182, 0 }, { 158, 158, 0 }, { 169, 169, 0 }, { 189, 190, 0 }, { 142, 143, 0 }, { 141, 142, 0 },
+	{ 130, 130, 0 }, { 166, 166, 0 }, { 169, 169, 0 }, { 174, 174, 0 }, { 176, 176, 0 },
+};
+static const uint16_t So_reverse_state[] = {
+	0, 201, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+	213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224,
+	225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236,
+	237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248,
+	249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 280, 281,
+	282, 283, 284, 285, 286, 288, 289, 290, 291, 292, 293, 294,
+	295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306,
+	307, 308, 309, 310, 311, 312, 313, 314, 316, 317, 318, 319,
+	320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331,
+	332, 333, 334, 335, 336, 337, 338, 339, 340, 341,
+};
+static const UTF8Range So_reverse_range[] = {
+	{ 128, 128, 115 }, { 128, 128, 113 }, { 128, 129, 110 }, { 128, 129, 109 }, { 128, 130, 107 }, { 128, 130, 106 },
+	{ 128, 131, 105 }, { 128, 133, 103 }, { 128, 134, 102 }, { 128, 134, 100 }, { 128, 135, 99 }, { 128, 135, 98 },
+	{ 128, 135, 96 }, { 128, 135, 95 }, { 128, 136, 94 }, { 128, 137, 92 }, { 128, 138, 91 }, { 128, 139, 90 },
+	{ 128, 139, 89 }, { 128, 141, 88 }, { 128, 146, 87 }, { 128, 147, 86 }, { 128, 147, 85 }, { 128, 149, 84 },
+	{ 128, 149, 83 }, { 128, 150, 82 }, { 128, 151, 81 }, { 128, 152, 80 }, { 128, 153, 79 }, { 128, 154, 78 },
+	{ 128, 155, 77 }, { 128, 158, 76 }, { 128, 163, 75 }, { 128, 164, 74 }, { 128, 166, 73 }, { 128, 166, 72 },
+	{ 128, 167, 71 }, { 128, 168, 70 }, { 128, 169, 69 }, { 128, 171, 68 }, { 128, 173, 67 }, { 128, 174, 66 },
+	{ 128, 175, 65 }, { 128, 179, 64 }, { 128, 181, 63 }, { 128, 182, 62 }, { 128, 184, 61 }, { 128, 186, 60 },
+	{ 128, 187, 59 }, { 128, 191, 57 }, { 129, 131, 56 }, { 129, 143, 55 }, { 130, 130, 54 }, { 130, 183, 115 },
+	{ 131, 132, 53 }, { 131, 134, 109 }, { 132, 132, 52 }, { 133, 133, 110 }, { 133, 133, 50 }, { 133, 134, 105 },
+	{ 133, 134, 49 }, { 135, 140, 103 }, { 136, 136, 48 }, { 136, 137, 109 }, { 138, 138, 47 }, { 138, 139, 46 },
+	{ 138, 176, 45 }, { 140, 141, 47 }, { 140, 142, 92 }, { 140, 159, 95 }, { 140, 169, 53 }, { 141, 142, 44 },
+	{ 141, 179, 49 }, { 141, 191, 90 }, { 141, 191, 43 }, { 142, 143, 103 }, { 142, 143, 42 }, { 143, 143, 40 },
+	{ 143, 143, 47 }, { 143, 143, 39 }, { 144, 144, 96 }, { 144, 145, 94 }, { 144, 145, 38 }, { 144, 145, 37 },
+	{ 144, 145, 88 }, { 144, 150, 107 }, { 144, 153, 98 }, { 144, 153, 36 }, { 144, 156, 92 }, { 144, 168, 102 },
+	{ 144, 173, 99 }, { 144, 187, 106 }, { 144, 188, 35 }, { 144, 191, 89 }, { 144, 191, 34 }, { 145, 181, 55 },
+	{ 146, 147, 52 }, { 147, 147, 88 }, { 147, 147, 56 }, { 148, 148, 109 }, { 148, 191, 87 }, { 148, 191, 33 },
+	{ 149, 151, 56 }, { 149, 152, 103 }, { 149, 153, 46 }, { 149, 156, 31 }, { 149, 179, 88 }, { 150, 151, 109 },
+	{ 150, 159, 38 }, { 151, 191, 83 }, { 154, 159, 56 }, { 155, 191, 79 }, { 156, 156, 29 }, { 156, 159, 46 },
+	{ 156, 191, 28 }, { 158, 158, 27 }, { 158, 159, 26 }, { 158, 163, 109 }, { 158, 191, 25 }, { 160, 160, 92 },
+	{ 160, 160, 52 }, { 160, 165, 94 }, { 160, 171, 80 }, { 160, 172, 81 }, { 160, 173, 86 }, { 160, 174, 85 },
+	{ 160, 191, 98 }, { 160, 191, 96 }, { 161, 162, 46 }, { 161, 170, 24 }, { 161, 177, 31 }, { 162, 168, 95 },
+	{ 162, 191, 77 }, { 164, 164, 22 }, { 164, 165, 46 }, { 165, 165, 109 }, { 165, 170, 21 }, { 166, 166, 20 },
+	{ 166, 191, 19 }, { 167, 167, 109 }, { 167, 173, 46 }, { 168, 168, 22 }, { 168, 171, 18 }, { 169, 169, 109 },
+	{ 169, 169, 27 }, { 169, 169, 20 }, { 169, 191, 73 }, { 170, 172, 74 }, { 170, 191, 76 }, { 171, 191, 95 },
+	{ 172, 172, 17 }, { 173, 173, 16 }, { 173, 174, 22 }, { 173, 180, 15 }, { 174, 174, 14 }, { 174, 174, 109 },
+	{ 174, 174, 20 }, { 174, 191, 53 }, { 175, 191, 46 }, { 176, 176, 13 }, { 176, 176, 20 }, { 176, 177, 99 },
+	{ 176, 180, 86 }, { 176, 182, 102 }, { 176, 187, 84 }, { 176, 188, 81 }, { 176, 191, 68 }, { 176, 191, 66 },
+	{ 177, 191, 85 }, { 179, 184, 12 }, { 180, 180, 56 }, { 180, 188, 24 }, { 180, 191, 78 }, { 182, 182, 56 },
+	{ 182, 182, 11 }, { 182, 183, 18 }, { 182, 183, 52 }, { 182, 191, 15 }, { 182, 191, 49 }, { 183, 184, 10 },
+	{ 183, 185, 9 }, { 183, 186, 8 }, { 183, 191, 7 }, { 184, 184, 56 }, { 184, 186, 86 }, { 184, 191, 62 },
+	{ 185, 185, 18 }, { 185, 185, 39 }, { 185, 191, 6 }, { 186, 186, 12 }, { 186, 186, 5 }, { 186, 187, 109 },
+	{ 186, 191, 61 }, { 188, 189, 22 }, { 188, 191, 4 }, { 189, 189, 3 }, { 189, 190, 27 }, { 189, 191, 59 },
+	{ 190, 191, 52 }, { 190, 191, 2 }, { 191, 191, 1 }, { 156, 156, 32 }, { 177, 177, 104 }, { 190, 190, 104 },
+	{ 183, 183, 23 }, { 172, 172, 51 }, { 167, 167, 104 }, { 133, 133, 93 }, { 132, 132, 93 }, { 168, 168, 111 },
+	{ 169, 169, 101 }, { 161, 161, 93 }, { 223, 223, 0 }, { 175, 175, 104 }, { 173, 173, 104 }, { 180, 180, 41 },
+	{ 169, 169, 111 }, { 153, 153, 114 }, { 178, 178, 41 }, { 160, 160, 101 }, { 135, 135, 108 }, { 194, 194, 0 },
+	{ 179, 179, 116 }, { 191, 191, 23 }, { 239, 239, 0 }, { 173, 173, 114 }, { 167, 167, 114 }, { 130, 130, 114 },
+	{ 219, 219, 0 }, { 146, 146, 116 }, { 178, 178, 30 }, { 155, 155, 112 }, { 191, 191, 32 }, { 145, 145, 112 },
+	{ 158, 158, 116 }, { 146, 146, 101 }, { 135, 135, 93 }, { 142, 142, 114 }, { 185, 185, 116 }, { 134, 134, 97 },
+	{ 181, 181, 104 }, { 133, 133, 41 }, { 158, 158, 112 }, { 216, 216, 0 }, { 132, 132, 108 }, { 214, 214, 0 },
+	{ 138, 138, 97 }, { 134, 134, 116 }, { 133, 133, 116 }, { 171, 171, 93 }, { 173, 173, 116 }, { 173, 173, 51 },
+	{ 150, 150, 112 }, { 128, 128, 97 }, { 134, 134, 111 }, { 210, 210, 0 }, { 131, 131, 108 }, { 188, 188, 104 },
+	{ 128, 130, 111 }, { 129, 129, 108 }, { 133, 133, 108 }, { 136, 136, 111 }, { 139, 143, 97 }, { 140, 140, 111 },
+	{ 140, 142, 108 }, { 144, 154, 108 }, { 148, 149, 116 }, { 152, 152, 116 }, { 154, 156, 116 }, { 156, 156, 108 },
+	{ 158, 158, 108 }, { 160, 163, 116 }, { 160, 167, 111 }, { 164, 164, 108 }, { 166, 166, 108 }, { 168, 168, 108 },
+	{ 172, 173, 108 }, { 175, 175, 116 }, { 183, 183, 58 }, { 188, 190, 116 }, { 228, 228, 0 }, { 141, 141, 116 },
+	{ 143, 143, 108 }, { 165, 165, 108 }, { 150, 150, 116 }, { 131, 131, 111 }, { 157, 157, 108 }, { 187, 187, 116 },
+	{ 172, 172, 116 }, { 153, 153, 116 }, { 134, 134, 108 }, { 128, 128, 108 }, { 147, 147, 116 }, { 135, 135, 111 },
+	{ 157, 157, 116 }, { 144, 144, 116 }, { 132, 132, 111 }, { 133, 133, 111 }, { 135, 135, 97 }, { 136, 136, 97 },
+	{ 143, 143, 116 }, { 142, 142, 116 }, { 186, 186, 116 }, { 159, 159, 108 }, { 155, 155, 108 }, { 141, 141, 111 },
+	{ 174, 174, 116 }, { 191, 191, 116 }, { 130, 130, 108 }, { 169, 169, 108 }, { 174, 174, 108 }, { 135, 135, 116 },
+	{ 160, 160, 108 }, { 167, 167, 108 }, { 145, 145, 116 }, { 175, 175, 108 }, { 134, 134, 93 }, { 144, 144, 112 },
+	{ 137, 137, 108 }, { 140, 140, 116 }, { 137, 137, 97 }, { 227, 227, 0 }, { 161, 161, 108 }, { 162, 162, 108 },
+	{ 147, 147, 101 }, { 234, 234, 0 }, { 170, 170, 108 }, { 191, 191, 104 }, { 224, 224, 0 }, { 170, 170, 111 },
+	{ 136, 136, 108 }, { 171, 171, 108 }, { 159, 159, 112 }, { 132, 132, 116 }, { 137, 137, 111 }, { 157, 157, 112 },
+	{ 240, 240, 0 }, { 165, 165, 114 }, { 225, 225, 0 }, { 151, 151, 116 }, { 226, 226, 0 },
+};
+static const uint16_t Sogdian_forward_state[] = {
+	0, 1, 2, 4, 5, 6,
+};
+static const UTF8Range Sogdian_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 188, 188, 4 }, { 189, 189, 3 }, { 128, 153, 0 }, { 176, 191, 0 },
+};
+static const uint16_t Sogdian_reverse_state[] = {
+	0, 2, 3, 4, 5, 6,
+};
+static const UTF8Range Sogdian_reverse_range[] = {
+	{ 128, 153, 2 }, { 176, 191, 1 }, { 188, 188, 3 }, { 189, 189, 3 }, { 144, 144, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Sora_Sompeng_forward_state[] = {
+	0, 1, 2, 3, 5,
+};
+static const UTF8Range Sora_Sompeng_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 131, 131, 3 }, { 144, 168, 0 }, { 176, 185, 0 },
+};
+static const uint16_t Sora_Sompeng_reverse_state[] = {
+	0, 2, 3, 4, 5,
+};
+static const UTF8Range Sora_Sompeng_reverse_range[] = {
+	{ 144, 168, 1 }, { 176, 185, 1 }, { 131, 131, 2 }, { 145, 145, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Soyombo_forward_state[] = {
+	0, 1, 2, 4, 5, 6,
+};
+static const UTF8Range Soyombo_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 169, 169, 4 }, { 170, 170, 3 }, { 128, 162, 0 }, { 144, 191, 0 },
+};
+static const uint16_t Soyombo_reverse_state[] = {
+	0, 2, 3, 4, 5, 6,
+};
+static const UTF8Range Soyombo_reverse_range[] = {
+	{ 128, 162, 2 }, { 144, 191, 1 }, { 169, 169, 3 }, { 170, 170, 3 }, { 145, 145, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Sundanese_forward_state[] = {
+	0, 1, 3, 4, 5,
+};
+static const UTF8Range Sundanese_forward_range[] = {
+	{ 225, 225, 1 }, { 174, 174, 3 }, { 179, 179, 2 }, { 128, 135, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Sundanese_reverse_state[] = {
+	0, 2, 3, 4, 5,
+};
+static const UTF8Range Sundanese_reverse_range[] = {
+	{ 128, 135, 2 }, { 128, 191, 1 }, { 174, 174, 3 }, { 179, 179, 3 }, { 225, 225, 0 },
+};
+static const uint16_t Syloti_Nagri_forward_state[] = {
+	0, 1, 2, 3,
+};
+static const UTF8Range Syloti_Nagri_forward_range[] = {
+	{ 234, 234, 1 }, { 160, 160, 2 }, { 128, 172, 0 },
+};
+static const uint16_t Syloti_Nagri_reverse_state[] = {
+	0, 1, 2, 3,
+};
+static const UTF8Range Syloti_Nagri_reverse_range[] = {
+	{ 128, 172, 1 }, { 160, 160, 2 }, { 234, 234, 0 },
+};
+static const uint16_t Syriac_forward_state[] = {
+	0, 3, 4, 5, 7, 9,
+};
+static const UTF8Range Syriac_forward_range[] = {
+	{ 220, 220, 4 }, { 221, 221, 3 }, { 224, 224, 1 }, { 161, 161, 2 }, { 160, 170, 0 }, { 128, 138, 0 },
+	{ 141, 143, 0 }, { 128, 141, 0 }, { 143, 191, 0 },
+};
+static const uint16_t Syriac_reverse_state[] = {
+	0, 5, 6, 7, 8, 9,
+};
+static const UTF8Range Syriac_reverse_range[] = {
+	{ 128, 138, 4 }, { 128, 141, 3 }, { 141, 143, 4 }, { 143, 191, 3 }, { 160, 170, 1 }, { 161, 161, 2 },
+	{ 224, 224, 0 }, { 220, 220, 0 }, { 221, 221, 0 },
+};
+static const uint16_t Tagalog_forward_state[] = {
+	0, 1, 2, 4,
+};
+static const UTF8Range Tagalog_forward_range[] = {
+	{ 225, 225, 1 }, { 156, 156, 2 }, { 128, 140, 0 }, { 142, 148, 0 },
+};
+static const uint16_t Tagalog_reverse_state[] = {
+	0, 2, 3, 4,
+};
+static const UTF8Range Tagalog_reverse_range[] = {
+	{ 128, 140, 1 }, { 142, 148, 1 }, { 156, 156, 2 }, { 225, 225, 0 },
+};
+static const uint16_t Tagbanwa_forward_state[] = {
+	0, 1, 2, 5,
+};
+static const UTF8Range Tagbanwa_forward_range[] = {
+	{ 225, 225, 1 }, { 157, 157, 2 }, { 160, 172, 0 }, { 174, 176, 0 }, { 178, 179, 0 },
+};
+static const uint16_t Tagbanwa_reverse_state[] = {
+	0, 3, 4, 5,
+};
+static const UTF8Range Tagbanwa_reverse_range[] = {
+	{ 160, 172, 1 }, { 174, 176, 1 }, { 178, 179, 1 }, { 157, 157, 2 }, { 225, 225, 0 },
+};
+static const uint16_t Tai_Le_forward_state[] = {
+	0, 1, 2, 4,
+};
+static const UTF8Range Tai_Le_forward_range[] = {
+	{ 225, 225, 1 }, { 165, 165, 2 }, { 144, 173, 0 }, { 176, 180, 0 },
+};
+static const uint16_t Tai_Le_reverse_state[] = {
+	0, 2, 3, 4,
+};
+static const UTF8Range Tai_Le_reverse_range[] = {
+	{ 144, 173, 1 }, { 176, 180, 1 }, { 165, 165, 2 }, { 225, 225, 0 },
+};
+static const uint16_t Tai_Tham_forward_state[] = {
+	0, 1, 4, 7, 10, 11,
+};
+static const UTF8Range Tai_Tham_forward_range[] = {
+	{ 225, 225, 1 }, { 168, 168, 4 }, { 169, 169, 3 }, { 170, 170, 2 }, { 128, 137, 0 }, { 144, 153, 0 },
+	{ 160, 173, 0 }, { 128, 158, 0 }, { 160, 188, 0 }, { 191, 191, 0 }, { 160, 191, 0 },
+};
+static const uint16_t Tai_Tham_reverse_state[] = {
+	0, 7, 8, 9, 10, 11,
+};
+static const UTF8Range Tai_Tham_reverse_range[] = {
+	{ 128, 137, 3 }, { 128, 158, 2 }, { 144, 153, 3 }, { 160, 173, 3 }, { 160, 188, 2 }, { 160, 191, 1 },
+	{ 191, 191, 2 }, { 168, 168, 4 }, { 169, 169, 4 }, { 170, 170, 4 }, { 225, 225, 0 },
+};
+static const uint16_t Tai_Viet_forward_state[] = {
+	0, 1, 3, 5, 6,
+};
+static const UTF8Range Tai_Viet_forward_range[] = {
+	{ 234, 234, 1 }, { 170, 170, 3 }, { 171, 171, 2 }, { 128, 130, 0 }, { 155, 159, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Tai_Viet_reverse_state[] = {
+	0, 3, 4, 5, 6,
+};
+static const UTF8Range Tai_Viet_reverse_range[] = {
+	{ 128, 130, 2 }, { 128, 191, 1 }, { 155, 159, 2 }, { 170, 170, 3 }, { 171, 171, 3 }, { 234, 234, 0 },
+};
+static const uint16_t Takri_forward_state[] = {
+	0, 1, 2, 4, 5, 6,
+};
+static const UTF8Range Takri_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 154, 154, 4 }, { 155, 155, 3 }, { 128, 137, 0 }, { 128, 184, 0 },
+};
+static const uint16_t Takri_reverse_state[] = {
+	0, 2, 3, 4, 5, 6,
+};
+static const UTF8Range Takri_reverse_range[] = {
+	{ 128, 137, 2 }, { 128, 184, 1 }, { 154, 154, 3 }, { 155, 155, 3 }, { 145, 145, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Tamil_forward_state[] = {
+	0, 2, 3, 4, 6, 8, 14, 25,
+};
+static const UTF8Range Tamil_forward_range[] = {
+	{ 224, 224, 4 }, { 240, 240, 1 }, { 145, 145, 2 }, { 191, 191, 3 }, { 128, 177, 0 }, { 191, 191, 0 },
+	{ 174, 174, 6 }, { 175, 175, 5 }, { 128, 130, 0 }, { 134, 136, 0 }, { 138, 141, 0 }, { 144, 144, 0 },
+	{ 151, 151, 0 }, { 166, 186, 0 }, { 130, 131, 0 }, { 133, 138, 0 }, { 142, 144, 0 }, { 146, 149, 0 },
+	{ 153, 154, 0 }, { 156, 156, 0 }, { 158, 159, 0 }, { 163, 164, 0 }, { 168, 170, 0 }, { 174, 185, 0 },
+	{ 190, 191, 0 },
+};
+static const uint16_t Tamil_reverse_state[] = {
+	0, 19, 20, 21, 22, 23, 24, 25,
+};
+static const UTF8Range Tamil_reverse_range[] = {
+	{ 128, 130, 5 }, { 128, 177, 2 }, { 130, 131, 1 }, { 133, 138, 1 }, { 134, 136, 5 }, { 138, 141, 5 },
+	{ 142, 144, 1 }, { 144, 144, 5 }, { 146, 149, 1 }, { 151, 151, 5 }, { 153, 154, 1 }, { 156, 156, 1 },
+	{ 158, 159, 1 }, { 163, 164, 1 }, { 166, 186, 5 }, { 168, 170, 1 }, { 174, 185, 1 }, { 190, 191, 1 },
+	{ 191, 191, 2 }, { 174, 174, 6 }, { 191, 191, 3 }, { 145, 145, 4 }, { 240, 240, 0 }, { 175, 175, 6 },
+	{ 224, 224, 0 },
+};
+static const uint16_t Tangut_forward_state[] = {
+	0, 1, 4, 8, 9, 10, 11, 12, 13, 14,
+};
+static const UTF8Range Tangut_forward_range[] = {
+	{ 240, 240, 1 }, { 150, 150, 7 }, { 151, 151, 5 }, { 152, 152, 2 }, { 128, 158, 6 }, { 159, 159, 4 },
+	{ 160, 171, 6 }, { 180, 180, 3 }, { 128, 136, 0 }, { 128, 183, 0 }, { 128, 191, 6 }, { 128, 191, 0 },
+	{ 191, 191, 8 }, { 160, 160, 0 },
+};
+static const uint16_t Tangut_reverse_state[] = {
+	0, 4, 5, 6, 9, 10, 11, 12, 13, 14,
+};
+static const UTF8Range Tangut_reverse_range[] = {
+	{ 128, 136, 6 }, { 128, 183, 5 }, { 128, 191, 3 }, { 160, 160, 1 }, { 191, 191, 2 }, { 150, 150, 8 },
+	{ 128, 158, 7 }, { 128, 191, 4 }, { 160, 171, 7 }, { 151, 151, 8 }, { 159, 159, 7 }, { 180, 180, 7 },
+	{ 152, 152, 8 }, { 240, 240, 0 },
+};
+static const uint16_t Telugu_forward_state[] = {
+	0, 1, 3, 11, 16,
+};
+static const UTF8Range Telugu_forward_range[] = {
+	{ 224, 224, 1 }, { 176, 176, 3 }, { 177, 177, 2 }, { 128, 132, 0 }, { 134, 136, 0 }, { 138, 141, 0 },
+	{ 149, 150, 0 }, { 152, 154, 0 }, { 160, 163, 0 }, { 166, 175, 0 }, { 183, 191, 0 }, { 128, 140, 0 },
+	{ 142, 144, 0 }, { 146, 168, 0 }, { 170, 185, 0 }, { 189, 191, 0 },
+};
+static const uint16_t Telugu_reverse_state[] = {
+	0, 13, 14, 15, 16,
+};
+static const UTF8Range Telugu_reverse_range[] = {
+	{ 128, 132, 2 }, { 128, 140, 1 }, { 134, 136, 2 }, { 138, 141, 2 }, { 142, 144, 1 }, { 146, 168, 1 },
+	{ 149, 150, 2 }, { 152, 154, 2 }, { 160, 163, 2 }, { 166, 175, 2 }, { 170, 185, 1 }, { 183, 191, 2 },
+	{ 189, 191, 1 }, { 176, 176, 3 }, { 177, 177, 3 }, { 224, 224, 0 },
+};
+static const uint16_t Thaana_forward_state[] = {
+	0, 1, 2,
+};
+static const UTF8Range Thaana_forward_range[] = {
+	{ 222, 222, 1 }, { 128, 177, 0 },
+};
+static const uint16_t Thaana_reverse_state[] = {
+	0, 1, 2,
+};
+static const UTF8Range Thaana_reverse_range[] = {
+	{ 128, 177, 1 }, { 222, 222, 0 },
+};
+static const uint16_t Thai_forward_state[] = {
+	0, 1, 3, 4, 5,
+};
+static const UTF8Range Thai_forward_range[] = {
+	{ 224, 224, 1 }, { 184, 184, 3 }, { 185, 185, 2 }, { 128, 155, 0 }, { 129, 186, 0 },
+};
+static const uint16_t Thai_reverse_state[] = {
+	0, 2, 3, 4, 5,
+};
+static const UTF8Range Thai_reverse_range[] = {
+	{ 128, 155, 2 }, { 129, 186, 1 }, { 184, 184, 3 }, { 185, 185, 3 }, { 224, 224, 0 },
+};
+static const uint16_t Tibetan_forward_state[] = {
+	0, 1, 5, 8, 11, 14, 15,
+};
+static const UTF8Range Tibetan_forward_range[] = {
+	{ 224, 224, 1 }, { 188, 188, 5 }, { 189, 189, 4 }, { 190, 190, 3 }, { 191, 191, 2 }, { 128, 140, 0 },
+	{ 142, 148, 0 }, { 153, 154, 0 }, { 128, 151, 0 }, { 153, 188, 0 }, { 190, 191, 0 }, { 128, 135, 0 },
+	{ 137, 172, 0 }, { 177, 191, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Tibetan_reverse_state[] = {
+	0, 10, 11, 12, 13, 14, 15,
+};
+static const UTF8Range Tibetan_reverse_range[] = {
+	{ 128, 135, 4 }, { 128, 140, 3 }, { 128, 151, 2 }, { 128, 191, 1 }, { 137, 172, 4 }, { 142, 148, 3 },
+	{ 153, 154, 3 }, { 153, 188, 2 }, { 177, 191, 4 }, { 190, 191, 2 }, { 188, 188, 5 }, { 190, 190, 5 },
+	{ 191, 191, 5 }, { 189, 189, 5 }, { 224, 224, 0 },
+};
+static const uint16_t Tifinagh_forward_state[] = {
+	0, 1, 3, 6, 7,
+};
+static const UTF8Range Tifinagh_forward_range[] = {
+	{ 226, 226, 1 }, { 180, 180, 3 }, { 181, 181, 2 }, { 128, 167, 0 }, { 175, 176, 0 }, { 191, 191, 0 },
+	{ 176, 191, 0 },
+};
+static const uint16_t Tifinagh_reverse_state[] = {
+	0, 4, 5, 6, 7,
+};
+static const UTF8Range Tifinagh_reverse_range[] = {
+	{ 128, 167, 2 }, { 175, 176, 2 }, { 176, 191, 1 }, { 191, 191, 2 }, { 180, 180, 3 }, { 181, 181, 3 },
+	{ 226, 226, 0 },
+};
+static const uint16_t Tirhuta_forward_state[] = {
+	0, 1, 2, 4, 6, 7,
+};
+static const UTF8Range Tirhuta_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 146, 146, 4 }, { 147, 147, 3 }, { 128, 135, 0 }, { 144, 153, 0 },
+	{ 128, 191, 0 },
+};
+static const uint16_t Tirhuta_reverse_state[] = {
+	0, 3, 4, 5, 6, 7,
+};
+static const UTF8Range Tirhuta_reverse_range[] = {
+	{ 128, 135, 2 }, { 128, 191, 1 }, { 144, 153, 2 }, { 146, 146, 3 }, { 147, 147, 3 }, { 145, 145, 4 },
+	{ 240, 240, 0 },
+};
+static const uint16_t Ugaritic_forward_state[] = {
+	0, 1, 2, 3, 5,
+};
+static const UTF8Range Ugaritic_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 142, 142, 3 }, { 128, 157, 0 }, { 159, 159, 0 },
+};
+static const uint16_t Ugaritic_reverse_state[] = {
+	0, 2, 3, 4, 5,
+};
+static const UTF8Range Ugaritic_reverse_range[] = {
+	{ 128, 157, 1 }, { 159, 159, 1 }, { 142, 142, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Vai_forward_state[] = {
+	0, 1, 3, 4, 5,
+};
+static const UTF8Range Vai_forward_range[] = {
+	{ 234, 234, 1 }, { 148, 151, 3 }, { 152, 152, 2 }, { 128, 171, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Vai_reverse_state[] = {
+	0, 2, 3, 4, 5,
+};
+static const UTF8Range Vai_reverse_range[] = {
+	{ 128, 171, 2 }, { 128, 191, 1 }, { 148, 151, 3 }, { 152, 152, 3 }, { 234, 234, 0 },
+};
+static const uint16_t Wancho_forward_state[] = {
+	0, 1, 2, 3, 5,
+};
+static const UTF8Range Wancho_forward_range[] = {
+	{ 240, 240, 1 }, { 158, 158, 2 }, { 139, 139, 3 }, { 128, 185, 0 }, { 191, 191, 0 },
+};
+static const uint16_t Wancho_reverse_state[] = {
+	0, 2, 3, 4, 5,
+};
+static const UTF8Range Wancho_reverse_range[] = {
+	{ 128, 185, 1 }, { 191, 191, 1 }, { 139, 139, 2 }, { 158, 158, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Warang_Citi_forward_state[] = {
+	0, 1, 2, 4, 6, 7,
+};
+static const UTF8Range Warang_Citi_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 162, 162, 4 }, { 163, 163, 3 }, { 128, 178, 0 }, { 191, 191, 0 },
+	{ 160, 191, 0 },
+};
+static const uint16_t Warang_Citi_reverse_state[] = {
+	0, 3, 4, 5, 6, 7,
+};
+static const UTF8Range Warang_Citi_reverse_range[] = {
+	{ 128, 178, 2 }, { 160, 191, 1 }, { 191, 191, 2 }, { 162, 162, 3 }, { 163, 163, 3 }, { 145, 145, 4 },
+	{ 240, 240, 0 },
+};
+static const uint16_t Yezidi_forward_state[] = {
+	0, 1, 2, 3, 6,
+};
+static const UTF8Range Yezidi_forward_range[] = {
+	{ 240, 240, 1 }, { 144, 144, 2 }, { 186, 186, 3 }, { 128, 169, 0 }, { 171, 173, 0 }, { 176, 177, 0 },
+};
+static const uint16_t Yezidi_reverse_state[] = {
+	0, 3, 4, 5, 6,
+};
+static const UTF8Range Yezidi_reverse_range[] = {
+	{ 128, 169, 1 }, { 171, 173, 1 }, { 176, 177, 1 }, { 186, 186, 2 }, { 144, 144, 3 }, { 240, 240, 0 },
+};
+static const uint16_t Yi_forward_state[] = {
+	0, 1, 4, 5, 7, 8,
+};
+static const UTF8Range Yi_forward_range[] = {
+	{ 234, 234, 1 }, { 128, 145, 4 }, { 146, 146, 3 }, { 147, 147, 2 }, { 128, 134, 0 }, { 128, 140, 0 },
+	{ 144, 191, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Yi_reverse_state[] = {
+	0, 4, 5, 6, 7, 8,
+};
+static const UTF8Range Yi_reverse_range[] = {
+	{ 128, 134, 3 }, { 128, 140, 2 }, { 128, 191, 1 }, { 144, 191, 2 }, { 128, 145, 4 }, { 146, 146, 4 },
+	{ 147, 147, 4 }, { 234, 234, 0 },
+};
+static const uint16_t Z_forward_state[] = {
+	0, 5, 6, 8, 9, 12, 13, 14, 15,
+};
+static const UTF8Range Z_forward_range[] = {
+	{ 32, 32, 0 }, { 194, 194, 7 }, { 225, 225, 5 }, { 226, 226, 2 }, { 227, 227, 1 }, { 128, 128, 6 },
+	{ 128, 128, 4 }, { 129, 129, 3 }, { 159, 159, 0 }, { 128, 138, 0 }, { 168, 169, 0 }, { 175, 175, 0 },
+	{ 154, 154, 6 }, { 128, 128, 0 }, { 160, 160, 0 },
+};
+static const uint16_t Z_reverse_state[] = {
+	0, 7, 8, 9, 10, 11, 13, 14, 15,
+};
+static const UTF8Range Z_reverse_range[] = {
+	{ 32, 32, 0 }, { 128, 128, 5 }, { 128, 138, 3 }, { 159, 159, 2 }, { 160, 160, 1 }, { 168, 169, 3 },
+	{ 175, 175, 3 }, { 194, 194, 0 }, { 129, 129, 4 }, { 128, 128, 4 }, { 226, 226, 0 }, { 128, 128, 7 },
+	{ 154, 154, 6 }, { 225, 225, 0 }, { 227, 227, 0 },
+};
+static const uint16_t Zanabazar_Square_forward_state[] = {
+	0, 1, 2, 4, 5, 6,
+};
+static const UTF8Range Zanabazar_Square_forward_range[] = {
+	{ 240, 240, 1 }, { 145, 145, 2 }, { 168, 168, 4 }, { 169, 169, 3 }, { 128, 135, 0 }, { 128, 191, 0 },
+};
+static const uint16_t Zanabazar_Square_reverse_state[] = {
+	0, 2, 3, 4, 5, 6,
+};
+static const UTF8Range Zanabazar_Square_reverse_range[] = {
+	{ 128, 135, 2 }, { 128, 191, 1 }, { 168, 168, 3 }, { 169, 169, 3 }, { 145, 145, 4 }, { 240, 240, 0 },
+};
+static const uint16_t Zl_forward_state[] = {
+	0, 1, 2, 3,
+};
+static const UTF8Range Zl_forward_range[] = {
+	{ 226, 226, 1 }, { 128, 128, 2 }, { 168, 168, 0 },
+};
+static const uint16_t Zl_reverse_state[] = {
+	0, 1, 2, 3,
+};
+static const UTF8Range Zl_reverse_range[] = {
+	{ 168, 168, 1 }, { 128, 128, 2 }, { 226, 226, 0 },
+};
+static const uint16_t Zp_forward_state[] = {
+	0, 1, 2, 3,
+};
+static const UTF8Range Zp_forward_range[] = {
+	{ 226, 226, 1 }, { 128, 128, 2 }, { 169, 169, 0 },
+};
+static const uint16_t Zp_reverse_state[] = {
+	0, 1, 2, 3,
+};
+static const UTF8Range Zp_reverse_range[] = {
+	{ 169, 169, 1 }, { 128, 128, 2 }, { 226, 226, 0 },
+};
+static const uint16_t Zs_forward_state[] = {
+	0, 5, 6, 8, 9, 11, 12, 13, 14,
+};
+static const UTF8Range Zs_forward_range[] = {
+	{ 32, 32, 0 }, { 194, 194, 7 }, { 225, 225, 5 }, { 226, 226, 2 }, { 227, 227, 1 }, { 128, 128, 6 },
+	{ 128, 128, 4 }, { 129, 129, 3 }, { 159, 159, 0 }, { 128, 138, 0 }, { 175, 175, 0 }, { 154, 154, 6 },
+	{ 128, 128, 0 }, { 160, 160, 0 },
+};
+static const uint16_t Zs_reverse_state[] = {
+	0, 6, 7, 8, 9, 10, 12, 13, 14,
+};
+static const UTF8Range Zs_reverse_range[] = {
+	{ 32, 32, 0 }, { 128, 128, 5 }, { 128, 138, 3 }, { 159, 159, 2 }, { 160, 160, 1 }, { 175, 175, 3 },
+	{ 194, 194, 0 }, { 129, 129, 4 }, { 128, 128, 4 }, { 226, 226, 0 }, { 128, 128, 7 }, { 154, 154, 6 },
+	{ 225, 225, 0 }, { 227, 227, 0 },
+};
+// 17786 automaton transitions
+const UGroupAutomata unicode_group_automata[] = {
+	{ &unicode_groups[152], 0x0124D6CE, { Sc_forward_state, 26, Sc_forward_range }, { Sc_reverse_state, 26, Sc_reverse_range } },
+	{ &unicode_groups[187], 0x0214C1A8, { Z_forward_state, 8, Z_forward_range }, { Z_reverse_state, 8, Z_reverse_range } },
+	{ &unicode_groups[108], 0x0250EE43, { Myanmar_forward_state, 7, Myanmar_forward_range }, { Myanmar_reverse_state, 7, Myanmar_reverse_range } },
+	{ &unicode_groups[185], 0x08011D55, { Yezidi_forward_state, 4, Yezidi_forward_range }, { Yezidi_reverse_state, 4, Yezidi_reverse_range } },
+	{ &unicode_groups[1], 0x09DC8C4E, { Ahom_forward_state, 4, Ahom_forward_range }, { Ahom_reverse_state, 4, Ahom_reverse_range } },
+	{ &unicode_groups[4], 0x0C5D3517, { Armenian_forward_state, 6, Armenian_forward_range }, { Armenian_reverse_state, 6, Armenian_reverse_range } },
+	{ &unicode_groups[121], 0x0C70ACD0, { Ol_Chiki_forward_state, 3, Ol_Chiki_forward_range }, { Ol_Chiki_reverse_state, 3, Ol_Chiki_reverse_range } },
+	{ &unicode_groups[14], 0x0DCBD7A0, { Braille_forward_state, 3, Braille_forward_range }, { Braille_reverse_state, 3, Braille_reverse_range } },
+	{ &unicode_groups[21], 0x0DE03776, { Cc_forward_state, 2, Cc_forward_range }, { Cc_reverse_state, 2, Cc_reverse_range } },
+	{ &unicode_groups[15], 0x0E00CE2B, { Buginese_forward_state, 3, Buginese_forward_range }, { Buginese_reverse_state, 3, Buginese_reverse_range } },
+	{ &unicode_groups[16], 0x0ECFDAE4, { Buhid_forward_state, 3, Buhid_forward_range }, { Buhid_reverse_state, 3, Buhid_reverse_range } },
+	{ &unicode_groups[23], 0x10383766, { Chakma_forward_state, 5, Chakma_forward_range }, { Chakma_reverse_state, 5, Chakma_reverse_range } },
+	{ &unicode_groups[89], 0x1048D045, { Makasar_forward_state, 4, Makasar_forward_range }, { Makasar_reverse_state, 4, Makasar_reverse_range } },
+	{ &unicode_groups[144], 0x11335873, { Po_forward_state, 110, Po_forward_range }, { Po_reverse_state, 110, Po_reverse_range } },
+	{ &unicode_groups[113], 0x124290A2, { New_Tai_Lue_forward_state, 4, New_Tai_Lue_forward_range }, { New_Tai_Lue_reverse_state, 4, New_Tai_Lue_reverse_range } },
+	{ &unicode_groups[191], 0x1388FA9B, { Zs_forward_state, 8, Zs_forward_range }, { Zs_reverse_state, 8, Zs_reverse_range } },
+	{ &unicode_groups[67], 0x198CAD3D, { Kharoshthi_forward_state, 5, Kharoshthi_forward_range }, { Kharoshthi_reverse_state, 5, Kharoshthi_reverse_range } },
+	{ &unicode_groups[136], 0x19FA5F65, { Pau_Cin_Hau_forward_state, 4, Pau_Cin_Hau_forward_range }, { Pau_Cin_Hau_reverse_state, 4, Pau_Cin_Hau_reverse_range } },
+	{ &unicode_groups[155], 0x1D29C11D, { Siddham_forward_state, 5, Siddham_forward_range }, { Siddham_reverse_state, 5, Siddham_reverse_range } },
+	{ &unicode_groups[165], 0x22CCC749, { Syloti_Nagri_forward_state, 3, Syloti_Nagri_forward_range }, { Syloti_Nagri_reverse_state, 3, Syloti_Nagri_reverse_range } },
+	{ &unicode_groups[172], 0x232280C2, { Takri_forward_state, 5, Takri_forward_range }, { Takri_reverse_state, 5, Takri_reverse_range } },
+	{ &unicode_groups[42], 0x2828867E, { Ethiopic_forward_state, 14, Ethiopic_forward_range }, { Ethiopic_reverse_state, 14, Ethiopic_reverse_range } },
+	{ &unicode_groups[38], 0x29ECC0E1, { Duployan_forward_state, 6, Duployan_forward_range }, { Duployan_reverse_state, 6, Duployan_reverse_range } },
+	{ &unicode_groups[156], 0x2A4DD556, { SignWriting_forward_state, 5, SignWriting_forward_range }, { SignWriting_reverse_state, 5, SignWriting_reverse_range } },
+	{ &unicode_groups[170], 0x2A6EC49F, { Tai_Tham_forward_state, 5, Tai_Tham_forward_range }, { Tai_Tham_reverse_state, 5, Tai_Tham_reverse_range } },
+	{ &unicode_groups[25], 0x2AE34C38, { Cherokee_forward_state, 7, Cherokee_forward_range }, { Cherokee_reverse_state, 7, Cherokee_reverse_range } },
+	{ &unicode_groups[182], 0x2D1DB9DC, { Vai_forward_state, 4, Vai_forward_range }, { Vai_reverse_state, 4, Vai_reverse_range } },
+	{ &unicode_groups[48], 0x2D6465A4, { Gujarati_forward_state, 4, Gujarati_forward_range }, { Gujarati_reverse_state, 4, Gujarati_reverse_range } },
+	{ &unicode_groups[56], 0x2DF8AE08, { Hebrew_forward_state, 6, Hebrew_forward_range }, { Hebrew_reverse_state, 6, Hebrew_reverse_range } },
+	{ &unicode_groups[180], 0x324EF083, { Tirhuta_forward_state, 5, Tirhuta_forward_range }, { Tirhuta_reverse_state, 5, Tirhuta_reverse_range } },
+	{ &unicode_groups[77], 0x33C8D759, { Linear_A_forward_state, 6, Linear_A_forward_range }, { Linear_A_reverse_state, 6, Linear_A_reverse_range } },
+	{ &unicode_groups[8], 0x342926D5, { Bassa_Vah_forward_state, 4, Bassa_Vah_forward_range }, { Bassa_Vah_reverse_state, 4, Bassa_Vah_reverse_range } },
+	{ &unicode_groups[112], 0x3564DB9A, { Nd_forward_state, 22, Nd_forward_range }, { Nd_reverse_state, 22, Nd_reverse_range } },
+	{ &unicode_groups[24], 0x36383242, { Cham_forward_state, 4, Cham_forward_range }, { Cham_reverse_state, 4, Cham_reverse_range } },
+	{ &unicode_groups[183], 0x373881F8, { Wancho_forward_state, 4, Wancho_forward_range }, { Wancho_reverse_state, 4, Wancho_reverse_range } },
+	{ &unicode_groups[41], 0x3796096B, { Elymaic_forward_state, 4, Elymaic_forward_range }, { Elymaic_reverse_state, 4, Elymaic_reverse_range } },
+	{ &unicode_groups[110], 0x386A2209, { Nabataean_forward_state, 4, Nabataean_forward_range }, { Nabataean_reverse_state, 4, Nabataean_reverse_range } },
+	{ &unicode_groups[75], 0x387AECF8, { Lepcha_forward_state, 4, Lepcha_forward_range }, { Lepcha_reverse_state, 4, Lepcha_reverse_range } },
+	{ &unicode_groups[149], 0x3886D23A, { S_forward_state, 138, S_forward_range }, { S_reverse_state, 138, S_reverse_range } },
+	{ &unicode_groups[87], 0x39C69A9A, { M_forward_state, 153, M_forward_range }, { M_reverse_state, 153, M_reverse_range } },
+	{ &unicode_groups[148], 0x3C40C191, { Runic_forward_state, 4, Runic_forward_range }, { Runic_reverse_state, 4, Runic_reverse_range } },
+	{ &unicode_groups[164], 0x3D842765, { Sundanese_forward_state, 4, Sundanese_forward_range }, { Sundanese_reverse_state, 4, Sundanese_reverse_range } },
+	{ &unicode_groups[76], 0x3DDC112E, { Limbu_forward_state, 4, Limbu_forward_range }, { Limbu_reverse_state, 4, Limbu_reverse_range } },
+	{ &unicode_groups[122], 0x418B6116, { Old_Hungarian_forward_state, 5, Old_Hungarian_forward_range }, { Old_Hungarian_reverse_state, 5, Old_Hungarian_reverse_range } },
+	{ &unicode_groups[95], 0x42D9CA91, { Mc_forward_state, 81, Mc_forward_range }, { Mc_reverse_state, 81, Mc_reverse_range } },
+	{ &unicode_groups[26], 0x433079EC, { Chorasmian_forward_state, 5, Chorasmian_forward_range }, { Chorasmian_reverse_state, 5, Chorasmian_reverse_range } },
+	{ &unicode_groups[62], 0x442B1106, { Javanese_forward_state, 4, Javanese_forward_range }, { Javanese_reverse_state, 4, Javanese_reverse_range } },
+	{ &unicode_groups[66], 0x45C2111C, { Kayah_Li_forward_state, 3, Kayah_Li_forward_range }, { Kayah_Li_reverse_state, 3, Kayah_Li_reverse_range } },
+	{ &unicode_groups[86], 0x4663D458, { Lydian_forward_state, 4, Lydian_forward_range }, { Lydian_reverse_state, 4, Lydian_reverse_range } },
+	{ &unicode_groups[120], 0x4780B5B9, { Ogham_forward_state, 3, Ogham_forward_range }, { Ogham_reverse_state, 3, Ogham_reverse_range } },
+	{ &unicode_groups[97], 0x47B8121F, { Medefaidrin_forward_state, 5, Medefaidrin_forward_range }, { Medefaidrin_reverse_state, 5, Medefaidrin_reverse_range } },
+	{ &unicode_groups[131], 0x48E7C86D, { Osage_forward_state, 5, Osage_forward_range }, { Osage_reverse_state, 5, Osage_reverse_range } },
+	{ &unicode_groups[167], 0x49FEC1A3, { Tagalog_forward_state, 3, Tagalog_forward_range }, { Tagalog_reverse_state, 3, Tagalog_reverse_range } },
+	{ &unicode_groups[64], 0x4CA2DC41, { Kannada_forward_state, 4, Kannada_forward_range }, { Kannada_reverse_state, 4, Kannada_reverse_range } },
+	{ &unicode_groups[35], 0x4D1B458F, { Devanagari_forward_state, 6, Devanagari_forward_range }, { Devanagari_reverse_state, 6, Devanagari_reverse_range } },
+	{ &unicode_groups[111], 0x4DDEA46D, { Nandinagari_forward_state, 5, Nandinagari_forward_range }, { Nandinagari_reverse_state, 5, Nandinagari_reverse_range } },
+	{ &unicode_groups[46], 0x4E0FC775, { Grantha_forward_state, 5, Grantha_forward_range }, { Grantha_reverse_state, 5, Grantha_reverse_range } },
+	{ &unicode_groups[99], 0x5134742C, { Mende_Kikakui_forward_state, 5, Mende_Kikakui_forward_range }, { Mende_Kikakui_reverse_state, 5, Mende_Kikakui_reverse_range } },
+	{ &unicode_groups[60], 0x513AF206, { Inscriptional_Pahlavi_forward_state, 4, Inscriptional_Pahlavi_forward_range }, { Inscriptional_Pahlavi_reverse_state, 4, Inscriptional_Pahlavi_reverse_range } },
+	{ &unicode_groups[137], 0x53517C3D, { Pc_forward_state, 7, Pc_forward_range }, { Pc_reverse_state, 7, Pc_reverse_range } },
+	{ &unicode_groups[37], 0x53C62FAC, { Dogra_forward_state, 4, Dogra_forward_range }, { Dogra_reverse_state, 4, Dogra_reverse_range } },
+	{ &unicode_groups[190], 0x53F23E57, { Zp_forward_state, 3, Zp_forward_range }, { Zp_reverse_state, 3, Zp_reverse_range } },
+	{ &unicode_groups[116], 0x544E7917, { Nl_forward_state, 18, Nl_forward_range }, { Nl_reverse_state, 18, Nl_reverse_range } },
+	{ &unicode_groups[173], 0x5552083A, { Tamil_forward_state, 7, Tamil_forward_range }, { Tamil_reverse_state, 7, Tamil_reverse_range } },
+	{ &unicode_groups[32], 0x55CFD862, { Cypriot_forward_state, 4, Cypriot_forward_range }, { Cypriot_reverse_state, 4, Cypriot_reverse_range } },
+	{ &unicode_groups[50], 0x57F481B7, { Gurmukhi_forward_state, 4, Gurmukhi_forward_range }, { Gurmukhi_reverse_state, 4, Gurmukhi_reverse_range } },
+	{ &unicode_groups[2], 0x58A2411B, { Anatolian_Hieroglyphs_forward_state, 5, Anatolian_Hieroglyphs_forward_range }, { Anatolian_Hieroglyphs_reverse_state, 5, Anatolian_Hieroglyphs_reverse_range } },
+	{ &unicode_groups[169], 0x58AC8342, { Tai_Le_forward_state, 3, Tai_Le_forward_range }, { Tai_Le_reverse_state, 3, Tai_Le_reverse_range } },
+	{ &unicode_groups[141], 0x592576F8, { Phags_Pa_forward_state, 3, Phags_Pa_forward_range }, { Phags_Pa_reverse_state, 3, Phags_Pa_reverse_range } },
+	{ &unicode_groups[145], 0x5E40D097, { Ps_forward_state, 24, Ps_forward_range }, { Ps_reverse_state, 24, Ps_reverse_range } },
+	{ &unicode_groups[51], 0x5EBC8634, { Han_forward_state, 30, Han_forward_range }, { Han_reverse_state, 30, Han_reverse_range } },
+	{ &unicode_groups[93], 0x61482938, { Marchen_forward_state, 5, Marchen_forward_range }, { Marchen_reverse_state, 5, Marchen_reverse_range } },
+	{ &unicode_groups[132], 0x6492A941, { Osmanya_forward_state, 4, Osmanya_forward_range }, { Osmanya_reverse_state, 4, Osmanya_reverse_range } },
+	{ &unicode_groups[90], 0x64CA716A, { Malayalam_forward_state, 4, Malayalam_forward_range }, { Malayalam_reverse_state, 4, Malayalam_reverse_range } },
+	{ &unicode_groups[36], 0x64F07535, { Dives_Akuru_forward_state, 5, Dives_Akuru_forward_range }, { Dives_Akuru_reverse_state, 5, Dives_Akuru_reverse_range } },
+	{ &unicode_groups[96], 0x650070F7, { Me_forward_state, 8, Me_forward_range }, { Me_reverse_state, 8, Me_reverse_range } },
+	{ &unicode_groups[142], 0x67785D82, { Phoenician_forward_state, 4, Phoenician_forward_range }, { Phoenician_reverse_state, 4, Phoenician_reverse_range } },
+	{ &unicode_groups[139], 0x6E708AC8, { Pe_forward_state, 22, Pe_forward_range }, { Pe_reverse_state, 22, Pe_reverse_range } },
+	{ &unicode_groups[54], 0x6EC11911, { Hanunoo_forward_state, 3, Hanunoo_forward_range }, { Hanunoo_reverse_state, 3, Hanunoo_reverse_range } },
+	{ &unicode_groups[9], 0x6FC906F5, { Batak_forward_state, 3, Batak_forward_range }, { Batak_reverse_state, 3, Batak_reverse_range } },
+	{ &unicode_groups[175], 0x70972C2B, { Telugu_forward_state, 4, Telugu_forward_range }, { Telugu_reverse_state, 4, Telugu_reverse_range } },
+	{ &unicode_groups[28], 0x7263B23D, { Common_forward_state, 113, Common_forward_range }, { Common_reverse_state, 113, Common_reverse_range } },
+	{ &unicode_groups[126], 0x730BDBF3, { Old_Persian_forward_state, 5, Old_Persian_forward_range }, { Old_Persian_reverse_state, 5, Old_Persian_reverse_range } },
+	{ &unicode_groups[147], 0x77E068EA, { Rejang_forward_state, 4, Rejang_forward_range }, { Rejang_reverse_state, 4, Rejang_reverse_range } },
+	{ &unicode_groups[168], 0x784C903C, { Tagbanwa_forward_state, 3, Tagbanwa_forward_range }, { Tagbanwa_reverse_state, 3, Tagbanwa_reverse_range } },
+	{ &unicode_groups[114], 0x78AC8AC6, { Newa_forward_state, 5, Newa_forward_range }, { Newa_reverse_state, 5, Newa_reverse_range } },
+	{ &unicode_groups[189], 0x78F4B72D, { Zl_forward_state, 3, Zl_forward_range }, { Zl_reverse_state, 3, Zl_reverse_range } },
+	{ &unicode_groups[94], 0x7C1CE3EB, { Masaram_Gondi_forward_state, 5, Masaram_Gondi_forward_range }, { Masaram_Gondi_reverse_state, 5, Masaram_Gondi_reverse_range } },
+	{ &unicode_groups[160], 0x7C6FF578, { So_forward_state, 117, So_forward_range }, { So_reverse_state, 117, So_reverse_range } },
+	{ &unicode_groups[20], 0x7D9D2F5A, { Caucasian_Albanian_forward_state, 5, Caucasian_Albanian_forward_range }, { Caucasian_Albanian_reverse_state, 5, Caucasian_Albanian_reverse_range } },
+	{ &unicode_groups[19], 0x7E4F14FD, { Carian_forward_state, 5, Carian_forward_range }, { Carian_reverse_state, 5, Carian_reverse_range } },
+	{ &unicode_groups[92], 0x7FBD4772, { Manichaean_forward_state, 4, Manichaean_forward_range }, { Manichaean_reverse_state, 4, Manichaean_reverse_range } },
+	{ &unicode_groups[143], 0x83ABCB1A, { Pi_forward_state, 5, Pi_forward_range }, { Pi_reverse_state, 5, Pi_reverse_range } },
+	{ &unicode_groups[11], 0x83D89C96, { Bhaiksuki_forward_state, 5, Bhaiksuki_forward_range }, { Bhaiksuki_reverse_state, 5, Bhaiksuki_reverse_range } },
+	{ &unicode_groups[49], 0x83DE7BC6, { Gunjala_Gondi_forward_state, 5, Gunjala_Gondi_forward_range }, { Gunjala_Gondi_reverse_state, 5, Gunjala_Gondi_reverse_range } },
+	{ &unicode_groups[78], 0x853BD977, { Linear_B_forward_state, 7, Linear_B_forward_range }, { Linear_B_reverse_state, 7, Linear_B_reverse_range } },
+	{ &unicode_groups[171], 0x87544BB1, { Tai_Viet_forward_state, 4, Tai_Viet_forward_range }, { Tai_Viet_reverse_state, 4, Tai_Viet_reverse_range } },
+	{ &unicode_groups[0], 0x89B8B4EC, { Adlam_forward_state, 5, Adlam_forward_range }, { Adlam_reverse_state, 5, Adlam_reverse_range } },
+	{ &unicode_groups[146], 0x89F8C5E7, { Psalter_Pahlavi_forward_state, 4, Psalter_Pahlavi_forward_range }, { Psalter_Pahlavi_reverse_state, 4, Psalter_Pahlavi_reverse_range } },
+	{ &unicode_groups[12], 0x8AE1449F, { Bopomofo_forward_state, 5, Bopomofo_forward_range }, { Bopomofo_reverse_state, 5, Bopomofo_reverse_range } },
+	{ &unicode_groups[127], 0x8B221128, { Old_Sogdian_forward_state, 4, Old_Sogdian_forward_range }, { Old_Sogdian_reverse_state, 4, Old_Sogdian_reverse_range } },
+	{ &unicode_groups[159], 0x8BA758E1, { Sm_forward_state, 40, Sm_forward_range }, { Sm_reverse_state, 40, Sm_reverse_range } },
+	{ &unicode_groups[98], 0x8C77234F, { Meetei_Mayek_forward_state, 4, Meetei_Mayek_forward_range }, { Meetei_Mayek_reverse_state, 4, Meetei_Mayek_reverse_range } },
+	{ &unicode_groups[188], 0x8FC4FD88, { Zanabazar_Square_forward_state, 5, Zanabazar_Square_forward_range }, { Zanabazar_Square_reverse_state, 5, Zanabazar_Square_reverse_range } },
+	{ &unicode_groups[109], 0x9082605D, { N_forward_state, 88, N_forward_range }, { N_reverse_state, 88, N_reverse_range } },
+	{ &unicode_groups[47], 0x9160C161, { Greek_forward_state, 22, Greek_forward_range }, { Greek_reverse_state, 22, Greek_reverse_range } },
+	{ &unicode_groups[73], 0x9240C9D8, { Lao_forward_state, 4, Lao_forward_range }, { Lao_reverse_state, 4, Lao_reverse_range } },
+	{ &unicode_groups[104], 0x93EA826E, { Modi_forward_state, 5, Modi_forward_range }, { Modi_reverse_state, 5, Modi_reverse_range } },
+	{ &unicode_groups[133], 0x95CFEF7E, { P_forward_state, 120, P_forward_range }, { P_reverse_state, 120, P_reverse_range } },
+	{ &unicode_groups[39], 0x96978803, { Egyptian_Hieroglyphs_forward_state, 5, Egyptian_Hieroglyphs_forward_range }, { Egyptian_Hieroglyphs_reverse_state, 5, Egyptian_Hieroglyphs_reverse_range } },
+	{ &unicode_groups[40], 0x96E3F928, { Elbasan_forward_state, 4, Elbasan_forward_range }, { Elbasan_reverse_state, 4, Elbasan_reverse_range } },
+	{ &unicode_groups[150], 0x97A69424, { Samaritan_forward_state, 3, Samaritan_forward_range }, { Samaritan_reverse_state, 3, Samaritan_reverse_range } },
+	{ &unicode_groups[176], 0x97CE2F6A, { Thaana_forward_state, 2, Thaana_forward_range }, { Thaana_reverse_state, 2, Thaana_reverse_range } },
+	{ &unicode_groups[181], 0x97D7312C, { Ugaritic_forward_state, 4, Ugaritic_forward_range }, { Ugaritic_reverse_state, 4, Ugaritic_reverse_range } },
+	{ &unicode_groups[17], 0x9858EC6E, { C_forward_state, 34, C_forward_range }, { C_reverse_state, 34, C_reverse_range } },
+	{ &unicode_groups[102], 0x98AF1C73, { Miao_forward_state, 6, Miao_forward_range }, { Miao_reverse_state, 6, Miao_reverse_range } },
+	{ &unicode_groups[119], 0x9996CC22, { Nyiakeng_Puachue_Hmong_forward_state, 5, Nyiakeng_Puachue_Hmong_forward_range }, { Nyiakeng_Puachue_Hmong_reverse_state, 5, Nyiakeng_Puachue_Hmong_reverse_range } },
+	{ &unicode_groups[63], 0x9E732888, { Kaithi_forward_state, 5, Kaithi_forward_range }, { Kaithi_reverse_state, 5, Kaithi_reverse_range } },
+	{ &unicode_groups[59], 0xA15B6804, { Inherited_forward_state, 31, Inherited_forward_range }, { Inherited_reverse_state, 31, Inherited_reverse_range } },
+	{ &unicode_groups[10], 0xA2DA634F, { Bengali_forward_state, 4, Bengali_forward_range }, { Bengali_reverse_state, 4, Bengali_reverse_range } },
+	{ &unicode_groups[129], 0xA7AFB7F5, { Old_Turkic_forward_state, 5, Old_Turkic_forward_range }, { Old_Turkic_reverse_state, 5, Old_Turkic_reverse_range } },
+	{ &unicode_groups[33], 0xA899B8B2, { Cyrillic_forward_state, 14, Cyrillic_forward_range }, { Cyrillic_reverse_state, 14, Cyrillic_reverse_range } },
+	{ &unicode_groups[88], 0xACF614FB, { Mahajani_forward_state, 4, Mahajani_forward_range }, { Mahajani_reverse_state, 4, Mahajani_reverse_range } },
+	{ &unicode_groups[79], 0xAD308CB0, { Lisu_forward_state, 6, Lisu_forward_range }, { Lisu_reverse_state, 6, Lisu_reverse_range } },
+	{ &unicode_groups[117], 0xAEDA49C5, { No_forward_state, 74, No_forward_range }, { No_reverse_state, 74, No_reverse_range } },
+	{ &unicode_groups[43], 0xB103E620, { Georgian_forward_state, 7, Georgian_forward_range }, { Georgian_reverse_state, 7, Georgian_reverse_range } },
+	{ &unicode_groups[34], 0xB1698CF0, { Deseret_forward_state, 5, Deseret_forward_range }, { Deseret_reverse_state, 5, Deseret_reverse_range } },
+	{ &unicode_groups[105], 0xB188E36F, { Mongolian_forward_state, 8, Mongolian_forward_range }, { Mongolian_reverse_state, 8, Mongolian_reverse_range } },
+	{ &unicode_groups[179], 0xB5DC3A6D, { Tifinagh_forward_state, 4, Tifinagh_forward_range }, { Tifinagh_reverse_state, 4, Tifinagh_reverse_range } },
+	{ &unicode_groups[184], 0xB60E18A5, { Warang_Citi_forward_state, 5, Warang_Citi_forward_range }, { Warang_Citi_reverse_state, 5, Warang_Citi_reverse_range } },
+	{ &unicode_groups[7], 0xB9060250, { Bamum_forward_state, 8, Bamum_forward_range }, { Bamum_reverse_state, 8, Bamum_reverse_range } },
+	{ &unicode_groups[91], 0xB9B62E98, { Mandaic_forward_state, 3, Mandaic_forward_range }, { Mandaic_reverse_state, 3, Mandaic_reverse_range } },
+	{ &unicode_groups[135], 0xBA5C9C40, { Palmyrene_forward_state, 4, Palmyrene_forward_range }, { Palmyrene_reverse_state, 4, Palmyrene_reverse_range } },
+	{ &unicode_groups[13], 0xBB03B9D7, { Brahmi_forward_state, 5, Brahmi_forward_range }, { Brahmi_reverse_state, 5, Brahmi_reverse_range } },
+	{ &unicode_groups[128], 0xBC156440, { Old_South_Arabian_forward_state, 4, Old_South_Arabian_forward_range }, { Old_South_Arabian_reverse_state, 4, Old_South_Arabian_reverse_range } },
+	{ &unicode_groups[27], 0xBD9EAEC8, { Co_forward_state, 8, Co_forward_range }, { Co_reverse_state, 8, Co_reverse_range } },
+	{ &unicode_groups[162], 0xC340AF02, { Sora_Sompeng_forward_state, 4, Sora_Sompeng_forward_range }, { Sora_Sompeng_reverse_state, 4, Sora_Sompeng_reverse_range } },
+	{ &unicode_groups[154], 0xC40C4CD0, { Shavian_forward_state, 4, Shavian_forward_range }, { Shavian_reverse_state, 4, Shavian_reverse_range } },
+	{ &unicode_groups[44], 0xC56299C4, { Glagolitic_forward_state, 7, Glagolitic_forward_range }, { Glagolitic_reverse_state, 7, Glagolitic_reverse_range } },
+	{ &unicode_groups[71], 0xC5B3378C, { Khudawadi_forward_state, 5, Khudawadi_forward_range }, { Khudawadi_reverse_state, 5, Khudawadi_reverse_range } },
+	{ &unicode_groups[106], 0xC64FB93F, { Mro_forward_state, 4, Mro_forward_range }, { Mro_reverse_state, 4, Mro_reverse_range } },
+	{ &unicode_groups[68], 0xC812A6CE, { Khitan_Small_Script_forward_state, 7, Khitan_Small_Script_forward_range }, { Khitan_Small_Script_reverse_state, 7, Khitan_Small_Script_reverse_range } },
+	{ &unicode_groups[107], 0xC874A74E, { Multani_forward_state, 4, Multani_forward_range }, { Multani_reverse_state, 4, Multani_reverse_range } },
+	{ &unicode_groups[74], 0xC99F2B1D, { Latin_forward_state, 27, Latin_forward_range }, { Latin_reverse_state, 27, Latin_reverse_range } },
+	{ &unicode_groups[100], 0xCA71CF2A, { Meroitic_Cursive_forward_state, 5, Meroitic_Cursive_forward_range }, { Meroitic_Cursive_reverse_state, 5, Meroitic_Cursive_reverse_range } },
+	{ &unicode_groups[138], 0xD08BB2F8, { Pd_forward_state, 18, Pd_forward_range }, { Pd_reverse_state, 18, Pd_reverse_range } },
+	{ &unicode_groups[123], 0xD1C3F2DC, { Old_Italic_forward_state, 4, Old_Italic_forward_range }, { Old_Italic_reverse_state, 4, Old_Italic_reverse_range } },
+	{ &unicode_groups[82], 0xD207D600, { Lo_forward_state, 231, Lo_forward_range }, { Lo_reverse_state, 231, Lo_reverse_range } },
+	{ &unicode_groups[163], 0xD47F75D7, { Soyombo_forward_state, 5, Soyombo_forward_range }, { Soyombo_reverse_state, 5, Soyombo_reverse_range } },
+	{ &unicode_groups[125], 0xD57B66AF, { Old_Permic_forward_state, 4, Old_Permic_forward_range }, { Old_Permic_reverse_state, 4, Old_Permic_reverse_range } },
+	{ &unicode_groups[101], 0xD6DBB300, { Meroitic_Hieroglyphs_forward_state, 4, Meroitic_Hieroglyphs_forward_range }, { Meroitic_Hieroglyphs_reverse_state, 4, Meroitic_Hieroglyphs_reverse_range } },
+	{ &unicode_groups[161], 0xD9A90B42, { Sogdian_forward_state, 5, Sogdian_forward_range }, { Sogdian_reverse_state, 5, Sogdian_reverse_range } },
+	{ &unicode_groups[124], 0xDB3FB100, { Old_North_Arabian_forward_state, 4, Old_North_Arabian_forward_range }, { Old_North_Arabian_reverse_state, 4, Old_North_Arabian_reverse_range } },
+	{ &unicode_groups[83], 0xDCBF01A0, { Lt_forward_state, 5, Lt_forward_range }, { Lt_reverse_state, 5, Lt_reverse_range } },
+	{ &unicode_groups[186], 0xDD4FE707, { Yi_forward_state, 5, Yi_forward_range }, { Yi_reverse_state, 5, Yi_reverse_range } },
+	{ &unicode_groups[72], 0xDF0AD50E, { L_forward_state, 275, L_forward_range }, { L_reverse_state, 275, L_reverse_range } },
+	{ &unicode_groups[58], 0xDF1761FC, { Imperial_Aramaic_forward_state, 4, Imperial_Aramaic_forward_range }, { Imperial_Aramaic_reverse_state, 4, Imperial_Aramaic_reverse_range } },
+	{ &unicode_groups[134], 0xE03204AB, { Pahawh_Hmong_forward_state, 6, Pahawh_Hmong_forward_range }, { Pahawh_Hmong_reverse_state, 6, Pahawh_Hmong_reverse_range } },
+	{ &unicode_groups[130], 0xE2C0879E, { Oriya_forward_state, 4, Oriya_forward_range }, { Oriya_reverse_state, 4, Oriya_reverse_range } },
+	{ &unicode_groups[55], 0xE2FB9A36, { Hatran_forward_state, 4, Hatran_forward_range }, { Hatran_reverse_state, 4, Hatran_reverse_range } },
+	{ &unicode_groups[45], 0xE339907F, { Gothic_forward_state, 5, Gothic_forward_range }, { Gothic_reverse_state, 5, Gothic_reverse_range } },
+	{ &unicode_groups[3], 0xE3ED4D9F, { Arabic_forward_state, 24, Arabic_forward_range }, { Arabic_reverse_state, 24, Arabic_reverse_range } },
+	{ &unicode_groups[118], 0xE4A02D9A, { Nushu_forward_state, 8, Nushu_forward_range }, { Nushu_reverse_state, 8, Nushu_reverse_range } },
+	{ &unicode_groups[53], 0xE54FEF63, { Hanifi_Rohingya_forward_state, 4, Hanifi_Rohingya_forward_range }, { Hanifi_Rohingya_reverse_state, 4, Hanifi_Rohingya_reverse_range } },
+	{ &unicode_groups[103], 0xE5616EE1, { Mn_forward_state, 157, Mn_forward_range }, { Mn_reverse_state, 157, Mn_reverse_range } },
+	{ &unicode_groups[61], 0xE6090837, { Inscriptional_Parthian_forward_state, 4, Inscriptional_Parthian_forward_range }, { Inscriptional_Parthian_reverse_state, 4, Inscriptional_Parthian_reverse_range } },
+	{ &unicode_groups[158], 0xE6FB7640, { Sk_forward_state, 23, Sk_forward_range }, { Sk_reverse_state, 23, Sk_reverse_range } },
+	{ &unicode_groups[157], 0xE72BD89B, { Sinhala_forward_state, 7, Sinhala_forward_range }, { Sinhala_reverse_state, 7, Sinhala_reverse_range } },
+	{ &unicode_groups[52], 0xEB44934E, { Hangul_forward_state, 17, Hangul_forward_range }, { Hangul_reverse_state, 17, Hangul_reverse_range } },
+	{ &unicode_groups[6], 0xEC3971E8, { Balinese_forward_state, 4, Balinese_forward_range }, { Balinese_reverse_state, 4, Balinese_reverse_range } },
+	{ &unicode_groups[177], 0xEC4EF607, { Thai_forward_state, 4, Thai_forward_range }, { Thai_reverse_state, 4, Thai_reverse_range } },
+	{ &unicode_groups[18], 0xEC66FE9F, { Canadian_Aboriginal_forward_state, 5, Canadian_Aboriginal_forward_range }, { Canadian_Aboriginal_reverse_state, 5, Canadian_Aboriginal_reverse_range } },
+	{ &unicode_groups[166], 0xECDBB445, { Syriac_forward_state, 5, Syriac_forward_range }, { Syriac_reverse_state, 5, Syriac_reverse_range } },
+	{ &unicode_groups[80], 0xEE1DAEF9, { Ll_forward_state, 80, Ll_forward_range }, { Ll_reverse_state, 80, Ll_reverse_range } },
+	{ &unicode_groups[174], 0xEF351DCD, { Tangut_forward_state, 9, Tangut_forward_range }, { Tangut_reverse_state, 9, Tangut_reverse_range } },
+	{ &unicode_groups[31], 0xEFF55FED, { Cuneiform_forward_state, 7, Cuneiform_forward_range }, { Cuneiform_reverse_state, 7, Cuneiform_reverse_range } },
+	{ &unicode_groups[84], 0xF190D07A, { Lu_forward_state, 72, Lu_forward_range }, { Lu_reverse_state, 72, Lu_reverse_range } },
+	{ &unicode_groups[5], 0xF1946FAE, { Avestan_forward_state, 4, Avestan_forward_range }, { Avestan_reverse_state, 4, Avestan_reverse_range } },
+	{ &unicode_groups[85], 0xF20665B9, { Lycian_forward_state, 4, Lycian_forward_range }, { Lycian_reverse_state, 4, Lycian_reverse_range } },
+	{ &unicode_groups[29], 0xF280D8EB, { Coptic_forward_state, 5, Coptic_forward_range }, { Coptic_reverse_state, 5, Coptic_reverse_range } },
+	{ &unicode_groups[70], 0xF2D4CCFF, { Khojki_forward_state, 4, Khojki_forward_range }, { Khojki_reverse_state, 4, Khojki_reverse_range } },
+	{ &unicode_groups[65], 0xF383E880, { Katakana_forward_state, 15, Katakana_forward_range }, { Katakana_reverse_state, 15, Katakana_reverse_range } },
+	{ &unicode_groups[69], 0xF5489D2F, { Khmer_forward_state, 5, Khmer_forward_range }, { Khmer_reverse_state, 5, Khmer_reverse_range } },
+	{ &unicode_groups[115], 0xF58743DB, { Nko_forward_state, 2, Nko_forward_range }, { Nko_reverse_state, 2, Nko_reverse_range } },
+	{ &unicode_groups[30], 0xF7241EA0, { Cs_forward_state, 3, Cs_forward_range }, { Cs_reverse_state, 3, Cs_reverse_range } },
+	{ &unicode_groups[151], 0xF9A262FB, { Saurashtra_forward_state, 4, Saurashtra_forward_range }, { Saurashtra_reverse_state, 4, Saurashtra_reverse_range } },
+	{ &unicode_groups[81], 0xFABF8920, { Lm_forward_state, 52, Lm_forward_range }, { Lm_reverse_state, 52, Lm_reverse_range } },
+	{ &unicode_groups[140], 0xFC4A33AD, { Pf_forward_state, 5, Pf_forward_range }, { Pf_reverse_state, 5, Pf_reverse_range } },
+	{ &unicode_groups[178], 0xFED6AC57, { Tibetan_forward_state, 6, Tibetan_forward_range }, { Tibetan_reverse_state, 6, Tibetan_reverse_range } },
+	{ &unicode_groups[57], 0xFF0F23BF, { Hiragana_forward_state, 11, Hiragana_forward_range }, { Hiragana_reverse_state, 11, Hiragana_reverse_range } },
+	{ &unicode_groups[22], 0xFFCE55D0, { Cf_forward_state, 29, Cf_forward_range }, { Cf_reverse_state, 29, Cf_reverse_range } },
+	{ &unicode_groups[153], 0xFFD637C0, { Sharada_forward_state, 5, Sharada_forward_range }, { Sharada_reverse_state, 5, Sharada_reverse_range } },
+};
+const int num_unicode_group_automata = 192;
+
 
 }  // namespace re2
 
@@ -52,6 +52,40 @@ struct UGroup
 extern const UGroup unicode_groups[];
 extern const int num_unicode_groups;
 
+// A byte-level automaton recognizing the UTF-8 encodings of the runes
+// in a group.  State 0 is the start state.  The transitions out of
+// state i are range[state[i]] through range[state[i+1]-1]; they are
+// disjoint and sorted.  A transition leads to state next or, if next
+// is 0, to a match.  Every transition leads to a higher-numbered state.
+struct UTF8Range
+{
+  uint8_t lo;
+  uint8_t hi;
+  uint16_t next;
+};
+
+struct UTF8Automaton
+{
+  const uint16_t *state;  // nstate+1 entries
+  int nstate;
+  const UTF8Range *range;
+};
+
+// Minimized automata for a group, for matching forward and backward.
+// The fingerprint is computed over the group's runes as a sorted list
+// of maximal ranges; see UGroupFingerprint() in compile.cc.
+struct UGroupAutomata
+{
+  const UGroup *group;
+  uint32_t fingerprint;
+  UTF8Automaton forward;
+  UTF8Automaton reverse;
+};
+
+// Automata for each of the unicode_groups, sorted by fingerprint.
+extern const UGroupAutomata unicode_group_automata[];
+extern const int num_unicode_group_automata;
+
 // Named by POSIX name (e.g., "[:alpha:]", "[:^lower:]").
 // Negated groups are included.
 extern const UGroup posix_groups[];
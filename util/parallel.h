@@ -0,0 +1,49 @@
+// Copyright 2026 The RE2 Authors.  All Rights Reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#ifndef UTIL_PARALLEL_H_
+#define UTIL_PARALLEL_H_
+
+#include <stddef.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace re2 {
+
+// Calls fn(i) for each i in [0, n) using up to num_threads threads,
+// one of which is the calling thread, and returns once all of the calls
+// have returned.  The threads take the next i in turn, so that the work
+// is balanced even if some calls take much longer than others.
+// fn must be safe to call concurrently for different values of i.
+template <typename Fn>
+void ParallelFor(int n, int num_threads, const Fn& fn) {
+  if (num_threads > n)
+    num_threads = n;
+  if (num_threads <= 1) {
+    for (int i = 0; i < n; i++)
+      fn(i);
+    return;
+  }
+
+  std::atomic<int> next(0);
+  auto work = [&next, n, &fn]() {
+    for (;;) {
+      int i = next.fetch_add(1, std::memory_order_relaxed);
+      if (i >= n)
+        break;
+      fn(i);
+    }
+  };
+  std::vector<std::thread> threads;
+  for (int i = 1; i < num_threads; i++)
+    threads.emplace_back(work);
+  work();
+  for (size_t i = 0; i < threads.size(); i++)
+    threads[i].join();
+}
+
+}  // namespace re2
+
+#endif  // UTIL_PARALLEL_H_
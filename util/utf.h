@@ -35,6 +35,7 @@ enum
 
 int runetochar(char* s, const Rune* r);
 int chartorune(Rune* r, const char* s);
+int runelen(Rune r);
 int fullrune(const char* s, int n);
 int utflen(const char* s);
 char* utfrune(const char*, Rune);